@@ -0,0 +1,256 @@
+#!/usr/bin/env python3
+"""Reference client for the ESP32 Bus Pirate binary RPC mode.
+
+Frames, little endian:
+
+    A5 5A | type | status | id:2 | length:4 | check | payload | crc32:4
+
+check is the complement of the byte sum of type..length, crc32 (zlib)
+covers type..length and the payload. Replies carry the request id and the
+request type | 0x80, in the order the requests were sent.
+
+The device enters the mode on the first frame sent on an empty line, or
+with the 'binary' command. Buses use the pins and speeds set in the text
+terminal before.
+
+    with BusPirateRpc("/dev/ttyACM0") as bp:
+        print(bp.i2c_read(0x50, 16, register=b"\\x00"))
+        image = bp.flash_read(0, 1 << 20)
+
+python3 bus_pirate_rpc.py --selftest checks the framing without a device.
+"""
+
+import argparse
+import struct
+import sys
+import time
+import zlib
+from collections import deque
+
+MAGIC = b"\xA5\x5A"
+HEADER = struct.Struct("<2sBBHIB")
+MAX_PAYLOAD = 65536
+
+PING, EXIT, INFO = 0x01, 0x02, 0x03
+SPI_TRANSFER = 0x10
+I2C_WRITE, I2C_READ = 0x20, 0x21
+UART_WRITE, UART_READ = 0x30, 0x31
+GPIO_SET, GPIO_GET = 0x40, 0x41
+FLASH_READ = 0x50
+RESPONSE = 0x80
+
+SPI_KEEP_SELECTED = 0x01
+
+STATUS = {
+    0x00: "ok",
+    0x01: "bad request",
+    0x02: "unknown type",
+    0x03: "crc error",
+    0x04: "bus error",
+    0x05: "protected pin",
+}
+
+
+class RpcError(Exception):
+    def __init__(self, request_type, status):
+        super().__init__("request 0x%02X: %s" % (request_type, STATUS.get(status, "status 0x%02X" % status)))
+        self.status = status
+
+
+def encode(frame_type, request_id, payload=b"", status=0):
+    if len(payload) > MAX_PAYLOAD:
+        raise ValueError("payload over %d bytes" % MAX_PAYLOAD)
+    fields = struct.pack("<BBHI", frame_type, status, request_id & 0xFFFF, len(payload))
+    check = ~sum(fields) & 0xFF
+    crc = zlib.crc32(payload, zlib.crc32(fields))
+    return MAGIC + fields + bytes([check]) + payload + struct.pack("<I", crc)
+
+
+class FrameParser:
+    """Incremental parser, resyncs on A5 5A after a damaged header."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+
+    def feed(self, data):
+        """Yield (type, status, id, payload, crc_ok) for each complete frame."""
+        self.buffer += data
+        while True:
+            start = self.buffer.find(MAGIC)
+            if start < 0:
+                del self.buffer[:-1 if self.buffer.endswith(MAGIC[:1]) else len(self.buffer)]
+                return
+            del self.buffer[:start]
+            if len(self.buffer) < HEADER.size:
+                return
+            _, frame_type, status, request_id, length, check = HEADER.unpack_from(self.buffer)
+            fields = bytes(self.buffer[2:10])
+            if (~sum(fields) & 0xFF) != check or length > MAX_PAYLOAD:
+                del self.buffer[:1]
+                continue
+            end = HEADER.size + length + 4
+            if len(self.buffer) < end:
+                return
+            payload = bytes(self.buffer[HEADER.size:HEADER.size + length])
+            (crc,) = struct.unpack_from("<I", self.buffer, HEADER.size + length)
+            del self.buffer[:end]
+            yield frame_type, status, request_id, payload, crc == zlib.crc32(payload, zlib.crc32(fields))
+
+
+class BusPirateRpc:
+    def __init__(self, port, baudrate=115200, timeout=5.0):
+        import serial  # pyserial
+
+        self.port = serial.Serial(port, baudrate, timeout=0.05)
+        self.timeout = timeout
+        self.parser = FrameParser()
+        self.pending = deque()
+        self.done = {}
+        self.next_id = 0
+        self.port.reset_input_buffer()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+    def close(self):
+        try:
+            self.call(EXIT)
+        finally:
+            self.port.close()
+
+    # Pipelining: submit() returns an id at once, result() waits for it
+    def submit(self, frame_type, payload=b""):
+        request_id = self.next_id
+        self.next_id = (self.next_id + 1) & 0xFFFF
+        self.port.write(encode(frame_type, request_id, payload))
+        self.pending.append((request_id, frame_type))
+        return request_id
+
+    def result(self, request_id):
+        deadline = time.monotonic() + self.timeout
+        while request_id not in self.done:
+            if time.monotonic() > deadline:
+                raise TimeoutError("no reply to request %d" % request_id)
+            for frame_type, status, rid, payload, crc_ok in self.parser.feed(self.port.read(65536)):
+                if not crc_ok:
+                    status = 0x03
+                self.done[rid] = (frame_type & ~RESPONSE, status, payload)
+                if self.pending and self.pending[0][0] == rid:
+                    self.pending.popleft()
+        frame_type, status, payload = self.done.pop(request_id)
+        if status:
+            raise RpcError(frame_type, status)
+        return payload
+
+    def call(self, frame_type, payload=b""):
+        return self.result(self.submit(frame_type, payload))
+
+    # Requests
+    def ping(self, data=b""):
+        return self.call(PING, data)
+
+    def info(self):
+        version, max_payload = struct.unpack("<BI", self.call(INFO))
+        return {"version": version, "max_payload": max_payload}
+
+    def spi_transfer(self, data, keep_selected=False):
+        return self.call(SPI_TRANSFER, bytes([SPI_KEEP_SELECTED if keep_selected else 0]) + bytes(data))
+
+    def i2c_write(self, address, data):
+        self.call(I2C_WRITE, bytes([address]) + bytes(data))
+
+    def i2c_read(self, address, count, register=b""):
+        return self.call(I2C_READ, struct.pack("<BH", address, count) + bytes(register))
+
+    def uart_write(self, data):
+        self.call(UART_WRITE, bytes(data))
+
+    def uart_read(self, count, timeout_ms=100):
+        return self.call(UART_READ, struct.pack("<HH", count, timeout_ms))
+
+    def gpio_set(self, pin, level):
+        self.call(GPIO_SET, bytes([pin, 1 if level else 0]))
+
+    def gpio_get(self, pin):
+        return self.call(GPIO_GET, bytes([pin]))[0] == 1
+
+    def flash_read(self, address, length, window=4):
+        """SPI flash range, MAX_PAYLOAD per request with window requests in flight."""
+        image = bytearray()
+        chunks = deque()
+        offset = 0
+        while offset < length or chunks:
+            while offset < length and len(chunks) < window:
+                n = min(MAX_PAYLOAD, length - offset)
+                chunks.append((self.submit(FLASH_READ, struct.pack("<II", address + offset, n)), offset, n))
+                offset += n
+            request_id, at, n = chunks.popleft()
+            try:
+                image += self.result(request_id)
+            except RpcError as error:
+                if error.status != 0x03:
+                    raise
+                image += self.call(FLASH_READ, struct.pack("<II", address + at, n))  # damaged, once more
+        return bytes(image)
+
+
+def selftest():
+    import random
+
+    rng = random.Random(1)
+    payloads = [bytes(rng.getrandbits(8) for _ in range(rng.choice([0, 1, 300, 4096, MAX_PAYLOAD])))
+                for _ in range(24)]
+    wire = bytearray(b"\r\nnoise\xA5")
+    for i, payload in enumerate(payloads):
+        wire += encode(PING | RESPONSE, i, payload)
+
+    damaged = bytearray(encode(PING, 99, b"damaged"))
+    damaged[HEADER.size + 2] ^= 0x01
+    wire += damaged
+    bad_length = bytearray(encode(PING, 98, b"length"))
+    bad_length[8] = 0x7F
+    wire += bad_length + encode(PING, 100, b"last")
+
+    parser = FrameParser()
+    frames = []
+    at = 0
+    while at < len(wire):
+        n = rng.randint(1, 5000)
+        frames += list(parser.feed(bytes(wire[at:at + n])))
+        at += n
+
+    assert [f[2] for f in frames] == list(range(len(payloads))) + [99, 100], [f[2] for f in frames]
+    assert all(f[3] == p and f[4] for f, p in zip(frames, payloads))
+    assert not frames[-2][4] and frames[-1][3] == b"last"
+    print("framing selftest: %d frames ok" % len(frames))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("port", nargs="?")
+    parser.add_argument("--selftest", action="store_true", help="check the framing, no device needed")
+    parser.add_argument("--ping", type=int, default=256, help="round trips to time")
+    args = parser.parse_args()
+
+    if args.selftest or not args.port:
+        selftest()
+        return 0
+
+    with BusPirateRpc(args.port) as bp:
+        print("device:", bp.info())
+        data = bytes(range(256)) * 16
+        start = time.monotonic()
+        ids = [bp.submit(PING, data) for _ in range(args.ping)]
+        for request_id in ids:
+            assert bp.result(request_id) == data
+        elapsed = time.monotonic() - start
+        print("%d pipelined 4 KB pings in %.2f s, %.0f KB/s each way"
+              % (args.ping, elapsed, args.ping * len(data) / 1024 / elapsed))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -17,8 +17,10 @@ ANetworkController::ANetworkController(
     NvsService& nvsService,
     HttpService& httpService,
     TelnetService& telnetService,
+    LittleFsService& littleFsService,
     ArgTransformer& argTransformer,
     JsonTransformer& jsonTransformer,
+    WifiSniffTransformer& wifiSniffTransformer,
     UserInputManager& userInputManager,
     ModbusShell& modbusShell
 )
@@ -35,8 +37,10 @@ ANetworkController::ANetworkController(
   nvsService(nvsService),
   httpService(httpService),
   telnetService(telnetService),
+  littleFsService(littleFsService),
   argTransformer(argTransformer),
   jsonTransformer(jsonTransformer),
+  wifiSniffTransformer(wifiSniffTransformer),
   userInputManager(userInputManager),
   modbusShell(modbusShell)
 {
@@ -139,7 +143,23 @@ void ANetworkController::handleDiscovery(const TerminalCommand &cmd)
     }
 
     const std::string deviceIP = phy_interface == phy_interface_t::phy_wifi ? wifiService.getLocalIP() : ethernetService.getLocalIP();
-    icmpService.startDiscoveryTask(deviceIP);
+
+    // Range, the local subnet by default, /24 if it is larger than a /22
+    std::string cidr = cmd.getSubcommand();
+    if (cidr.empty()) {
+        const std::string mask = phy_interface == phy_interface_t::phy_wifi ? wifiService.getSubnetMask() : ethernetService.getSubnetMask();
+        int prefix = IcmpDiscoveryEngine::maskToPrefix(mask);
+        if (prefix < 22) prefix = 24;
+        cidr = deviceIP + "/" + std::to_string(prefix);
+    }
+
+    uint32_t first, count;
+    if (!IcmpDiscoveryEngine::parseCidr(cidr, first, count)) {
+        terminalView.println("Discovery: Invalid range, use <ip>/<prefix> (/16 to /32)");
+        return;
+    }
+
+    icmpService.startDiscoveryTask(deviceIP, cidr);
 
     while (!icmpService.isDiscoveryReady()) {
         // Display logs
@@ -717,7 +737,7 @@ Help
 void ANetworkController::handleHelp()
 {
     terminalView.println("  ping <host>");
-    terminalView.println("  discovery");
+    terminalView.println("  discovery [cidr]");
     terminalView.println("  ssh <host> <user> <password> [port]");
     terminalView.println("  telnet <host> [port]");
     terminalView.println("  nc <host> <port>");
@@ -12,12 +12,15 @@
 #include "Services/NetcatService.h"
 #include "Services/NmapService.h"
 #include "Services/ICMPService.h"
+#include "Services/IcmpDiscoveryEngine.h"
 #include "Services/NvsService.h"
 #include "Services/TelnetService.h"
 #include "Services/HttpService.h"
 #include "Services/ModbusService.h"
+#include "Services/LittleFsService.h"
 #include "Transformers/ArgTransformer.h"
 #include "Transformers/JsonTransformer.h"
+#include "Transformers/WifiSniffTransformer.h"
 #include "Managers/UserInputManager.h"
 #include "States/GlobalState.h"
 #include "Models/TerminalCommand.h"
@@ -40,8 +43,10 @@ public:
         NvsService& nvsService,
         HttpService& httpService,
         TelnetService& telnetService,
+        LittleFsService& littleFsService,
         ArgTransformer& argTransformer,
         JsonTransformer& jsonTransformer,
+        WifiSniffTransformer& wifiSniffTransformer,
         UserInputManager& userInputManager,
         ModbusShell& modbusShell
     );
@@ -84,11 +89,13 @@ protected:
     ICMPService&       icmpService;
     HttpService&       httpService;
     TelnetService&     telnetService;
+    LittleFsService&   littleFsService;
 
     ModbusShell&       modbusShell;
 
     ArgTransformer&    argTransformer;
     JsonTransformer&   jsonTransformer;
+    WifiSniffTransformer& wifiSniffTransformer;
     UserInputManager&  userInputManager;
     GlobalState&       globalState = GlobalState::getInstance();
 };
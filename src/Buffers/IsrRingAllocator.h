@@ -0,0 +1,23 @@
+#pragma once
+
+#include <new>
+#include <esp_heap_caps.h>
+
+// Rings filled from an ISR or a driver callback, allocated only while a
+// capture runs. Internal RAM, so the producer never touches PSRAM, aligned
+// for the cache line members of SpscRingBuffer. nullptr when out of memory.
+
+template <typename Ring>
+Ring* allocateIsrRing() {
+    void* p = heap_caps_aligned_alloc(alignof(Ring), sizeof(Ring), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    return p ? new (p) Ring() : nullptr;
+}
+
+// Call once the producer is stopped
+template <typename Ring>
+void freeIsrRing(Ring*& ring) {
+    if (!ring) return;
+    ring->~Ring();
+    heap_caps_free(ring);
+    ring = nullptr;
+}
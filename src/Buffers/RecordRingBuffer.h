@@ -0,0 +1,156 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Record drained from a RecordRingBuffer, payload lives in RecordBatch::bytes
+struct RecordView {
+    uint32_t timestampUs;
+    uint32_t offset;
+    uint16_t length;
+    uint16_t flags;
+};
+
+// Records drained in one go, clear() keeps the storage for the next drain
+struct RecordBatch {
+    std::vector<uint8_t> bytes;
+    std::vector<RecordView> records;
+
+    void clear() { bytes.clear(); records.clear(); }
+    const uint8_t* data(const RecordView& record) const { return bytes.data() + record.offset; }
+};
+
+// Fixed capacity, lock-free single producer / single consumer ring of
+// variable length records. Each record is an 8 byte header (timestamp,
+// length, flags) followed by its payload, padded to 8 bytes. A record never
+// wraps: when it does not fit before the end, a wrap marker is written and it
+// starts again at offset 0. push() does not allocate or lock, it can be
+// called from an ISR; a full ring drops the record and counts it.
+
+template <size_t Capacity>
+class RecordRingBuffer {
+    static_assert(Capacity >= 64 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    static constexpr uint16_t FlagTruncated = 0x0001;
+    static constexpr size_t HeaderSize = 8;
+    static constexpr size_t MaxPayload = Capacity / 4 - HeaderSize; // keeps a few records in flight
+
+    // Producer side, returns false if the record was dropped
+    __attribute__((always_inline)) inline
+    bool push(const uint8_t* src, size_t len, uint32_t timestampUs, uint16_t flags = 0) {
+        if (len > MaxPayload) {
+            len = MaxPayload;
+            flags |= FlagTruncated;
+        }
+        if (flags & FlagTruncated) truncated.fetch_add(1, std::memory_order_relaxed);
+
+        uint32_t need = align(HeaderSize + len);
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t t = tail.load(std::memory_order_acquire);
+        uint32_t space = Capacity - (h - t);
+        uint32_t idx = h & Mask;
+        uint32_t contiguous = Capacity - idx;
+
+        // Pad to the end if the record would wrap
+        uint32_t pad = need > contiguous ? contiguous : 0;
+        if (need + pad > space) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        if (pad) {
+            writeHeader(idx, 0, WrapMarker, 0);
+            h += pad;
+            idx = 0;
+        }
+
+        writeHeader(idx, timestampUs, (uint16_t)len, flags);
+        memcpy(&data[idx + HeaderSize], src, len);
+
+        head.store(h + need, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, append records to the batch until maxBytes of payload
+    size_t drain(RecordBatch& out, size_t maxBytes = (size_t)-1) {
+        size_t count = 0;
+        size_t taken = 0;
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+
+        while (t != h) {
+            uint32_t idx = t & Mask;
+            uint32_t timestampUs;
+            uint16_t len, flags;
+            readHeader(idx, timestampUs, len, flags);
+
+            if (len == WrapMarker) {
+                t += Capacity - idx;
+                continue;
+            }
+            if (count && taken + len > maxBytes) break;
+
+            RecordView view{timestampUs, (uint32_t)out.bytes.size(), len, flags};
+            out.bytes.insert(out.bytes.end(), &data[idx + HeaderSize], &data[idx + HeaderSize] + len);
+            out.records.push_back(view);
+
+            t += align(HeaderSize + len);
+            taken += len;
+            count++;
+        }
+
+        tail.store(t, std::memory_order_release);
+        return count;
+    }
+
+    // Consumer side, drop everything currently queued
+    void clear() {
+        tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    bool empty() const {
+        return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+    }
+
+    // Bytes in use, headers and padding included
+    size_t used() const {
+        return (uint32_t)(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+    }
+
+    uint32_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+    uint32_t truncatedCount() const { return truncated.load(std::memory_order_relaxed); }
+
+    void resetCounters() {
+        dropped.store(0, std::memory_order_relaxed);
+        truncated.store(0, std::memory_order_relaxed);
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    static constexpr uint32_t Mask = Capacity - 1;
+    static constexpr uint16_t WrapMarker = 0xFFFF;
+
+    static constexpr uint32_t align(uint32_t n) { return (n + 7u) & ~7u; }
+
+    inline void writeHeader(uint32_t idx, uint32_t timestampUs, uint16_t len, uint16_t flags) {
+        memcpy(&data[idx], &timestampUs, 4);
+        memcpy(&data[idx + 4], &len, 2);
+        memcpy(&data[idx + 6], &flags, 2);
+    }
+
+    inline void readHeader(uint32_t idx, uint32_t& timestampUs, uint16_t& len, uint16_t& flags) const {
+        memcpy(&timestampUs, &data[idx], 4);
+        memcpy(&len, &data[idx + 4], 2);
+        memcpy(&flags, &data[idx + 6], 2);
+    }
+
+    alignas(64) std::atomic<uint32_t> head{0};
+    alignas(64) std::atomic<uint32_t> tail{0};
+    std::atomic<uint32_t> dropped{0};
+    std::atomic<uint32_t> truncated{0};
+    alignas(8) uint8_t data[Capacity];
+};
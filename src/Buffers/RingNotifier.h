@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#else
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#endif
+
+// Wakes a consumer blocked on an empty ring.
+// The producer calls notify() after a push, the consumer re-checks the ring
+// and calls wait() when it is still empty. A notify() that happens before
+// wait() is remembered, so no wakeup is lost.
+
+class RingNotifier {
+public:
+#ifdef ARDUINO
+    RingNotifier() : sem(xSemaphoreCreateBinary()) {}
+    ~RingNotifier() { if (sem) vSemaphoreDelete(sem); }
+
+    void notify() {
+        xSemaphoreGive(sem);
+    }
+
+    void notifyFromIsr() {
+        BaseType_t woken = pdFALSE;
+        xSemaphoreGiveFromISR(sem, &woken);
+        if (woken) portYIELD_FROM_ISR();
+    }
+
+    // True if notified before the timeout
+    bool wait(uint32_t timeoutMs) {
+        return xSemaphoreTake(sem, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+    }
+#else
+    RingNotifier() = default;
+
+    void notify() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            signaled = true;
+        }
+        cv.notify_one();
+    }
+
+    void notifyFromIsr() {
+        notify();
+    }
+
+    bool wait(uint32_t timeoutMs) {
+        std::unique_lock<std::mutex> lock(mtx);
+        bool ok = cv.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return signaled; });
+        signaled = false;
+        return ok;
+    }
+#endif
+
+    RingNotifier(const RingNotifier&) = delete;
+    RingNotifier& operator=(const RingNotifier&) = delete;
+
+private:
+#ifdef ARDUINO
+    SemaphoreHandle_t sem;
+#else
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool signaled = false;
+#endif
+};
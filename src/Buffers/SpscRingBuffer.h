@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Fixed capacity, lock-free single producer / single consumer ring.
+// One task (or ISR) pushes, one other task pops, no lock is taken.
+// Indexes run freely and are masked, Capacity must be a power of two.
+// Head and tail live on separate cache lines to avoid false sharing.
+
+template <typename T, size_t Capacity>
+class SpscRingBuffer {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "T must be trivially copyable");
+
+public:
+    static constexpr size_t CacheLine = 64;
+
+    // Producer side, returns the number of items pushed
+    size_t push(const T* src, size_t count) {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        uint32_t t = tail.load(std::memory_order_acquire);
+        size_t space = Capacity - (uint32_t)(h - t);
+        if (count > space) count = space;
+        if (count == 0) return 0;
+
+        size_t idx = h & Mask;
+        size_t first = Capacity - idx;
+        if (first > count) first = count;
+        memcpy(&data[idx], src, first * sizeof(T));
+        memcpy(&data[0], src + first, (count - first) * sizeof(T));
+
+        head.store(h + (uint32_t)count, std::memory_order_release);
+        return count;
+    }
+
+    bool push(const T& item) {
+        return push(&item, 1) == 1;
+    }
+
+    // Producer side, slot to fill in place before commit(), nullptr when full
+    T* writeSlot() {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if ((uint32_t)(h - tail.load(std::memory_order_acquire)) >= Capacity) return nullptr;
+        return &data[h & Mask];
+    }
+
+    // Producer side, publish the slot returned by writeSlot()
+    void commit() {
+        head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Consumer side, returns the number of items popped
+    size_t pop(T* dst, size_t count) {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        uint32_t h = head.load(std::memory_order_acquire);
+        size_t avail = (uint32_t)(h - t);
+        if (count > avail) count = avail;
+        if (count == 0) return 0;
+
+        size_t idx = t & Mask;
+        size_t first = Capacity - idx;
+        if (first > count) first = count;
+        memcpy(dst, &data[idx], first * sizeof(T));
+        memcpy(dst + first, &data[0], (count - first) * sizeof(T));
+
+        tail.store(t + (uint32_t)count, std::memory_order_release);
+        return count;
+    }
+
+    bool pop(T& item) {
+        return pop(&item, 1) == 1;
+    }
+
+    // Consumer side, look at the next item without removing it
+    bool peek(T& item) const {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire)) return false;
+        item = data[t & Mask];
+        return true;
+    }
+
+    // Consumer side, drop everything currently queued
+    void clear() {
+        tail.store(head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    // Approximate when called from the other side
+    size_t size() const {
+        return (uint32_t)(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+    }
+
+    size_t freeSpace() const {
+        return Capacity - size();
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    static constexpr size_t capacity() {
+        return Capacity;
+    }
+
+private:
+    static constexpr uint32_t Mask = Capacity - 1;
+
+    alignas(CacheLine) std::atomic<uint32_t> head{0}; // written by producer
+    alignas(CacheLine) std::atomic<uint32_t> tail{0}; // written by consumer
+    alignas(CacheLine) T data[Capacity];
+};
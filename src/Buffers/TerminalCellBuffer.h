@@ -0,0 +1,141 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+// Character cells of a text terminal, the screen and its scrollback in one
+// fixed ring of lines allocated once. Scrolling moves the ring head instead of
+// the text. Every change marks the visible row dirty for the renderer.
+//
+// Live rows are the screen when not scrolled back, 0 is the top one.
+// Screen rows are what is shown, scrollOffset lines back in the history.
+
+class TerminalCellBuffer {
+public:
+    TerminalCellBuffer(int rows = 10, int cols = 34, int historyRows = 256) {
+        resize(rows, cols, historyRows);
+    }
+
+    void resize(int rows, int cols, int historyRows) {
+        rowCount = std::max(rows, 1);
+        colCount = std::max(cols, 1);
+        historyMax = std::max(historyRows, 0);
+        lineCount = rowCount + historyMax;
+        cells.assign((size_t)lineCount * colCount, ' ');
+        dirtyRows.assign(rowCount, 1);
+        top = 0;
+        history = 0;
+        offset = 0;
+        scrolled = 0;
+        anyDirtyRow = true;
+    }
+
+    int rows() const { return rowCount; }
+    int cols() const { return colCount; }
+    int historyCount() const { return history; }
+    int scrollOffset() const { return offset; }
+
+    char at(int row, int col) const { return cells[start(row) + col]; }
+
+    void put(int row, int col, char c) {
+        char& cell = cells[start(row) + col];
+        if (cell == c) return;
+        cell = c;
+        markLive(row);
+    }
+
+    // Blank [from, to) of a live row
+    void clear(int row, int from, int to) {
+        from = std::max(from, 0);
+        to = std::min(to, colCount);
+        if (from >= to) return;
+        memset(&cells[start(row) + from], ' ', (size_t)(to - from));
+        markLive(row);
+    }
+
+    void clearScreen() {
+        for (int r = 0; r < rowCount; ++r) clear(r, 0, colCount);
+    }
+
+    void clearHistory() {
+        history = 0;
+        if (offset) {
+            offset = 0;
+            markAllDirty();
+        }
+    }
+
+    // Top live row goes to the history, a blank row comes in at the bottom
+    void scrollUp() {
+        top = (top + 1) % lineCount;
+        memset(&cells[start(rowCount - 1)], ' ', (size_t)colCount);
+        if (history < historyMax) history++;
+
+        if (offset == 0) {
+            scrolled++;
+            markAllDirty();
+        } else if (offset < history) {
+            offset++;           // the view stays on the same lines
+        } else {
+            markAllDirty();     // its top line was just dropped
+        }
+    }
+
+    // Lines back in the history, clamped; true when the view changed
+    bool setScrollOffset(int lines) {
+        lines = std::max(0, std::min(lines, history));
+        if (lines == offset) return false;
+        offset = lines;
+        markAllDirty();
+        return true;
+    }
+
+    // cols characters of the line shown at a screen row
+    const char* visibleLine(int screenRow) const { return &cells[start(screenRow - offset)]; }
+
+    bool isDirty(int screenRow) const { return dirtyRows[screenRow] != 0; }
+    bool anyDirty() const { return anyDirtyRow; }
+    void markDirty(int screenRow) {
+        dirtyRows[screenRow] = 1;
+        anyDirtyRow = true;
+    }
+    void markAllDirty() {
+        std::fill(dirtyRows.begin(), dirtyRows.end(), 1);
+        anyDirtyRow = true;
+    }
+
+    // Live scrolls since the last clearDirty(), for hardware scrolling
+    uint32_t scrolledLines() const { return scrolled; }
+
+    void clearDirty() {
+        std::fill(dirtyRows.begin(), dirtyRows.end(), 0);
+        anyDirtyRow = false;
+        scrolled = 0;
+    }
+
+private:
+    int rowCount = 0;
+    int colCount = 0;
+    int historyMax = 0;
+    int lineCount = 0;
+    int top = 0;            // ring line of live row 0
+    int history = 0;
+    int offset = 0;
+    uint32_t scrolled = 0;
+    bool anyDirtyRow = true;
+    std::vector<char> cells;
+    std::vector<uint8_t> dirtyRows;
+
+    // Negative live rows are history lines
+    size_t start(int liveRow) const {
+        int line = ((top + liveRow) % lineCount + lineCount) % lineCount;
+        return (size_t)line * colCount;
+    }
+
+    void markLive(int row) {
+        int screen = row + offset;
+        if (screen < rowCount) markDirty(screen);
+    }
+};
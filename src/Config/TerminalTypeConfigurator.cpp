@@ -17,12 +17,15 @@ TerminalTypeEnum TerminalTypeConfigurator::configure() {
     #if defined(DEVICE_M5STAMPS3) || defined(DEVICE_S3DEVKIT)
         selected = selector.selectHeadless();
     #else
-        selected = selector.select(
-            "ESP32 BUS PIRATE",
-            options,
-            "Select terminal type",
-            ""
-        );
+        // A terminal is required, cancel shows the choice again
+        do {
+            selected = selector.select(
+                "ESP32 BUS PIRATE",
+                options,
+                "Select terminal type",
+                ""
+            );
+        } while (selected < 0);
     #endif
 
     switch (selected) {
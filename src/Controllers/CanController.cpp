@@ -1,15 +1,17 @@
 #include "CanController.h"
 
 CanController::CanController(ITerminalView& terminalView, IInput& terminalInput, UserInputManager& userInputManager,
-                             CanService& canService, ArgTransformer& argTransformer)
+                             CanService& canService, LittleFsService& littleFsService, ArgTransformer& argTransformer,
+                             CanLogTransformer& canLogTransformer)
     : terminalView(terminalView), terminalInput(terminalInput), userInputManager(userInputManager),
-      canService(canService), argTransformer(argTransformer) {}
+      canService(canService), littleFsService(littleFsService), argTransformer(argTransformer),
+      canLogTransformer(canLogTransformer) {}
 
 /*
 Entry point for CAN commands
 */
 void CanController::handleCommand(const TerminalCommand& cmd) {
-    if (cmd.getRoot() == "sniff")          handleSniff();
+    if (cmd.getRoot() == "sniff")          handleSniff(cmd);
     else if (cmd.getRoot() == "send")      handleSend(cmd);
     else if (cmd.getRoot() == "receive")   handleReceive(cmd);
     else if (cmd.getRoot() == "status")    handleStatus();
@@ -20,34 +22,158 @@ void CanController::handleCommand(const TerminalCommand& cmd) {
 /*
 Sniff all CAN frames
 */
-void CanController::handleSniff() {
+void CanController::handleSniff(const TerminalCommand& cmd) {
+    const std::string& sub = cmd.getSubcommand();
+    if (sub == "log" || sub == "candump") {
+        handleSniffLog(cmd, false);
+        return;
+    }
+    if (sub == "csv" || sub == "savvycan") {
+        handleSniffLog(cmd, true);
+        return;
+    }
+
     canService.reset();
-    
-    terminalView.println("CAN Sniff: Waiting for frame... Press [ENTER] to stop.\n");
-    
-    unsigned long lastFrameTime = millis();
+    if (!canService.beginCapture(state.getCanIntPin())) {
+        terminalView.println("CAN Sniff: Failed to start the capture.");
+        return;
+    }
+
+    CanStatsManager stats;
+    std::vector<CanFrameRecord> batch(32);
+    unsigned long lastDraw = 0;
+
     while (true) {
-        auto frame = canService.readFrameAsString();
+        // Abort if ENTER is pressed
+        char ch = terminalInput.readChar();
+        if (ch == '\n' || ch == '\r') break;
 
-        // Received frame
-        if (!frame.empty()) {
-            terminalView.println(" 📥 " + frame);
-            lastFrameTime = millis();  // reset timer
+        size_t n;
+        while ((n = canService.readFrames(batch.data(), batch.size())) > 0) {
+            stats.add(batch.data(), n);
         }
 
-        // Reset CAN if no frame for 3 seconds
-        if (millis() - lastFrameTime > 3000) {
-            canService.reset();
-            lastFrameTime = millis();
+        // Redraw the per ID table, not every frame
+        if (millis() - lastDraw >= 500) {
+            stats.addOverflows(canService.overflowCount() - stats.totals().overflows);
+            stats.addDropped(canService.droppedFrames() - stats.totals().dropped);
+
+            terminalView.clear();
+            terminalView.println("CAN Sniff: " + std::to_string(state.getCanKbps()) + " kbps, " +
+                                 (state.getCanIntPin() == 0xFF ? std::string("polled") : "INT on GPIO " + std::to_string(state.getCanIntPin())) +
+                                 ". Press [ENTER] to stop. '*' marks changed bytes.");
+            for (const auto& line : stats.formatTop(20)) {
+                terminalView.println(line);
+            }
+            lastDraw = millis();
         }
 
-        // Abort if ENTER is pressed
+        delay(10);
+    }
+
+    canService.endCapture();
+    const auto& totals = stats.totals();
+    terminalView.println("\nCAN Sniff: Stopped by user. " + std::to_string(totals.frames) + " frames, " +
+                         std::to_string(stats.ids().size()) + " IDs, " +
+                         std::to_string(canService.overflowCount()) + " overflows, " +
+                         std::to_string(canService.droppedFrames()) + " dropped.");
+}
+
+/*
+Sniff CAN frames to a log file
+*/
+void CanController::handleSniffLog(const TerminalCommand& cmd, bool csv) {
+    std::string path = csv ? "/can.csv" : "/can.log";
+    std::string name = cmd.getArgs();
+    if (!name.empty()) {
+        if (!littleFsService.isSafeRootFileName(name)) {
+            terminalView.println("CAN Sniff: Invalid file name.");
+            return;
+        }
+        path = "/" + name;
+    }
+    if (!littleFsService.mounted()) {
+        littleFsService.begin();
+    }
+
+    std::string out = csv ? CanLogTransformer::savvyCanHeader() : "";
+    if (!littleFsService.write(path, out)) {
+        terminalView.println("CAN Sniff: Failed to create " + path);
+        return;
+    }
+    size_t fileBytes = out.size();
+    out.clear();
+
+    canService.reset();
+    if (!canService.beginCapture(state.getCanIntPin())) {
+        terminalView.println("CAN Sniff: Failed to start the capture.");
+        return;
+    }
+    terminalView.println("CAN Sniffing to " + path + "... Press [ENTER] to stop.\n");
+
+    std::vector<CanFrameRecord> batch(32);
+    uint32_t frames = 0;
+    bool storageFull = false;
+    unsigned long lastStatus = millis();
+
+    while (true) {
         char ch = terminalInput.readChar();
-        if (ch == '\n' || ch == '\r') {
-            terminalView.println("\nCan Sniff: Stopped by user.");
-            break;
+        if (ch == '\n' || ch == '\r') break;
+
+        // Format here, not in the drain task
+        size_t n;
+        while ((n = canService.readFrames(batch.data(), batch.size())) > 0) {
+            for (size_t i = 0; i < n; ++i) {
+                if (csv) canLogTransformer.appendSavvyCan(out, batch[i]);
+                else canLogTransformer.appendCandump(out, batch[i]);
+            }
+            frames += n;
         }
+
+        // Write in blocks, the file is reopened on each write
+        if (out.size() >= 4096) {
+            if (littleFsService.freeBytes() < out.size() + 4096 ||
+                !littleFsService.write(path, out, true)) {
+                storageFull = true;
+                break;
+            }
+            fileBytes += out.size();
+            out.clear();
+        }
+
+        if (millis() - lastStatus >= 1000) {
+            terminalView.println("  " + std::to_string(frames) + " frames, " +
+                                 std::to_string(canService.overflowCount()) + " overflows, " +
+                                 std::to_string(canService.droppedFrames()) + " dropped, " +
+                                 std::to_string(fileBytes / 1024) + " KB");
+            lastStatus = millis();
+        }
+
+        delay(10);
+    }
+
+    canService.stopCapture();
+
+    // Frames still in the ring
+    size_t n;
+    while (!storageFull && (n = canService.readFrames(batch.data(), batch.size())) > 0) {
+        for (size_t i = 0; i < n; ++i) {
+            if (csv) canLogTransformer.appendSavvyCan(out, batch[i]);
+            else canLogTransformer.appendCandump(out, batch[i]);
+        }
+        frames += n;
     }
+    canService.endCapture();
+    if (!out.empty() && !storageFull && littleFsService.write(path, out, true)) {
+        fileBytes += out.size();
+    }
+
+    if (storageFull) terminalView.println("CAN Sniff: LittleFS is full.");
+    terminalView.println("CAN Sniffing stopped. " + std::to_string(frames) + " frames, " +
+                         std::to_string(canService.overflowCount()) + " overflows, " +
+                         std::to_string(canService.droppedFrames()) + " dropped.");
+    terminalView.println("Saved " + path + " (" + std::to_string(fileBytes) + " bytes), " +
+                         (csv ? "open it in SavvyCAN.\n" : "replay it with canplayer.\n"));
 }
 
 /*
@@ -154,7 +280,7 @@ Help message for CAN commands
 */
 void CanController::handleHelp() {
     terminalView.println("Available CAN commands:");
-    terminalView.println("  sniff");
+    terminalView.println("  sniff [log|csv <file>]");
     terminalView.println("  send [id]");
     terminalView.println("  receive [id]");
     terminalView.println("  status");
@@ -189,6 +315,15 @@ void CanController::handleConfig() {
     uint8_t so = userInputManager.readValidatedPinNumber("MCP2515 SO (MISO) pin", state.getCanSoPin(), forbidden);
     state.setCanSoPin(so);
 
+    // Configure INT, optional, frames are polled without it
+    uint8_t intPin = state.getCanIntPin();
+    if (userInputManager.readYesNo("Use the MCP2515 INT pin?", intPin != 0xFF)) {
+        intPin = userInputManager.readValidatedPinNumber("MCP2515 INT pin", intPin == 0xFF ? 4 : intPin, forbidden);
+    } else {
+        intPin = 0xFF;
+    }
+    state.setCanIntPin(intPin);
+
     // Configure bitrate
     uint32_t kbps = userInputManager.readValidatedUint32("Speed in kbps", state.getCanKbps());
     uint32_t adjusted = canService.closestSupportedBitrate(kbps);
@@ -5,32 +5,42 @@
 #include "Interfaces/IInput.h"
 #include "Models/TerminalCommand.h"
 #include "Services/CanService.h"
+#include "Services/LittleFsService.h"
 #include "Transformers/ArgTransformer.h"
+#include "Transformers/CanLogTransformer.h"
+#include "Managers/CanStatsManager.h"
 #include "Managers/UserInputManager.h"
 #include "States/GlobalState.h"
 
 class CanController {
 public:
     CanController(ITerminalView& terminalView, IInput& terminalInput, UserInputManager& userInputManager,
-                  CanService& canService, ArgTransformer& argTransformer);
+                  CanService& canService, LittleFsService& littleFsService, ArgTransformer& argTransformer,
+                  CanLogTransformer& canLogTransformer);
     
     // Entry point to handle CAN commands
     void handleCommand(const TerminalCommand& cmd);
 
     // Ensure the CAN controller is configured
     void ensureConfigured();
+    void markConfigured() { configured = true; }
     
 private:
     ITerminalView& terminalView;
     IInput& terminalInput;
     CanService& canService;
+    LittleFsService& littleFsService;
     ArgTransformer& argTransformer;
+    CanLogTransformer& canLogTransformer;
     UserInputManager& userInputManager;
     GlobalState& state = GlobalState::getInstance();
     bool configured = false;
     
-    // Sniffing all CAN frames
-    void handleSniff();
+    // Sniffing all CAN frames, live per ID view or log file
+    void handleSniff(const TerminalCommand& cmd);
+
+    // Capture to a candump -L or SavvyCAN CSV file on LittleFS
+    void handleSniffLog(const TerminalCommand& cmd, bool csv);
 
     // Status of the CAN controller
     void handleStatus();
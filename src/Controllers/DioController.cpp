@@ -5,8 +5,10 @@
 /*
 Constructor
 */
-DioController::DioController(ITerminalView& terminalView, IInput& terminalInput, PinService& pinService, ArgTransformer& argTransformer)
-    : terminalView(terminalView), terminalInput(terminalInput), pinService(pinService), argTransformer(argTransformer) {}
+DioController::DioController(ITerminalView& terminalView, IInput& terminalInput, PinService& pinService, ArgTransformer& argTransformer,
+                             EdgeCaptureService& edgeCaptureService, EdgeStatsManager& edgeStatsManager)
+    : terminalView(terminalView), terminalInput(terminalInput), pinService(pinService), argTransformer(argTransformer),
+      edgeCaptureService(edgeCaptureService), edgeStatsManager(edgeStatsManager) {}
 
 /*
 Entry point to handle a DIO command
@@ -139,7 +141,18 @@ void DioController::handleSniff(const TerminalCommand& cmd) {
     int last = pinService.read(pin);
     terminalView.println("Initial state: " + std::to_string(last));
 
+    // Transitions are timestamped by the edge interrupt, printed in batches
+    if (!edgeCaptureService.beginEdges(pin)) {
+        terminalView.println("DIO Sniff: Not enough memory for the edge buffer.");
+        return;
+    }
+    edgeStatsManager.reset(edgeCaptureService.tickRate());
+
+    EdgeEvent batch[64];
+    uint32_t previousTicks = 0;
+    bool havePrevious = false;
     unsigned long lastCheck = millis();
+
     while (true) {
         // check ENTER press
         if (millis() - lastCheck > 10) {
@@ -151,16 +164,35 @@ void DioController::handleSniff(const TerminalCommand& cmd) {
             }
         }
 
-        // check pin state
-        int current = pinService.read(pin);
-        if (current != last) {
-            std::string transition = (last == 0 && current == 1)
-                ? "LOW  -> HIGH"
-                : "HIGH -> LOW";
-            terminalView.println("Pin " + std::to_string(pin) + ": " + transition);
-            last = current;
+        // Too fast to print, the ring overflowed
+        if (edgeCaptureService.droppedEdges()) {
+            terminalView.println("DIO Sniff: Edges too fast to print, stopped. Use 'measure " +
+                                 std::to_string(pin) + "' instead.");
+            break;
+        }
+
+        size_t count = edgeCaptureService.readEdges(batch, 64);
+        if (count == 0) {
+            delay(1);
+            continue;
+        }
+
+        std::string out;
+        for (size_t i = 0; i < count; ++i) {
+            const EdgeEvent& e = batch[i];
+            out += "Pin " + std::to_string(pin) + ": " + (e.level ? "LOW  -> HIGH" : "HIGH -> LOW");
+            if (havePrevious) {
+                out += "  (+" + EdgeStatsManager::formatDuration(edgeStatsManager.ticksToNs(e.ticks - previousTicks)) + ")";
+            }
+            out += "\n";
+            previousTicks = e.ticks;
+            havePrevious = true;
         }
+        out.pop_back();
+        terminalView.println(out);
     }
+
+    edgeCaptureService.endEdges();
 }
 
 /*
@@ -273,42 +305,98 @@ void DioController::handleMeasure(const TerminalCommand& cmd) {
 
     uint32_t durationMs = 1000;
     if (!args.empty() && argTransformer.isValidNumber(args[0])) {
-        durationMs = std::min(argTransformer.toUint32(args[0]), 5000u);
-        if (durationMs == 5000) {
-            terminalView.println("Note: Duration limited to 5000 ms max.");
+        durationMs = std::min(argTransformer.toUint32(args[0]), 60000u);
+        if (durationMs == 60000) {
+            terminalView.println("Note: Duration limited to 60000 ms max.");
         }
     }
 
     terminalView.println("DIO EdgeCount: Sampling pin " + std::to_string(pin) +
-                         " for " + std::to_string(durationMs) + " ms...");
+                         " for " + std::to_string(durationMs) + " ms... Press [ENTER] to stop.");
 
     pinService.setInput(pin);
-    int last = pinService.read(pin);
-    uint32_t rising = 0, falling = 0;
 
+    // Rising edges are counted by the hardware counter, at any rate
+    bool counting = edgeCaptureService.beginCounter(pin);
     unsigned long startMs = millis();
 
+    // Timestamp the edges only when the interrupt can keep up
+    bool timestamps = true;
+    if (counting) {
+        delay(10);
+        uint64_t probe = edgeCaptureService.counterValue();
+        timestamps = probe * 2 * 1000 / std::max<unsigned long>(millis() - startMs, 1) <= MaxTimestampedEdgeRate;
+    }
+    edgeStatsManager.reset(edgeCaptureService.tickRate());
+    if (timestamps) timestamps = edgeCaptureService.beginEdges(pin);
+
+    // Drops are flagged on the events themselves. The 32 bit ticks wrap
+    // (17.9 s at 240 MHz), an interval longer than half a wrap is broken
+    // here instead of being measured wrong.
+    EdgeEvent batch[128];
+    const unsigned long halfWrapMs = (unsigned long)(0x80000000ull * 1000 / edgeCaptureService.tickRate());
+    unsigned long lastEdgeMs = millis();
+    unsigned long lastCheck = millis();
+    auto drain = [&]() {
+        size_t count;
+        bool received = false;
+        while ((count = edgeCaptureService.readEdges(batch, 128)) > 0) {
+            edgeStatsManager.add(batch, count);
+            received = true;
+        }
+        unsigned long now = millis();
+        if (received) {
+            lastEdgeMs = now;
+        } else if (now - lastEdgeMs > halfWrapMs) {
+            edgeStatsManager.markGap();
+            lastEdgeMs = now;
+        }
+    };
+
     while (millis() - startMs < durationMs) {
-        int current = pinService.read(pin);
-        if (current != last) {
-            if (last == 0 && current == 1) ++rising;
-            else if (last == 1 && current == 0) ++falling;
-            last = current;
+        if (timestamps) drain();
+
+        if (millis() - lastCheck > 10) {
+            lastCheck = millis();
+            char c = terminalInput.readChar();
+            if (c == '\r' || c == '\n') break;
         }
+        delay(1);
     }
 
-    terminalView.println("");
-    terminalView.println(" Results:");
-    terminalView.println("  • Rising edges:     " + std::to_string(rising));
-    terminalView.println("  • Falling edges:    " + std::to_string(falling));
+    unsigned long elapsedMs = std::max<unsigned long>(millis() - startMs, 1);
+    uint64_t hardwareRising = counting ? edgeCaptureService.counterValue() : 0;
+    edgeCaptureService.endCounter();
+    // Last edges read before endEdges frees the ring
+    if (timestamps) {
+        drain();
+        edgeCaptureService.endEdges();
+    }
 
-    uint32_t totalEdges = rising + falling;
-    float freqHz = (totalEdges / 2.0f) / (durationMs / 1000.0f);
+    const EdgeStats& stats = edgeStatsManager.stats();
+    terminalView.println("");
+    terminalView.println(" Results (" + std::to_string(elapsedMs) + " ms):");
+    if (counting) {
+        terminalView.println("  • Rising edges:     " + std::to_string(hardwareRising) + " (hardware counter)");
+        terminalView.println("  • Frequency:        " +
+                             argTransformer.formatFloat(hardwareRising * 1000.0 / elapsedMs, 2) + " Hz");
+    }
+    if (!timestamps) {
+        terminalView.println("  • Edge timing:      skipped, above " +
+                             std::to_string(MaxTimestampedEdgeRate / 1000) + "k edges/s");
+        terminalView.println("");
+        return;
+    }
 
-    std::ostringstream oss;
-    oss.precision(2);
-    oss << std::fixed << "  • Approx. frequency: " << freqHz << " Hz\n";
-    terminalView.println(oss.str());
+    terminalView.println("  • Timestamped:      " + std::to_string(stats.rising) + " rising, " +
+                         std::to_string(stats.falling) + " falling");
+    if (edgeCaptureService.droppedEdges()) {
+        terminalView.println("  • Dropped edges:    " + std::to_string(edgeCaptureService.droppedEdges()));
+    }
+    for (const auto& line : edgeStatsManager.formatReport()) {
+        terminalView.println(line);
+    }
+    terminalView.println("");
 }
 
 /*
@@ -5,6 +5,8 @@
 #include "Interfaces/ITerminalView.h"
 #include "Interfaces/IInput.h"
 #include "Services/PinService.h"
+#include "Services/EdgeCaptureService.h"
+#include "Managers/EdgeStatsManager.h"
 #include "Models/TerminalCommand.h"
 #include "States/GlobalState.h"
 #include "Transformers/ArgTransformer.h"
@@ -12,7 +14,8 @@
 class DioController {
 public:
     // Constructor
-    DioController(ITerminalView& terminalView, IInput& terminalInput, PinService& pinService, ArgTransformer& argTransformer);
+    DioController(ITerminalView& terminalView, IInput& terminalInput, PinService& pinService, ArgTransformer& argTransformer,
+                  EdgeCaptureService& edgeCaptureService, EdgeStatsManager& edgeStatsManager);
 
     // Entry point to handle a DIO command
     void handleCommand(const TerminalCommand& cmd);
@@ -22,6 +25,8 @@ private:
     IInput& terminalInput;
     PinService& pinService;
     ArgTransformer& argTransformer;
+    EdgeCaptureService& edgeCaptureService;
+    EdgeStatsManager& edgeStatsManager;
     GlobalState& state = GlobalState::getInstance();
 
     // Read digital value from a pin
@@ -63,6 +68,9 @@ private:
     // Display DIO help info
     void handleHelp();
 
+    // Timestamped edges above this rate would keep the CPU in the interrupt
+    static constexpr uint32_t MaxTimestampedEdgeRate = 100000;
+
     // Check protected pin
     bool isPinAllowed(uint8_t pin, const std::string& context);
 };
\ No newline at end of file
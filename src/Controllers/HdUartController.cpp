@@ -4,9 +4,11 @@
 Constructor
 */
 HdUartController::HdUartController(ITerminalView& terminalView, IInput& terminalInput, IInput& deviceInput,
-                                   HdUartService& hdUartService, UartService& uartService, ArgTransformer& argTransformer, UserInputManager& userInputManager)
+                                   HdUartService& hdUartService, UartService& uartService, ArgTransformer& argTransformer, UserInputManager& userInputManager,
+                                   UartBridgeManager& uartBridgeManager)
     : terminalView(terminalView), terminalInput(terminalInput), deviceInput(deviceInput),
-      hdUartService(hdUartService), uartService(uartService), argTransformer(argTransformer), userInputManager(userInputManager) {}
+      hdUartService(hdUartService), uartService(uartService), argTransformer(argTransformer), userInputManager(userInputManager),
+      uartBridgeManager(uartBridgeManager) {}
 
 /*
 Entry point for HDUART commands
@@ -20,8 +22,8 @@ void HdUartController::handleCommand(const TerminalCommand& cmd) {
 /*
 Entry point for HDUART instructions
 */
-void HdUartController::handleInstruction(const std::vector<ByteCode>& bytecodes) {
-    auto result = hdUartService.executeByteCode(bytecodes);
+void HdUartController::handleInstruction(const ByteCodeProgram& program) {
+    auto result = hdUartService.executeProgram(program);
     terminalView.println("");
     terminalView.print("HDUART Read: ");
     terminalView.println(result.empty() ? "No data" : "\n\n" + result);
@@ -34,33 +36,13 @@ Bridge mode read/write
 void HdUartController::handleBridge() {
     terminalView.println("HDUART Bridge: In progress... Press [ANY ESP32 BUTTON] to stop.");
 
-    std::string echoBuffer;
-
-    while (true) {
-        // Receive UART
-        while (hdUartService.available()) {
-            char incoming = hdUartService.read();
-            if (!echoBuffer.empty() && incoming == echoBuffer.front()) {
-                echoBuffer.erase(0, 1); // Filter for echo line
-            } else {
-                terminalView.print(std::string(1, incoming));
-            }
-        }
-
-        // Terminal input
-        char c = terminalInput.readChar();
-        if (c != KEY_NONE) {
-            hdUartService.write(c);
-            echoBuffer += c; // echo char
-        }
-
-        // Device input
-        c = deviceInput.readChar();
-        if (c != KEY_NONE) {
-            terminalView.println("\nHDUART Bridge: Stopped by user.");
-            break;
-        }
-    }
+    // Single wire, what we send comes back on RX
+    UartBridgeManager::Options options;
+    options.filterEcho = true;
+    UartBridgeStats stats = uartBridgeManager.run(hdUartService, options);
+
+    terminalView.println("\nHDUART Bridge: Stopped by user.");
+    terminalView.println("HDUART Bridge: " + uartBridgeManager.formatStats(stats));
 }
 
 /*
@@ -2,24 +2,26 @@
 
 #include "Interfaces/ITerminalView.h"
 #include "Interfaces/IInput.h"
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
 #include "Models/TerminalCommand.h"
 #include "Services/HdUartService.h"
 #include "Services/UartService.h"
 #include "Transformers/ArgTransformer.h"
 #include "States/GlobalState.h"
 #include "Managers/UserInputManager.h"
+#include "Managers/UartBridgeManager.h"
 
 class HdUartController {
 public:
     HdUartController(ITerminalView& terminalView, IInput& terminalInput, IInput& deviceInput,
-                     HdUartService& hdUartService, UartService& uartService, ArgTransformer& argTransformer, UserInputManager& userInputManager);
+                     HdUartService& hdUartService, UartService& uartService, ArgTransformer& argTransformer, UserInputManager& userInputManager,
+                     UartBridgeManager& uartBridgeManager);
     
     // Entry point for HDUART command
     void handleCommand(const TerminalCommand& cmd);
 
     // Entry point for HDUART instructions
-    void handleInstruction(const std::vector<ByteCode>& bytecodes);
+    void handleInstruction(const ByteCodeProgram& program);
 
     // HDUART config check
     void ensureConfigured();
@@ -32,6 +34,7 @@ private:
     UartService& uartService;
     ArgTransformer& argTransformer;
     UserInputManager& userInputManager;
+    UartBridgeManager& uartBridgeManager;
     GlobalState& state = GlobalState::getInstance();
     
     bool configured = false;
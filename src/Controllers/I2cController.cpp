@@ -7,14 +7,18 @@ I2cController::I2cController(
     ITerminalView& terminalView,
     IInput& terminalInput,
     I2cService& i2cService,
+    LittleFsService& littleFsService,
     ArgTransformer& argTransformer,
+    I2cSniffTransformer& i2cSniffTransformer,
     UserInputManager& userInputManager,
     I2cEepromShell& eepromShell
 )
     : terminalView(terminalView),
       terminalInput(terminalInput),
       i2cService(i2cService),
+      littleFsService(littleFsService),
       argTransformer(argTransformer),
+      i2cSniffTransformer(i2cSniffTransformer),
       userInputManager(userInputManager),
       eepromShell(eepromShell)
 {}
@@ -24,7 +28,7 @@ Entry point to handle I2C command
 */
 void I2cController::handleCommand(const TerminalCommand& cmd) {
     if (cmd.getRoot() == "scan") handleScan();
-    else if (cmd.getRoot() == "sniff") handleSniff();
+    else if (cmd.getRoot() == "sniff") handleSniff(cmd);
     else if (cmd.getRoot() == "ping") handlePing(cmd);
     else if (cmd.getRoot() == "identify") handleIdentify(cmd);
     else if (cmd.getRoot() == "write") handleWrite(cmd);
@@ -43,8 +47,8 @@ void I2cController::handleCommand(const TerminalCommand& cmd) {
 /*
 Entry point to handle I2C instruction
 */
-void I2cController::handleInstruction(const std::vector<ByteCode>& bytecodes) {
-    auto result = i2cService.executeByteCode(bytecodes);
+void I2cController::handleInstruction(const ByteCodeProgram& program) {
+    auto result = i2cService.executeProgram(program);
     if (!result.empty()) {
         terminalView.println("I2C Read:\n");
         terminalView.println(result);
@@ -84,35 +88,102 @@ void I2cController::handleScan() {
 /*
 Sniff
 */    
-void I2cController::handleSniff() {
-    terminalView.println("I2C Sniffer: Listening on SCL/SDA... Press [ENTER] to stop.\n");
+void I2cController::handleSniff(const TerminalCommand& cmd) {
+    // sniff [csv], sniff pcap [file] to LittleFS for Wireshark
+    const std::string& mode = cmd.getSubcommand();
+    bool csv = mode == "csv";
+    bool pcap = mode == "pcap";
+    std::string path = "/i2c.pcap";
+
+    if (pcap) {
+        std::string name = cmd.getArgs();
+        if (!name.empty()) {
+            if (!littleFsService.isSafeRootFileName(name)) {
+                terminalView.println("I2C Sniffer: Invalid file name.");
+                return;
+            }
+            path = "/" + name;
+        }
+        if (!littleFsService.mounted()) {
+            littleFsService.begin();
+        }
+        if (!littleFsService.write(path, i2cSniffTransformer.pcapHeader())) {
+            terminalView.println("I2C Sniffer: Failed to create " + path);
+            return;
+        }
+        terminalView.println("I2C Sniffer: Capturing to " + path + "... Press [ENTER] to stop.\n");
+    } else {
+        terminalView.println("I2C Sniffer: Listening on SCL/SDA... Press [ENTER] to stop.\n");
+        if (csv) terminalView.println(I2cSniffTransformer::csvHeader());
+    }
+
     i2c_sniffer_begin(state.getI2cSclPin(), state.getI2cSdaPin()); // dont need freq to work
     i2c_sniffer_setup();
+    i2cSniffTransformer.setTickRate(i2c_sniffer_tick_rate());
 
-    std::string line;
+    // Transactions are formatted as they complete, output is batched
+    std::string out;
+    I2cSniffManager decoder([&](const I2cTransaction& t) {
+        if (pcap) {
+            i2cSniffTransformer.appendPcapRecord(out, t);
+        } else {
+            out += csv ? i2cSniffTransformer.toCsv(t) : i2cSniffTransformer.toLine(t);
+            out += "\r\n";
+        }
+    });
+
+    I2cSnifferEvent events[64];
+    uint32_t dropped = 0;
+    bool storageFull = false;
+    unsigned long lastStatus = millis();
 
     while (true) {
         char key = terminalInput.readChar();
         if (key == '\r' || key == '\n') break;
 
-        while (i2c_sniffer_available()) {
-            char c = i2c_sniffer_read();
+        size_t n;
+        while ((n = i2c_sniffer_read_events(events, 64)) > 0) {
+            // Drops are flagged on the first event after them, the decoder
+            // closes the open transaction there
+            decoder.add(events, n);
+            dropped = i2c_sniffer_dropped();
+        }
 
-            if (c == '\n') {
-                line += "  ";
-                terminalView.println(line);
-                line.clear();
-            } else {
-                line += c;
+        if (pcap && out.size() >= 4096) {
+            if (littleFsService.freeBytes() < out.size() + 4096 ||
+                !littleFsService.write(path, out, true)) {
+                storageFull = true;
+                break;
             }
+            out.clear();
+        } else if (!pcap && !out.empty()) {
+            terminalView.print(out);
+            out.clear();
+        }
+
+        if (pcap && millis() - lastStatus >= 1000) {
+            terminalView.println("  " + std::to_string(decoder.stats().transactions) + " transactions, " +
+                                 std::to_string(dropped) + " events dropped");
+            lastStatus = millis();
         }
         delayMicroseconds(100);
     }
 
-    i2c_sniffer_reset_buffer();
     i2c_sniffer_stop();
+    size_t rest;
+    while ((rest = i2c_sniffer_read_events(events, 64)) > 0) decoder.add(events, rest);
+    decoder.flush();
+    if (pcap && !out.empty() && !storageFull) littleFsService.write(path, out, true);
+    else if (!pcap && !out.empty()) terminalView.print(out);
+
+    const I2cSniffStats& stats = decoder.stats();
+    i2c_sniffer_reset_buffer();
     i2cService.configure(state.getI2cSdaPin(), state.getI2cSclPin(), state.getI2cFrequency());
-    terminalView.println("\n\nI2C Sniffer: Stopped.");
+
+    if (storageFull) terminalView.println("\nI2C Sniffer: Storage full, capture stopped.");
+    terminalView.println("\n\nI2C Sniffer: Stopped. " + std::to_string(stats.transactions) + " transactions, " +
+                         std::to_string(stats.bytes) + " bytes, " + std::to_string(stats.nacks) + " NACKs, " +
+                         std::to_string(stats.incomplete) + " incomplete, " + std::to_string(dropped) + " events dropped");
 }
 
 /*
@@ -266,6 +337,10 @@ void I2cController::handleConfig() {
     state.setI2cSclPin(scl);
 
     uint32_t freq = userInputManager.readValidatedUint32("Frequency", state.getI2cFrequency());
+    if (freq > I2cService::MaxFrequency) {
+        freq = I2cService::MaxFrequency;
+        terminalView.println("I2C: Frequency limited to 1 MHz (Fast-mode Plus).");
+    }
     state.setI2cFrequency(freq);
 
     i2cService.configure(sda, scl, freq);
@@ -351,159 +426,112 @@ void I2cController::handleDump(const TerminalCommand& cmd) {
         len = argTransformer.parseHexOrDec16(args[0]);
     }
 
-    std::vector<uint8_t> values(len, 0xFF);
-    std::vector<bool> valid(len, false);
+    I2cDumpOptions options;
+    options.address = addr;
+    options.start = start;
+    options.length = len;
+    options.maxChunk = i2cService.maxReadChunk();
 
     // Device registers are readable
     if (i2cService.isReadableDevice(addr, start)) {
         terminalView.println("I2C Dump: 0x" + argTransformer.toHex(addr) +
                              " from 0x" + argTransformer.toHex(start) +
                              " for " + std::to_string(len) + " bytes... Press [ENTER] to stop.\n");
-
-        performRegisterRead(addr, start, len, values, valid);
+        options.addressBytes = (start + len - 1) > 0xFF ? 2 : 1;
 
     // Not readable
     } else {
         terminalView.println("I2C Dump: Device at 0x" + argTransformer.toHex(addr) +
                              " may not use standard register access — trying raw read...");
-
-        performRawRead(addr, start, len, values, valid);
+        options.addressBytes = 0;
     }
 
+    // Lines are printed while the next chunks are read
+    I2cHexLineStream lines(start);
+    auto printLine = [&](const std::string& line) { terminalView.println(line); };
+    bool anyValid = false;
+    I2cDumpStats stats;
+
+    uint32_t startUs = micros();
+    I2cDumpEngine::dump(i2cService, options,
+        [&](uint32_t reg, const uint8_t* data, size_t count) {
+            anyValid = anyValid || data;
+            lines.add(reg, data, count, printLine);
+        },
+        [&]() { return isCancelRequested(); },
+        stats);
+    stats.elapsedUs = micros() - startUs;
+
     // Not able to read any data
-    if (std::all_of(valid.begin(), valid.end(), [](bool b) { return !b; })) {
+    if (!anyValid) {
         terminalView.println("I2C Dump: Unable to read any data — device NACKed or unsupported protocol.\n");
         return;
     }
 
-    printHexDump(start, len, values, valid);
+    lines.finish(printLine);
+    terminalView.println("");
+
+    if (stats.cancelled) {
+        terminalView.println("I2C Dump: Cancelled by user.");
+    } else if (stats.aborted) {
+        terminalView.println("I2C Dump: Aborted after 3 consecutive errors.");
+    }
+
+    char summary[96];
+    snprintf(summary, sizeof(summary), "I2C Dump: %u bytes in %.1f ms (%.1f kB/s), chunk %u, %u NACKs\n",
+             (unsigned)stats.bytesRead, stats.elapsedUs / 1000.0, stats.bytesPerSecond() / 1000.0,
+             (unsigned)stats.lastChunk, (unsigned)stats.nacks);
+    terminalView.println(summary);
 }
 
 void I2cController::performRegisterRead(uint8_t addr, uint16_t start, uint16_t len,
                                         std::vector<uint8_t>& values, std::vector<bool>& valid) {
-    const uint8_t CHUNK_SIZE = 16;
-    const bool use16bitAddr = (start + len - 1) > 0xFF;
-    int consecutiveErrors = 0;
-
-    for (uint16_t offset = 0; offset < len; offset += CHUNK_SIZE) {
-        if (consecutiveErrors >= 3) {
-            terminalView.println("I2C Dump: Aborted after 3 consecutive errors.");
-            return;
-        }
-
-        uint16_t reg = start + offset;
-        uint8_t toRead = (offset + CHUNK_SIZE <= len) ? CHUNK_SIZE : (len - offset);
-
-        // Write register address (1 or 2 bytes)
-        i2cService.beginTransmission(addr);
-        if (use16bitAddr) {
-            i2cService.write((reg >> 8) & 0xFF); // MSB
-            i2cService.write(reg & 0xFF);        // LSB
-        } else {
-            i2cService.write((uint8_t)(reg & 0xFF));
-        }
-        bool writeOk = (i2cService.endTransmission(false) == 0);  // No stop
-        if (!writeOk) {
-            consecutiveErrors++;
-            continue;
-        }
-
-        // Read chunk
-        uint8_t received = i2cService.requestFrom(addr, toRead, true);
-        if (received == toRead) {
-            for (uint8_t i = 0; i < toRead; ++i) {
-                char key = terminalInput.readChar();
-                if (key == '\r' || key == '\n') {
-                    terminalView.println("I2C Dump: Cancelled by user.");
-                    return;
-                }
-
-                if (i2cService.available()) {
-                    values[offset + i] = i2cService.read();
-                    valid[offset + i] = true;
-                }
-            }
-            consecutiveErrors = 0;
-        } else {
-            while (i2cService.available()) i2cService.read();  // Flush
-            consecutiveErrors++;
-        }
-
-        delay(1);
-    }
+    const uint8_t addressBytes = (start + len - 1) > 0xFF ? 2 : 1;
+    performChunkedRead(addr, start, len, addressBytes, values, valid);
 }
 
 void I2cController::performRawRead(uint8_t addr, uint16_t start,
                                    uint16_t len,
                                    std::vector<uint8_t>& values,
                                    std::vector<bool>& valid) {
-    values.assign(len, 0xFF);
-    valid.assign(len, false);
-
     terminalView.println("I2C Dump: Trying read raw...");
-
-    // Write start register
-    i2cService.beginTransmission(addr);
-    i2cService.write(start);
-    if (i2cService.endTransmission(false) != 0) {
-        return;  // NACK
-    }
-
-    // Read len from register addr
-    uint16_t received = i2cService.requestFrom(addr, (uint8_t)len, true);
-    for (uint16_t i = 0; i < received && i < len; ++i) {
-        auto key = terminalInput.readChar();
-        if (key == '\r' || key == '\n') {
-            terminalView.println("I2C Dump: Cancelled by user.");
-            return;
-        }
-        if (i2cService.available()) {
-            values[i] = i2cService.read();
-            valid[i] = true;
-        }
-    }
-
-    while (i2cService.available()) i2cService.read();
+    performChunkedRead(addr, start, len, 0, values, valid);
 }
 
-void I2cController::printHexDump(uint16_t start, uint16_t len,
-                                 const std::vector<uint8_t>& values, const std::vector<bool>& valid) {
-    for (uint16_t lineStart = 0; lineStart < len; lineStart += 16) {
-        std::string line;
-        char addrStr[8];
-        snprintf(addrStr, sizeof(addrStr), "%02X:", start + lineStart);
-        line += addrStr;
-
-        for (uint8_t i = 0; i < 16; ++i) {
-            uint16_t idx = lineStart + i;
-            if (idx < len) {
-                if (valid[idx]) {
-                    char hex[4];
-                    snprintf(hex, sizeof(hex), " %02X", values[idx]);
-                    line += hex;
-                } else {
-                    line += " ??";
-                }
-            } else {
-                line += "   ";
-            }
-        }
-
-        line += "  ";
+void I2cController::performChunkedRead(uint8_t addr, uint16_t start, uint16_t len, uint8_t addressBytes,
+                                       std::vector<uint8_t>& values, std::vector<bool>& valid) {
+    values.assign(len, 0xFF);
+    valid.assign(len, false);
 
-        for (uint8_t i = 0; i < 16; ++i) {
-            uint16_t idx = lineStart + i;
-            if (idx < len && valid[idx]) {
-                char c = values[idx];
-                line += (c >= 32 && c <= 126) ? c : '.';
-            } else {
-                line += '.';
+    I2cDumpOptions options;
+    options.address = addr;
+    options.start = start;
+    options.length = len;
+    options.addressBytes = addressBytes;
+    options.maxChunk = i2cService.maxReadChunk();
+
+    I2cDumpStats stats;
+    I2cDumpEngine::dump(i2cService, options,
+        [&](uint32_t reg, const uint8_t* data, size_t count) {
+            if (!data) return;
+            for (size_t i = 0; i < count; ++i) {
+                values[reg - start + i] = data[i];
+                valid[reg - start + i] = true;
             }
-        }
+        },
+        [&]() { return isCancelRequested(); },
+        stats);
 
-        terminalView.println(line);
+    if (stats.cancelled) {
+        terminalView.println("I2C Dump: Cancelled by user.");
+    } else if (stats.aborted) {
+        terminalView.println("I2C Dump: Aborted after 3 consecutive errors.");
     }
-    terminalView.println("");
+}
+
+bool I2cController::isCancelRequested() {
+    char key = terminalInput.readChar();
+    return key == '\r' || key == '\n';
 }
 
 /*
@@ -774,7 +802,8 @@ void I2cController::handleHelp() {
     terminalView.println("  scan");
     terminalView.println("  ping <addr>");
     terminalView.println("  identify <addr>");
-    terminalView.println("  sniff");
+    terminalView.println("  sniff [csv]");
+    terminalView.println("  sniff pcap [file]");
     terminalView.println("  slave <addr>");
     terminalView.println("  read <addr> <reg>");
     terminalView.println("  write <addr> <reg> <val>");
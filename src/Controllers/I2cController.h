@@ -6,11 +6,15 @@
 #include "Interfaces/ITerminalView.h"
 #include "Interfaces/IInput.h"
 #include "Services/I2cService.h"
+#include "Services/I2cDumpEngine.h"
+#include "Services/LittleFsService.h"
 #include "Models/TerminalCommand.h"
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
 #include "States/GlobalState.h"
 #include "Transformers/ArgTransformer.h"
+#include "Transformers/I2cSniffTransformer.h"
 #include "Managers/UserInputManager.h"
+#include "Managers/I2cSniffManager.h"
 #include "Vendors/i2c_sniffer.h"
 #include "Shells/I2cEepromShell.h"
 #include "Data/I2cKnownAdresses.h"
@@ -18,13 +22,13 @@
 class I2cController {
 public:
     // Constructor
-    I2cController(ITerminalView& terminalView, IInput& terminalInput, I2cService& i2cService, ArgTransformer& argTransformer, UserInputManager& userInputManager, I2cEepromShell& eepromShell);
+    I2cController(ITerminalView& terminalView, IInput& terminalInput, I2cService& i2cService, LittleFsService& littleFsService, ArgTransformer& argTransformer, I2cSniffTransformer& i2cSniffTransformer, UserInputManager& userInputManager, I2cEepromShell& eepromShell);
 
     // Entry point for I2C command
     void handleCommand(const TerminalCommand& cmd);
 
     // Entry point for compiled bytecode instructions
-    void handleInstruction(const std::vector<ByteCode>& bytecodes);
+    void handleInstruction(const ByteCodeProgram& program);
 
     // Ensure I2C is configured before use
     void ensureConfigured();
@@ -33,7 +37,9 @@ private:
     ITerminalView& terminalView;
     IInput& terminalInput;
     I2cService& i2cService;
+    LittleFsService& littleFsService;
     ArgTransformer& argTransformer;
+    I2cSniffTransformer& i2cSniffTransformer;
     UserInputManager& userInputManager;
     I2cEepromShell& eepromShell;
     GlobalState& state = GlobalState::getInstance();
@@ -46,7 +52,7 @@ private:
     void handleScan();
 
     // Start sniffing I2C traffic passively
-    void handleSniff();
+    void handleSniff(const TerminalCommand& cmd);
 
     // Read data from an I2C device
     void handleRead(const TerminalCommand& cmd);
@@ -87,6 +93,9 @@ private:
                             std::vector<uint8_t>& values, std::vector<bool>& valid);
     void performRawRead(uint8_t addr, uint16_t, uint16_t len,
                         std::vector<uint8_t>& values, std::vector<bool>& valid);
-    void printHexDump(uint16_t, uint16_t len,
-                    const std::vector<uint8_t>& values, const std::vector<bool>& valid);
+    void performChunkedRead(uint8_t addr, uint16_t start, uint16_t len, uint8_t addressBytes,
+                            std::vector<uint8_t>& values, std::vector<bool>& valid);
+
+    // ENTER pressed, polled once per chunk
+    bool isCancelRequested();
 };
@@ -21,6 +21,7 @@ public:
 
     // Ensore I2S config before any action
     void ensureConfigured();
+    void markConfigured() { configured = true; }
 
 private:
     // Configure I2S pins and parameters interactively
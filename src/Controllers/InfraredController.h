@@ -30,6 +30,7 @@ public:
 
     // Ensure infrared is properly configured
     void ensureConfigured();
+    void markConfigured() { configured = true; }
 
 private:
     ITerminalView& terminalView;
@@ -55,38 +55,45 @@ void JtagController::handleScanJtag() {
     terminalView.println("JTAG: Scanning for JTAG devices...");
 
     std::vector<uint8_t> jtagCandidates = state.getJtagScanPins();
-    uint8_t tdi, tdo, tck, tms;
-    int trst;
-    std::vector<uint32_t> ids;
+    JtagPinout pinout;
+    JtagScanStats stats;
 
     bool found = jtagService.scanJtagDevice(
         jtagCandidates,
-        tdi, tdo, tck, tms, trst,
-        ids,
-        true, // detect pullup
+        pinout,
+        stats,
+        true, // exhaustive BYPASS search if no IDCODE
         nullptr // callback progression
     );
 
     if (found) {
         terminalView.println("\n JTAG device(s) found!");
-        terminalView.println("  • TDI   : GPIO " + std::to_string(tdi));
-        terminalView.println("  • TDO   : GPIO " + std::to_string(tdo));
-        terminalView.println("  • TCK   : GPIO " + std::to_string(tck));
-        terminalView.println("  • TMS   : GPIO " + std::to_string(tms));
-        if (trst >= 0) {
-            terminalView.println("  • TRST  : GPIO " + std::to_string(trst));
+        if (pinout.tdi != JtagScanEngine::NoPin) {
+            terminalView.println("  • TDI   : GPIO " + std::to_string(pinout.tdi));
+        } else {
+            terminalView.println("  • TDI   : not found (IDCODE only)");
+        }
+        terminalView.println("  • TDO   : GPIO " + std::to_string(pinout.tdo));
+        terminalView.println("  • TCK   : GPIO " + std::to_string(pinout.tck));
+        terminalView.println("  • TMS   : GPIO " + std::to_string(pinout.tms));
+        if (pinout.trst >= 0) {
+            terminalView.println("  • TRST  : GPIO " + std::to_string(pinout.trst));
         }
 
-        for (size_t i = 0; i < ids.size(); ++i) {
+        for (size_t i = 0; i < pinout.ids.size(); ++i) {
             char buf[11];
-            snprintf(buf, sizeof(buf), "0x%08X", ids[i]);
+            snprintf(buf, sizeof(buf), "0x%08X", pinout.ids[i]);
             terminalView.println("  • IDCODE[" + std::to_string(i) + "] : " + buf);
         }
-
-        terminalView.println("  ✅ Scan complete.\n");
     } else {
         terminalView.println("\nJTAG: No device found on available GPIOs.");
     }
+
+    char line[96];
+    snprintf(line, sizeof(line), "  • Tried %u permutations in %u ms (%.0f/s)",
+             (unsigned)stats.permutations(), (unsigned)(stats.elapsedUs / 1000), stats.permutationsPerSecond());
+    terminalView.println(line);
+    if (found) terminalView.println("  ✅ Scan complete.\n");
 }
 
 /*
@@ -17,6 +17,7 @@ public:
 
     // Ensure configuration is done before running commands
     void ensureConfigured();
+    void markConfigured() { configured = true; }
 
 private:
     ITerminalView& terminalView;
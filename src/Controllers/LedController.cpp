@@ -45,7 +45,7 @@ void LedController::handleCommand(const TerminalCommand& cmd) {
 /*
 Instructions
 */
-void LedController::handleInstruction(const std::vector<ByteCode>& bytecodes) {
+void LedController::handleInstruction(const ByteCodeProgram& program) {
     terminalView.println("[ERROR] LED instructions not implemented.");
 }
 
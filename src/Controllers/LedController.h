@@ -4,7 +4,7 @@
 #include "Interfaces/ITerminalView.h"
 #include "Interfaces/IInput.h"
 #include "Models/TerminalCommand.h"
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
 #include "Services/LedService.h"
 #include "Transformers/ArgTransformer.h"
 #include "Managers/UserInputManager.h"
@@ -20,10 +20,11 @@ public:
     void handleCommand(const TerminalCommand& cmd);
 
     // Execute LED instruction from bytecode
-    void handleInstruction(const std::vector<ByteCode>& bytecodes);
+    void handleInstruction(const ByteCodeProgram& program);
 
     // Ensure LED mode is properly configured before use
     void ensureConfigured();
+    void markConfigured() { configured = true; }
 
 private:
     // Try to autodetect LED protocol by scanning different types
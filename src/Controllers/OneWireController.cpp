@@ -40,8 +40,8 @@ void OneWireController::handleCommand(const TerminalCommand& command) {
 /*
 Entry point for instructions
 */
-void OneWireController::handleInstruction(std::vector<ByteCode>& bytecodes) {
-    auto result = oneWireService.executeByteCode(bytecodes);
+void OneWireController::handleInstruction(const ByteCodeProgram& program) {
+    auto result = oneWireService.executeProgram(program);
     if (!result.empty()) {
         terminalView.println("OneWire Read:\n");
         terminalView.println(result);
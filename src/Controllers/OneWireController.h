@@ -29,7 +29,7 @@ public:
     void handleCommand(const TerminalCommand& cmd);
 
     // Entry point for handle parsed bytecode instructions
-    void handleInstruction(std::vector<ByteCode>& bytecodes);
+    void handleInstruction(const ByteCodeProgram& program);
 
     // Ensure initialized/configured
     void ensureConfigured();
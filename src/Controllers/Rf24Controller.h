@@ -36,6 +36,7 @@ public:
 
     // Ensure NRF24 is configured before use
     void ensureConfigured();
+    void markConfigured() { configured = true; }
 
 private:
     // Command handlers
@@ -26,6 +26,7 @@ public:
 
     // Ensure the PN532 is configured
     void ensureConfigured();
+    void markConfigured() { configured = true; }
 
 private:
     // Command handlers
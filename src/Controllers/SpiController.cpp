@@ -36,8 +36,8 @@ void SpiController::handleCommand(const TerminalCommand& cmd) {
 /*
 Entry point for instructions
 */
-void SpiController::handleInstruction(const std::vector<ByteCode>& bytecodes) {
-    auto result = spiService.executeByteCode(bytecodes);
+void SpiController::handleInstruction(const ByteCodeProgram& program) {
+    auto result = spiService.executeProgram(program);
     if (!result.empty()) {
         terminalView.println("SPI Read:\n");
         terminalView.println(result);
@@ -59,6 +59,7 @@ void SpiController::handleSniff() {
     std::vector<std::string> choices = { " MOSI", " MISO" };
     int choice = userInputManager.readValidatedChoiceIndex("Select line to sniff", choices, 0);
     bool sniffMosi = (choice == 0);
+    int transactionSize = userInputManager.readValidatedInt("Max bytes per transaction", 64, 4, SLAVE_MAX_TRANSACTION);
 
     // Pins
     int sclk = state.getSpiCLKPin();
@@ -83,29 +84,27 @@ void SpiController::handleSniff() {
     terminalView.println("");
 
     // Launch SPI slave on the selected line
-    spiService.startSlave(sclk, slaveMisoPin, slaveMosiPin, cs);
+    if (!spiService.startSlave(sclk, slaveMisoPin, slaveMosiPin, cs, transactionSize)) {
+        terminalView.println("SPI Sniffer: Not enough DMA memory, try a smaller transaction size.\n");
+        spiService.configure(mosi, miso, sclk, cs, state.getSpiFrequency());
+        return;
+    }
 
-    // Log data until user stops
+    // Log data until user stops, the batch storage is reused
     const char* tag = sniffMosi ? "[MOSI] " : "[MISO] ";
+    RecordBatch batch;
+    uint32_t transactions = 0;
     while (true) {
         char c = terminalInput.readChar();
         if (c == '\n' || c == '\r') break;
 
-        auto packets = spiService.getSlaveData();
-        for (const auto& packet : packets) {
-            if (packet.empty()) continue;
-            std::stringstream ss;
-            ss << tag;
-            for (uint8_t b : packet) {
-                ss << std::hex << std::uppercase
-                   << std::setw(2) << std::setfill('0') << (int)b << " ";
-            }
-            terminalView.println(ss.str());
-        }
+        transactions += spiService.getSlaveData(batch);
+        printSlaveRecords(batch, tag);
     }
 
     terminalView.println("\nSPI Sniffer: Stopping... Please wait.");
     spiService.stopSlave(sclk, slaveMisoPin, slaveMosiPin, cs);
+    printSlaveStats(transactions);
     spiService.end();
     spiService.configure(mosi, miso, sclk, cs, state.getSpiFrequency());
     terminalView.println("SPI Sniffer: Stopped by user.\n");
@@ -144,8 +143,14 @@ void SpiController::handleSlave() {
     int mosi = state.getSpiMOSIPin();
     int cs   = state.getSpiCSPin();
 
+    int transactionSize = userInputManager.readValidatedInt("Max bytes per transaction", 64, 4, SLAVE_MAX_TRANSACTION);
+
+    if (!spiService.startSlave(sclk, miso, mosi, cs, transactionSize)) {
+        terminalView.println("SPI Slave: Not enough DMA memory, try a smaller transaction size.\n");
+        spiService.configure(mosi, miso, sclk, cs, state.getSpiFrequency());
+        return;
+    }
     terminalView.println("SPI Slave: In progress... Press [ENTER] to stop.");
-    spiService.startSlave(sclk, miso, mosi, cs);
 
     terminalView.println("");
     terminalView.println("  [INFO]");
@@ -154,28 +159,50 @@ void SpiController::handleSlave() {
     terminalView.println("    Data is only captured when CS (chip select) is active.");
     terminalView.println("");
 
+    RecordBatch batch;
+    uint32_t transactions = 0;
     while (true) {
         char c = terminalInput.readChar();
         if (c == '\n' || c == '\r') break;
 
         // Read slave data from master
-        auto packets = spiService.getSlaveData();
-        for (const auto& packet : packets) {
-            std::stringstream ss;
-            ss << "[MOSI] ";
-            for (uint8_t b : packet) {
-                ss << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << (int)b << " ";
-            }
-            terminalView.println(ss.str());
-        }
+        transactions += spiService.getSlaveData(batch);
+        printSlaveRecords(batch, "[MOSI] ");
     }
     terminalView.println("\nSPI Slave: Stopping... Please wait.");
     spiService.stopSlave(sclk, miso, mosi, cs);
+    printSlaveStats(transactions);
     spiService.end();
     spiService.configure(mosi, miso, sclk, cs, state.getSpiFrequency());
     terminalView.println("SPI Slave: Stopped by user.\n");
 }
 
+/*
+Slave records
+*/
+void SpiController::printSlaveRecords(const RecordBatch& batch, const char* tag) {
+    static const char hex[] = "0123456789ABCDEF";
+
+    for (const auto& record : batch.records) {
+        if (record.length == 0) continue;
+
+        const uint8_t* data = batch.data(record);
+        std::string line(tag);
+        line.reserve(line.size() + record.length * 3 + 4);
+        for (size_t i = 0; i < record.length; ++i) {
+            line += hex[data[i] >> 4];
+            line += hex[data[i] & 0x0F];
+            line += ' ';
+        }
+        terminalView.println(line);
+    }
+}
+
+void SpiController::printSlaveStats(uint32_t transactions) {
+    terminalView.println("  " + std::to_string(transactions) + " transactions, " +
+                         std::to_string(spiService.getSlaveDroppedCount()) + " dropped (buffer full)");
+}
+
 /*
 SD Card
 */
@@ -6,7 +6,7 @@
 #include "Services/SdService.h"
 #include "Interfaces/IInput.h"
 #include "Models/TerminalCommand.h"
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
 #include "Transformers/ArgTransformer.h"
 #include "Managers/UserInputManager.h"
 #include "Shells/SdCardShell.h"
@@ -34,7 +34,7 @@ public:
     void handleCommand(const TerminalCommand& cmd);
 
     // Entry point for handle parsed instruction bytecodes
-    void handleInstruction(const std::vector<ByteCode>& bytecodes);
+    void handleInstruction(const ByteCodeProgram& program);
 
     // Ensure SPI is properly configured before use
     void ensureConfigured();
@@ -68,6 +68,12 @@ private:
     // Slave mode
     void handleSlave();
 
+    // Print captured slave transactions, one line each
+    void printSlaveRecords(const RecordBatch& batch, const char* tag);
+
+    // Captured and dropped counts
+    void printSlaveStats(uint32_t transactions);
+
     // Configure SPI bus parameters
     void handleConfig();
 
@@ -1,4 +1,6 @@
 #include "SubGhzController.h"
+#include <esp_timer.h>
+#include <cmath>
 
 /*
 Entry point for commands
@@ -25,7 +27,12 @@ void SubGhzController::handleCommand(const TerminalCommand& cmd) {
 /*
 Sniff for signals
 */
-void SubGhzController::handleSniff(const TerminalCommand&) {
+void SubGhzController::handleSniff(const TerminalCommand& cmd) {
+    if (cmd.getSubcommand() == "save") {
+        handleSniffSave(cmd);
+        return;
+    }
+
     float f = state.getSubGhzFrequency();
     uint32_t count = 0;
 
@@ -33,9 +40,19 @@ void SubGhzController::handleSniff(const TerminalCommand&) {
         terminalView.println("SUBGHZ: Not detected. Run 'config' first.");
         return;
     }
-    
+
+    // Blocks wait here until printed, the RMT ring is emptied at once
+    size_t items = 16384;
+    uint32_t* buffer = subGhzService.allocateCaptureBuffer(items);
+    if (!buffer) {
+        terminalView.println("SUBGHZ Sniff: Not enough memory.");
+        return;
+    }
+    SubGhzCaptureManager capture(buffer, items, RMT_1US_TICKS);
+    uint32_t skipped = 0, dropped = 0, overflows = 0;
+
     terminalView.println("SUBGHZ Sniff: Frequency @ " + std::to_string(f) + " MHz... Press [ENTER] to stop\n");
-    
+
     subGhzService.startRawSniffer(state.getSubGhzGdoPin());
     while (true) {
         char c = terminalInput.readChar();
@@ -43,20 +60,141 @@ void SubGhzController::handleSniff(const TerminalCommand&) {
             break;
         }
 
-        auto [line, pulseCount] = subGhzService.readRawPulses();
-        if (pulseCount > 8) { // ignore too short frames, likely noise
-            count += pulseCount;
-            terminalView.println(line);
-        }
+        while (subGhzService.readRawBlock([&](const uint32_t* block, size_t n) {
+            if (n <= 8) return; // ignore too short frames, likely noise
+            if (capture.addFrame(block, n, (uint64_t)esp_timer_get_time())) count += n;
+            else dropped++;
+        })) {}
 
         if (subGhzService.isSnifferOverflowing()) {
+            overflows++;
             terminalView.println("\n[WARNING] SUBGHZ Sniffer: Overflow detected! Draining buffer...\n");
             subGhzService.drainSniffer();
         }
+
+        // Format what arrived, only the latest frame when the terminal falls behind
+        size_t frames = capture.frameCount();
+        if (frames) {
+            size_t first = frames > 8 ? frames - 1 : 0;
+            skipped += first;
+            std::string out;
+            for (size_t i = first; i < frames; ++i) capture.formatFrame(i, f, out);
+            terminalView.println(out);
+            capture.reset();
+        }
     }
     subGhzService.stopRawSniffer();
+    subGhzService.freeCaptureBuffer(buffer);
+
+    terminalView.println("\nSUBGHZ Sniff: Stopped by user. " + std::to_string(count) + " pulses, " +
+                         std::to_string(skipped) + " frames not shown, " +
+                         std::to_string(dropped + overflows) + " dropped\n");
+}
+
+/*
+Sniff to a Flipper .sub RAW file
+*/
+void SubGhzController::handleSniffSave(const TerminalCommand& cmd) {
+    std::string path = "/capture.sub";
+    std::string name = cmd.getArgs();
+    if (!name.empty()) {
+        if (name.size() < 4 || name.compare(name.size() - 4, 4, ".sub") != 0) name += ".sub";
+        if (!littleFsService.isSafeRootFileName(name)) {
+            terminalView.println("SUBGHZ Sniff: Invalid file name.");
+            return;
+        }
+        path = "/" + name;
+    }
+    if (!littleFsService.mounted()) {
+        littleFsService.begin();
+    }
 
-    terminalView.println("\nSUBGHZ Sniff: Stopped by user. " + std::to_string(count) + " pulses\n");
+    float f = state.getSubGhzFrequency();
+    if (!subGhzService.applySniffProfile(f)) {
+        terminalView.println("SUBGHZ: Not detected. Run 'config' first.");
+        return;
+    }
+
+    // 1 MB in PSRAM, about a minute of busy OOK traffic
+    size_t items = 262144;
+    uint32_t* buffer = subGhzService.allocateCaptureBuffer(items);
+    if (!buffer) {
+        terminalView.println("SUBGHZ Sniff: Not enough memory.");
+        return;
+    }
+    SubGhzCaptureManager capture(buffer, items, RMT_1US_TICKS);
+    uint32_t overflows = 0;
+
+    terminalView.println("SUBGHZ Sniff: Capturing @ " + std::to_string(f) + " MHz to " + path +
+                         " (" + std::to_string(items) + " items)... Press [ENTER] to stop\n");
+
+    subGhzService.startRawSniffer(state.getSubGhzGdoPin());
+    unsigned long lastStatus = millis();
+    while (true) {
+        char c = terminalInput.readChar();
+        if (c == '\n' || c == '\r') break;
+
+        while (subGhzService.readRawBlock([&](const uint32_t* block, size_t n) {
+            if (n > 8) capture.addFrame(block, n, (uint64_t)esp_timer_get_time());
+        })) {}
+
+        if (subGhzService.isSnifferOverflowing()) {
+            overflows++;
+            subGhzService.drainSniffer();
+        }
+
+        if (capture.full()) {
+            terminalView.println("SUBGHZ Sniff: Capture buffer full.");
+            break;
+        }
+
+        if (millis() - lastStatus >= 1000) {
+            terminalView.println("  " + std::to_string(capture.frameCount()) + " frames, " +
+                                 std::to_string(capture.itemCount()) + " items, " +
+                                 std::to_string(capture.durationUs() / 1000) + " ms");
+            lastStatus = millis();
+        }
+        delay(1);
+    }
+    subGhzService.stopRawSniffer();
+
+    // Format now, written in blocks
+    std::string out = subGhzTransformer.rawFileHeader((uint32_t)llround((double)f * 1e6), "");
+    std::vector<int32_t> line;
+    line.reserve(SubGhzTransformer::TimingsPerLine);
+    size_t fileBytes = 0, timings = 0;
+    bool ok = littleFsService.write(path, "");
+
+    capture.forEachTiming([&](int32_t t) {
+        line.push_back(t);
+        timings++;
+        if (line.size() == SubGhzTransformer::TimingsPerLine) {
+            subGhzTransformer.appendRawDataLine(out, line.data(), line.size());
+            line.clear();
+        }
+        if (ok && out.size() >= 4096) {
+            ok = littleFsService.freeBytes() > out.size() + 4096 && littleFsService.write(path, out, true);
+            if (ok) fileBytes += out.size();
+            out.clear();
+        }
+    });
+    subGhzTransformer.appendRawDataLine(out, line.data(), line.size());
+    if (ok) ok = littleFsService.write(path, out, true);
+    if (ok) fileBytes += out.size();
+
+    const uint64_t durationMs = capture.durationUs() / 1000;
+    const std::string summary = std::to_string(capture.frameCount()) + " frames, " +
+                                std::to_string(timings) + " timings over " + std::to_string(durationMs) + " ms, " +
+                                std::to_string(capture.droppedFrames()) + " frames dropped, " +
+                                std::to_string(overflows) + " RMT overflows";
+    subGhzService.freeCaptureBuffer(buffer);
+
+    if (!ok) {
+        terminalView.println("\nSUBGHZ Sniff: Failed to write " + path + " (LittleFS full?). " + summary + "\n");
+        return;
+    }
+    terminalView.println("\nSUBGHZ Sniff: " + summary + ".");
+    terminalView.println("Saved " + path + " (" + std::to_string(fileBytes) + " bytes), send it with 'load'.\n");
 }
 
 /*
@@ -843,7 +981,7 @@ void SubGhzController::handleHelp() {
     terminalView.println("SubGHz commands:");
     terminalView.println("  scan");
     terminalView.println("  sweep");
-    terminalView.println("  sniff");
+    terminalView.println("  sniff [save <file>]");
     terminalView.println("  decode");
     terminalView.println("  replay");
     terminalView.println("  jam");
@@ -14,6 +14,7 @@
 #include "Transformers/SubGhzTransformer.h"
 #include "Managers/UserInputManager.h"
 #include "Managers/SubGhzAnalyzeManager.h"
+#include "Managers/SubGhzCaptureManager.h"
 #include "States/GlobalState.h"
 #include "Services/SubGhzService.h"
 #include "Services/PinService.h"
@@ -51,11 +52,15 @@ public:
 
     // Ensure subghz mode is properly configured before use
     void ensureConfigured();
+    void markConfigured() { configured = true; }
 
 private:
     // Sniff for signals
     void handleSniff(const TerminalCommand& cmd);
 
+    // Capture to a Flipper .sub RAW file on LittleFS
+    void handleSniffSave(const TerminalCommand& cmd);
+
     // Scan for frequencies
     void handleScan(const TerminalCommand& cmd);
 
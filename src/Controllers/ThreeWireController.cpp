@@ -29,7 +29,7 @@ void ThreeWireController::handleCommand(const TerminalCommand& cmd) {
 /*
 Entry point for instructions
 */
-void ThreeWireController::handleInstruction(const std::vector<ByteCode>& bytecodes) {
+void ThreeWireController::handleInstruction(const ByteCodeProgram& program) {
     terminalView.println("Instruction handling not yet implemented");
 }
 
@@ -9,7 +9,7 @@
 #include "Services/ThreeWireService.h"
 #include "Interfaces/IInput.h"
 #include "Models/TerminalCommand.h"
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
 #include "Managers/UserInputManager.h"
 #include "Transformers/ArgTransformer.h"
 #include "Shells/ThreeWireEepromShell.h"
@@ -29,7 +29,7 @@ public:
     void handleCommand(const TerminalCommand& cmd);
 
     // Entry point for instruction handling
-    void handleInstruction(const std::vector<ByteCode>& bytecodes);
+    void handleInstruction(const ByteCodeProgram& program);
 
     // Ensure configured before any action
     void ensureConfigured();
@@ -31,7 +31,7 @@ void TwoWireController::handleCommand(const TerminalCommand& cmd) {
 /*
 Entry point for 2WIRE instruction
 */
-void TwoWireController::handleInstruction(const std::vector<ByteCode>& bytecodes) {
+void TwoWireController::handleInstruction(const ByteCodeProgram& program) {
     terminalView.println("[TODO] Instruction support for 2WIRE not yet implemented.");
 }
 
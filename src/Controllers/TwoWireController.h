@@ -5,7 +5,7 @@
 #include "Services/SpiService.h" 
 #include "Interfaces/IInput.h"
 #include "Models/TerminalCommand.h"
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
 #include "Services/TwoWireService.h"
 #include "Managers/UserInputManager.h"
 #include "States/GlobalState.h"
@@ -26,7 +26,7 @@ public:
     void handleCommand(const TerminalCommand& cmd);
 
     // Entry point for handle compiled bytecode instructions
-    void handleInstruction(const std::vector<ByteCode>& bytecodes);
+    void handleInstruction(const ByteCodeProgram& program);
 
     // Ensure 2WIRE is configured before use
     void ensureConfigured();
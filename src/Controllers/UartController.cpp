@@ -12,6 +12,7 @@ UartController::UartController(
     HdUartService& hdUartService,
     ArgTransformer& argTransformer,
     UserInputManager& userInputManager,
+    UartBridgeManager& uartBridgeManager,
     UartAtShell& uartAtShell
 )
     : terminalView(terminalView),
@@ -22,6 +23,7 @@ UartController::UartController(
       hdUartService(hdUartService),
       argTransformer(argTransformer),
       userInputManager(userInputManager),
+      uartBridgeManager(uartBridgeManager),
       uartAtShell(uartAtShell) 
 {}
 
@@ -46,8 +48,8 @@ void UartController::handleCommand(const TerminalCommand& cmd) {
 /*
 Entry point for instructions
 */
-void UartController::handleInstruction(const std::vector<ByteCode>& bytecodes) {
-    auto result = uartService.executeByteCode(bytecodes);
+void UartController::handleInstruction(const ByteCodeProgram& program) {
+    auto result = uartService.executeProgram(program);
     terminalView.println("");
     terminalView.print("UART Read: ");
     if (!result.empty()) {
@@ -66,26 +68,12 @@ Bridge
 */
 void UartController::handleBridge() {
     terminalView.println("Uart Bridge: In progress... Press [ANY ESP32 BUTTON] to stop.\n");
-    while (true) {
-        // Read from UART and print to terminal
-        if (uartService.available()) {
-            char c = uartService.read();
-            terminalView.print(std::string(1, c));
-        }
 
-        // Read from user input and write to UART
-        char c = terminalInput.readChar();
-        if (c != KEY_NONE) {
-            uartService.write(c);
-        }
-        
-        // Read from device input and stop bridge if any
-        c = deviceInput.readChar();
-        if (c != KEY_NONE) {  
-            terminalView.println("\nUart Bridge: Stopped by user.");
-            break;
-        }
-    }
+    UartBridgeManager::Options options;
+    UartBridgeStats stats = uartBridgeManager.run(uartService, options);
+
+    terminalView.println("\nUart Bridge: Stopped by user.");
+    terminalView.println("Uart Bridge: " + uartBridgeManager.formatStats(stats));
 }
 
 /*
@@ -95,21 +83,16 @@ void UartController::handleRead() {
     terminalView.println("UART Read: Streaming until [ENTER] is pressed...");
     uartService.flush();
 
-    while (true) {
-        // Stop if ENTER is pressed
-        char key = terminalInput.readChar();
-        if (key == '\r' || key == '\n') {
-            terminalView.println("");
-            terminalView.println("UART Read: Stopped by user.");
-            break;
-        }
+    // Stream UART data as it comes, until ENTER
+    UartBridgeManager::Options options;
+    options.forwardInput = false;
+    options.stopOnEnter = true;
+    options.stopOnDeviceInput = false;
+    UartBridgeStats stats = uartBridgeManager.run(uartService, options);
 
-        // Print UART data as it comes
-        while (uartService.available() > 0) {
-            char c = uartService.read();
-            terminalView.print(std::string(1, c));
-        }
-    }
+    terminalView.println("");
+    terminalView.println("UART Read: Stopped by user.");
+    terminalView.println("UART Read: " + uartBridgeManager.formatStats(stats));
 }
 
 /*
@@ -4,7 +4,7 @@
 #include <string>
 #include "HardwareSerial.h"
 #include "Models/TerminalCommand.h"
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
 #include "Services/UartService.h"
 #include "Services/HdUartService.h"
 #include "Services/SdService.h"
@@ -13,6 +13,7 @@
 #include "States/GlobalState.h"
 #include "Transformers/ArgTransformer.h"
 #include "Managers/UserInputManager.h"
+#include "Managers/UartBridgeManager.h"
 #include "Shells/UartAtShell.h"
 
 class UartController {
@@ -26,13 +27,14 @@ public:
                    HdUartService& hdUartService, 
                    ArgTransformer& argTransformer,
                    UserInputManager& userInputManager,
+                   UartBridgeManager& uartBridgeManager,
                    UartAtShell& uartAtShell);
     
     // Entry point for UART command
     void handleCommand(const TerminalCommand& cmd);
 
     //  Entry point for handle parsed bytecode instructions
-    void handleInstruction(const std::vector<ByteCode>& bytecodes);
+    void handleInstruction(const ByteCodeProgram& program);
     
     // Ensure UART is configured before use
     void ensureConfigured();
@@ -103,6 +105,7 @@ private:
     HdUartService& hdUartService;
     ArgTransformer& argTransformer;
     UserInputManager& userInputManager;
+    UartBridgeManager& uartBridgeManager;
     UartAtShell& uartAtShell;
     GlobalState& state = GlobalState::getInstance();
     bool configured = false;
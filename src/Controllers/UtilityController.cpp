@@ -10,7 +10,9 @@ UtilityController::UtilityController(
     PinService& pinService,
     UserInputManager& userInputManager,
     ArgTransformer& argTransformer,
-    SysInfoShell& sysInfoShell
+    SysInfoShell& sysInfoShell,
+    LogicAnalyzerShell& logicAnalyzerShell,
+    RpcShell& rpcShell
 )
     : terminalView(terminalView),
       deviceView(deviceView),
@@ -18,7 +20,9 @@ UtilityController::UtilityController(
       pinService(pinService),
       userInputManager(userInputManager),
       argTransformer(argTransformer),
-      sysInfoShell(sysInfoShell)
+      sysInfoShell(sysInfoShell),
+      logicAnalyzerShell(logicAnalyzerShell),
+      rpcShell(rpcShell)
 {}
 
 /*
@@ -30,6 +34,7 @@ void UtilityController::handleCommand(const TerminalCommand& cmd) {
     else if (cmd.getRoot() == "p")                                               handleDisablePullups();
     else if (cmd.getRoot() == "logic")                                           handleLogicAnalyzer(cmd);
     else if (cmd.getRoot() == "system")                                          handleSystem();
+    else if (cmd.getRoot() == "binary")                                          rpcShell.run();
     else {
         terminalView.println("Unknown command. Try 'help'.");
     }
@@ -207,8 +212,18 @@ void UtilityController::handleEnablePullups() {
 Logic
 */
 void UtilityController::handleLogicAnalyzer(const TerminalCommand& cmd) {
+    if (cmd.getSubcommand() == "capture") {
+        logicAnalyzerShell.run();
+        return;
+    }
+    if (cmd.getSubcommand() == "sump") {
+        logicAnalyzerShell.runSump();
+        return;
+    }
     if (cmd.getSubcommand().empty() || !argTransformer.isValidNumber(cmd.getSubcommand())) {
         terminalView.println("Usage: logic <pin>");
+        terminalView.println("       logic capture");
+        terminalView.println("       logic sump");
         return;
     }
 
@@ -274,7 +289,11 @@ void UtilityController::handleHelp() {
     terminalView.println("  help                 - Show this help");
     terminalView.println("  system               - Show system infos");
     terminalView.println("  mode <name>          - Set active mode");
+    terminalView.println("  run <file>, (file)   - Run a script from LittleFS");
     terminalView.println("  logic <pin>          - Logic analyzer");
+    terminalView.println("  logic capture        - Capture up to 8 pins");
+    terminalView.println("  logic sump           - SUMP for PulseView/OLS");
+    terminalView.println("  binary               - Framed RPC for host scripts");
     terminalView.println("  P                    - Enable pull-up");
     terminalView.println("  p                    - Disable pull-up");
 
@@ -427,8 +446,8 @@ void UtilityController::handleHelp() {
     terminalView.println("  scan                 - List Wi-Fi networks");
     terminalView.println("  connect              - Connect to a network");
     terminalView.println("  ping <host>          - Ping a remote host");
-    terminalView.println("  discovery            - Discover network devices");
-    terminalView.println("  sniff                - Monitor Wi-Fi packets");
+    terminalView.println("  discovery [cidr]     - Discover network devices");
+    terminalView.println("  sniff [pcap <file>]  - Monitor Wi-Fi packets");
     terminalView.println("  probe                - Search for net access");
     terminalView.println("  spoof ap <mac>       - Spoof AP MAC");
     terminalView.println("  spoof sta <mac>      - Spoof Station MAC");
@@ -475,7 +494,7 @@ void UtilityController::handleHelp() {
     terminalView.println("  connect              - Connect using DHCP");
     terminalView.println("  status               - Show ETH status");
     terminalView.println("  ping <host>          - Ping a remote host");
-    terminalView.println("  discovery            - Discover network devices");
+    terminalView.println("  discovery [cidr]     - Discover network devices");
     terminalView.println("  ssh <h> <u> <p> [p]  - Open SSH session");
     terminalView.println("  telnet <host> [port] - Open telnet session");
     terminalView.println("  nc <host> <port>     - Open netcat session");
@@ -537,5 +556,5 @@ bool UtilityController::isGlobalCommand(const TerminalCommand& cmd) {
 
     return (root == "mode"  || root == "m" || root == "l" ||
             root == "logic" || root == "P" || root == "p") || 
-            root == "system";
+            root == "system" || root == "binary";
 }
\ No newline at end of file
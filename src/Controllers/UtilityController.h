@@ -15,6 +15,8 @@
 #include "Managers/UserInputManager.h"
 #include "Transformers/ArgTransformer.h"
 #include "Shells/SysInfoShell.h"
+#include "Shells/LogicAnalyzerShell.h"
+#include "Shells/RpcShell.h"
 
 class UtilityController {
 public:
@@ -26,7 +28,9 @@ public:
         PinService& pinService, 
         UserInputManager& userInputManager, 
         ArgTransformer& argTransformer,
-        SysInfoShell& sysInfoShell
+        SysInfoShell& sysInfoShell,
+        LogicAnalyzerShell& logicAnalyzerShell,
+        RpcShell& rpcShell
     );
 
     // Entry point for global utility commands
@@ -35,7 +39,7 @@ public:
     // Process mode change command and return new mode
     ModeEnum handleModeChangeCommand(const TerminalCommand& cmd);
 
-    // Loic Analyzer on device screen
+    // Logic analyzer, live trace on the device screen or capture shell
     void handleLogicAnalyzer(const TerminalCommand& cmd);
 
     // Check if a command is a global utility command
@@ -64,5 +68,7 @@ private:
     UserInputManager& userInputManager;
     ArgTransformer& argTransformer;
     SysInfoShell& sysInfoShell;
+    LogicAnalyzerShell& logicAnalyzerShell;
+    RpcShell& rpcShell;
     GlobalState& state = GlobalState::getInstance();
 };
\ No newline at end of file
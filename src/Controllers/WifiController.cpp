@@ -342,14 +342,46 @@ Sniff
 */
 void WifiController::handleSniff(const TerminalCommand &cmd)
 {
-    terminalView.println("WiFi Sniffing started... Press [ENTER] to stop.\n");
+    // sniff pcap [file], capture to LittleFS instead of the terminal
+    bool pcap = cmd.getSubcommand() == "pcap";
+    std::string path = "/sniff.pcap";
+    if (pcap) {
+        std::string name = cmd.getArgs();
+        if (!name.empty()) {
+            if (!littleFsService.isSafeRootFileName(name)) {
+                terminalView.println("WiFi Sniff: Invalid file name.");
+                return;
+            }
+            path = "/" + name;
+        }
+        if (!littleFsService.mounted()) {
+            littleFsService.begin();
+        }
+        if (!littleFsService.write(path, wifiSniffTransformer.pcapHeader())) {
+            terminalView.println("WiFi Sniff: Failed to create " + path);
+            return;
+        }
+        terminalView.println("WiFi Sniffing to " + path + "... Press [ENTER] to stop.\n");
+    } else {
+        terminalView.println("WiFi Sniffing started... Press [ENTER] to stop.\n");
+    }
 
-    wifiService.startPassiveSniffing();
+    if (!wifiService.startPassiveSniffing()) {
+        terminalView.println("WiFi Sniff: Not enough memory for the frame buffer.\n");
+        return;
+    }
     wifiService.switchChannel(1);
 
+    std::vector<WifiSniffRecord> batch(16);
+    std::string out;
+    uint32_t frames = 0;
+    size_t fileBytes = 24; // pcap header
+    bool storageFull = false;
+
     uint8_t channel = 1;
     unsigned long lastHop = 0;
     unsigned long lastPull = 0;
+    unsigned long lastStatus = millis();
 
     while (true)
     {
@@ -358,17 +390,50 @@ void WifiController::handleSniff(const TerminalCommand &cmd)
         if (key == '\r' || key == '\n')
             break;
 
-        // Read sniff data
+        // Drain the capture ring, format here, not in the WiFi task
         if (millis() - lastPull > 20)
         {
-            auto logs = wifiService.getSniffLog();
-            for (const auto &line : logs)
+            size_t n;
+            while ((n = wifiService.readSniffRecords(batch.data(), batch.size())) > 0)
             {
-                terminalView.println(line);
+                for (size_t i = 0; i < n; ++i) {
+                    if (pcap) {
+                        wifiSniffTransformer.appendPcapRecord(out, batch[i]);
+                    } else {
+                        out += wifiSniffTransformer.toLine(batch[i]);
+                        out += "\r\n";
+                    }
+                }
+                frames += n;
+            }
+
+            if (!pcap && !out.empty()) {
+                terminalView.print(out);
+                out.clear();
             }
             lastPull = millis();
         }
 
+        // Write in blocks, the file is reopened on each write
+        if (pcap && out.size() >= 4096)
+        {
+            if (littleFsService.freeBytes() < out.size() + 4096 ||
+                !littleFsService.write(path, out, true)) {
+                storageFull = true;
+                break;
+            }
+            fileBytes += out.size();
+            out.clear();
+        }
+
+        if (pcap && millis() - lastStatus >= 1000)
+        {
+            terminalView.println("  " + std::to_string(frames) + " frames, " +
+                                 std::to_string(wifiService.getSniffDropCount()) + " dropped, " +
+                                 std::to_string(fileBytes / 1024) + " KB");
+            lastStatus = millis();
+        }
+
         // Switch channel every 100ms
         if (millis() - lastHop > 100)
         {
@@ -380,8 +445,19 @@ void WifiController::handleSniff(const TerminalCommand &cmd)
         delay(5);
     }
 
+    uint32_t dropped = wifiService.getSniffDropCount();
     wifiService.stopPassiveSniffing();
-    terminalView.println("WiFi Sniffing stopped.\n");
+
+    if (pcap && !out.empty() && !storageFull && littleFsService.write(path, out, true)) {
+        fileBytes += out.size();
+    }
+
+    if (storageFull) terminalView.println("WiFi Sniff: LittleFS is full.");
+    terminalView.println("WiFi Sniffing stopped. " + std::to_string(frames) + " frames, " +
+                         std::to_string(dropped) + " dropped.");
+    if (pcap) {
+        terminalView.println("Saved " + path + " (" + std::to_string(fileBytes) + " bytes), open it in Wireshark.\n");
+    }
 }
 
 /*
@@ -478,7 +554,7 @@ void WifiController::handleHelp()
     terminalView.println("WiFi commands:");
     terminalView.println("  scan");
     terminalView.println("  connect");;
-    terminalView.println("  sniff");
+    terminalView.println("  sniff [pcap <file>]");
     terminalView.println("  probe");
     terminalView.println("  spoof sta <mac>");
     terminalView.println("  spoof ap <mac>");
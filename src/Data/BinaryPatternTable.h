@@ -0,0 +1,1116 @@
+#pragma once
+
+#include <cstdint>
+#include "Data/BinaryPatterns.h"
+
+// Aho-Corasick automaton of binaryPatterns, 247 states x 66 byte classes.
+// Generated by the native tests, do not edit:
+// PATTERN_TABLE_REGEN=1 pio test -e native
+
+static const uint8_t binaryPatternByteClass[256] = {
+    48, 0, 0, 39, 40, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 51, 36, 0, 0, 45, 0, 0, 37,
+    7, 0, 50, 56, 0, 62, 0, 34, 54, 0, 0, 0, 0, 1, 0, 31,
+    0, 22, 20, 65, 0, 21, 0, 41, 61, 23, 27, 0, 0, 26, 0, 0,
+    0, 10, 2, 16, 19, 3, 17, 4, 18, 5, 0, 14, 28, 30, 6, 25,
+    11, 52, 8, 9, 13, 29, 12, 24, 47, 15, 42, 0, 64, 49, 0, 32,
+    0, 10, 2, 16, 19, 3, 17, 4, 18, 5, 0, 14, 28, 30, 6, 25,
+    11, 52, 8, 9, 13, 29, 12, 24, 47, 15, 42, 63, 0, 0, 0, 33,
+    0, 0, 0, 0, 0, 55, 0, 0, 0, 58, 0, 38, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 43, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 59,
+};
+
+static const uint16_t binaryPatternNext[16302] = {
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 2, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 3, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 4, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 5, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 5, 6, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 7,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 207, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 8, 233, 132, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 184, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 9, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 10, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 204, 107, 234, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 11, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 12, 64,
+    102, 32, 0, 0, 0, 0, 48, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 237, 0, 0,
+    236, 13, 243, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 65, 14, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 218, 0,
+    0, 187, 0, 194, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 15, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 103,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 16, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 17, 64, 79, 78, 0, 0, 159, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 87, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 18, 0, 0, 236, 64, 243, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    19, 0, 0, 0, 124, 238, 107, 234, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    20, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 21, 0, 0, 124, 118, 107, 103, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 22, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 132, 23, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 184, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 24, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 25, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 132, 0, 236, 64, 102, 78, 0, 0,
+    0, 26, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 184, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 27, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 28, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 29, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 30, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 31, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 5,
+    6, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 33, 64, 79, 78, 0, 0, 159, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 87, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 34, 0, 0, 236, 64, 243, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    35, 0, 0, 0, 124, 238, 107, 234, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    36, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 37, 0, 0, 124, 118, 107, 103, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 38, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 132, 39, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 184, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 40, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 41, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 132, 0, 236, 64, 102, 78, 0, 0,
+    0, 42, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 184, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 43, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 44, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 45, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 46, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 47, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 5,
+    6, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 49, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 125, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 132, 0, 50, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 184, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 237, 0, 0, 236, 64, 243, 78,
+    0, 51, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 52, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 53, 107, 234, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 54,
+    0, 0, 236, 64, 102, 78, 0, 119, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 55, 118, 107, 234,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 56, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 125, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 57, 0, 0,
+    124, 118, 107, 103, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 58, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 59, 206, 131, 202, 233, 132, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 184, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 60, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 61, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 62, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 63, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 5,
+    6, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 65, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 218, 0, 0, 187, 0, 194, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 65, 102, 78, 0, 0,
+    0, 0, 124, 118, 66, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 218, 0, 0, 187, 0, 194, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 67, 206, 131, 202, 233, 0, 0, 236, 181, 102, 78,
+    0, 108, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 138, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 2, 206, 71, 202, 233, 0, 0, 68, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 237, 0, 0,
+    236, 69, 243, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 65, 70, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 218, 0,
+    0, 187, 0, 194, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 103,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 132, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 72, 0, 0, 0, 0, 0, 0, 184, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 143, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 73, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 74, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 75, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 76, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 77,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 79, 78, 0, 0, 159, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 87, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 80, 102, 78, 0, 135, 0, 0, 124, 118,
+    107, 103, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 81, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 218, 0, 0, 187, 0, 194, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 65, 102, 78, 0, 0,
+    0, 0, 124, 118, 66, 142, 0, 0, 0, 0, 82, 0, 0, 90, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 218, 0, 0, 187, 0, 194, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 83, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 84, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 237, 0, 0,
+    236, 64, 243, 78, 0, 0, 0, 0, 124, 118, 107, 85, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 143, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 86, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 88, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 143, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 89, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 92,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 93, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 94,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 95, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 204, 107, 234,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 96, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 191, 131, 202, 233, 0, 0, 236, 98, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 99, 202, 233, 0, 0, 236, 65, 102, 78,
+    0, 240, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 218, 0, 0, 187, 0, 194, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 132, 0, 100, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    184, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 237, 0, 0,
+    236, 64, 243, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 101, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 103,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 143, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 104, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 105, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 106, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 234, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 181,
+    102, 78, 0, 108, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 138,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 109, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 110, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 114, 79, 78, 0, 0, 159, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 87, 0, 0, 111, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 112, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 113,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 65, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 115,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 218, 0, 0, 187, 0, 194, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 116, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 117, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 119, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 120, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 79, 78, 0, 0, 159, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 87, 0, 0, 121, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 122, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 123, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 125, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    126, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 127, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 128, 0, 0, 236, 64, 102, 78, 0, 119, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 129, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 234, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 203, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 130, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 132, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    184, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 133, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 134, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    136, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 181, 102, 78, 0, 108, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 138, 137, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 139, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 140, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 132, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 141, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 185,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 143,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 132, 0, 236, 64, 102, 78, 144, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 184, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 145, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 146, 118, 107, 234, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 147, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 125, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 132, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    148, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 185, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 150, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 132, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 184, 0, 151, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 152,
+    107, 142, 0, 0, 0, 0, 0, 92, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 119, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 154, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 155, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 156, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    158, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 160, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 161, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 178, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 163, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 164, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 165, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 166, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 154,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 167, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 169, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 170, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 164,
+    0, 0, 168, 171, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    172, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 173, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 175, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 176, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 178, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 179, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 180, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 65, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 182, 0,
+    0, 187, 0, 194, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 183, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 219, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 65, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 218, 0, 0, 187, 0, 194, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 185, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 186, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 188, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 189,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 190, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 192, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 207, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 234, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 193, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 196, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 197, 0,
+    236, 64, 79, 78, 0, 0, 159, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    87, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 198, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 203, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 200, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 201, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 200, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 203, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 204, 107, 234, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 119, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 205, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 207, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 209, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 79, 78, 0, 0,
+    159, 0, 124, 118, 107, 210, 0, 0, 0, 0, 87, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 143, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 211, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 212, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 119, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 2, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 214, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 215, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 237, 0, 0, 236, 64, 243, 78, 0, 216, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 217, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 119,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    219, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 220, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 92,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 221, 0, 0, 124, 118, 107, 234, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 222, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 132, 223, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 184, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 224,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 119, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 225, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 226, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 237, 0, 0, 236, 64, 243, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 227, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    228, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 229, 0, 0, 124, 118, 107, 103, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 230, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 231, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 232, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 234, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 143, 202, 233, 0, 0, 236, 64, 102, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 235, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 237, 0, 0,
+    236, 64, 243, 78, 0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 64, 102, 78, 0, 0, 0, 0, 124, 238, 107, 234, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 64, 102, 78, 0, 119, 0, 0, 124, 239, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1,
+    206, 131, 202, 233, 0, 0, 236, 64, 102, 78, 0, 119, 0, 0, 124, 118,
+    107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149,
+    153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174,
+    0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0,
+    0, 1, 206, 131, 202, 233, 0, 0, 236, 64, 241, 78, 0, 0, 0, 0,
+    124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0,
+    0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0,
+    0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0, 208, 213,
+    0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 242, 64, 102, 78, 0, 0,
+    0, 0, 124, 118, 107, 103, 0, 0, 0, 0, 0, 0, 0, 0, 91, 97,
+    0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0, 0, 0,
+    168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199, 0, 0,
+    208, 213, 0, 0, 0, 1, 206, 131, 202, 237, 0, 0, 236, 64, 243, 78,
+    0, 0, 0, 0, 124, 118, 107, 142, 0, 0, 0, 0, 0, 0, 0, 0,
+    91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162, 0, 0,
+    0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0, 195, 199,
+    0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0, 236, 64,
+    102, 78, 0, 0, 0, 0, 124, 244, 107, 103, 0, 0, 0, 0, 0, 0,
+    0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0, 177, 162,
+    0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187, 0, 0,
+    195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233, 0, 0,
+    236, 64, 102, 78, 0, 119, 0, 0, 124, 245, 107, 142, 0, 0, 0, 0,
+    0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157, 0, 0,
+    177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0, 0, 187,
+    0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131, 202, 233,
+    0, 0, 236, 246, 102, 78, 0, 119, 0, 0, 124, 118, 107, 142, 0, 0,
+    0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0, 0, 157,
+    0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0, 0, 0,
+    0, 187, 0, 0, 195, 199, 0, 0, 208, 213, 0, 0, 0, 1, 206, 131,
+    202, 233, 0, 0, 236, 65, 102, 78, 0, 0, 0, 0, 124, 118, 107, 142,
+    0, 0, 0, 0, 0, 0, 0, 0, 91, 97, 0, 0, 0, 149, 153, 0,
+    0, 157, 0, 0, 177, 162, 0, 0, 0, 0, 168, 0, 0, 174, 0, 0,
+    218, 0, 0, 187, 0, 194, 195, 199, 0, 0, 208, 213, 0, 0,
+};
+
+static const uint16_t binaryPatternOutput[247] = {
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 31,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 47,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 63,
+    65535, 65535, 65535, 65535, 65535, 65535, 70, 65535, 65535, 65535, 65535, 65535, 65535, 77, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 86, 65535, 65535, 89, 90, 65535, 65535, 65535, 65535, 65535,
+    96, 65535, 65535, 65535, 65535, 101, 65535, 65535, 65535, 65535, 106, 65535, 65535, 65535, 65535, 65535,
+    65535, 113, 65535, 65535, 65535, 117, 65535, 65535, 65535, 65535, 65535, 123, 65535, 65535, 65535, 65535,
+    65535, 65535, 130, 65535, 65535, 65535, 134, 65535, 65535, 137, 65535, 65535, 65535, 141, 65535, 65535,
+    65535, 65535, 65535, 65535, 148, 65535, 65535, 65535, 152, 65535, 65535, 65535, 156, 65535, 158, 65535,
+    65535, 161, 65535, 65535, 65535, 65535, 65535, 167, 65535, 65535, 65535, 65535, 65535, 173, 65535, 65535,
+    176, 65535, 65535, 65535, 180, 65535, 65535, 183, 65535, 65535, 186, 65535, 65535, 65535, 190, 65535,
+    65535, 193, 194, 65535, 65535, 65535, 198, 65535, 65535, 201, 65535, 65535, 65535, 205, 65535, 207,
+    65535, 65535, 65535, 65535, 212, 65535, 65535, 65535, 65535, 217, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 232, 65535, 65535, 235, 65535, 65535, 65535, 239,
+    65535, 65535, 242, 65535, 65535, 65535, 246,
+};
+
+static const uint16_t binaryPatternOutputLink[247] = {
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535,
+};
+
+static const uint8_t binaryPatternMatch[247] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 6, 7, 0, 0, 0, 0, 0,
+    8, 0, 0, 0, 0, 9, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0,
+    0, 11, 0, 0, 0, 12, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0,
+    0, 0, 14, 0, 0, 0, 15, 0, 0, 16, 0, 0, 0, 17, 0, 0,
+    0, 0, 0, 0, 18, 0, 0, 0, 19, 0, 0, 0, 20, 0, 21, 0,
+    0, 22, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 24, 0, 0,
+    25, 0, 0, 0, 26, 0, 0, 27, 0, 0, 28, 0, 0, 0, 29, 0,
+    0, 30, 31, 0, 0, 0, 32, 0, 0, 33, 0, 0, 0, 34, 0, 35,
+    0, 0, 0, 0, 36, 0, 0, 0, 0, 37, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 39, 0, 0, 0, 40,
+    0, 0, 42, 0, 0, 0, 43,
+};
+
+static const PatternTable binaryPatternTable = {
+    binaryPatternByteClass,
+    binaryPatternNext,
+    binaryPatternOutput,
+    binaryPatternOutputLink,
+    binaryPatternMatch,
+    binaryPatterns,
+    247, 66, 44
+};
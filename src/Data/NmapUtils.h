@@ -24,6 +24,7 @@ struct NmapOptions {
     bool hasTrash = false;  // Did user pass non-option tokens?
     bool help = false;      // -h or --help
     bool pingOnly = false;  // -sn
+    int timing = 3;         // -T0..-T5
 };
 
 enum class Layer4Protocol
@@ -1,5 +1,38 @@
 #include "ActionDispatcher.h"
 
+namespace {
+
+// Script steps run straight on the mode service, quietly, the bytes read go
+// back to the script
+struct DispatcherScriptHost : IScriptHost {
+    DependencyProvider& provider;
+    ActionDispatcher& dispatcher;
+
+    DispatcherScriptHost(DependencyProvider& provider, ActionDispatcher& dispatcher)
+        : provider(provider), dispatcher(dispatcher) {}
+
+    bool runInstruction(const ByteCodeProgram& program, std::vector<uint8_t>& read) override {
+        // A script command may have changed the mode
+        switch (GlobalState::getInstance().getCurrentMode()) {
+            case ModeEnum::OneWire: provider.getOneWireService().executeProgram(program, read); return true;
+            case ModeEnum::I2C:     provider.getI2cService().executeProgram(program, read); return true;
+            case ModeEnum::SPI:     provider.getSpiService().executeProgram(program, read); return true;
+            case ModeEnum::UART:    provider.getUartService().executeProgram(program, read); return true;
+            case ModeEnum::HDUART:  provider.getHdUartService().executeProgram(program, read); return true;
+            default: return false;
+        }
+    }
+
+    void runCommand(const std::string& line) override { dispatcher.dispatch(line); }
+    void print(const std::string& text) override { provider.getTerminalView().println(text); }
+    void delayMs(uint32_t ms) override { delay(ms); }
+
+    // Any key stops the script
+    bool stopRequested() override { return provider.getTerminalInput().readChar() != KEY_NONE; }
+};
+
+} // namespace
+
 /*
 Constructor
 */
@@ -50,14 +83,15 @@ void ActionDispatcher::dispatch(const std::string& raw) {
 
     // Instructions
     if (first == '[' || first == '>' || first == '{') {
-        std::vector<Instruction> instructions = provider.getInstructionTransformer().transform(raw);
-        dispatchInstructions(instructions);
+        provider.getInstructionTransformer().compile(raw, program);
+        dispatchInstructions(program);
         return;
     }
 
-    // Macros
+    // Macros, (file) runs a script like 'run file'
     if (first == '(') {
-        provider.getTerminalView().println("Macros Not Yet Implemented.");
+        size_t close = raw.find(')');
+        runScript(raw.substr(1, close == std::string::npos ? std::string::npos : close - 1));
         return;
     }
 
@@ -70,6 +104,12 @@ void ActionDispatcher::dispatch(const std::string& raw) {
 Dispatch Command
 */
 void ActionDispatcher::dispatchCommand(const TerminalCommand& cmd) {
+    // Script, in any mode
+    if (cmd.getRoot() == "run") {
+        runScript(cmd.getSubcommand());
+        return;
+    }
+
     // Mode change command
     if (cmd.getRoot() == "mode" || cmd.getRoot() == "m") {
         ModeEnum maybeNewMode = provider.getUtilityController().handleModeChangeCommand(cmd);
@@ -86,6 +126,10 @@ void ActionDispatcher::dispatchCommand(const TerminalCommand& cmd) {
             // hack to rerender the pinout view after logic analyzer cmd
             setCurrentMode(state.getCurrentMode());
         } 
+        if (cmd.getRoot() == "binary") {
+            // Binary mode may have moved the pins to another bus, set the mode up again
+            setCurrentMode(state.getCurrentMode());
+        }
         return;
     }
 
@@ -169,54 +213,100 @@ void ActionDispatcher::dispatchCommand(const TerminalCommand& cmd) {
 /*
 Dispatch Instructions
 */
-void ActionDispatcher::dispatchInstructions(const std::vector<Instruction>& instructions) {
-    // Convert raw instructions into bytecodes vector
-    auto bytecodes = provider.getInstructionTransformer().transformByteCodes(instructions);
-
+void ActionDispatcher::dispatchInstructions(const ByteCodeProgram& program) {
     switch (state.getCurrentMode()) {
         case ModeEnum::OneWire:
-            provider.getOneWireController().handleInstruction(bytecodes);
+            provider.getOneWireController().handleInstruction(program);
             break;
         case ModeEnum::UART:
-            provider.getUartController().handleInstruction(bytecodes);
+            provider.getUartController().handleInstruction(program);
             break;
         case ModeEnum::HDUART:
-            provider.getHdUartController().handleInstruction(bytecodes);
+            provider.getHdUartController().handleInstruction(program);
             break;
         case ModeEnum::I2C:
-            provider.getI2cController().handleInstruction(bytecodes);
+            provider.getI2cController().handleInstruction(program);
             break;
         case ModeEnum::SPI:
-            provider.getSpiController().handleInstruction(bytecodes);
+            provider.getSpiController().handleInstruction(program);
             break;
         case ModeEnum::TwoWire:
-            provider.getTwoWireController().handleInstruction(bytecodes);
+            provider.getTwoWireController().handleInstruction(program);
             break;
         case ModeEnum::ThreeWire:
-            provider.getThreeWireController().handleInstruction(bytecodes);
+            provider.getThreeWireController().handleInstruction(program);
             break;
         case ModeEnum::LED:
-            provider.getLedController().handleInstruction(bytecodes);
+            provider.getLedController().handleInstruction(program);
             break;
         default:
             provider.getTerminalView().println("Cannot execute instruction in this mode.");
             return;
     }
 
-    // Line by line bytecode
+    // Step by step bytecode, written spans shown by their first bytes
     provider.getTerminalView().println("");
     provider.getTerminalView().println("ByteCode Sequence:");
-    for (const auto& code : bytecodes) {
-        provider.getTerminalView().println(
-            ByteCodeEnumMapper::toString(code.getCommand()) +
-            " | data=" + std::to_string(code.getData()) +
-            " | bits=" + std::to_string(code.getBits()) +
-            " | repeat=" + std::to_string(code.getRepeat())
-        );
+    for (const auto& op : program.ops()) {
+        std::string line = ByteCodeEnumMapper::toString(op.command) + " | count=" + std::to_string(op.count);
+        if (op.command == ByteCodeEnum::Write) {
+            uint32_t shown = std::min<uint32_t>(op.count, 16);
+            line += " | data=";
+            ByteCodeEngine::appendHex(line, program.bytes(op), shown);
+            if (shown < op.count) line += "...";
+        }
+        provider.getTerminalView().println(line);
     }
     provider.getTerminalView().println("");
 }
 
+/*
+Run Script
+*/
+void ActionDispatcher::runScript(const std::string& name) {
+    auto& view = provider.getTerminalView();
+    if (name.empty()) {
+        view.println("Usage: run <file> or (file)");
+        return;
+    }
+    if (scriptRunning) {
+        view.println("Script: cannot run a script from a script.");
+        return;
+    }
+
+    std::string path = name[0] == '/' ? name : "/" + name;
+    auto& littleFsService = provider.getLittleFsService();
+    if (!littleFsService.mounted()) {
+        littleFsService.begin();
+    }
+
+    // Compiled once, reused while the file does not change
+    std::string source, error;
+    if (!littleFsService.readAll(path, source)) {
+        view.println("Script: cannot read " + path);
+        return;
+    }
+    const Script* script = provider.getScriptEngine().load(path, source, error);
+    if (!script) {
+        view.println("Script: " + path + " " + error);
+        return;
+    }
+
+    view.println("Script: running " + path + ", press any key to stop.");
+    DispatcherScriptHost host(provider, *this);
+    scriptRunning = true;
+    uint32_t startUs = micros();
+    ScriptRunStats stats = provider.getScriptEngine().run(*script, host);
+    uint32_t elapsedUs = micros() - startUs;
+    scriptRunning = false;
+
+    if (!stats.error.empty()) view.println("Script: " + stats.error);
+    else if (stats.stopped) view.println("Script: stopped by user.");
+    view.println("Script done: " + std::to_string(stats.steps) + " steps, " +
+                 std::to_string(stats.instructions) + " instructions, " +
+                 std::to_string(elapsedUs / 1000) + " ms");
+}
+
 /*
 User Action
 */
@@ -230,6 +320,16 @@ std::string ActionDispatcher::getUserAction() {
         char c = provider.getTerminalInput().readChar();
         if (c == KEY_NONE) continue;
 
+        // A frame start on an empty line enters binary mode, never typed
+        if (c == (char)RpcFrameTransformer::Magic0 && inputLine.empty() &&
+            state.getTerminalMode() == TerminalTypeEnum::Serial) {
+            const uint8_t first = RpcFrameTransformer::Magic0;
+            provider.getRpcShell().run(&first, 1);
+            // Binary mode may have moved the pins to another bus, set the mode up again
+            setCurrentMode(state.getCurrentMode());
+            return "";
+        }
+
         if (handleCardputerEscapeSequence(c, cursorIndex, inputLine, mode)) continue;
         if (handleEscapeSequence(c, inputLine, cursorIndex, mode)) continue;
         if (handleEnterKey(c, inputLine)) return inputLine;
@@ -368,6 +468,9 @@ void ActionDispatcher::setCurrentMode(ModeEnum newMode) {
     config.setMode(ModeEnumMapper::toString(newMode));
     auto proto = InfraredProtocolMapper::toString(state.getInfraredProtocol());
 
+    // Give the heap of the mode left back before the new one is built
+    provider.releaseModules(newMode);
+
     switch (newMode) {
         case ModeEnum::HIZ:
             provider.disableAllProtocols();
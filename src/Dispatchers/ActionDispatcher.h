@@ -3,7 +3,8 @@
 #include <string>
 #include <vector>
 #include "Models/TerminalCommand.h"
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
+#include "Services/ByteCodeEngine.h"
 #include "Transformers/InstructionTransformer.h"
 #include "Enums/ModeEnum.h"
 #include "Providers/DependencyProvider.h"
@@ -28,12 +29,17 @@ public:
 private:
     DependencyProvider& provider;
     GlobalState& state = GlobalState::getInstance();
+    ByteCodeProgram program;    // reused by every instruction line
+    bool scriptRunning = false;
 
     // Handle a command
     void dispatchCommand(const TerminalCommand& cmd);
 
-    // Handle a sequence of bytecode instructions
-    void dispatchInstructions(const std::vector<Instruction>& instructions);
+    // Handle a compiled instruction line
+    void dispatchInstructions(const ByteCodeProgram& program);
+
+    // Load a script file from LittleFS and run it
+    void runScript(const std::string& path);
 
     // Read user input with cursor support
     std::string getUserAction();
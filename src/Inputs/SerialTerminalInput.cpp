@@ -16,4 +16,10 @@ char SerialTerminalInput::readChar() {
         return Serial.read();
     }
     return KEY_NONE;
-}
\ No newline at end of file
+}
+
+size_t SerialTerminalInput::readChars(char* dst, size_t len) {
+    size_t avail = Serial.available();
+    if (len > avail) len = avail;
+    return len ? Serial.read(reinterpret_cast<uint8_t*>(dst), len) : 0;
+}
@@ -9,4 +9,5 @@ public:
     char handler() override;
     void waitPress() override;
     char readChar() override;
+    size_t readChars(char* dst, size_t len) override;
 };
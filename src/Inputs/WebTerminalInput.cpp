@@ -10,6 +10,10 @@ char WebTerminalInput::readChar() {
     return server.readCharNonBlocking();
 }
 
+size_t WebTerminalInput::readChars(char* dst, size_t len) {
+    return server.readChars(dst, len);
+}
+
 void WebTerminalInput::waitPress() {
     server.readCharBlocking();
 }
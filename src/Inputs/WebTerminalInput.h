@@ -8,6 +8,7 @@ public:
 
     char handler() override;
     char readChar() override;
+    size_t readChars(char* dst, size_t len) override;
     void waitPress() override;
 
 private:
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+// Interface for a sector addressed storage device, 512 byte sectors.
+// Multi sector calls should map to a single multi block transfer.
+
+class IBlockDevice {
+public:
+    virtual ~IBlockDevice() = default;
+
+    // Number of sectors on the medium
+    virtual uint32_t sectorCount() const = 0;
+
+    // Read or write count consecutive sectors starting at lba
+    virtual bool readSectors(uint32_t lba, uint8_t* out, uint32_t count) = 0;
+    virtual bool writeSectors(uint32_t lba, const uint8_t* data, uint32_t count) = 0;
+
+    // Commit the device own buffers, if any
+    virtual bool sync() { return true; }
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Interface for a raw, non blocking byte link (UART, HDUART...)
+// Used by engines that move blocks of data instead of single chars.
+
+class IByteStream {
+public:
+    virtual ~IByteStream() = default;
+
+    // Number of bytes ready to be read
+    virtual size_t available() const = 0;
+
+    // Read up to len bytes without blocking, returns the count read
+    virtual size_t readBytes(uint8_t* dst, size_t len) = 0;
+
+    // Write len bytes, returns the count written
+    virtual size_t writeBytes(const uint8_t* src, size_t len) = 0;
+
+    // Bytes that can be written without blocking
+    virtual size_t availableForWrite() = 0;
+
+    // Receive overruns since configure
+    virtual uint32_t getOverrunCount() const { return 0; }
+};
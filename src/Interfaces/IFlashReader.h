@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Interface for reading a serial NOR flash.
+// Bulk readers (dumps) bracket their reads with beginBulkRead/endBulkRead,
+// so the implementation can switch to a faster read path in between.
+
+class IFlashReader {
+public:
+    virtual ~IFlashReader() = default;
+
+    // Prepare reads of up to maxLength bytes, dual output if supported
+    virtual bool beginBulkRead(size_t /*maxLength*/, bool /*dualOutput*/) { return true; }
+    virtual void endBulkRead() {}
+
+    // Buffers given between begin/end come from allocateReadBuffer
+    virtual void readFlashData(uint32_t address, uint8_t* buffer, size_t length) = 0;
+
+    // Buffer suitable for bulk reads, DMA capable on the device
+    virtual uint8_t* allocateReadBuffer(size_t length) { return new uint8_t[length]; }
+    virtual void freeReadBuffer(uint8_t* buffer) { delete[] buffer; }
+};
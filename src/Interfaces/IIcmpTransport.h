@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+// Interface for sending ICMP echo requests and receiving the replies.
+// Addresses are IPv4 in host byte order.
+
+class IIcmpTransport {
+public:
+    virtual ~IIcmpTransport() = default;
+
+    // Open the transport, false if no socket is available
+    virtual bool begin() { return true; }
+    virtual void end() {}
+
+    // Send one echo request, returns false if it could not be sent
+    virtual bool sendEcho(uint32_t ipv4, uint16_t ident, uint16_t seq) = 0;
+
+    // Wait up to timeoutMs for any echo reply, false on timeout
+    virtual bool receiveEcho(uint32_t& ipv4, uint16_t& ident, uint16_t& seq, uint32_t timeoutMs) = 0;
+};
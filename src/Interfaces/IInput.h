@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <cstddef>
 #include "Inputs/InputKeys.h"
 
 // Interface for terminal input
@@ -19,5 +20,16 @@ public:
 
     // Wait an inpout
     virtual void waitPress() = 0;
-    
+
+    // Non blocking bulk read, stops at the first KEY_NONE
+    virtual size_t readChars(char* dst, size_t len) {
+        size_t n = 0;
+        while (n < len) {
+            char c = readChar();
+            if (c == KEY_NONE) break;
+            dst[n++] = c;
+        }
+        return n;
+    }
+
 };
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "Models/ByteCodeProgram.h"
+
+// What a running script can do on the device, implemented by the dispatcher
+// and by fakes in the host tests.
+
+class IScriptHost {
+public:
+    virtual ~IScriptHost() = default;
+
+    // Run a compiled instruction line in the current mode, the bytes read
+    // replace read. False when the mode has no instruction support.
+    virtual bool runInstruction(const ByteCodeProgram& program, std::vector<uint8_t>& read) = 0;
+
+    // Run a terminal command line as if typed
+    virtual void runCommand(const std::string& line) = 0;
+
+    virtual void print(const std::string& text) = 0;
+    virtual void delayMs(uint32_t ms) = 0;
+
+    // Polled between steps, true to stop the script
+    virtual bool stopRequested() = 0;
+};
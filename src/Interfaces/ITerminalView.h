@@ -19,6 +19,14 @@ public:
     virtual void println(const std::string& text) = 0;
     virtual void printPrompt(const std::string& mode = "HIZ") = 0;
 
+    // Write raw bytes, no conversion
+    virtual void write(const uint8_t* data, size_t len) {
+        for (size_t i = 0; i < len; ++i) print(data[i]);
+    }
+
+    // Push buffered output, if any
+    virtual void flush() {}
+
     // Wait press
     virtual void waitPress() = 0;
 
@@ -2,7 +2,8 @@
 
 #include <vector>
 #include <string>
-#include <Services/SpiService.h>
+#include <cstdint>
+#include <functional>
 #include "Interfaces/IInput.h"
 #include "Interfaces/ITerminalView.h"
 
@@ -14,12 +15,6 @@ struct BinaryBlockStats {
     const char* signature;
 };
 
-struct FileSignature {
-    const char* name;
-    const uint8_t* pattern;
-    size_t length;
-};
-
 class BinaryAnalyzeManager {
 public:
     struct AnalysisResult {
@@ -48,10 +43,6 @@ private:
     ITerminalView& terminalView;
 
     BinaryBlockStats analyzeBlock(const uint8_t* buffer, size_t size);
-    const char* detectFileSignature(const uint8_t* buf, size_t size);
-    const char* detectSensitivePattern(const uint8_t* buf, size_t size);
     std::vector<std::string> extractPrintableStrings(const uint8_t* buf, size_t size, size_t minLen = 8);
-    static const FileSignature knownSignatures[];
-    static const size_t knownSignaturesCount;
 };
 
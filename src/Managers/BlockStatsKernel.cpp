@@ -0,0 +1,98 @@
+#include "BlockStatsKernel.h"
+#include <cstring>
+
+const uint8_t BlockStatsKernel::byteClass[256] = {
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+};
+
+/*
+Fixed point
+*/
+uint32_t BlockStatsKernel::log2Q16(uint32_t n) {
+    uint32_t k = 31 - __builtin_clz(n);
+    uint32_t result = k << 16;
+
+    // Mantissa in [1, 2) as Q30, squared once per fractional bit
+    uint64_t x = ((uint64_t)n << 30) >> k;
+    for (int bit = 15; bit >= 0; --bit) {
+        x = (x * x) >> 30;
+        if (x >= (2ull << 30)) {
+            x >>= 1;
+            result |= 1u << bit;
+        }
+    }
+    return result;
+}
+
+uint64_t BlockStatsKernel::nLog2nQ16(uint32_t n) {
+    if (n < LutSize) return nLog2nTable()[n];
+    return (uint64_t)n * log2Q16(n);
+}
+
+const uint32_t* BlockStatsKernel::nLog2nTable() {
+    // Built once, 2 KB
+    static struct Table {
+        uint32_t values[LutSize];
+        Table() {
+            values[0] = 0;
+            for (uint32_t n = 1; n < LutSize; ++n) values[n] = n * log2Q16(n);
+        }
+    } table;
+    return table.values;
+}
+
+/*
+Kernel
+*/
+template <typename Count>
+BlockCounts BlockStatsKernel::computeWith(const uint8_t* data, size_t size) {
+    Count hist[256];
+    memset(hist, 0, sizeof(hist));
+
+    // Histogram only, 4 bytes per iteration
+    size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        hist[data[i]]++;
+        hist[data[i + 1]]++;
+        hist[data[i + 2]]++;
+        hist[data[i + 3]]++;
+    }
+    for (; i < size; ++i) hist[data[i]]++;
+
+    // Per bucket, classes are masks so there is no branch on the data
+    const uint32_t* lut = nLog2nTable();
+    uint64_t sum = 0;
+    uint32_t printable = 0;
+    for (int b = 0; b < 256; ++b) {
+        uint32_t c = hist[b];
+        sum += c < LutSize ? lut[c] : (uint64_t)c * log2Q16(c);
+        printable += c & (0u - (byteClass[b] & ClassPrintable));
+    }
+
+    // H = log2(N) - sum(c * log2(c)) / N
+    uint64_t total = nLog2nQ16((uint32_t)size);
+    uint32_t entropyQ16 = total > sum ? (uint32_t)((total - sum) / size) : 0;
+
+    return {entropyQ16, printable, hist[0x00], hist[0xFF]};
+}
+
+BlockCounts BlockStatsKernel::compute(const uint8_t* data, size_t size) {
+    if (size == 0 || size > MaxBlockSize) return {0, 0, 0, 0};
+    if (size <= 0xFF) return computeWith<uint8_t>(data, size);
+    return computeWith<uint16_t>(data, size);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Byte statistics of one block, entropy in Q16 bits per byte
+struct BlockCounts {
+    uint32_t entropyQ16;
+    uint32_t printable;
+    uint32_t nulls;
+    uint32_t ff;
+};
+
+// Histogram based statistics of a block, integer only so every target
+// computes the same entropy. The histogram uses 8 bit counters for blocks
+// up to 255 bytes and 16 bit counters up to 65535, the byte classes come
+// from the histogram through a 256 entry LUT instead of per byte tests,
+// and n*log2(n) comes from a table for counts up to LutSize.
+class BlockStatsKernel {
+public:
+    static constexpr size_t MaxBlockSize = 65535;
+    static constexpr size_t LutSize = 513;           // covers the 512 byte default block
+    static constexpr uint8_t ClassPrintable = 0x01;
+    static constexpr uint8_t ClassNull = 0x02;
+    static constexpr uint8_t ClassFF = 0x04;
+
+    // Larger blocks must be split by the caller
+    static BlockCounts compute(const uint8_t* data, size_t size);
+
+    static float entropy(const BlockCounts& counts) { return counts.entropyQ16 / 65536.0f; }
+
+    // log2(n) in Q16 for n >= 1, rounded down, at most 2^-15 below the real value
+    static uint32_t log2Q16(uint32_t n);
+
+    // n * log2(n) in Q16, 0 for n <= 1
+    static uint64_t nLog2nQ16(uint32_t n);
+
+    static const uint8_t byteClass[256];
+
+private:
+    template <typename Count>
+    static BlockCounts computeWith(const uint8_t* data, size_t size);
+
+    static const uint32_t* nLog2nTable();
+};
@@ -0,0 +1,109 @@
+#include "CanStatsManager.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+CanStatsManager::CanStatsManager() {
+    table.reserve(32);
+}
+
+void CanStatsManager::reset() {
+    table.clear();
+    bus = CanBusStats();
+}
+
+void CanStatsManager::add(const CanFrameRecord* frames, size_t count) {
+    for (size_t i = 0; i < count; ++i) add(frames[i]);
+}
+
+void CanStatsManager::add(const CanFrameRecord& frame) {
+    if (bus.frames == 0) bus.firstUs = frame.timestampUs;
+    bus.frames++;
+    bus.lastUs = frame.timestampUs;
+
+    const uint64_t k = key(frame.id, frame.extended());
+    auto it = std::lower_bound(table.begin(), table.end(), k,
+        [](const CanIdStats& s, uint64_t value) { return key(s.id, s.extended) < value; });
+
+    if (it == table.end() || key(it->id, it->extended) != k) {
+        if (table.size() >= MaxIds) {
+            bus.untracked++;
+            return;
+        }
+        CanIdStats fresh;
+        fresh.id = frame.id;
+        fresh.extended = frame.extended();
+        fresh.firstUs = frame.timestampUs;
+        it = table.insert(it, fresh);
+    }
+
+    CanIdStats& s = *it;
+    uint8_t dlc = frame.dlc > 8 ? 8 : frame.dlc;
+
+    if (s.count > 0) {
+        // Smoothed period, 1/8 weight for the new interval
+        uint64_t interval = frame.timestampUs - s.lastUs;
+        uint32_t period = interval > 0xFFFFFFFFull ? 0xFFFFFFFFu : (uint32_t)interval;
+        s.periodUs = s.count == 1 ? period : (uint32_t)(((uint64_t)s.periodUs * 7 + period) / 8);
+
+        uint8_t changed = 0;
+        for (uint8_t i = 0; i < 8; ++i) {
+            bool inOld = i < s.dlc, inNew = i < dlc;
+            if (inOld != inNew || (inNew && s.data[i] != frame.data[i])) changed |= (uint8_t)(1u << i);
+        }
+        s.changedMask = changed;
+        s.everChangedMask |= changed;
+    }
+
+    s.count++;
+    s.lastUs = frame.timestampUs;
+    s.dlc = dlc;
+    if (!frame.remote()) memcpy(s.data, frame.data, dlc);
+}
+
+const CanIdStats* CanStatsManager::find(uint32_t id, bool extended) const {
+    const uint64_t k = key(id, extended);
+    auto it = std::lower_bound(table.begin(), table.end(), k,
+        [](const CanIdStats& s, uint64_t value) { return key(s.id, s.extended) < value; });
+    if (it == table.end() || key(it->id, it->extended) != k) return nullptr;
+    return &*it;
+}
+
+double CanStatsManager::frameRate() const {
+    if (bus.frames < 2 || bus.lastUs <= bus.firstUs) return 0;
+    return (bus.frames - 1) * 1e6 / (double)(bus.lastUs - bus.firstUs);
+}
+
+std::vector<std::string> CanStatsManager::formatTop(size_t maxRows) const {
+    std::vector<std::string> lines;
+    char text[128];
+
+    snprintf(text, sizeof(text), " %u frames, %u IDs, %.1f frames/s, %u overflows, %u dropped",
+             (unsigned)bus.frames, (unsigned)table.size(), frameRate(),
+             (unsigned)bus.overflows, (unsigned)(bus.dropped + bus.untracked));
+    lines.push_back(text);
+    lines.push_back("");
+    lines.push_back("  ID        DLC  Count     Rate/s  Data");
+
+    // Busiest first, then by ID
+    std::vector<const CanIdStats*> order;
+    order.reserve(table.size());
+    for (const auto& s : table) order.push_back(&s);
+    std::stable_sort(order.begin(), order.end(),
+        [](const CanIdStats* a, const CanIdStats* b) { return a->count > b->count; });
+
+    for (size_t row = 0; row < order.size() && row < maxRows; ++row) {
+        const CanIdStats& s = *order[row];
+        int n = snprintf(text, sizeof(text), s.extended ? "  %08X  %u    %-8u  %7.1f  " : "  %03X       %u    %-8u  %7.1f  ",
+                         (unsigned)s.id, (unsigned)s.dlc, (unsigned)s.count, s.rate());
+        std::string line(text, n > 0 ? (size_t)n : 0);
+        for (uint8_t i = 0; i < s.dlc; ++i) {
+            snprintf(text, sizeof(text), "%02X%c", s.data[i], (s.changedMask >> i) & 1 ? '*' : ' ');
+            line += text;
+        }
+        while (!line.empty() && line.back() == ' ') line.pop_back();
+        lines.push_back(line);
+    }
+    return lines;
+}
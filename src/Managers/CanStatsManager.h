@@ -0,0 +1,68 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Models/CanFrameRecord.h"
+
+struct CanIdStats {
+    uint32_t id = 0;
+    bool extended = false;
+    uint32_t count = 0;
+    uint64_t firstUs = 0;
+    uint64_t lastUs = 0;
+    uint32_t periodUs = 0;          // smoothed interval between frames
+    uint8_t dlc = 0;
+    uint8_t data[8] = {0};
+    uint8_t changedMask = 0;        // bytes that changed with the last frame
+    uint8_t everChangedMask = 0;    // bytes seen changing since the start
+
+    // Frames per second from the smoothed period, 0 before two frames
+    double rate() const { return periodUs ? 1e6 / periodUs : 0; }
+};
+
+struct CanBusStats {
+    uint32_t frames = 0;
+    uint32_t overflows = 0;         // frames lost in the controller (RXnOVR)
+    uint32_t dropped = 0;           // frames lost in the ring
+    uint32_t untracked = 0;         // frames of IDs beyond MaxIds
+    uint64_t firstUs = 0;
+    uint64_t lastUs = 0;
+};
+
+// Per identifier statistics of a CAN capture: count, rate, last payload and
+// which bytes change, for a live "top" view of the bus. IDs are kept sorted,
+// a new ID is the only insertion; the table is bounded by MaxIds.
+
+class CanStatsManager {
+public:
+    static constexpr size_t MaxIds = 256;
+
+    CanStatsManager();
+
+    void reset();
+    void add(const CanFrameRecord& frame);
+    void add(const CanFrameRecord* frames, size_t count);
+    void addOverflows(uint32_t count) { bus.overflows += count; }
+    void addDropped(uint32_t count) { bus.dropped += count; }
+
+    const std::vector<CanIdStats>& ids() const { return table; }
+    const CanBusStats& totals() const { return bus; }
+
+    // null if the ID was never seen
+    const CanIdStats* find(uint32_t id, bool extended) const;
+
+    // Bus frame rate over the capture
+    double frameRate() const;
+
+    // Table for the terminal, busiest IDs first, at most maxRows rows;
+    // changed bytes are followed by '*'
+    std::vector<std::string> formatTop(size_t maxRows) const;
+
+private:
+    std::vector<CanIdStats> table;
+    CanBusStats bus;
+
+    static uint64_t key(uint32_t id, bool extended) { return ((uint64_t)extended << 32) | id; }
+};
@@ -0,0 +1,149 @@
+#include "EdgeStatsManager.h"
+#include <cmath>
+#include <cstdio>
+
+double EdgeStats::dutyPercent() const {
+    uint64_t total = highTicks + lowTicks;
+    return total ? 100.0 * highTicks / total : 0;
+}
+
+double EdgeStats::jitterRms() const {
+    return periods > 1 ? std::sqrt(periodM2 / (periods - 1)) : 0;
+}
+
+EdgeStatsManager::EdgeStatsManager(uint32_t tickHz) {
+    reset(tickHz);
+}
+
+void EdgeStatsManager::reset(uint32_t newTickHz) {
+    tickHz = newTickHz ? newTickHz : 1;
+    current = EdgeStats();
+    havePrevious = false;
+    haveRising = false;
+    periodSamples.clear();
+    periodSamples.reserve(MaxHistogramSamples);
+}
+
+void EdgeStatsManager::markGap() {
+    if (havePrevious) current.gaps++;
+    havePrevious = false;
+    haveRising = false;
+}
+
+void EdgeStatsManager::add(const EdgeEvent* events, size_t count) {
+    for (size_t i = 0; i < count; ++i) add(events[i]);
+}
+
+void EdgeStatsManager::add(const EdgeEvent& event) {
+    uint8_t level = event.level ? 1 : 0;
+
+    // Dropped by the capture, or same level twice when an edge pair was missed
+    if (event.gap || (havePrevious && previous.level == level)) markGap();
+
+    if (level) current.rising++;
+    else current.falling++;
+
+    if (havePrevious) {
+        uint32_t dt = event.ticks - previous.ticks;  // wraps
+        if (previous.level) current.highTicks += dt;
+        else current.lowTicks += dt;
+    }
+
+    if (level) {
+        if (haveRising) addPeriod(event.ticks - lastRising);
+        lastRising = event.ticks;
+        haveRising = true;
+    }
+
+    previous = event;
+    previous.level = level;
+    havePrevious = true;
+}
+
+void EdgeStatsManager::addPeriod(uint32_t period) {
+    EdgeStats& s = current;
+    s.periods++;
+    if (s.periods == 1 || period < s.minPeriod) s.minPeriod = period;
+    if (period > s.maxPeriod) s.maxPeriod = period;
+
+    double delta = period - s.meanPeriod;
+    s.meanPeriod += delta / s.periods;
+    s.periodM2 += delta * (period - s.meanPeriod);
+
+    if (periodSamples.size() < MaxHistogramSamples) periodSamples.push_back(period);
+}
+
+/*
+Histogram
+*/
+std::vector<uint32_t> EdgeStatsManager::periodHistogram(size_t bins, uint32_t& low, uint32_t& high) const {
+    std::vector<uint32_t> counts(bins ? bins : 1, 0);
+    low = high = 0;
+    if (periodSamples.empty()) return counts;
+
+    low = high = periodSamples[0];
+    for (uint32_t p : periodSamples) {
+        if (p < low) low = p;
+        if (p > high) high = p;
+    }
+
+    uint64_t span = (uint64_t)(high - low) + 1;
+    for (uint32_t p : periodSamples) {
+        size_t bin = (size_t)((uint64_t)(p - low) * counts.size() / span);
+        counts[bin]++;
+    }
+    return counts;
+}
+
+/*
+Format
+*/
+std::string EdgeStatsManager::formatDuration(double ns) {
+    char buf[32];
+    if (ns < 1000.0)            snprintf(buf, sizeof(buf), "%.1f ns", ns);
+    else if (ns < 1000000.0)    snprintf(buf, sizeof(buf), "%.3f us", ns / 1e3);
+    else if (ns < 1000000000.0) snprintf(buf, sizeof(buf), "%.3f ms", ns / 1e6);
+    else                        snprintf(buf, sizeof(buf), "%.3f s", ns / 1e9);
+    return buf;
+}
+
+std::vector<std::string> EdgeStatsManager::formatReport(size_t histogramBins) const {
+    std::vector<std::string> lines;
+    const EdgeStats& s = current;
+    char buf[128];
+
+    if (s.highTicks + s.lowTicks) {
+        snprintf(buf, sizeof(buf), "  • Duty cycle:      %.2f %%", s.dutyPercent());
+        lines.push_back(buf);
+    }
+    if (s.periods == 0) {
+        lines.push_back("  • Period:          not enough edges");
+        return lines;
+    }
+
+    lines.push_back("  • Period:          " + formatDuration(ticksToNs(s.meanPeriod)) +
+                    " (min " + formatDuration(ticksToNs(s.minPeriod)) +
+                    ", max " + formatDuration(ticksToNs(s.maxPeriod)) + ")");
+    snprintf(buf, sizeof(buf), "  • Edge frequency:  %.3f Hz", 1e9 / ticksToNs(s.meanPeriod));
+    lines.push_back(buf);
+    lines.push_back("  • Jitter:          " + formatDuration(ticksToNs(s.jitterRms())) + " RMS, " +
+                    formatDuration(ticksToNs(s.maxPeriod - s.minPeriod)) + " p-p");
+    if (s.gaps) lines.push_back("  • Gaps:            " + std::to_string(s.gaps) + " (lost edges, not in the stats)");
+
+    // Histogram, bar scaled to the largest bin
+    uint32_t low, high;
+    std::vector<uint32_t> counts = periodHistogram(histogramBins, low, high);
+    if (low == high) return lines;
+
+    uint32_t most = 0;
+    for (uint32_t c : counts) if (c > most) most = c;
+    lines.push_back("  • Period histogram:");
+    double binTicks = ((double)high - low + 1) / counts.size();
+    for (size_t i = 0; i < counts.size(); ++i) {
+        std::string bar((size_t)(20.0 * counts[i] / most + 0.5), '#');
+        snprintf(buf, sizeof(buf), "     %12s | %-20s %u",
+                 formatDuration(ticksToNs(low + binTicks * i)).c_str(), bar.c_str(), counts[i]);
+        lines.push_back(buf);
+    }
+    return lines;
+}
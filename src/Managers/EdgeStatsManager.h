@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Models/EdgeEvent.h"
+
+struct EdgeStats {
+    uint32_t rising = 0;
+    uint32_t falling = 0;
+    uint32_t gaps = 0;          // discontinuities, dropped or missed edges
+    uint64_t highTicks = 0;     // time high between two edges
+    uint64_t lowTicks = 0;
+    uint32_t periods = 0;       // rising to rising intervals
+    uint32_t minPeriod = 0;
+    uint32_t maxPeriod = 0;
+    double meanPeriod = 0;      // ticks
+    double periodM2 = 0;        // sum of squared deviations (Welford)
+
+    // Percent of the measured time spent high, 0 without complete intervals
+    double dutyPercent() const;
+
+    // Period standard deviation in ticks, the RMS jitter
+    double jitterRms() const;
+};
+
+// Edge stream statistics for the DIO measure and sniff commands: edge
+// counts, duty cycle, period min/mean/max, RMS and peak to peak jitter, and
+// a period histogram. Events are added in order; a gap (edges lost by the
+// capture, flagged on the first event after them) breaks the current
+// intervals so no period spans it.
+
+class EdgeStatsManager {
+public:
+    static constexpr size_t MaxHistogramSamples = 2048;
+
+    explicit EdgeStatsManager(uint32_t tickHz = 1000000);
+
+    void reset(uint32_t tickHz);
+    void add(const EdgeEvent& event);
+    void add(const EdgeEvent* events, size_t count);
+
+    // Edges were lost before the next event
+    void markGap();
+
+    const EdgeStats& stats() const { return current; }
+    uint32_t tickRate() const { return tickHz; }
+
+    double ticksToNs(double ticks) const { return ticks * 1e9 / tickHz; }
+
+    // Period histogram, bins evenly spread over min..max of the first periods
+    std::vector<uint32_t> periodHistogram(size_t bins, uint32_t& low, uint32_t& high) const;
+
+    // Result lines for the terminal
+    std::vector<std::string> formatReport(size_t histogramBins = 8) const;
+
+    // "12.500 us", "1.250 ms", unit picked from the value
+    static std::string formatDuration(double ns);
+
+private:
+    uint32_t tickHz;
+    EdgeStats current;
+    EdgeEvent previous{0, 0, 0};
+    bool havePrevious = false;
+    uint32_t lastRising = 0;
+    bool haveRising = false;
+    std::vector<uint32_t> periodSamples;
+
+    void addPeriod(uint32_t period);
+};
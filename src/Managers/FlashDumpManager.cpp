@@ -0,0 +1,262 @@
+#include "FlashDumpManager.h"
+#include <cstdio>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+FlashDumpManager::FlashDumpManager(IFlashReader& reader) : reader(reader) {
+    #ifdef ARDUINO
+        clock = []() { return (uint32_t)millis(); };
+    #else
+        clock = []() {
+            using namespace std::chrono;
+            return (uint32_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+        };
+    #endif
+}
+
+void FlashDumpManager::setClock(std::function<uint32_t()> newClock) {
+    clock = std::move(newClock);
+}
+
+/*
+Run
+*/
+FlashDumpStats FlashDumpManager::run(uint32_t address, uint32_t length, const Options& options,
+                                     BlockCallback onBlock, StopCallback shouldStop) {
+    FlashDumpStats stats;
+    if (length == 0 || !onBlock) return stats;
+
+    size_t blockSize = options.blockSize ? options.blockSize : 4096;
+    if (!reader.beginBulkRead(blockSize, options.dualOutput)) {
+        stats.stopped = true;
+        return stats;
+    }
+
+    buffers[0] = reader.allocateReadBuffer(blockSize);
+    buffers[1] = reader.allocateReadBuffer(blockSize);
+    if (!buffers[0] || !buffers[1]) {
+        if (buffers[0]) reader.freeReadBuffer(buffers[0]);
+        if (buffers[1]) reader.freeReadBuffer(buffers[1]);
+        buffers[0] = buffers[1] = nullptr;
+        reader.endBulkRead();
+        stats.stopped = true;
+        return stats;
+    }
+
+    readAddress = address;
+    imageLength = length;
+    readBlockSize = blockSize;
+    readBlocks = (uint32_t)((length + blockSize - 1) / blockSize);
+    produced.store(0);
+    consumed.store(0);
+    abort.store(false);
+
+    uint32_t start = clock();
+
+    #ifdef ARDUINO
+        // Core 0, the terminal side keeps running on core 1
+        if (xTaskCreatePinnedToCore(readerTask, "FlashDump", 4096, this, 1, nullptr, 0) != pdPASS) {
+            readInline(address, onBlock, shouldStop, stats);
+            stats.elapsedMs = clock() - start;
+            reader.freeReadBuffer(buffers[0]);
+            reader.freeReadBuffer(buffers[1]);
+            buffers[0] = buffers[1] = nullptr;
+            reader.endBulkRead();
+            return stats;
+        }
+    #else
+        std::thread readerThread(readerTask, this);
+    #endif
+
+    uint32_t index = 0;
+    while (index < readBlocks) {
+        if (shouldStop && shouldStop()) {
+            stats.stopped = true;
+            break;
+        }
+
+        // Next block still on the bus
+        if (produced.load(std::memory_order_acquire) == index) {
+            uint32_t waitStart = clock();
+            blockReady.wait(WaitSliceMs);
+            stats.readWaitMs += clock() - waitStart;
+            continue;
+        }
+
+        uint32_t slot = index & 1;
+        bool keepGoing = onBlock(address + index * (uint32_t)blockSize, buffers[slot], lengths[slot]);
+        stats.bytes += (uint32_t)lengths[slot];
+        stats.crc32 = crcs[slot];
+
+        // Hand the buffer back to the reader
+        consumed.store(++index, std::memory_order_release);
+        blockFree.notify();
+
+        if (!keepGoing) {
+            stats.stopped = true;
+            break;
+        }
+    }
+
+    // Stop the reader and wait for it to leave the bus
+    abort.store(true, std::memory_order_release);
+    blockFree.notify();
+    #ifdef ARDUINO
+        while (!readerDone.wait(WaitSliceMs)) {}
+    #else
+        readerThread.join();
+    #endif
+
+    stats.elapsedMs = clock() - start;
+
+    reader.freeReadBuffer(buffers[0]);
+    reader.freeReadBuffer(buffers[1]);
+    buffers[0] = buffers[1] = nullptr;
+    reader.endBulkRead();
+
+    return stats;
+}
+
+/*
+Reader
+*/
+void FlashDumpManager::readerTask(void* param) {
+    static_cast<FlashDumpManager*>(param)->readerLoop();
+    #ifdef ARDUINO
+        vTaskDelete(nullptr);
+    #endif
+}
+
+void FlashDumpManager::readerLoop() {
+    uint32_t crc = 0;
+
+    for (uint32_t i = 0; i < readBlocks && !abort.load(std::memory_order_acquire); ++i) {
+        // Both buffers still owned by the output side
+        while (i - consumed.load(std::memory_order_acquire) >= 2 && !abort.load(std::memory_order_acquire)) {
+            blockFree.wait(WaitSliceMs);
+        }
+        if (abort.load(std::memory_order_acquire)) break;
+
+        uint32_t slot = i & 1;
+        uint32_t offset = i * (uint32_t)readBlockSize;
+        size_t len = imageLength - offset < readBlockSize ? imageLength - offset : readBlockSize;
+
+        reader.readFlashData(readAddress + offset, buffers[slot], len);
+        crc = crc32(buffers[slot], len, crc);
+
+        lengths[slot] = len;
+        crcs[slot] = crc;
+        produced.store(i + 1, std::memory_order_release);
+        blockReady.notify();
+    }
+
+    readerDone.notify();
+}
+
+// No reader task, one buffer read then handed out on the calling task
+void FlashDumpManager::readInline(uint32_t address, const BlockCallback& onBlock, const StopCallback& shouldStop,
+                                  FlashDumpStats& stats) {
+    uint32_t crc = 0;
+    for (uint32_t i = 0; i < readBlocks; ++i) {
+        if (shouldStop && shouldStop()) {
+            stats.stopped = true;
+            return;
+        }
+
+        uint32_t offset = i * (uint32_t)readBlockSize;
+        size_t len = imageLength - offset < readBlockSize ? imageLength - offset : readBlockSize;
+
+        uint32_t waitStart = clock();
+        reader.readFlashData(address + offset, buffers[0], len);
+        stats.readWaitMs += clock() - waitStart;
+        crc = crc32(buffers[0], len, crc);
+        stats.bytes += (uint32_t)len;
+        stats.crc32 = crc;
+
+        if (!onBlock(address + offset, buffers[0], len)) {
+            stats.stopped = true;
+            return;
+        }
+    }
+}
+
+/*
+CRC32
+*/
+uint32_t FlashDumpManager::crc32(const uint8_t* data, size_t len, uint32_t crc) {
+    struct Table {
+        uint32_t entries[256];
+        constexpr Table() : entries() {
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                entries[i] = c;
+            }
+        }
+    };
+    static constexpr Table table;
+
+    crc = ~crc;
+    for (size_t i = 0; i < len; ++i) {
+        crc = table.entries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+/*
+Format
+*/
+void FlashDumpManager::appendHexLines(std::string& out, uint32_t address, const uint8_t* data, size_t len) {
+    static const char digits[] = "0123456789ABCDEF";
+    char line[80];
+
+    for (size_t i = 0; i < len; i += 16) {
+        uint32_t lineAddress = address + (uint32_t)i;
+        size_t n = len - i < 16 ? len - i : 16;
+        size_t pos = 0;
+
+        // Address
+        for (int shift = 20; shift >= 0; shift -= 4) line[pos++] = digits[(lineAddress >> shift) & 0xF];
+        line[pos++] = ':';
+        line[pos++] = ' ';
+
+        // Hex
+        for (size_t j = 0; j < 16; ++j) {
+            if (j < n) {
+                line[pos++] = digits[data[i + j] >> 4];
+                line[pos++] = digits[data[i + j] & 0xF];
+            } else {
+                line[pos++] = ' ';
+                line[pos++] = ' ';
+            }
+            line[pos++] = ' ';
+        }
+
+        // ASCII
+        line[pos++] = ' ';
+        for (size_t j = 0; j < n; ++j) {
+            uint8_t c = data[i + j];
+            line[pos++] = (c >= 0x20 && c < 0x7F) ? (char)c : '.';
+        }
+        line[pos++] = '\r';
+        line[pos++] = '\n';
+
+        out.append(line, pos);
+    }
+}
+
+std::string FlashDumpManager::formatStats(const FlashDumpStats& stats) const {
+    char line[128];
+    float secs = stats.elapsedMs / 1000.0f;
+    float rate = stats.elapsedMs ? (stats.bytes / 1048576.0f) / secs : 0.0f;
+
+    snprintf(line, sizeof(line), "%u bytes in %.1f s (%.2f MB/s), CRC32 0x%08X",
+             (unsigned)stats.bytes, secs, rate, (unsigned)stats.crc32);
+
+    return std::string(line);
+}
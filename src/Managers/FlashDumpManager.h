@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include "Interfaces/IFlashReader.h"
+#include "Buffers/RingNotifier.h"
+
+struct FlashDumpStats {
+    uint32_t bytes = 0;
+    uint32_t crc32 = 0;
+    uint32_t elapsedMs = 0;
+    uint32_t readWaitMs = 0;    // output side waiting for the flash
+    bool stopped = false;       // stop callback or output asked to stop
+};
+
+// Double buffered flash dump.
+// A reader task fills one block while the output callback consumes the other,
+// so the bus keeps running while the previous block is formatted or written.
+// The CRC32 of the image is computed on the reader side, after each read.
+// If the reader task cannot be created the blocks are read in turn on the
+// calling task instead.
+
+class FlashDumpManager {
+public:
+    struct Options {
+        size_t blockSize = 4096;
+        bool dualOutput = false;
+    };
+
+    // Return false to stop the dump
+    using BlockCallback = std::function<bool(uint32_t address, const uint8_t* data, size_t len)>;
+    using StopCallback = std::function<bool()>;
+
+    explicit FlashDumpManager(IFlashReader& reader);
+
+    // Read length bytes from address, blocks are handed to onBlock in order
+    FlashDumpStats run(uint32_t address, uint32_t length, const Options& options,
+                       BlockCallback onBlock, StopCallback shouldStop = nullptr);
+
+    // "16777216 bytes in 9.8 s (1.63 MB/s), CRC32 0x1A2B3C4D"
+    std::string formatStats(const FlashDumpStats& stats) const;
+
+    // Standard CRC-32 (IEEE 802.3), pass the previous value to continue
+    static uint32_t crc32(const uint8_t* data, size_t len, uint32_t crc = 0);
+
+    // Hex view lines "00FF00: 41 42 ... AB..", appended to out
+    static void appendHexLines(std::string& out, uint32_t address, const uint8_t* data, size_t len);
+
+    // Time source in ms, millis() by default
+    void setClock(std::function<uint32_t()> clock);
+
+private:
+    IFlashReader& reader;
+    std::function<uint32_t()> clock;
+
+    // Reader side state, shared with the task
+    uint8_t* buffers[2] = {nullptr, nullptr};
+    size_t lengths[2] = {0, 0};
+    uint32_t readAddress = 0;
+    uint32_t readBlocks = 0;
+    size_t readBlockSize = 0;
+    uint32_t imageLength = 0;
+    uint32_t crcs[2] = {0, 0};     // running CRC32 after each buffer
+    std::atomic<uint32_t> produced{0};
+    std::atomic<uint32_t> consumed{0};
+    std::atomic<bool> abort{false};
+    RingNotifier blockReady;
+    RingNotifier blockFree;
+    RingNotifier readerDone;
+
+    static constexpr uint32_t WaitSliceMs = 50; // stop callback latency
+
+    void readerLoop();
+    void readInline(uint32_t address, const BlockCallback& onBlock, const StopCallback& shouldStop,
+                    FlashDumpStats& stats);
+    static void readerTask(void* param);
+};
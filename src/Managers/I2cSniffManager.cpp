@@ -0,0 +1,117 @@
+#include "I2cSniffManager.h"
+
+I2cSniffManager::I2cSniffManager(Handler onTransaction)
+    : onTransaction(onTransaction) {
+    current.data.reserve(64);
+    current.acks.reserve(64);
+}
+
+void I2cSniffManager::add(const I2cSnifferEvent* events, size_t count) {
+    for (size_t i = 0; i < count; ++i) add(events[i]);
+}
+
+void I2cSniffManager::add(const I2cSnifferEvent& event) {
+    if (event.gap) markGap();
+
+    // The counter wraps, each step is taken modulo 2^32
+    if (started) now += (uint32_t)(event.ticks - lastTicks);
+    started = true;
+    lastTicks = event.ticks;
+
+    switch (event.type) {
+        case I2cSnifferEventType::Start:
+            if (active) finish(true, false);
+            begin();
+            break;
+
+        case I2cSnifferEventType::Stop:
+            if (active) finish(false, expect == Expect::Address);
+            else counters.strayEvents++;
+            break;
+
+        case I2cSnifferEventType::Address:
+            if (!active || expect != Expect::Address) {
+                counters.strayEvents++;
+                break;
+            }
+            current.address = event.value >> 1;
+            current.read = event.value & 1;
+            expect = Expect::AddressAck;
+            break;
+
+        case I2cSnifferEventType::Data:
+            if (!active || expect == Expect::Address) {
+                counters.strayEvents++;
+                break;
+            }
+            // A missing ACK bit is taken as lost
+            if (expect == Expect::AddressAck || expect == Expect::DataAck) current.incomplete = true;
+            if (expect == Expect::DataAck) current.acks.push_back(false);
+            current.data.push_back(event.value);
+            expect = Expect::DataAck;
+            break;
+
+        case I2cSnifferEventType::Ack: {
+            bool ack = event.value == 0;
+            if (active && expect == Expect::AddressAck) {
+                current.addressAck = ack;
+                if (!ack) counters.nacks++;
+                expect = Expect::Data;
+            } else if (active && expect == Expect::DataAck) {
+                current.acks.push_back(ack);
+                if (!ack) counters.nacks++;
+                expect = Expect::Data;
+            } else {
+                counters.strayEvents++;
+            }
+            break;
+        }
+    }
+}
+
+void I2cSniffManager::markGap() {
+    if (active) {
+        current.incomplete = true;
+        finish(false, true);
+    }
+}
+
+void I2cSniffManager::flush() {
+    if (active) finish(false, true);
+}
+
+void I2cSniffManager::reset() {
+    active = false;
+    started = false;
+    now = 0;
+    expect = Expect::Address;
+    current.clear();
+    counters = I2cSniffStats();
+}
+
+void I2cSniffManager::begin() {
+    current.clear();
+    current.startTicks = now;
+    active = true;
+    expect = Expect::Address;
+}
+
+void I2cSniffManager::finish(bool repeated, bool incomplete) {
+    // Last data byte without its ACK bit
+    if (expect == Expect::DataAck) {
+        current.acks.push_back(false);
+        incomplete = true;
+    }
+
+    current.durationTicks = (uint32_t)(now - current.startTicks);
+    current.repeatedStart = repeated;
+    current.incomplete = current.incomplete || incomplete;
+
+    counters.transactions++;
+    counters.bytes += (uint32_t)current.data.size();
+    if (current.incomplete) counters.incomplete++;
+
+    active = false;
+    expect = Expect::Address;
+    if (onTransaction) onTransaction(current);
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include "Models/I2cSnifferEvent.h"
+#include "Models/I2cTransaction.h"
+
+struct I2cSniffStats {
+    uint32_t transactions = 0;
+    uint32_t bytes = 0;             // data bytes, address excluded
+    uint32_t nacks = 0;             // address and data
+    uint32_t incomplete = 0;
+    uint32_t strayEvents = 0;       // outside any START
+};
+
+// Groups sniffer events into transactions: START, address with R/W and its
+// ACK, data bytes with their ACK, then STOP or a repeated START. A finished
+// transaction is passed to the handler; the object is reused, copy what
+// must be kept. markGap() tells that events were dropped before the next one, an event
+// with its gap flag set does the same.
+
+class I2cSniffManager {
+public:
+    using Handler = std::function<void(const I2cTransaction&)>;
+
+    explicit I2cSniffManager(Handler onTransaction);
+
+    void add(const I2cSnifferEvent& event);
+    void add(const I2cSnifferEvent* events, size_t count);
+    void markGap();
+
+    // Emit the transaction in progress, if any, as incomplete
+    void flush();
+    void reset();
+
+    bool inTransaction() const { return active; }
+    const I2cSniffStats& stats() const { return counters; }
+
+private:
+    enum class Expect : uint8_t { Address, AddressAck, Data, DataAck };
+
+    Handler onTransaction;
+    I2cTransaction current;
+    I2cSniffStats counters;
+    bool active = false;
+    Expect expect = Expect::Address;
+    bool started = false;
+    uint32_t lastTicks = 0;         // raw counter of the last event
+    uint64_t now = 0;               // unwrapped
+
+    void begin();
+    void finish(bool repeated, bool incomplete);
+};
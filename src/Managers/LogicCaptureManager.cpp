@@ -0,0 +1,104 @@
+#include "LogicCaptureManager.h"
+
+/*
+Trace
+*/
+void LogicTrace::clear() {
+    runs.clear();
+    samples = 0;
+    triggerSample = 0;
+    triggered = false;
+    runLimit = SIZE_MAX;
+    cut = false;
+}
+
+void LogicTrace::limitRuns(size_t maxRuns, size_t expectedRuns) {
+    runLimit = maxRuns;
+    runs.reserve(std::min(maxRuns, expectedRuns));
+}
+
+size_t LogicTrace::countRuns(const uint8_t* data, size_t count) {
+    if (!count) return 0;
+    size_t n = 1;
+    uint32_t length = 1;
+    for (size_t i = 1; i < count; ++i) {
+        if (data[i] != data[i - 1] || length == MaxRun) {
+            n++;
+            length = 0;
+        }
+        length++;
+    }
+    return n;
+}
+
+void LogicTrace::append(const uint8_t* data, size_t count) {
+    size_t i = 0;
+    while (i < count && !cut) {
+        uint8_t value = data[i];
+        size_t j = i + 1;
+        while (j < count && data[j] == value) ++j;
+        uint32_t length = (uint32_t)(j - i);
+        samples += length;
+        i = j;
+
+        // Extend the last run when it has the same value
+        if (!runs.empty() && (uint8_t)(runs.back() >> 24) == value) {
+            uint32_t last = (runs.back() & (MaxRun - 1)) + 1;
+            uint32_t add = std::min(length, MaxRun - last);
+            runs.back() += add;
+            length -= add;
+        }
+        while (length) {
+            if (runs.size() >= runLimit) {
+                samples -= length;
+                cut = true;
+                break;
+            }
+            uint32_t n = std::min(length, MaxRun);
+            runs.push_back(((uint32_t)value << 24) | (n - 1));
+            length -= n;
+        }
+    }
+}
+
+size_t LogicTrace::expand(uint32_t first, uint8_t* out, size_t count) const {
+    size_t written = 0;
+    uint32_t start = 0;
+    for (uint32_t run : runs) {
+        if (written == count) break;
+        uint32_t length = (run & (MaxRun - 1)) + 1;
+        uint32_t end = start + length;
+        if (end > first) {
+            uint32_t from = std::max(start, first);
+            size_t n = std::min((size_t)(end - from), count - written);
+            memset(out + written, (uint8_t)(run >> 24), n);
+            written += n;
+        }
+        start = end;
+    }
+    return written;
+}
+
+/*
+Capture
+*/
+uint32_t LogicCaptureManager::linearize(uint8_t* buffer, uint32_t pre, uint32_t ringPos, uint32_t ringFill) {
+    if (ringFill == pre) {
+        // Full ring, oldest sample at ringPos
+        std::rotate(buffer, buffer + ringPos, buffer + pre);
+        return 0;
+    }
+
+    // Partial ring, in order from 0, moved next to the trigger
+    memmove(buffer + pre - ringFill, buffer, ringFill);
+    return pre - ringFill;
+}
+
+void LogicCaptureManager::toTrace(const uint8_t* buffer, const LogicCaptureStats& stats, LogicTrace& trace,
+                                  size_t maxRuns) {
+    trace.clear();
+    trace.limitRuns(maxRuns, LogicTrace::countRuns(buffer + stats.first, stats.samples));
+    trace.append(buffer + stats.first, stats.samples);
+    trace.triggerSample = stats.triggerSample;
+    trace.triggered = stats.triggered && stats.triggerSample < trace.sampleCount();
+}
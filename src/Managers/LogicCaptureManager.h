@@ -0,0 +1,163 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <algorithm>
+
+// Trigger on one 8 channel sample, channel n is bit n.
+// The pattern must hold on the trigger sample and, when edgeMask is set,
+// at least one of those channels must have the selected edge.
+struct LogicTrigger {
+    enum Edge : uint8_t { None, Rising, Falling, Either };
+
+    uint8_t patternMask = 0;
+    uint8_t patternValue = 0;
+    uint8_t edgeMask = 0;
+    Edge edge = None;
+
+    bool enabled() const { return patternMask || (edgeMask && edge != None); }
+
+    inline bool fires(uint8_t prev, uint8_t cur) const {
+        if ((cur & patternMask) != patternValue) return false;
+        uint8_t changed = (uint8_t)((prev ^ cur) & edgeMask);
+        switch (edge) {
+            case Rising:  return (changed & cur) != 0;
+            case Falling: return (changed & (uint8_t)~cur) != 0;
+            case Either:  return changed != 0;
+            default:      return true;
+        }
+    }
+};
+
+// Captured samples as runs, value << 24 | (length - 1)
+class LogicTrace {
+public:
+    static constexpr uint32_t MaxRun = 1u << 24;
+
+    uint32_t sampleRate = 0;
+    uint32_t triggerSample = 0;     // index of the trigger sample
+    bool triggered = false;
+    std::vector<uint8_t> pins;      // GPIO of each channel
+
+    void clear();
+
+    // At most maxRuns runs, room for them is taken at once; samples past the
+    // limit are dropped and the trace is marked truncated
+    void limitRuns(size_t maxRuns, size_t expectedRuns);
+    bool truncated() const { return cut; }
+
+    // Runs needed for these samples on their own
+    static size_t countRuns(const uint8_t* samples, size_t count);
+
+    // Compress and append samples
+    void append(const uint8_t* samples, size_t count);
+
+    // Decompress count samples starting at sample first, returns the count written
+    size_t expand(uint32_t first, uint8_t* out, size_t count) const;
+
+    // f(value, startSample, length) for every run, in order
+    template <typename Callback>
+    void forEachRun(Callback&& f) const {
+        uint32_t start = 0;
+        for (uint32_t run : runs) {
+            uint32_t length = (run & (MaxRun - 1)) + 1;
+            f((uint8_t)(run >> 24), start, length);
+            start += length;
+        }
+    }
+
+    uint32_t sampleCount() const { return samples; }
+    size_t runCount() const { return runs.size(); }
+    size_t compressedBytes() const { return runs.size() * sizeof(uint32_t); }
+    uint8_t channelCount() const { return (uint8_t)pins.size(); }
+
+private:
+    std::vector<uint32_t> runs;
+    uint32_t samples = 0;
+    size_t runLimit = SIZE_MAX;
+    bool cut = false;
+};
+
+struct LogicCaptureOptions {
+    uint32_t depth = 0;         // samples in the buffer
+    uint32_t preTrigger = 0;    // samples kept before the trigger
+    LogicTrigger trigger;
+};
+
+struct LogicCaptureStats {
+    uint32_t first = 0;         // first valid sample in the buffer
+    uint32_t samples = 0;
+    uint32_t triggerSample = 0; // relative to first
+    bool triggered = false;     // false without a trigger
+    bool stopped = false;       // stop requested while armed
+};
+
+// Trigger and buffer logic of the logic analyzer, independent of how samples
+// are taken. While armed the samples go to a ring of preTrigger entries at the
+// start of the buffer, the trigger sample and everything after are written
+// linearly behind it, then the ring is put back in order.
+//
+// Source provides uint8_t sample(), paced to the sample rate, and
+// bool stopRequested(), only polled while armed so the post trigger part
+// runs without interruption.
+
+class LogicCaptureManager {
+public:
+    static constexpr uint32_t PollInterval = 4096;
+
+    template <typename Source>
+    static LogicCaptureStats capture(Source& source, const LogicCaptureOptions& options, uint8_t* buffer) {
+        LogicCaptureStats stats;
+        const uint32_t depth = options.depth;
+        if (depth == 0 || !buffer) return stats;
+
+        const LogicTrigger trigger = options.trigger;
+        uint32_t pre = trigger.enabled() ? std::min(options.preTrigger, depth - 1) : 0;
+        uint32_t ringPos = 0, ringFill = 0;
+        uint32_t poll = PollInterval;
+        uint8_t cur = source.sample();
+
+        if (trigger.enabled()) {
+            uint8_t prev = cur;
+            while (true) {
+                if (pre) {
+                    buffer[ringPos] = prev;
+                    if (++ringPos == pre) ringPos = 0;
+                    if (ringFill < pre) ringFill++;
+                }
+                cur = source.sample();
+                if (trigger.fires(prev, cur)) break;
+                prev = cur;
+
+                if (--poll == 0) {
+                    poll = PollInterval;
+                    if (source.stopRequested()) {
+                        stats.stopped = true;
+                        break;
+                    }
+                }
+            }
+        }
+
+        uint32_t end = pre;
+        if (!stats.stopped) {
+            buffer[end++] = cur;
+            while (end < depth) buffer[end++] = source.sample();
+        }
+
+        stats.first = linearize(buffer, pre, ringPos, ringFill);
+        stats.triggerSample = ringFill;
+        stats.samples = ringFill + (end - pre);
+        stats.triggered = trigger.enabled() && !stats.stopped;
+        return stats;
+    }
+
+    // Put the pre trigger ring in order right before buffer[pre], returns the first sample
+    static uint32_t linearize(uint8_t* buffer, uint32_t pre, uint32_t ringPos, uint32_t ringFill);
+
+    // Captured buffer into a trace of at most maxRuns runs
+    static void toTrace(const uint8_t* buffer, const LogicCaptureStats& stats, LogicTrace& trace,
+                        size_t maxRuns = SIZE_MAX);
+};
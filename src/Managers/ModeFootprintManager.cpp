@@ -0,0 +1,101 @@
+#include "ModeFootprintManager.h"
+#include <cstdio>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+ModeFootprintManager::ModeFootprintManager() {
+    #ifdef ARDUINO
+        probe = []() { return Memory{ESP.getFreeHeap(), ESP.getFreePsram()}; };
+        clock = []() { return (uint32_t)micros(); };
+    #else
+        probe = []() { return Memory{0, 0}; };
+        clock = []() {
+            using namespace std::chrono;
+            return (uint32_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+        };
+    #endif
+}
+
+void ModeFootprintManager::setProbe(std::function<Memory()> newProbe) {
+    probe = std::move(newProbe);
+}
+
+void ModeFootprintManager::setClock(std::function<uint32_t()> newClock) {
+    clock = std::move(newClock);
+}
+
+/*
+Records
+*/
+void ModeFootprintManager::setStartup(uint32_t provider, uint32_t providerHeapBytes, uint32_t boot) {
+    providerUs = provider;
+    providerHeap = providerHeapBytes;
+    bootMs = boot;
+}
+
+const ModeFootprint* ModeFootprintManager::find(const std::string& name) const {
+    for (const auto& mode : modes) {
+        if (mode.name == name) return &mode;
+    }
+    return nullptr;
+}
+
+ModeFootprint& ModeFootprintManager::entry(const std::string& name) {
+    for (auto& mode : modes) {
+        if (mode.name == name) return mode;
+    }
+    modes.push_back(ModeFootprint());
+    modes.back().name = name;
+    return modes.back();
+}
+
+void ModeFootprintManager::recordBuild(const std::string& name, const Memory& before, const Memory& after, uint32_t elapsedUs) {
+    ModeFootprint& mode = entry(name);
+    mode.loaded = true;
+    mode.loads++;
+    mode.heapBytes = (int32_t)(before.freeHeap - after.freeHeap);
+    mode.psramBytes = (int32_t)(before.freePsram - after.freePsram);
+    mode.buildUs = elapsedUs;
+}
+
+void ModeFootprintManager::recordRelease(const std::string& name, const Memory& before, const Memory& after) {
+    ModeFootprint& mode = entry(name);
+    mode.loaded = false;
+    mode.heapFreed = (int32_t)(after.freeHeap - before.freeHeap);
+    mode.psramFreed = (int32_t)(after.freePsram - before.freePsram);
+}
+
+/*
+Format
+*/
+std::vector<std::string> ModeFootprintManager::formatLines() const {
+    std::vector<std::string> lines;
+    char line[96];
+
+    snprintf(line, sizeof(line), "Provider built    : %.1f ms, %.1f KB heap",
+             providerUs / 1000.0, providerHeap / 1024.0);
+    lines.push_back(line);
+    snprintf(line, sizeof(line), "Boot to provider  : %u ms", (unsigned)bootMs);
+    lines.push_back(line);
+
+    if (modes.empty()) {
+        lines.push_back("No mode module built yet");
+        return lines;
+    }
+
+    lines.push_back("Module     State     Heap KB  PSRAM KB  Build ms  Loads");
+    for (const auto& mode : modes) {
+        // A released module shows what its release gave back
+        double heap = (mode.loaded ? mode.heapBytes : mode.heapFreed) / 1024.0;
+        double psram = (mode.loaded ? mode.psramBytes : mode.psramFreed) / 1024.0;
+        snprintf(line, sizeof(line), "%-10s %-8s %8.1f %9.1f %9.1f %6u",
+                 mode.name.c_str(), mode.loaded ? "loaded" : "freed",
+                 heap, psram, mode.buildUs / 1000.0, (unsigned)mode.loads);
+        lines.push_back(line);
+    }
+    return lines;
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <functional>
+
+struct ModeFootprint {
+    std::string name;
+    bool loaded = false;
+    uint32_t loads = 0;
+    int32_t heapBytes = 0;      // taken by the last construction
+    int32_t psramBytes = 0;
+    int32_t heapFreed = 0;      // given back by the last release
+    int32_t psramFreed = 0;
+    uint32_t buildUs = 0;
+};
+
+// Heap, PSRAM and time taken by the mode modules the DependencyProvider
+// builds on first use and releases on mode exit, plus the boot figures,
+// for the system shell. Free memory is sampled around each construction
+// and release, so allocations made by other tasks meanwhile count too.
+
+class ModeFootprintManager {
+public:
+    struct Memory {
+        uint32_t freeHeap;
+        uint32_t freePsram;
+    };
+
+    ModeFootprintManager();
+
+    // Free memory and time in us, ESP and micros() by default
+    void setProbe(std::function<Memory()> probe);
+    void setClock(std::function<uint32_t()> clock);
+
+    template <typename Build>
+    void build(const std::string& name, Build&& construct) {
+        Memory before = probe();
+        uint32_t start = clock();
+        construct();
+        uint32_t elapsed = clock() - start;
+        recordBuild(name, before, probe(), elapsed);
+    }
+
+    template <typename Release>
+    void release(const std::string& name, Release&& destroy) {
+        Memory before = probe();
+        destroy();
+        recordRelease(name, before, probe());
+    }
+
+    // Provider construction, and time from reset until it was ready
+    void setStartup(uint32_t providerUs, uint32_t providerHeapBytes, uint32_t bootMs);
+
+    const ModeFootprint* find(const std::string& name) const;
+    const std::vector<ModeFootprint>& footprints() const { return modes; }
+
+    // Table lines for the system shell
+    std::vector<std::string> formatLines() const;
+
+private:
+    std::function<Memory()> probe;
+    std::function<uint32_t()> clock;
+    std::vector<ModeFootprint> modes;
+    uint32_t providerUs = 0;
+    uint32_t providerHeap = 0;
+    uint32_t bootMs = 0;
+
+    ModeFootprint& entry(const std::string& name);
+    void recordBuild(const std::string& name, const Memory& before, const Memory& after, uint32_t elapsedUs);
+    void recordRelease(const std::string& name, const Memory& before, const Memory& after);
+};
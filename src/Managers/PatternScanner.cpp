@@ -0,0 +1,130 @@
+#include "PatternScanner.h"
+
+static inline uint8_t foldCase(uint8_t b) {
+    return (b >= 'A' && b <= 'Z') ? (uint8_t)(b + 32) : b;
+}
+
+/*
+Build
+*/
+bool PatternAutomaton::build(const PatternSpec* patterns, size_t count) {
+    if (count == 0 || count > MaxPatterns) return false;
+
+    // Byte classes, 0 for bytes found in no pattern
+    byteClass.assign(256, 0);
+    uint16_t classCount = 1;
+    size_t totalLength = 0;
+    for (size_t p = 0; p < count; ++p) {
+        if (patterns[p].length == 0 || patterns[p].length > PatternScanner::MaxPatternLength) return false;
+        totalLength += patterns[p].length;
+        for (size_t k = 0; k < patterns[p].length; ++k) {
+            uint8_t b = foldCase((uint8_t)patterns[p].bytes[k]);
+            if (!byteClass[b]) byteClass[b] = (uint8_t)classCount++;
+        }
+    }
+    if (totalLength + 1 >= PatternTable::NoOutput) return false;
+    for (int b = 'A'; b <= 'Z'; ++b) byteClass[b] = byteClass[b + 32];
+
+    // Trie, 0 is the root and never a child
+    next.assign((totalLength + 1) * classCount, 0);
+    match.assign(totalLength + 1, 0);
+    std::vector<bool> terminal(totalLength + 1, false);
+    uint16_t stateCount = 1;
+
+    for (size_t p = 0; p < count; ++p) {
+        uint32_t s = 0;
+        for (size_t k = 0; k < patterns[p].length; ++k) {
+            uint32_t c = byteClass[(uint8_t)patterns[p].bytes[k]];
+            uint16_t& edge = next[s * classCount + c];
+            if (!edge) edge = stateCount++;
+            s = edge;
+        }
+        // Duplicates keep the first pattern
+        if (!terminal[s]) {
+            terminal[s] = true;
+            match[s] = (uint8_t)p;
+        }
+    }
+    next.resize((size_t)stateCount * classCount);
+    match.resize(stateCount);
+
+    // Failure links breadth first, missing edges become DFA transitions
+    std::vector<uint16_t> fail(stateCount, 0);
+    std::vector<uint16_t> queue;
+    queue.reserve(stateCount);
+    output.assign(stateCount, PatternTable::NoOutput);
+    outputLink.assign(stateCount, PatternTable::NoOutput);
+
+    for (uint32_t c = 0; c < classCount; ++c) {
+        uint16_t child = next[c];
+        if (child) queue.push_back(child);
+    }
+    for (size_t head = 0; head < queue.size(); ++head) {
+        uint16_t r = queue[head];
+        outputLink[r] = output[fail[r]];
+        output[r] = terminal[r] ? r : outputLink[r];
+
+        for (uint32_t c = 0; c < classCount; ++c) {
+            uint16_t& edge = next[r * classCount + c];
+            uint16_t fallback = next[fail[r] * classCount + c];
+            if (edge) {
+                fail[edge] = fallback;
+                queue.push_back(edge);
+            } else {
+                edge = fallback;
+            }
+        }
+    }
+
+    view.byteClass = byteClass.data();
+    view.next = next.data();
+    view.output = output.data();
+    view.outputLink = outputLink.data();
+    view.match = match.data();
+    view.patterns = patterns;
+    view.stateCount = stateCount;
+    view.classCount = classCount;
+    view.patternCount = (uint16_t)count;
+    return true;
+}
+
+/*
+Scanner
+*/
+PatternScanner::PatternScanner(const PatternTable& table) : table(table) {}
+
+void PatternScanner::reset(uint32_t newAddress) {
+    state = 0;
+    address = newAddress;
+    historyLength = 0;
+}
+
+bool PatternScanner::matchesRaw(const PatternSpec& pattern, const uint8_t* data, size_t end) const {
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(pattern.bytes);
+    size_t len = pattern.length;
+    size_t inBlock = end + 1;
+
+    if (inBlock >= len) {
+        return memcmp(data + inBlock - len, bytes, len) == 0;
+    }
+
+    // Starts in the previous block
+    size_t before = len - inBlock;
+    if (before > historyLength) return false;
+    return memcmp(history + historyLength - before, bytes, before) == 0 &&
+           memcmp(data, bytes + before, inBlock) == 0;
+}
+
+void PatternScanner::keepHistory(const uint8_t* data, size_t len) {
+    if (len >= MaxPatternLength) {
+        memcpy(history, data + len - MaxPatternLength, MaxPatternLength);
+        historyLength = MaxPatternLength;
+        return;
+    }
+
+    size_t keep = MaxPatternLength - len;
+    if (keep > historyLength) keep = historyLength;
+    memmove(history, history + historyLength - keep, keep);
+    memcpy(history + keep, data, len);
+    historyLength = keep + len;
+}
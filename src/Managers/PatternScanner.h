@@ -0,0 +1,118 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// Pattern to look for, bytes may contain 0x00
+struct PatternSpec {
+    const char* bytes;
+    uint8_t length;
+    uint8_t flags;
+    const char* label;
+
+    static constexpr uint8_t IgnoreCase = 0x01;     // ASCII letters match in any case
+    static constexpr uint8_t FileSignature = 0x02;  // magic number, only meaningful at a block start
+};
+
+// Aho-Corasick automaton as a flat DFA over byte classes.
+// next[state * classCount + byteClass[b]] is the state after b, ASCII letters
+// share their class so the walk is case folded; case sensitive patterns are
+// checked on the raw bytes when they match. Tables can live in flash.
+struct PatternTable {
+    const uint8_t* byteClass;     // 256 entries
+    const uint16_t* next;         // stateCount * classCount entries
+    const uint16_t* output;       // first matching state on the suffix chain, NoOutput if none
+    const uint16_t* outputLink;   // next matching state on the suffix chain
+    const uint8_t* match;         // pattern ending at a matching state
+    const PatternSpec* patterns;
+    uint16_t stateCount;
+    uint16_t classCount;
+    uint16_t patternCount;
+
+    static constexpr uint16_t NoOutput = 0xFFFF;
+};
+
+// Builds a PatternTable at runtime, for patterns only known at run time
+// (user searches) or to generate the precompiled tables in Data/.
+class PatternAutomaton {
+public:
+    static constexpr size_t MaxPatterns = 255;
+
+    // False if a pattern is empty or too long, or if there are too many patterns
+    bool build(const PatternSpec* patterns, size_t count);
+
+    const PatternTable& table() const { return view; }
+
+    const std::vector<uint8_t>& byteClasses() const { return byteClass; }
+    const std::vector<uint16_t>& transitions() const { return next; }
+    const std::vector<uint16_t>& outputs() const { return output; }
+    const std::vector<uint16_t>& outputLinks() const { return outputLink; }
+    const std::vector<uint8_t>& matches() const { return match; }
+
+private:
+    std::vector<uint8_t> byteClass;
+    std::vector<uint16_t> next;
+    std::vector<uint16_t> output;
+    std::vector<uint16_t> outputLink;
+    std::vector<uint8_t> match;
+    PatternTable view{};
+};
+
+// Streams blocks through a PatternTable, the automaton state and the last
+// bytes are kept between calls so a match across two blocks is found
+// without reading an overlap again.
+class PatternScanner {
+public:
+    static constexpr size_t MaxPatternLength = 64;
+
+    explicit PatternScanner(const PatternTable& table);
+
+    // Start over, address is the position of the next byte scanned
+    void reset(uint32_t address = 0);
+
+    // onMatch(patternIndex, startAddress) for every match, in end order
+    template <typename Callback>
+    void scan(const uint8_t* data, size_t len, Callback&& onMatch) {
+        const uint8_t* byteClass = table.byteClass;
+        const uint16_t* next = table.next;
+        const uint16_t* output = table.output;
+        const uint32_t classes = table.classCount;
+        uint32_t s = state;
+
+        for (size_t i = 0; i < len; ++i) {
+            s = next[s * classes + byteClass[data[i]]];
+            if (output[s] != PatternTable::NoOutput) {
+                reportMatches(s, data, i, onMatch);
+            }
+        }
+
+        state = (uint16_t)s;
+        keepHistory(data, len);
+        address += (uint32_t)len;
+    }
+
+    uint32_t position() const { return address; }
+
+private:
+    const PatternTable& table;
+    uint16_t state = 0;
+    uint32_t address = 0;
+    uint8_t history[MaxPatternLength];  // bytes before the current block
+    size_t historyLength = 0;
+
+    template <typename Callback>
+    void reportMatches(uint32_t s, const uint8_t* data, size_t end, Callback& onMatch) {
+        for (uint16_t m = table.output[s]; m != PatternTable::NoOutput; m = table.outputLink[m]) {
+            uint8_t index = table.match[m];
+            const PatternSpec& pattern = table.patterns[index];
+            if (!(pattern.flags & PatternSpec::IgnoreCase) && !matchesRaw(pattern, data, end)) continue;
+            onMatch(index, address + (uint32_t)(end + 1) - pattern.length);
+        }
+    }
+
+    bool matchesRaw(const PatternSpec& pattern, const uint8_t* data, size_t end) const;
+    void keepHistory(const uint8_t* data, size_t len);
+};
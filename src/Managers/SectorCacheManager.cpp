@@ -0,0 +1,236 @@
+#include "SectorCacheManager.h"
+
+#include <algorithm>
+#include <cstring>
+
+SectorCacheManager::SectorCacheManager(IBlockDevice& device, uint32_t readAheadSectors,
+                                       uint32_t runSectors, uint32_t metadataSectors)
+    : device(device),
+      window((size_t)std::max<uint32_t>(readAheadSectors, 1) * SectorSize),
+      windowCapacity(std::max<uint32_t>(readAheadSectors, 1)),
+      run((size_t)std::max(runSectors, MetadataMaxRun) * SectorSize),
+      runCapacity(std::max(runSectors, MetadataMaxRun)),
+      slots(std::max<uint32_t>(metadataSectors, 1), Slot{0, 0, false}),
+      slotData((size_t)std::max<uint32_t>(metadataSectors, 1) * SectorSize) {}
+
+bool SectorCacheManager::read(uint32_t lba, uint8_t* out, uint32_t count) {
+    const uint32_t total = device.sectorCount();
+    if (count == 0) return true;
+    if (lba >= total || count > total - lba) return false;
+
+    counters.reads++;
+    bool sequential = lba == nextRead;
+    nextRead = lba + count;
+
+    uint32_t at = lba;
+    uint8_t* dst = out;
+    uint32_t left = count;
+    bool hit = true;
+
+    while (left) {
+        if (windowCount && at >= windowLba && at - windowLba < windowCount) {
+            uint32_t offset = at - windowLba;
+            uint32_t n = std::min(left, windowCount - offset);
+            memcpy(dst, &window[(size_t)offset * SectorSize], (size_t)n * SectorSize);
+            at += n;
+            dst += (size_t)n * SectorSize;
+            left -= n;
+        } else if (sequential && left < windowCapacity) {
+            // Read ahead from here, the rest of the request included
+            uint32_t n = std::min(windowCapacity, total - at);
+            windowCount = 0;
+            if (!readDevice(at, window.data(), n)) return false;
+            windowLba = at;
+            windowCount = n;
+            hit = false;
+        } else {
+            // Random access or larger than the window, straight to the caller
+            if (!readDevice(at, dst, left)) return false;
+            hit = false;
+            left = 0;
+        }
+    }
+
+    if (hit) counters.readHits++;
+    overlayDirty(lba, out, count);
+    return true;
+}
+
+bool SectorCacheManager::write(uint32_t lba, const uint8_t* data, uint32_t count) {
+    const uint32_t total = device.sectorCount();
+    if (count == 0) return true;
+    if (lba >= total || count > total - lba) return false;
+
+    counters.writes++;
+
+    // Too large to gather, one multi block write
+    if (count > runCapacity) {
+        if (!flushRun()) return false;
+        dropSlots(lba, count);
+        return writeDevice(lba, data, count);
+    }
+
+    // Rewrite inside the run
+    if (runCount && lba >= runLba && lba + count <= runLba + runCount) {
+        memcpy(&run[(size_t)(lba - runLba) * SectorSize], data, (size_t)count * SectorSize);
+        return true;
+    }
+
+    // Extends the run
+    if (runCount && lba == runLba + runCount && runCount + count <= runCapacity) {
+        dropSlots(lba, count);
+        memcpy(&run[(size_t)runCount * SectorSize], data, (size_t)count * SectorSize);
+        runCount += count;
+        return true;
+    }
+
+    // Metadata, sector by sector, the part overlapping the run stays there
+    if (count <= MetadataMaxRun) {
+        for (uint32_t i = 0; i < count; ++i) {
+            const uint8_t* sector = data + (size_t)i * SectorSize;
+            if (inRun(lba + i)) {
+                memcpy(&run[(size_t)(lba + i - runLba) * SectorSize], sector, SectorSize);
+            } else if (!putSlot(lba + i, sector)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Start a new run, the previous one is complete
+    if (!flushRun()) return false;
+    dropSlots(lba, count);
+    memcpy(run.data(), data, (size_t)count * SectorSize);
+    runLba = lba;
+    runCount = count;
+    return true;
+}
+
+bool SectorCacheManager::flush() {
+    counters.flushes++;
+    if (!flushRun()) return false;
+    if (!flushSlots()) return false;
+    return device.sync();
+}
+
+bool SectorCacheManager::invalidate() {
+    bool ok = flush();
+    windowCount = 0;
+    nextRead = UINT32_MAX;
+    return ok;
+}
+
+uint32_t SectorCacheManager::dirtySectors() const {
+    uint32_t dirty = runCount;
+    for (const auto& slot : slots) {
+        if (slot.used) dirty++;
+    }
+    return dirty;
+}
+
+bool SectorCacheManager::readDevice(uint32_t lba, uint8_t* out, uint32_t count) {
+    counters.deviceReads++;
+    counters.deviceSectorsRead += count;
+    return device.readSectors(lba, out, count);
+}
+
+bool SectorCacheManager::writeDevice(uint32_t lba, const uint8_t* data, uint32_t count) {
+    counters.deviceWrites++;
+    counters.deviceSectorsWritten += count;
+    if (!device.writeSectors(lba, data, count)) return false;
+
+    // Keep the window a copy of the device
+    if (windowCount) {
+        uint32_t start = std::max(lba, windowLba);
+        uint32_t end = std::min(lba + count, windowLba + windowCount);
+        if (start < end) {
+            memcpy(&window[(size_t)(start - windowLba) * SectorSize],
+                   data + (size_t)(start - lba) * SectorSize,
+                   (size_t)(end - start) * SectorSize);
+        }
+    }
+    return true;
+}
+
+bool SectorCacheManager::flushRun() {
+    if (!runCount) return true;
+    if (!writeDevice(runLba, run.data(), runCount)) return false;
+    runCount = 0;
+    return true;
+}
+
+bool SectorCacheManager::flushSlots() {
+    // Called with an empty run, its buffer gathers adjacent sectors
+    std::vector<size_t> order;
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (slots[i].used) order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(),
+              [this](size_t a, size_t b) { return slots[a].lba < slots[b].lba; });
+
+    size_t i = 0;
+    while (i < order.size()) {
+        uint32_t first = slots[order[i]].lba;
+        uint32_t n = 0;
+        while (i + n < order.size() && n < runCapacity && slots[order[i + n]].lba == first + n) {
+            memcpy(&run[(size_t)n * SectorSize], slotSector(order[i + n]), SectorSize);
+            n++;
+        }
+        if (!writeDevice(first, run.data(), n)) return false;
+        for (uint32_t k = 0; k < n; ++k) slots[order[i + k]].used = false;
+        i += n;
+    }
+    return true;
+}
+
+bool SectorCacheManager::putSlot(uint32_t lba, const uint8_t* data) {
+    size_t target = slots.size();
+    size_t oldest = 0;
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (slots[i].used && slots[i].lba == lba) {
+            target = i;
+            break;
+        }
+        if (!slots[i].used) {
+            if (target == slots.size()) target = i;
+        } else if (slots[oldest].used && slots[i].lastUse < slots[oldest].lastUse) {
+            oldest = i;
+        }
+    }
+
+    if (target == slots.size()) {
+        // Full, write back the least recently used sector
+        if (!writeDevice(slots[oldest].lba, slotSector(oldest), 1)) return false;
+        counters.evictions++;
+        target = oldest;
+    }
+
+    slots[target].lba = lba;
+    slots[target].lastUse = ++useClock;
+    slots[target].used = true;
+    memcpy(slotSector(target), data, SectorSize);
+    return true;
+}
+
+void SectorCacheManager::dropSlots(uint32_t lba, uint32_t count) {
+    for (auto& slot : slots) {
+        if (slot.used && slot.lba >= lba && slot.lba - lba < count) slot.used = false;
+    }
+}
+
+void SectorCacheManager::overlayDirty(uint32_t lba, uint8_t* out, uint32_t count) const {
+    if (runCount) {
+        uint32_t start = std::max(lba, runLba);
+        uint32_t end = std::min(lba + count, runLba + runCount);
+        if (start < end) {
+            memcpy(out + (size_t)(start - lba) * SectorSize,
+                   &run[(size_t)(start - runLba) * SectorSize],
+                   (size_t)(end - start) * SectorSize);
+        }
+    }
+    for (size_t i = 0; i < slots.size(); ++i) {
+        if (slots[i].used && slots[i].lba >= lba && slots[i].lba - lba < count) {
+            memcpy(out + (size_t)(slots[i].lba - lba) * SectorSize, slotSector(i), SectorSize);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Interfaces/IBlockDevice.h"
+
+struct SectorCacheStats {
+    uint32_t reads = 0;             // host requests
+    uint32_t writes = 0;
+    uint32_t readHits = 0;          // served from the read-ahead window
+    uint32_t deviceReads = 0;       // device commands
+    uint32_t deviceWrites = 0;
+    uint64_t deviceSectorsRead = 0;
+    uint64_t deviceSectorsWritten = 0;
+    uint32_t evictions = 0;         // dirty metadata sectors written early
+    uint32_t flushes = 0;
+};
+
+// Sector cache between the USB mass storage callbacks and the SD card.
+//
+// Reads continuing the previous request refill a read-ahead window with one
+// multi block read. Writes extending a run are gathered and written with one
+// multi block write when the run is full. Small scattered writes (FAT, directory
+// entries) stay in a write-back set of single sectors until flush(), or until
+// evicted, least recently used first. Reads always see the latest data.
+
+class SectorCacheManager {
+public:
+    static constexpr uint32_t SectorSize = 512;
+
+    // Writes of up to this many sectors outside the run are kept as metadata
+    static constexpr uint32_t MetadataMaxRun = 2;
+
+    SectorCacheManager(IBlockDevice& device, uint32_t readAheadSectors = 32,
+                       uint32_t runSectors = 32, uint32_t metadataSectors = 16);
+
+    bool read(uint32_t lba, uint8_t* out, uint32_t count);
+    bool write(uint32_t lba, const uint8_t* data, uint32_t count);
+
+    // Write every dirty sector, adjacent ones merged, then sync the device
+    bool flush();
+
+    // Flush and drop the read-ahead window, for a media change
+    bool invalidate();
+
+    uint32_t dirtySectors() const;
+    uint32_t sectorCount() const { return device.sectorCount(); }
+
+    const SectorCacheStats& stats() const { return counters; }
+    void resetStats() { counters = SectorCacheStats(); }
+
+private:
+    struct Slot {
+        uint32_t lba;
+        uint32_t lastUse;
+        bool used;
+    };
+
+    IBlockDevice& device;
+    SectorCacheStats counters;
+
+    // Clean copy of the device, always kept in sync with device writes
+    std::vector<uint8_t> window;
+    uint32_t windowCapacity;
+    uint32_t windowLba = 0;
+    uint32_t windowCount = 0;
+    uint32_t nextRead = UINT32_MAX;
+
+    // Dirty sequential run, [runLba, runLba + runCount)
+    std::vector<uint8_t> run;
+    uint32_t runCapacity;
+    uint32_t runLba = 0;
+    uint32_t runCount = 0;
+
+    // Dirty single sectors, never overlapping the run
+    std::vector<Slot> slots;
+    std::vector<uint8_t> slotData;
+    uint32_t useClock = 0;
+
+    bool inRun(uint32_t lba) const { return runCount && lba >= runLba && lba - runLba < runCount; }
+    bool readDevice(uint32_t lba, uint8_t* out, uint32_t count);
+    bool writeDevice(uint32_t lba, const uint8_t* data, uint32_t count);
+    bool flushRun();
+    bool flushSlots();
+    bool putSlot(uint32_t lba, const uint8_t* data);
+    void dropSlots(uint32_t lba, uint32_t count);
+    void overlayDirty(uint32_t lba, uint8_t* out, uint32_t count) const;
+    uint8_t* slotSector(size_t index) { return &slotData[index * SectorSize]; }
+    const uint8_t* slotSector(size_t index) const { return &slotData[index * SectorSize]; }
+};
@@ -0,0 +1,85 @@
+#include "SubGhzCaptureManager.h"
+
+#include <cstdio>
+#include <cstring>
+
+SubGhzCaptureManager::SubGhzCaptureManager(uint32_t* storage, size_t capacity, uint32_t ticksPerUs, size_t maxFrames)
+    : storage(storage),
+      capacityItems(storage ? capacity : 0),
+      ticksPerUs(ticksPerUs ? ticksPerUs : 1),
+      maxFrames(maxFrames) {
+    frameList.reserve(maxFrames);
+}
+
+void SubGhzCaptureManager::reset() {
+    used = 0;
+    frameList.clear();
+    framesDropped = 0;
+    itemsDropped = 0;
+}
+
+bool SubGhzCaptureManager::addFrame(const uint32_t* items, size_t count, uint64_t receivedUs) {
+    if (!count) return true;
+    if (count > capacityItems - used || frameList.size() >= maxFrames) {
+        framesDropped++;
+        itemsDropped += count;
+        return false;
+    }
+
+    memcpy(storage + used, items, count * sizeof(uint32_t));
+
+    SubGhzCaptureFrame fr;
+    fr.offset = used;
+    fr.count = (uint32_t)count;
+    fr.durationUs = frameDurationUs(items, count);
+    fr.startUs = receivedUs > fr.durationUs ? receivedUs - fr.durationUs : 0;
+    frameList.push_back(fr);
+    used += count;
+    return true;
+}
+
+uint64_t SubGhzCaptureManager::durationUs() const {
+    if (frameList.empty()) return 0;
+    const SubGhzCaptureFrame& last = frameList.back();
+    return last.startUs + last.durationUs - frameList.front().startUs;
+}
+
+std::vector<int32_t> SubGhzCaptureManager::timings() const {
+    std::vector<int32_t> out;
+    out.reserve(used * 2);
+    forEachTiming([&](int32_t t) { out.push_back(t); });
+    return out;
+}
+
+void SubGhzCaptureManager::formatFrame(size_t index, float mhz, std::string& out) const {
+    const SubGhzCaptureFrame& fr = frameList[index];
+    const uint32_t* items = storage + fr.offset;
+    char text[96];
+
+    uint32_t ticks = 0;
+    for (uint32_t i = 0; i < fr.count; ++i) {
+        ticks += (items[i] & 0x7FFF) + ((items[i] >> 16) & 0x7FFF);
+    }
+    snprintf(text, sizeof(text), "[raw %u pulses | freq=%.2f MHz | dur=%u ticks]\r\n",
+             (unsigned)fr.count, mhz, (unsigned)ticks);
+    out += text;
+
+    for (uint32_t i = 0; i < fr.count; ++i) {
+        uint32_t word = items[i];
+        snprintf(text, sizeof(text), "%c:%u | %c:%u   ",
+                 (word & 0x8000) ? 'H' : 'L', (unsigned)(word & 0x7FFF),
+                 (word & 0x80000000u) ? 'H' : 'L', (unsigned)((word >> 16) & 0x7FFF));
+        out += text;
+        if ((i + 1) % 4 == 0) out += "\r\n";
+    }
+    out += "\n\r";
+}
+
+uint32_t SubGhzCaptureManager::frameDurationUs(const uint32_t* items, size_t count) const {
+    uint64_t ticks = 0;
+    for (size_t i = 0; i < count; ++i) {
+        ticks += (items[i] & 0x7FFF) + ((items[i] >> 16) & 0x7FFF);
+    }
+    uint64_t us = ticks / ticksPerUs;
+    return us > 0xFFFFFFFFull ? 0xFFFFFFFFu : (uint32_t)us;
+}
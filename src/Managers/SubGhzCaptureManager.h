@@ -0,0 +1,102 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// One RMT receive block, the items between two idle periods
+struct SubGhzCaptureFrame {
+    size_t offset = 0;          // first item in the capture buffer
+    uint32_t count = 0;         // items
+    uint64_t startUs = 0;       // estimated from the receive time and the duration
+    uint32_t durationUs = 0;
+};
+
+// Raw Sub-GHz capture: RMT items copied as 32 bit words into a preallocated
+// buffer (PSRAM on the device), one block per frame, nothing formatted while
+// capturing. Timings and text are produced later by the consumer.
+//
+// Item word, as rmt_item32_t: duration0 bits 0-14, level0 bit 15,
+// duration1 bits 16-30, level1 bit 31. A zero duration ends the frame.
+
+class SubGhzCaptureManager {
+public:
+    // Gaps between frames are clipped to this in exported timings
+    static constexpr uint32_t MaxGapUs = 1000000;
+
+    // storage is not owned, capacity in items
+    SubGhzCaptureManager(uint32_t* storage, size_t capacity, uint32_t ticksPerUs = 1, size_t maxFrames = 1024);
+
+    void reset();
+
+    // Copy a received block, receivedUs is the time it was taken from the RMT
+    // ring; false and counted as dropped when it does not fit
+    bool addFrame(const uint32_t* items, size_t count, uint64_t receivedUs);
+
+    size_t frameCount() const { return frameList.size(); }
+    const SubGhzCaptureFrame& frame(size_t index) const { return frameList[index]; }
+    size_t itemCount() const { return used; }
+    size_t capacity() const { return capacityItems; }
+    bool full() const { return used >= capacityItems || frameList.size() >= maxFrames; }
+
+    uint32_t droppedFrames() const { return framesDropped; }
+    uint64_t droppedItems() const { return itemsDropped; }
+
+    // First frame start to last frame end
+    uint64_t durationUs() const;
+
+    // Signed timings in us, high positive and low negative, same levels merged.
+    // Frames are joined by their gap as a low timing. emit(int32_t) for each.
+    template <typename Emit>
+    void forEachTiming(Emit&& emit) const {
+        int32_t pending = 0;
+        auto push = [&](bool high, uint32_t us) {
+            if (!us) return;
+            int32_t value = (int32_t)(us > 0x7FFFFFFFu ? 0x7FFFFFFFu : us);
+            if (!high) value = -value;
+            if (pending && (pending > 0) == high) {
+                pending += value;
+                return;
+            }
+            if (pending) emit(pending);
+            pending = value;
+        };
+
+        for (size_t f = 0; f < frameList.size(); ++f) {
+            const SubGhzCaptureFrame& fr = frameList[f];
+            if (f > 0) {
+                const SubGhzCaptureFrame& prev = frameList[f - 1];
+                uint64_t prevEnd = prev.startUs + prev.durationUs;
+                uint64_t gap = fr.startUs > prevEnd ? fr.startUs - prevEnd : 0;
+                push(false, (uint32_t)(gap > MaxGapUs ? MaxGapUs : gap));
+            }
+            for (uint32_t i = 0; i < fr.count; ++i) {
+                uint32_t word = storage[fr.offset + i];
+                uint32_t d0 = word & 0x7FFF, d1 = (word >> 16) & 0x7FFF;
+                if (!d0) break;
+                push(word & 0x8000, d0 / ticksPerUs);
+                if (!d1) break;
+                push(word & 0x80000000u, d1 / ticksPerUs);
+            }
+        }
+        if (pending) emit(pending);
+    }
+
+    std::vector<int32_t> timings() const;
+
+    // "H:123 | L:456" text of a frame, 4 items per line
+    void formatFrame(size_t index, float mhz, std::string& out) const;
+
+private:
+    uint32_t* storage;
+    size_t capacityItems;
+    uint32_t ticksPerUs;
+    size_t maxFrames;
+    size_t used = 0;
+    std::vector<SubGhzCaptureFrame> frameList;
+    uint32_t framesDropped = 0;
+    uint64_t itemsDropped = 0;
+
+    uint32_t frameDurationUs(const uint32_t* items, size_t count) const;
+};
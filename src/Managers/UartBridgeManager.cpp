@@ -0,0 +1,169 @@
+#include "UartBridgeManager.h"
+#include <cstdio>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+UartBridgeManager::UartBridgeManager(ITerminalView& view, IInput& terminalInput, IInput& deviceInput)
+    : terminalView(view), terminalInput(terminalInput), deviceInput(deviceInput) {
+    #ifdef ARDUINO
+        clock = []() { return (uint32_t)millis(); };
+    #else
+        clock = []() {
+            using namespace std::chrono;
+            return (uint32_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+        };
+    #endif
+}
+
+void UartBridgeManager::setClock(std::function<uint32_t()> newClock) {
+    clock = std::move(newClock);
+}
+
+/*
+Run
+*/
+UartBridgeStats UartBridgeManager::run(IByteStream& port, const Options& options) {
+    UartBridgeStats stats;
+    txRing.clear();
+    echoRing.clear();
+
+    uint32_t start = clock();
+    uint32_t lastDevicePoll = start;
+    uint32_t windowStart = start;
+    uint32_t windowBytes = 0;
+    uint32_t overrunsAtStart = port.getOverrunCount();
+    bool unflushed = false;
+
+    while (true) {
+        // Device -> terminal, everything available in one block
+        size_t avail = port.available();
+        if (avail) {
+            size_t n = port.readBytes(rxBlock, avail < BlockSize ? avail : BlockSize);
+            if (n) {
+                forwardToTerminal(n, options.filterEcho);
+                stats.bytesIn += n;
+                windowBytes += n;
+                unflushed = true;
+            }
+        } else if (unflushed) {
+            // Line is idle, show what we have
+            terminalView.flush();
+            unflushed = false;
+        }
+
+        // Terminal -> device, bulk read then bulk write
+        size_t room = txRing.freeSpace();
+        if (room > sizeof(inputBlock)) room = sizeof(inputBlock);
+        size_t got = room ? terminalInput.readChars(inputBlock, room) : 0;
+        if (got) {
+            if (options.stopOnEnter) {
+                bool enter = false;
+                for (size_t i = 0; i < got; ++i) {
+                    if (inputBlock[i] == '\r' || inputBlock[i] == '\n') enter = true;
+                }
+                if (enter) break;
+            }
+            if (options.forwardInput) {
+                txRing.push(reinterpret_cast<const uint8_t*>(inputBlock), got);
+            }
+        }
+        if (!txRing.empty()) {
+            stats.bytesOut += drainToDevice(port, options.filterEcho);
+        }
+
+        uint32_t now = clock();
+
+        // Rate window
+        if (now - windowStart >= 1000) {
+            uint32_t rate = (uint32_t)((uint64_t)windowBytes * 1000 / (now - windowStart));
+            if (rate > stats.peakBytesPerSec) stats.peakBytesPerSec = rate;
+            windowStart = now;
+            windowBytes = 0;
+        }
+
+        // Stop button, only on a timer, it is slow on some boards
+        if (options.stopOnDeviceInput && now - lastDevicePoll >= options.devicePollMs) {
+            lastDevicePoll = now;
+            if (deviceInput.readChar() != KEY_NONE) break;
+        }
+    }
+
+    terminalView.flush();
+
+    uint32_t end = clock();
+    stats.durationMs = end - start;
+    stats.overruns = port.getOverrunCount() - overrunsAtStart;
+
+    // Short sessions never fill a whole window
+    if (stats.peakBytesPerSec == 0 && end > windowStart) {
+        stats.peakBytesPerSec = (uint32_t)((uint64_t)windowBytes * 1000 / (end - windowStart));
+    }
+
+    return stats;
+}
+
+/*
+Device -> terminal
+*/
+size_t UartBridgeManager::forwardToTerminal(size_t len, bool filterEcho) {
+    if (filterEcho && !echoRing.empty()) {
+        size_t out = 0;
+        for (size_t i = 0; i < len; ++i) {
+            uint8_t expected;
+            if (echoRing.peek(expected) && expected == rxBlock[i]) {
+                echoRing.pop(expected); // our own byte
+                continue;
+            }
+            rxBlock[out++] = rxBlock[i];
+        }
+        len = out;
+    }
+
+    if (len) {
+        terminalView.print(std::string(reinterpret_cast<const char*>(rxBlock), len));
+    }
+    return len;
+}
+
+/*
+Terminal -> device
+*/
+size_t UartBridgeManager::drainToDevice(IByteStream& port, bool filterEcho) {
+    uint8_t chunk[128];
+    size_t room = port.availableForWrite();
+    if (room > sizeof(chunk)) room = sizeof(chunk);
+    if (room == 0) return 0;
+
+    size_t n = txRing.pop(chunk, room);
+    size_t written = port.writeBytes(chunk, n);
+
+    if (filterEcho) {
+        echoRing.push(chunk, written);
+    }
+    return written;
+}
+
+/*
+Stats
+*/
+std::string UartBridgeManager::formatStats(const UartBridgeStats& stats) const {
+    char line[160];
+    uint32_t avg = stats.durationMs ? (uint32_t)(stats.bytesIn * 1000 / stats.durationMs) : 0;
+
+    snprintf(line, sizeof(line),
+        "RX %llu bytes, TX %llu bytes in %lu.%01lu s | avg %lu B/s, peak %lu B/s | %lu overruns",
+        (unsigned long long)stats.bytesIn,
+        (unsigned long long)stats.bytesOut,
+        (unsigned long)(stats.durationMs / 1000),
+        (unsigned long)((stats.durationMs % 1000) / 100),
+        (unsigned long)avg,
+        (unsigned long)stats.peakBytesPerSec,
+        (unsigned long)stats.overruns
+    );
+
+    return std::string(line);
+}
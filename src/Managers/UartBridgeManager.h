@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <functional>
+#include "Interfaces/IByteStream.h"
+#include "Interfaces/ITerminalView.h"
+#include "Interfaces/IInput.h"
+#include "Buffers/SpscRingBuffer.h"
+
+struct UartBridgeStats {
+    uint64_t bytesIn = 0;          // device -> terminal
+    uint64_t bytesOut = 0;         // terminal -> device
+    uint32_t peakBytesPerSec = 0;
+    uint32_t overruns = 0;
+    uint32_t durationMs = 0;
+};
+
+// Block based bridge between a byte stream and the terminal.
+// Every available byte is drained in one read and printed as one block,
+// terminal input is queued in a ring and written in bulk, device input
+// (the stop button) is only polled every devicePollMs.
+
+class UartBridgeManager {
+public:
+    struct Options {
+        bool forwardInput = true;       // terminal -> device
+        bool stopOnEnter = false;       // read only streaming, ENTER stops
+        bool stopOnDeviceInput = true;  // any ESP32 button stops
+        bool filterEcho = false;        // half duplex, drop our own bytes echoed back
+        uint32_t devicePollMs = 50;
+    };
+
+    UartBridgeManager(ITerminalView& view, IInput& terminalInput, IInput& deviceInput);
+
+    // Run until stopped, returns transfer counters
+    UartBridgeStats run(IByteStream& port, const Options& options);
+
+    // Human readable counters
+    std::string formatStats(const UartBridgeStats& stats) const;
+
+    // Time source in ms, millis() by default
+    void setClock(std::function<uint32_t()> clock);
+
+private:
+    ITerminalView& terminalView;
+    IInput& terminalInput;
+    IInput& deviceInput;
+    std::function<uint32_t()> clock;
+
+    static constexpr size_t BlockSize = 1024;
+    uint8_t rxBlock[BlockSize];
+    char inputBlock[128];
+
+    // Terminal -> device, waits here when the device TX buffer is full
+    SpscRingBuffer<uint8_t, 1024> txRing;
+
+    // Bytes sent on a half duplex line, expected back as echo
+    SpscRingBuffer<uint8_t, 256> echoRing;
+
+    size_t forwardToTerminal(size_t len, bool filterEcho);
+    size_t drainToDevice(IByteStream& port, bool filterEcho);
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Enums/ByteCodeEnum.h"
+
+// One step of a compiled instruction line.
+// Write is a span of count bytes at offset in the program bytes, every other
+// command is kept symbolic with its repeat count (r:16 is one Read of 16).
+struct ByteCodeOp {
+    ByteCodeEnum command;
+    uint32_t count;
+    uint32_t offset;
+};
+
+// Compiled instruction line, filled by InstructionTransformer::compile.
+// Consecutive written bytes are coalesced into one span, Start and Stop are
+// explicit steps. clear() keeps the capacity so a program reused for every
+// line stops allocating once it has grown.
+
+class ByteCodeProgram {
+public:
+    void clear() {
+        steps.clear();
+        data.clear();
+    }
+
+    void addWrite(uint8_t value) {
+        if (steps.empty() || steps.back().command != ByteCodeEnum::Write) {
+            steps.push_back({ByteCodeEnum::Write, 0, (uint32_t)data.size()});
+        }
+        data.push_back(value);
+        steps.back().count++;
+    }
+
+    void add(ByteCodeEnum command, uint32_t count = 1) {
+        steps.push_back({command, count, 0});
+    }
+
+    const std::vector<ByteCodeOp>& ops() const { return steps; }
+    const uint8_t* bytes(const ByteCodeOp& op) const { return data.data() + op.offset; }
+    size_t byteCount() const { return data.size(); }
+    bool empty() const { return steps.empty(); }
+
+private:
+    std::vector<ByteCodeOp> steps;
+    std::vector<uint8_t> data;
+};
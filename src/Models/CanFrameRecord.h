@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+// CAN frame as drained from the controller RX buffers.
+// Fixed size so it fits a preallocated ring, formatting happens on the
+// consumer side.
+
+#define CAN_FRAME_EXTENDED 0x01
+#define CAN_FRAME_REMOTE   0x02
+
+struct CanFrameRecord {
+    uint64_t timestampUs;   // esp_timer time at the INT service
+    uint32_t id;            // 11 or 29 bit identifier, no flag bits
+    uint8_t dlc;
+    uint8_t flags;          // CAN_FRAME_*
+    uint8_t data[8];
+
+    bool extended() const { return flags & CAN_FRAME_EXTENDED; }
+    bool remote() const { return flags & CAN_FRAME_REMOTE; }
+};
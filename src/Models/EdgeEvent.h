@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+// One transition seen on a pin, recorded by the edge ISR.
+// ticks is a free running counter (CPU cycles on the device) and wraps,
+// only differences between consecutive events are meaningful.
+
+struct EdgeEvent {
+    uint32_t ticks;
+    uint8_t level;      // level after the edge, 1 for a rising edge
+    uint8_t gap;        // 1 when edges were dropped just before this one
+};
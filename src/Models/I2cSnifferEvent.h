@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+
+// One bus event recorded by the I2C sniffer ISR.
+// ticks is the CPU cycle counter at the event and wraps, only differences
+// between events are meaningful.
+
+enum class I2cSnifferEventType : uint8_t {
+    Start = 1,      // START or repeated START
+    Stop,
+    Data,
+    Address,        // first byte after a START, address and R/W bit
+    Ack             // value 0 ACK, 1 NACK
+};
+
+struct I2cSnifferEvent {
+    uint32_t ticks;
+    I2cSnifferEventType type;
+    uint8_t value;
+    uint8_t gap;        // 1 when events were dropped just before this one
+};
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+// One addressed transfer decoded from sniffer events, from its START to the
+// STOP or to the repeated START of the next one.
+
+struct I2cTransaction {
+    uint64_t startTicks = 0;        // since the first event, unwrapped
+    uint32_t durationTicks = 0;
+    uint8_t address = 0;            // 7 bit
+    bool read = false;
+    bool addressAck = false;
+    bool repeatedStart = false;     // ended by a repeated START, no STOP
+    bool incomplete = false;        // events lost or bus reset inside
+    std::vector<uint8_t> data;
+    std::vector<bool> acks;         // per data byte, false for NACK
+
+    void clear() {
+        startTicks = durationTicks = 0;
+        address = 0;
+        read = addressAck = repeatedStart = incomplete = false;
+        data.clear();
+        acks.clear();
+    }
+};
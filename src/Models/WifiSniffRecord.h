@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+
+// Raw 802.11 frame as captured by the promiscuous callback.
+// Fixed size so it can be copied into a preallocated ring from the WiFi
+// task, decoding and formatting happen on the consumer side.
+
+#define WIFI_SNIFF_SNAPLEN 256
+
+struct WifiSniffRecord {
+    uint64_t timestampUs;   // esp_timer time at capture
+    uint16_t length;        // frame length on air, without FCS
+    uint16_t captured;      // bytes kept in frame[]
+    int8_t   rssi;          // dBm
+    uint8_t  channel;
+    uint8_t  frame[WIFI_SNIFF_SNAPLEN]; // 802.11 header first
+
+    uint16_t frameControl() const {
+        return captured >= 2 ? (uint16_t)(frame[0] | (frame[1] << 8)) : 0;
+    }
+    uint8_t type() const { return (frameControl() & 0x0C) >> 2; }
+    uint8_t subtype() const { return (frameControl() & 0xF0) >> 4; }
+
+    // Receiver, transmitter, BSSID (or nullptr if the header is cut)
+    const uint8_t* addr1() const { return captured >= 10 ? frame + 4 : nullptr; }
+    const uint8_t* addr2() const { return captured >= 16 ? frame + 10 : nullptr; }
+    const uint8_t* addr3() const { return captured >= 22 ? frame + 16 : nullptr; }
+};
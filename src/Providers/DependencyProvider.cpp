@@ -1,5 +1,158 @@
 #include "DependencyProvider.h"
 
+/*
+Mode modules, a mode services and controller built together. A rebuilt
+controller skips its config prompt, the settings are in the GlobalState.
+*/
+struct DependencyProvider::BluetoothModule {
+    static const char* name() { return "Bluetooth"; }
+    BluetoothService service;
+    BluetoothController controller;
+
+    BluetoothModule(DependencyProvider &p, bool)
+        : service(),
+          controller(p.terminalView, p.terminalInput, p.deviceInput, service, p.argTransformer, p.userInputManager) {}
+};
+
+struct DependencyProvider::NetworkModule {
+    static const char* name() { return "Network"; }
+    NvsService nvsService;
+    WifiOpenScannerService wifiScannerService;
+    EthernetService ethernetService;
+    SshService sshService;
+    NetcatService netcatService;
+    NmapService nmapService;
+    ICMPService icmpService;
+    HttpService httpService;
+    TelnetService telnetService;
+    ModbusService modbusService;
+    ModbusShell modbusShell;
+    WifiController wifiController;
+    EthernetController ethernetController;
+
+    NetworkModule(DependencyProvider &p, bool)
+        : modbusShell(p.terminalView, p.terminalInput, p.argTransformer, p.userInputManager, modbusService),
+          wifiController(p.terminalView, p.terminalInput, p.deviceInput, p.wifiService, wifiScannerService, ethernetService, sshService, netcatService, nmapService, icmpService, nvsService, httpService, telnetService, p.littleFsService, p.argTransformer, p.jsonTransformer, p.wifiSniffTransformer, p.userInputManager, modbusShell),
+          ethernetController(p.terminalView, p.terminalInput, p.deviceInput, p.wifiService, wifiScannerService, ethernetService, sshService, netcatService, nmapService, icmpService, nvsService, httpService, telnetService, p.littleFsService, p.argTransformer, p.jsonTransformer, p.wifiSniffTransformer, p.userInputManager, modbusShell) {}
+};
+
+struct DependencyProvider::CanModule {
+    static const char* name() { return "CAN"; }
+    CanService service;
+    CanController controller;
+
+    CanModule(DependencyProvider &p, bool rebuilt)
+        : service(),
+          controller(p.terminalView, p.terminalInput, p.userInputManager, service, p.littleFsService, p.argTransformer, p.canLogTransformer) {
+        if (rebuilt) controller.markConfigured();
+    }
+};
+
+struct DependencyProvider::SubGhzModule {
+    static const char* name() { return "SubGHz"; }
+    SubGhzService service;
+    SubGhzAnalyzeManager analyzeManager;
+    SubGhzController controller;
+
+    SubGhzModule(DependencyProvider &p, bool rebuilt)
+        : service(),
+          analyzeManager(),
+          controller(p.terminalView, p.terminalInput, p.deviceView, service, p.pinService, p.i2sService, p.littleFsService, p.argTransformer, p.subGhzTransformer, p.userInputManager, analyzeManager) {
+        if (rebuilt) controller.markConfigured();
+    }
+};
+
+struct DependencyProvider::RfidModule {
+    static const char* name() { return "RFID"; }
+    RfidService service;
+    RfidController controller;
+
+    RfidModule(DependencyProvider &p, bool rebuilt)
+        : service(),
+          controller(p.terminalView, p.terminalInput, service, p.userInputManager, p.argTransformer) {
+        if (rebuilt) controller.markConfigured();
+    }
+};
+
+struct DependencyProvider::Rf24Module {
+    static const char* name() { return "RF24"; }
+    Rf24Service service;
+    Rf24Controller controller;
+
+    Rf24Module(DependencyProvider &p, bool rebuilt)
+        : service(),
+          controller(p.terminalView, p.terminalInput, p.deviceView, service, p.pinService, p.argTransformer, p.userInputManager) {
+        if (rebuilt) controller.markConfigured();
+    }
+};
+
+struct DependencyProvider::JtagModule {
+    static const char* name() { return "JTAG"; }
+    JtagService service;
+    JtagController controller;
+
+    JtagModule(DependencyProvider &p, bool rebuilt)
+        : service(),
+          controller(p.terminalView, p.terminalInput, service, p.userInputManager) {
+        if (rebuilt) controller.markConfigured();
+    }
+};
+
+struct DependencyProvider::LedModule {
+    static const char* name() { return "LED"; }
+    LedService service;
+    LedController controller;
+
+    LedModule(DependencyProvider &p, bool rebuilt)
+        : service(),
+          controller(p.terminalView, p.terminalInput, service, p.argTransformer, p.userInputManager) {
+        if (rebuilt) controller.markConfigured();
+    }
+};
+
+struct DependencyProvider::InfraredModule {
+    static const char* name() { return "Infrared"; }
+    InfraredService service;
+    UniversalRemoteShell universalRemoteShell;
+    InfraredController controller;
+
+    InfraredModule(DependencyProvider &p, bool rebuilt)
+        : service(),
+          universalRemoteShell(p.terminalView, p.terminalInput, service, p.argTransformer, p.userInputManager),
+          controller(p.terminalView, p.terminalInput, service, p.littleFsService, p.argTransformer, p.infraredTransformer, p.userInputManager, universalRemoteShell) {
+        if (rebuilt) controller.markConfigured();
+    }
+};
+
+// The I2S service is shared with SubGHz and stays in the provider
+struct DependencyProvider::I2sModule {
+    static const char* name() { return "I2S"; }
+    I2sController controller;
+
+    I2sModule(DependencyProvider &p, bool rebuilt)
+        : controller(p.terminalView, p.terminalInput, p.i2sService, p.argTransformer, p.userInputManager) {
+        if (rebuilt) controller.markConfigured();
+    }
+};
+
+template <typename Module>
+Module &DependencyProvider::load(std::unique_ptr<Module> &slot) {
+    if (!slot) {
+        bool rebuilt = modeFootprintManager.find(Module::name()) != nullptr;
+        modeFootprintManager.build(Module::name(), [&]() { slot.reset(new Module(*this, rebuilt)); });
+    }
+    return *slot;
+}
+
+template <typename Module, typename Stop>
+void DependencyProvider::unload(std::unique_ptr<Module> &slot, Stop stop) {
+    if (!slot) return;
+    modeFootprintManager.release(Module::name(), [&]() {
+        stop(*slot);
+        slot.reset();
+    });
+}
+
 DependencyProvider::DependencyProvider(ITerminalView &terminalView, IDeviceView &deviceView,
                                        IInput &terminalInput, IInput &deviceInput,
                                        IUsbService &usbService, IUsbController &usbController,
@@ -14,31 +167,19 @@ DependencyProvider::DependencyProvider(ITerminalView &terminalView, IDeviceView
 
       // Services
       sdService(),
-      nvsService(),
-      ledService(),
       uartService(),
       i2cService(),
       oneWireService(),
       twoWireService(),
       threeWireService(),
-      infraredService(),
       spiService(),
       pinService(),
-      bluetoothService(),
       wifiService(),
-      wifiScannerService(),
       i2sService(),
-      sshService(),
-      jtagService(),
-      canService(),
       systemService(),
-      ethernetService(),
-      httpService(),
-      telnetService(),
-      modbusService(),
-      subGhzService(),
-      rfidService(),
-      rf24Service(),
+      logicSamplerService(),
+      edgeCaptureService(),
+      scriptEngine(instructionTransformer),
 
       // Transformers
       commandTransformer(),
@@ -48,26 +189,36 @@ DependencyProvider::DependencyProvider(ITerminalView &terminalView, IDeviceView
       jsonTransformer(),
       infraredTransformer(),
       subGhzTransformer(),
+      wifiSniffTransformer(),
+      i2cSniffTransformer(),
+      canLogTransformer(),
+      xmodemTransformer(),
+      logicExportTransformer(),
+      sumpTransformer(),
+      rpcFrameTransformer(),
 
       // Managers
       commandHistoryManager(),
       binaryAnalyzeManager(terminalView, terminalInput),
       userInputManager(terminalView, terminalInput, argTransformer),
-      subGhzAnalyzeManager(),
+      uartBridgeManager(terminalView, terminalInput, deviceInput),
+      flashDumpManager(spiService),
+      edgeStatsManager(),
+      modeFootprintManager(),
 
       // Shells
       sdCardShell(sdService, terminalView, terminalInput, argTransformer, userInputManager),
-      spiFlashShell(spiService, terminalView, terminalInput, argTransformer, userInputManager, binaryAnalyzeManager),
+      spiFlashShell(spiService, terminalView, terminalInput, argTransformer, userInputManager, binaryAnalyzeManager, flashDumpManager, xmodemTransformer, littleFsService),
       spiEepromShell(spiService, terminalView, terminalInput, argTransformer, userInputManager, binaryAnalyzeManager),
       smartCardShell(twoWireService, terminalView, terminalInput, argTransformer, userInputManager),
-      universalRemoteShell(terminalView, terminalInput, infraredService, argTransformer, userInputManager),
       ibuttonShell(terminalView, terminalInput, userInputManager, argTransformer, oneWireService),
       i2cEepromShell(terminalView, terminalInput, i2cService, argTransformer, userInputManager, binaryAnalyzeManager),
       uartAtShell(terminalView, terminalInput, userInputManager, argTransformer, uartService),
       threeWireEepromShell(terminalView, terminalInput, userInputManager, threeWireService, argTransformer),
-      sysInfoShell(terminalView, terminalInput, userInputManager, argTransformer, systemService, wifiService),
-      modbusShell(terminalView, terminalInput, argTransformer, userInputManager, modbusService),
+      sysInfoShell(terminalView, terminalInput, userInputManager, argTransformer, systemService, wifiService, modeFootprintManager),
       oneWireEepromShell(terminalView, terminalInput, oneWireService, argTransformer, userInputManager, binaryAnalyzeManager),
+      logicAnalyzerShell(terminalView, deviceView, terminalInput, userInputManager, argTransformer, logicSamplerService, logicExportTransformer, sumpTransformer, littleFsService),
+      rpcShell(terminalView, spiService, i2cService, uartService, pinService, flashDumpManager, rpcFrameTransformer),
 
       // Selectors
       horizontalSelector(deviceView, deviceInput),
@@ -76,29 +227,20 @@ DependencyProvider::DependencyProvider(ITerminalView &terminalView, IDeviceView
       terminalTypeConfigurator(horizontalSelector),
 
       // Controllers
-      uartController(terminalView, terminalInput, deviceInput, uartService, sdService, hdUartService, argTransformer, userInputManager, uartAtShell),
-      i2cController(terminalView, terminalInput, i2cService, argTransformer, userInputManager, i2cEepromShell),
+      uartController(terminalView, terminalInput, deviceInput, uartService, sdService, hdUartService, argTransformer, userInputManager, uartBridgeManager, uartAtShell),
+      i2cController(terminalView, terminalInput, i2cService, littleFsService, argTransformer, i2cSniffTransformer, userInputManager, i2cEepromShell),
       oneWireController(terminalView, terminalInput, oneWireService, argTransformer, userInputManager, ibuttonShell, oneWireEepromShell),
-      infraredController(terminalView, terminalInput, infraredService, littleFsService, argTransformer, infraredTransformer, userInputManager, universalRemoteShell),
-      utilityController(terminalView, deviceView, terminalInput, pinService, userInputManager, argTransformer, sysInfoShell),
-      hdUartController(terminalView, terminalInput, deviceInput, hdUartService, uartService, argTransformer, userInputManager),
+      utilityController(terminalView, deviceView, terminalInput, pinService, userInputManager, argTransformer, sysInfoShell, logicAnalyzerShell, rpcShell),
+      hdUartController(terminalView, terminalInput, deviceInput, hdUartService, uartService, argTransformer, userInputManager, uartBridgeManager),
       spiController(terminalView, terminalInput, spiService, sdService, argTransformer, userInputManager, binaryAnalyzeManager, sdCardShell, spiFlashShell, spiEepromShell),
-      jtagController(terminalView, terminalInput, jtagService, userInputManager),
       twoWireController(terminalView, terminalInput, userInputManager, twoWireService, smartCardShell),
       threeWireController(terminalView, terminalInput, userInputManager, threeWireService, argTransformer, threeWireEepromShell),
-      dioController(terminalView, terminalInput, pinService, argTransformer),
-      ledController(terminalView, terminalInput, ledService, argTransformer, userInputManager),
-      bluetoothController(terminalView, terminalInput, deviceInput, bluetoothService, argTransformer, userInputManager),
-      i2sController(terminalView, terminalInput, i2sService, argTransformer, userInputManager),
-      wifiController(terminalView, terminalInput, deviceInput, wifiService, wifiScannerService, ethernetService, sshService, netcatService, nmapService, icmpService, nvsService, httpService, telnetService, argTransformer, jsonTransformer, userInputManager, modbusShell),
-      canController(terminalView, terminalInput, userInputManager, canService, argTransformer),
-      subGhzController(terminalView, terminalInput, deviceView, subGhzService, pinService, i2sService, littleFsService, argTransformer, subGhzTransformer, userInputManager, subGhzAnalyzeManager),
-      rfidController(terminalView, terminalInput, rfidService, userInputManager, argTransformer),
-      rf24Controller(terminalView, terminalInput, deviceView, rf24Service, pinService, argTransformer, userInputManager),
-      ethernetController(terminalView, terminalInput, deviceInput, wifiService, wifiScannerService, ethernetService, sshService, netcatService, nmapService, icmpService, nvsService, httpService, telnetService, argTransformer, jsonTransformer, userInputManager, modbusShell)
+      dioController(terminalView, terminalInput, pinService, argTransformer, edgeCaptureService, edgeStatsManager)
 {
 }
 
+DependencyProvider::~DependencyProvider() = default;
+
 // Accessors for core components
 ITerminalView &DependencyProvider::getTerminalView() { return terminalView; }
 void DependencyProvider::setTerminalView(ITerminalView &view) { terminalView = view; };
@@ -108,56 +250,59 @@ IInput &DependencyProvider::getDeviceInput() { return deviceInput; }
 
 // Services
 SdService &DependencyProvider::getSdService() { return sdService; }
-NvsService &DependencyProvider::getNvsService() { return nvsService; }
-LedService &DependencyProvider::getLedService() { return ledService; }
+NvsService &DependencyProvider::getNvsService() { return load(networkModule).nvsService; }
+LedService &DependencyProvider::getLedService() { return load(ledModule).service; }
 I2cService &DependencyProvider::getI2cService() { return i2cService; }
 UartService &DependencyProvider::getUartService() { return uartService; }
 OneWireService &DependencyProvider::getOneWireService() { return oneWireService; }
 TwoWireService &DependencyProvider::getTwoWireService() { return twoWireService; }
-InfraredService &DependencyProvider::getInfraredService() { return infraredService; }
+InfraredService &DependencyProvider::getInfraredService() { return load(infraredModule).service; }
 IUsbService &DependencyProvider::getUsbService() { return usbService; }
 SpiService &DependencyProvider::getSpiService() { return spiService; }
 HdUartService &DependencyProvider::getHdUartService() { return hdUartService; }
 PinService &DependencyProvider::getPinService() { return pinService; }
 WifiService &DependencyProvider::getWifiService() { return wifiService; }
-BluetoothService &DependencyProvider::getBluetoothService() { return bluetoothService; }
+BluetoothService &DependencyProvider::getBluetoothService() { return load(bluetoothModule).service; }
 I2sService &DependencyProvider::getI2sService() { return i2sService; }
-SshService &DependencyProvider::getSshService() { return sshService; }
-NetcatService &DependencyProvider::getNetcatService() { return netcatService; }
-NmapService &DependencyProvider::getNmapService() { return nmapService; }
-ICMPService &DependencyProvider::getICMPService() { return icmpService; }
-JtagService &DependencyProvider::getJtagService() { return jtagService; }
-CanService &DependencyProvider::getCanService() { return canService; }
-ModbusService &DependencyProvider::getModbusService() { return modbusService; }
+SshService &DependencyProvider::getSshService() { return load(networkModule).sshService; }
+NetcatService &DependencyProvider::getNetcatService() { return load(networkModule).netcatService; }
+NmapService &DependencyProvider::getNmapService() { return load(networkModule).nmapService; }
+ICMPService &DependencyProvider::getICMPService() { return load(networkModule).icmpService; }
+JtagService &DependencyProvider::getJtagService() { return load(jtagModule).service; }
+CanService &DependencyProvider::getCanService() { return load(canModule).service; }
+ModbusService &DependencyProvider::getModbusService() { return load(networkModule).modbusService; }
 SystemService &DependencyProvider::getSystemService() { return systemService; }
-EthernetService &DependencyProvider::getEthernetService() { return ethernetService; }
-SubGhzService &DependencyProvider::getSubGhzService() { return subGhzService; }
-RfidService &DependencyProvider::getRfidService() { return rfidService; }
-Rf24Service &DependencyProvider::getRf24Service() { return rf24Service; }
+EthernetService &DependencyProvider::getEthernetService() { return load(networkModule).ethernetService; }
+SubGhzService &DependencyProvider::getSubGhzService() { return load(subGhzModule).service; }
+RfidService &DependencyProvider::getRfidService() { return load(rfidModule).service; }
+Rf24Service &DependencyProvider::getRf24Service() { return load(rf24Module).service; }
 LittleFsService &DependencyProvider::getLittleFsService() { return littleFsService; }
+LogicSamplerService &DependencyProvider::getLogicSamplerService() { return logicSamplerService; }
+EdgeCaptureService &DependencyProvider::getEdgeCaptureService() { return edgeCaptureService; }
+ScriptEngine &DependencyProvider::getScriptEngine() { return scriptEngine; }
 
 // Controllers
 UartController &DependencyProvider::getUartController() { return uartController; }
 I2cController &DependencyProvider::getI2cController() { return i2cController; }
 OneWireController &DependencyProvider::getOneWireController() { return oneWireController; }
 UtilityController &DependencyProvider::getUtilityController() { return utilityController; }
-InfraredController &DependencyProvider::getInfraredController() { return infraredController; }
+InfraredController &DependencyProvider::getInfraredController() { return load(infraredModule).controller; }
 IUsbController &DependencyProvider::getUsbController() { return usbController; }
 HdUartController &DependencyProvider::getHdUartController() { return hdUartController; }
 SpiController &DependencyProvider::getSpiController() { return spiController; }
-JtagController &DependencyProvider::getJtagController() { return jtagController; }
+JtagController &DependencyProvider::getJtagController() { return load(jtagModule).controller; }
 TwoWireController &DependencyProvider::getTwoWireController() { return twoWireController; }
 ThreeWireController &DependencyProvider::getThreeWireController() { return threeWireController; }
 DioController &DependencyProvider::getDioController() { return dioController; }
-LedController &DependencyProvider::getLedController() { return ledController; }
-WifiController &DependencyProvider::getWifiController() { return wifiController; }
-BluetoothController &DependencyProvider::getBluetoothController() { return bluetoothController; }
-I2sController &DependencyProvider::getI2sController() { return i2sController; }
-CanController &DependencyProvider::getCanController() { return canController; }
-EthernetController &DependencyProvider::getEthernetController() { return ethernetController; }
-SubGhzController &DependencyProvider::getSubGhzController() { return subGhzController; }
-RfidController &DependencyProvider::getRfidController() { return rfidController; }
-Rf24Controller &DependencyProvider::getRf24Controller() { return rf24Controller; }
+LedController &DependencyProvider::getLedController() { return load(ledModule).controller; }
+WifiController &DependencyProvider::getWifiController() { return load(networkModule).wifiController; }
+BluetoothController &DependencyProvider::getBluetoothController() { return load(bluetoothModule).controller; }
+I2sController &DependencyProvider::getI2sController() { return load(i2sModule).controller; }
+CanController &DependencyProvider::getCanController() { return load(canModule).controller; }
+EthernetController &DependencyProvider::getEthernetController() { return load(networkModule).ethernetController; }
+SubGhzController &DependencyProvider::getSubGhzController() { return load(subGhzModule).controller; }
+RfidController &DependencyProvider::getRfidController() { return load(rfidModule).controller; }
+Rf24Controller &DependencyProvider::getRf24Controller() { return load(rf24Module).controller; }
 
 // Transformers
 TerminalCommandTransformer &DependencyProvider::getCommandTransformer() { return commandTransformer; }
@@ -165,15 +310,26 @@ InstructionTransformer &DependencyProvider::getInstructionTransformer() { return
 ArgTransformer &DependencyProvider::getArgTransformer() { return argTransformer; }
 WebRequestTransformer &DependencyProvider::getWebRequestTransformer() { return webRequestTransformer; }
 JsonTransformer &DependencyProvider::getJsonTransformer() { return jsonTransformer; }
+WifiSniffTransformer &DependencyProvider::getWifiSniffTransformer() { return wifiSniffTransformer; }
+I2cSniffTransformer &DependencyProvider::getI2cSniffTransformer() { return i2cSniffTransformer; }
+CanLogTransformer &DependencyProvider::getCanLogTransformer() { return canLogTransformer; }
+XmodemTransformer &DependencyProvider::getXmodemTransformer() { return xmodemTransformer; }
+LogicExportTransformer &DependencyProvider::getLogicExportTransformer() { return logicExportTransformer; }
+SumpTransformer &DependencyProvider::getSumpTransformer() { return sumpTransformer; }
+RpcFrameTransformer &DependencyProvider::getRpcFrameTransformer() { return rpcFrameTransformer; }
 
 // Managers
 CommandHistoryManager &DependencyProvider::getCommandHistoryManager() { return commandHistoryManager; }
 UserInputManager &DependencyProvider::getUserInputManager() { return userInputManager; }
 BinaryAnalyzeManager &DependencyProvider::getBinaryAnalyzeManager() { return binaryAnalyzeManager; }
+UartBridgeManager &DependencyProvider::getUartBridgeManager() { return uartBridgeManager; }
+FlashDumpManager &DependencyProvider::getFlashDumpManager() { return flashDumpManager; }
+EdgeStatsManager &DependencyProvider::getEdgeStatsManager() { return edgeStatsManager; }
+ModeFootprintManager &DependencyProvider::getModeFootprintManager() { return modeFootprintManager; }
 
 // Shells
 SdCardShell &DependencyProvider::getSdCardShell() { return sdCardShell; }
-UniversalRemoteShell &DependencyProvider::getUniversalRemoteShell() { return universalRemoteShell; }
+UniversalRemoteShell &DependencyProvider::getUniversalRemoteShell() { return load(infraredModule).universalRemoteShell; }
 I2cEepromShell &DependencyProvider::getI2cEepromShell() { return i2cEepromShell; }
 SpiFlashShell &DependencyProvider::getSpiFlashShell() { return spiFlashShell; }
 SpiEepromShell &DependencyProvider::getSpiEepromShell() { return spiEepromShell; }
@@ -182,6 +338,8 @@ ThreeWireEepromShell &DependencyProvider::getThreeWireEepromShell() { return thr
 IbuttonShell &DependencyProvider::getIbuttonShell() { return ibuttonShell; }
 UartAtShell &DependencyProvider::getUartAtShell() { return uartAtShell; }
 SysInfoShell &DependencyProvider::getSysInfoShell() { return sysInfoShell; }
+LogicAnalyzerShell &DependencyProvider::getLogicAnalyzerShell() { return logicAnalyzerShell; }
+RpcShell &DependencyProvider::getRpcShell() { return rpcShell; }
 
 // Selectors
 HorizontalSelector &DependencyProvider::getHorizontalSelector() { return horizontalSelector; }
@@ -199,3 +357,17 @@ void DependencyProvider::disableAllProtocols()
   // getI2sService().end();
   // getTwoWireService().end();
 }
+
+// Commands stop their own captures, the CAN drain task and the IR receiver
+// timer are stopped again in case one was left running
+void DependencyProvider::releaseModules(ModeEnum keep)
+{
+  if (keep != ModeEnum::CAN_) unload(canModule, [](CanModule &m) { m.service.endCapture(); });
+  if (keep != ModeEnum::SUBGHZ) unload(subGhzModule, [](SubGhzModule &) {});
+  if (keep != ModeEnum::RFID) unload(rfidModule, [](RfidModule &) {});
+  if (keep != ModeEnum::RF24_) unload(rf24Module, [](Rf24Module &m) { m.service.stopListening(); });
+  if (keep != ModeEnum::JTAG) unload(jtagModule, [](JtagModule &) {});
+  if (keep != ModeEnum::LED) unload(ledModule, [](LedModule &) {});
+  if (keep != ModeEnum::Infrared) unload(infraredModule, [](InfraredModule &m) { m.service.stopReceiver(); });
+  if (keep != ModeEnum::I2S) unload(i2sModule, [](I2sModule &) {});
+}
@@ -39,6 +39,9 @@ and injecting shared instances of core components
 #include "Services/RfidService.h"
 #include "Services/Rf24Service.h"
 #include "Services/LittleFsService.h"
+#include "Services/LogicSamplerService.h"
+#include "Services/EdgeCaptureService.h"
+#include "Services/ScriptEngine.h"
 #include "Controllers/UartController.h"
 #include "Controllers/I2cController.h"
 #include "Controllers/OneWireController.h"
@@ -66,10 +69,21 @@ and injecting shared instances of core components
 #include "Transformers/JsonTransformer.h"
 #include "Transformers/WebRequestTransformer.h"
 #include "Transformers/SubGhzTransformer.h"
+#include "Transformers/WifiSniffTransformer.h"
+#include "Transformers/I2cSniffTransformer.h"
+#include "Transformers/CanLogTransformer.h"
+#include "Transformers/XmodemTransformer.h"
+#include "Transformers/LogicExportTransformer.h"
+#include "Transformers/SumpTransformer.h"
+#include "Transformers/RpcFrameTransformer.h"
 #include "Managers/CommandHistoryManager.h"
 #include "Managers/BinaryAnalyzeManager.h"
 #include "Managers/UserInputManager.h"
 #include "Managers/SubGhzAnalyzeManager.h"
+#include "Managers/UartBridgeManager.h"
+#include "Managers/FlashDumpManager.h"
+#include "Managers/EdgeStatsManager.h"
+#include "Managers/ModeFootprintManager.h"
 #include "Shells/SdCardShell.h"
 #include "Shells/UniversalRemoteShell.h"
 #include "Shells/I2cEepromShell.h"
@@ -82,7 +96,11 @@ and injecting shared instances of core components
 #include "Shells/SysInfoShell.h"
 #include "Shells/ModbusShell.h"
 #include "Shells/OneWireEepromShell.h"
+#include "Shells/LogicAnalyzerShell.h"
+#include "Shells/RpcShell.h"
 #include "Config/TerminalTypeConfigurator.h"
+#include "Enums/ModeEnum.h"
+#include <memory>
 
 class DependencyProvider
 {
@@ -92,6 +110,7 @@ public:
                        IUsbService &usbService,
                        IUsbController &usbController,
                        LittleFsService &littleFsService);
+    ~DependencyProvider();
 
     // Core Components
     ITerminalView &getTerminalView();
@@ -133,6 +152,9 @@ public:
     RfidService &getRfidService();
     Rf24Service &getRf24Service();
     LittleFsService &getLittleFsService();
+    LogicSamplerService &getLogicSamplerService();
+    EdgeCaptureService &getEdgeCaptureService();
+    ScriptEngine &getScriptEngine();
 
     // Controllers
     UartController &getUartController();
@@ -165,12 +187,23 @@ public:
     JsonTransformer &getJsonTransformer();
     InfraredRemoteTransformer &getInfraredTransformer();
     SubGhzTransformer &getSubGhzTransformer();
+    WifiSniffTransformer &getWifiSniffTransformer();
+    I2cSniffTransformer &getI2cSniffTransformer();
+    CanLogTransformer &getCanLogTransformer();
+    XmodemTransformer &getXmodemTransformer();
+    LogicExportTransformer &getLogicExportTransformer();
+    SumpTransformer &getSumpTransformer();
+    RpcFrameTransformer &getRpcFrameTransformer();
 
     // Managers
     CommandHistoryManager &getCommandHistoryManager();
     UserInputManager &getUserInputManager();
     BinaryAnalyzeManager &getBinaryAnalyzeManager();
     SubGhzAnalyzeManager &getSubGhzAnalyzeManager();
+    UartBridgeManager &getUartBridgeManager();
+    FlashDumpManager &getFlashDumpManager();
+    EdgeStatsManager &getEdgeStatsManager();
+    ModeFootprintManager &getModeFootprintManager();
 
     // Shells
     SdCardShell &getSdCardShell();
@@ -185,6 +218,8 @@ public:
     SysInfoShell &getSysInfoShell();
     ModbusShell &getModbusShell();
     OneWireEepromShell &getOneWireEepromShell();
+    LogicAnalyzerShell &getLogicAnalyzerShell();
+    RpcShell &getRpcShell();
 
     // Selectors
     HorizontalSelector &getHorizontalSelector();
@@ -195,6 +230,9 @@ public:
     // Disable
     void disableAllProtocols();
 
+    // Free the modules of every mode but this one
+    void releaseModules(ModeEnum keep);
+
 private:
     // Core Components
     ITerminalView &terminalView;
@@ -207,57 +245,31 @@ private:
 
     // Services
     SdService sdService;
-    NvsService nvsService;
-    LedService ledService;
     UartService uartService;
     I2cService i2cService;
     OneWireService oneWireService;
     TwoWireService twoWireService;
     ThreeWireService threeWireService;
-    InfraredService infraredService;
     HdUartService hdUartService;
     SpiService spiService;
     PinService pinService;
     WifiService wifiService;
-    WifiOpenScannerService wifiScannerService;
-    BluetoothService bluetoothService;
     I2sService i2sService;
-    SshService sshService;
-    NetcatService netcatService;
-    NmapService nmapService;
-    ICMPService icmpService;
-    JtagService jtagService;
-    CanService canService;
     SystemService systemService;
-    EthernetService ethernetService;
-    HttpService httpService;
-    TelnetService telnetService;
-    ModbusService modbusService;
-    SubGhzService subGhzService;
-    RfidService rfidService;
-    Rf24Service rf24Service;
+    LogicSamplerService logicSamplerService;
+    EdgeCaptureService edgeCaptureService;
+    ScriptEngine scriptEngine;
 
     // Controllers
     UartController uartController;
     I2cController i2cController;
     OneWireController oneWireController;
     UtilityController utilityController;
-    InfraredController infraredController;
     HdUartController hdUartController;
     SpiController spiController;
-    JtagController jtagController;
     TwoWireController twoWireController;
     ThreeWireController threeWireController;
     DioController dioController;
-    LedController ledController;
-    WifiController wifiController;
-    BluetoothController bluetoothController;
-    I2sController i2sController;
-    CanController canController;
-    EthernetController ethernetController;
-    SubGhzController subGhzController;
-    RfidController rfidController;
-    Rf24Controller rf24Controller;
 
     // Transformers
     TerminalCommandTransformer commandTransformer;
@@ -267,16 +279,25 @@ private:
     JsonTransformer jsonTransformer;
     InfraredRemoteTransformer infraredTransformer;
     SubGhzTransformer subGhzTransformer;
+    WifiSniffTransformer wifiSniffTransformer;
+    I2cSniffTransformer i2cSniffTransformer;
+    CanLogTransformer canLogTransformer;
+    XmodemTransformer xmodemTransformer;
+    LogicExportTransformer logicExportTransformer;
+    SumpTransformer sumpTransformer;
+    RpcFrameTransformer rpcFrameTransformer;
 
     // Managers
     CommandHistoryManager commandHistoryManager;
     UserInputManager userInputManager;
     BinaryAnalyzeManager binaryAnalyzeManager;
-    SubGhzAnalyzeManager subGhzAnalyzeManager;
+    UartBridgeManager uartBridgeManager;
+    FlashDumpManager flashDumpManager;
+    EdgeStatsManager edgeStatsManager;
+    ModeFootprintManager modeFootprintManager;
 
     // Shells
     SdCardShell sdCardShell;
-    UniversalRemoteShell universalRemoteShell;
     I2cEepromShell i2cEepromShell;
     SpiFlashShell spiFlashShell;
     SpiEepromShell spiEepromShell;
@@ -285,12 +306,42 @@ private:
     IbuttonShell ibuttonShell;
     UartAtShell uartAtShell;
     SysInfoShell sysInfoShell;
-    ModbusShell modbusShell;
     OneWireEepromShell oneWireEepromShell;
+    LogicAnalyzerShell logicAnalyzerShell;
+    RpcShell rpcShell;
 
     // Selectors
     HorizontalSelector horizontalSelector;
 
     // Config
     TerminalTypeConfigurator terminalTypeConfigurator;
+
+    // Mode modules, built on the first getter call and for most of them
+    // released on mode exit. Network and Bluetooth stay once built, their
+    // tasks and stack callbacks outlive the mode.
+    struct BluetoothModule;
+    struct NetworkModule;
+    struct CanModule;
+    struct SubGhzModule;
+    struct RfidModule;
+    struct Rf24Module;
+    struct JtagModule;
+    struct LedModule;
+    struct InfraredModule;
+    struct I2sModule;
+    std::unique_ptr<BluetoothModule> bluetoothModule;
+    std::unique_ptr<NetworkModule> networkModule;
+    std::unique_ptr<CanModule> canModule;
+    std::unique_ptr<SubGhzModule> subGhzModule;
+    std::unique_ptr<RfidModule> rfidModule;
+    std::unique_ptr<Rf24Module> rf24Module;
+    std::unique_ptr<JtagModule> jtagModule;
+    std::unique_ptr<LedModule> ledModule;
+    std::unique_ptr<InfraredModule> infraredModule;
+    std::unique_ptr<I2sModule> i2sModule;
+
+    template <typename Module>
+    Module &load(std::unique_ptr<Module> &slot);
+    template <typename Module, typename Stop>
+    void unload(std::unique_ptr<Module> &slot, Stop stop);
 };
\ No newline at end of file
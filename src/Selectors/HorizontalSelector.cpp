@@ -31,6 +31,8 @@ int HorizontalSelector::select(
                 break;
             case KEY_OK:
                 return currentIndex;
+            case KEY_ESC_CUSTOM:
+                return -1;
             default:
                 break;
         }
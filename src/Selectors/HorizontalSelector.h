@@ -11,6 +11,7 @@ class HorizontalSelector {
 public:
     HorizontalSelector(IDeviceView& display, IInput& input);
 
+    // Index of the option chosen, -1 when cancelled
     int select(
         const std::string& title,
         const std::vector<std::string>& options,
@@ -0,0 +1,174 @@
+#include "WebSocketOutputBuffer.h"
+
+/*
+Constructor
+*/
+WebSocketOutputBuffer::WebSocketOutputBuffer(size_t maxFrameSize, uint32_t flushDelayMs)
+    : maxFrameSize(maxFrameSize ? maxFrameSize : 1), flushDelayMs(flushDelayMs) {
+    frame.reserve(this->maxFrameSize);
+}
+
+/*
+Config
+*/
+void WebSocketOutputBuffer::setSink(FrameSink frameSink) {
+    sink = std::move(frameSink);
+}
+
+void WebSocketOutputBuffer::setMaxFrameSize(size_t size) {
+    flush();
+    maxFrameSize = size ? size : 1;
+    frame.reserve(maxFrameSize);
+}
+
+void WebSocketOutputBuffer::setFlushDelay(uint32_t delayMs) {
+    flushDelayMs = delayMs;
+}
+
+size_t WebSocketOutputBuffer::getMaxFrameSize() const {
+    return maxFrameSize;
+}
+
+uint32_t WebSocketOutputBuffer::getFlushDelay() const {
+    return flushDelayMs;
+}
+
+/*
+Write
+*/
+void WebSocketOutputBuffer::write(const char* data, size_t len, uint32_t nowMs) {
+    const uint8_t* in = reinterpret_cast<const uint8_t*>(data);
+    bool newline = false;
+    size_t i = 0;
+
+    while (i < len) {
+        uint8_t c = in[i];
+
+        // Continue a sequence started in a previous byte or write
+        if (partialExpected) {
+            if ((c & 0xC0) == 0x80) {
+                partial[partialLen++] = c;
+                if (partialLen == partialExpected) {
+                    append(reinterpret_cast<const char*>(partial), partialLen, nowMs);
+                    partialLen = partialExpected = 0;
+                }
+                i++;
+                continue;
+            }
+            // Truncated sequence, drop it and handle c as a new lead byte
+            partialLen = partialExpected = 0;
+        }
+
+        // ASCII run, copied in one go
+        if (c <= 0x7F) {
+            size_t start = i;
+            while (i < len && in[i] <= 0x7F) {
+                if (in[i] == '\n') newline = true;
+                i++;
+            }
+            append(data + start, i - start, nowMs);
+            continue;
+        }
+
+        uint8_t expected = sequenceLength(c);
+        if (expected) {
+            partial[0] = c;
+            partialLen = 1;
+            partialExpected = expected;
+        }
+        // else: invalid lead byte, skipped
+        i++;
+    }
+
+    if (newline) {
+        flush();
+    } else {
+        poll(nowMs);
+    }
+}
+
+/*
+Poll
+*/
+void WebSocketOutputBuffer::poll(uint32_t nowMs) {
+    if (!frame.empty() && (uint32_t)(nowMs - firstPendingMs) >= flushDelayMs) {
+        flush();
+    }
+}
+
+/*
+Flush
+*/
+void WebSocketOutputBuffer::flush() {
+    if (frame.empty()) return;
+
+    if (sink) {
+        sink(reinterpret_cast<const uint8_t*>(frame.data()), frame.size());
+    }
+    frameCount++;
+    byteCount += frame.size();
+    frame.clear();
+}
+
+/*
+Clear
+*/
+void WebSocketOutputBuffer::clear() {
+    frame.clear();
+    partialLen = partialExpected = 0;
+}
+
+size_t WebSocketOutputBuffer::pending() const {
+    return frame.size();
+}
+
+/*
+Stats
+*/
+uint32_t WebSocketOutputBuffer::getFrameCount() const {
+    return frameCount;
+}
+
+uint64_t WebSocketOutputBuffer::getByteCount() const {
+    return byteCount;
+}
+
+void WebSocketOutputBuffer::resetStats() {
+    frameCount = 0;
+    byteCount = 0;
+}
+
+/*
+Append complete characters, a multibyte char is never split across frames
+*/
+void WebSocketOutputBuffer::append(const char* data, size_t len, uint32_t nowMs) {
+    if (len > 1 && (static_cast<uint8_t>(data[0]) & 0x80)) {
+        if (frame.size() + len > maxFrameSize) flush();
+        if (frame.empty()) firstPendingMs = nowMs;
+        frame.append(data, len);
+        return;
+    }
+
+    while (len > 0) {
+        if (frame.size() >= maxFrameSize) flush();
+        if (frame.empty()) firstPendingMs = nowMs;
+
+        size_t room = maxFrameSize - frame.size();
+        size_t n = len < room ? len : room;
+        frame.append(data, n);
+        data += n;
+        len -= n;
+    }
+
+    if (frame.size() >= maxFrameSize) flush();
+}
+
+/*
+UTF-8 lead byte to sequence length, 0 if invalid
+*/
+uint8_t WebSocketOutputBuffer::sequenceLength(uint8_t lead) {
+    if ((lead & 0xE0) == 0xC0) return 2;
+    if ((lead & 0xF0) == 0xE0) return 3;
+    if ((lead & 0xF8) == 0xF0) return 4;
+    return 0;
+}
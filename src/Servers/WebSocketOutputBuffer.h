@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <functional>
+
+// Coalesces terminal output into WebSocket text frames.
+// Frames are emitted when full, on newline, when the oldest pending byte
+// is older than the flush delay, or on explicit flush().
+// Bytes are validated as UTF-8 on the fly, an incomplete sequence at the end
+// of a write is kept and completed by the next write instead of being dropped.
+
+class WebSocketOutputBuffer {
+public:
+    using FrameSink = std::function<void(const uint8_t* data, size_t len)>;
+
+    WebSocketOutputBuffer(size_t maxFrameSize = 1024, uint32_t flushDelayMs = 20);
+
+    // Where full frames are sent
+    void setSink(FrameSink frameSink);
+
+    // Frame size and deadline tuning
+    void setMaxFrameSize(size_t size);
+    void setFlushDelay(uint32_t delayMs);
+    size_t getMaxFrameSize() const;
+    uint32_t getFlushDelay() const;
+
+    // Queue bytes, nowMs is used for the flush deadline
+    void write(const char* data, size_t len, uint32_t nowMs);
+
+    // Flush if the deadline has expired
+    void poll(uint32_t nowMs);
+
+    // Send all complete characters now
+    void flush();
+
+    // Drop pending output
+    void clear();
+
+    // Pending bytes not yet sent (complete characters only)
+    size_t pending() const;
+
+    // Stats
+    uint32_t getFrameCount() const;
+    uint64_t getByteCount() const;
+    void resetStats();
+
+private:
+    FrameSink sink;
+    std::string frame;
+    size_t maxFrameSize;
+    uint32_t flushDelayMs;
+    uint32_t firstPendingMs = 0;
+
+    // Partial UTF-8 sequence carried across writes
+    uint8_t partial[4] = {0};
+    uint8_t partialLen = 0;
+    uint8_t partialExpected = 0;
+
+    uint32_t frameCount = 0;
+    uint64_t byteCount = 0;
+
+    void append(const char* data, size_t len, uint32_t nowMs);
+    static uint8_t sequenceLength(uint8_t lead);
+};
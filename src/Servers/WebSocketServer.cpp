@@ -4,7 +4,15 @@
 static const char* TAG = "WebSocketServer";
 
 WebSocketServer::WebSocketServer(httpd_handle_t sharedServer)
-    : server(sharedServer) {}
+    : server(sharedServer) {
+    output.setSink([this](const uint8_t* data, size_t len) {
+        sendFrame(data, len);
+    });
+
+    outputMutex = xSemaphoreCreateMutex();
+    pollTimer = xTimerCreate("wsFlush", pollPeriod(output.getFlushDelay()), pdTRUE, this, pollTimerCallback);
+    if (pollTimer) xTimerStart(pollTimer, 0);
+}
 
 void WebSocketServer::setupRoutes() {
     static httpd_uri_t ws_uri = {
@@ -46,9 +54,18 @@ esp_err_t WebSocketServer::wsHandler(httpd_req_t *req) {
     }
     frame.payload[frame.len] = '\0';
     
-    // Push chars one by one into buffer
-    for (size_t i = 0; i < frame.len; ++i) {
-        self->buffer.push_back(((char*)frame.payload)[i]);
+    // Bulk push into the ring, wait a bit for the reader if it is full
+    const char* data = (const char*)frame.payload;
+    size_t remaining = frame.len;
+    for (int attempt = 0; remaining > 0 && attempt < 200; ++attempt) {
+        size_t pushed = self->buffer.push(data, remaining);
+        data += pushed;
+        remaining -= pushed;
+        self->dataReady.notify();
+        if (remaining > 0) delay(1);
+    }
+    if (remaining > 0) {
+        ESP_LOGW(TAG, "Input ring full, %u bytes dropped", (unsigned)remaining);
     }
 
     free(frame.payload);
@@ -56,67 +73,79 @@ esp_err_t WebSocketServer::wsHandler(httpd_req_t *req) {
 }
 
 char WebSocketServer::readCharBlocking() {
-    while (buffer.empty()) {
-        delay(10);
+    // Waiting for the user, everything printed so far must be visible
+    flush();
+
+    char c;
+    while (!buffer.pop(c)) {
+        dataReady.wait(1000);
     }
-    char c = buffer.front();
-    buffer.pop_front();
     return c;
 }
 
 char WebSocketServer::readCharNonBlocking() {
-    if (buffer.empty()) return KEY_NONE;
-
-    char c = buffer.front();
-    buffer.pop_front();
+    char c;
+    if (!buffer.pop(c)) return KEY_NONE;
 
     return c;
 }
 
+size_t WebSocketServer::readChars(char* dst, size_t len) {
+    return buffer.pop(dst, len);
+}
+
 void WebSocketServer::sendText(const std::string& msg) {
     if (clientFd < 0) return;
 
-    // Sanitize UTF8
-    std::string safeMsg = sanitizeUtf8(msg);
+    // Coalesced and UTF8 sanitized, sent by sendFrame
+    xSemaphoreTake(outputMutex, portMAX_DELAY);
+    output.write(msg.data(), msg.size(), millis());
+    xSemaphoreGive(outputMutex);
+}
+
+void WebSocketServer::flush() {
+    xSemaphoreTake(outputMutex, portMAX_DELAY);
+    output.flush();
+    xSemaphoreGive(outputMutex);
+}
+
+void WebSocketServer::setMaxFrameSize(size_t size) {
+    xSemaphoreTake(outputMutex, portMAX_DELAY);
+    output.setMaxFrameSize(size);
+    xSemaphoreGive(outputMutex);
+}
+
+void WebSocketServer::setFlushDelay(uint32_t delayMs) {
+    xSemaphoreTake(outputMutex, portMAX_DELAY);
+    output.setFlushDelay(delayMs);
+    xSemaphoreGive(outputMutex);
+    if (pollTimer) xTimerChangePeriod(pollTimer, pollPeriod(delayMs), 0);
+}
+
+// Sends the pending output once its deadline expired, even while the
+// dispatcher is busy and not reading input
+void WebSocketServer::pollTimerCallback(TimerHandle_t timer) {
+    WebSocketServer* self = static_cast<WebSocketServer*>(pvTimerGetTimerID(timer));
+
+    // Never block the timer task, the writer flushes itself when full
+    if (xSemaphoreTake(self->outputMutex, 0) != pdTRUE) return;
+    self->output.poll(millis());
+    xSemaphoreGive(self->outputMutex);
+}
+
+// Half the delay, a frame waits at most 1.5x the flush delay
+TickType_t WebSocketServer::pollPeriod(uint32_t flushDelayMs) {
+    TickType_t ticks = pdMS_TO_TICKS(flushDelayMs / 2);
+    return ticks ? ticks : 1;
+}
+
+void WebSocketServer::sendFrame(const uint8_t* data, size_t len) {
+    if (clientFd < 0) return;
 
     httpd_ws_frame_t ws_pkt = {};
     ws_pkt.type = HTTPD_WS_TYPE_TEXT;
-    ws_pkt.payload = (uint8_t*) safeMsg.c_str();
-    ws_pkt.len = safeMsg.length();
+    ws_pkt.payload = const_cast<uint8_t*>(data);
+    ws_pkt.len = len;
 
     httpd_ws_send_frame_async(server, clientFd, &ws_pkt);
 }
-
-std::string WebSocketServer::sanitizeUtf8(const std::string& input) {
-    std::string output;
-    size_t i = 0;
-
-    while (i < input.size()) {
-        unsigned char c = input[i];
-
-        if (c <= 0x7F) {  // ASCII
-            output += c;
-            i++;
-        } else if ((c & 0xE0) == 0xC0 && i + 1 < input.size() &&
-                   (input[i+1] & 0xC0) == 0x80) {
-            output += input.substr(i, 2);
-            i += 2;
-        } else if ((c & 0xF0) == 0xE0 && i + 2 < input.size() &&
-                   (input[i+1] & 0xC0) == 0x80 &&
-                   (input[i+2] & 0xC0) == 0x80) {
-            output += input.substr(i, 3);
-            i += 3;
-        } else if ((c & 0xF8) == 0xF0 && i + 3 < input.size() &&
-                   (input[i+1] & 0xC0) == 0x80 &&
-                   (input[i+2] & 0xC0) == 0x80 &&
-                   (input[i+3] & 0xC0) == 0x80) {
-            output += input.substr(i, 4);
-            i += 4;
-        } else {
-            // Invalid byte or sequence, skip it
-            i++;
-        }
-    }
-
-    return output;
-}
\ No newline at end of file
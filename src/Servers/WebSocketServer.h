@@ -1,5 +1,4 @@
 #pragma once
-#include <deque>
 #include <esp_http_server.h>
 #include <vector>
 #include <string>
@@ -7,6 +6,12 @@
 #include <Arduino.h>
 #include <esp_log.h>
 #include <cstring>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/timers.h>
+#include "Servers/WebSocketOutputBuffer.h"
+#include "Buffers/SpscRingBuffer.h"
+#include "Buffers/RingNotifier.h"
 
 class WebSocketServer {
 public:
@@ -15,12 +20,29 @@ public:
 
     char readCharBlocking();
     char readCharNonBlocking();
+    size_t readChars(char* dst, size_t len);
     void sendText(const std::string& msg);
-    std::string sanitizeUtf8(const std::string& input);
+    void flush();
+
+    // Output coalescing
+    void setMaxFrameSize(size_t size);
+    void setFlushDelay(uint32_t delayMs);
 
 private:
     static esp_err_t wsHandler(httpd_req_t *req);
+    static void pollTimerCallback(TimerHandle_t timer);
+    void sendFrame(const uint8_t* data, size_t len);
     httpd_handle_t server;
-    static inline std::deque<char> buffer;
+    WebSocketOutputBuffer output;
+
+    // The flush deadline is checked by a timer, not by the reader,
+    // output is shared between the dispatcher and the timer task
+    SemaphoreHandle_t outputMutex = nullptr;
+    TimerHandle_t pollTimer = nullptr;
+    static TickType_t pollPeriod(uint32_t flushDelayMs);
+
+    // Filled by the httpd task, drained by the dispatcher task
+    static inline SpscRingBuffer<char, 4096> buffer;
+    RingNotifier dataReady;
     static inline int clientFd = -1; 
 };
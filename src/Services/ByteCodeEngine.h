@@ -0,0 +1,235 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include "Models/ByteCodeProgram.h"
+
+// Execution of a compiled ByteCodeProgram, one bus call per written span
+// instead of one transfer per byte. Reads fill a byte vector, the string
+// versions format them for the terminal: "A5 01 " hex, or raw text on UART.
+//
+// Every Bus provides:
+//   void delayUs(uint32_t us)
+//   void delayMs(uint32_t ms)
+//
+// SPI bus:
+//   void select(bool active)                                      // transaction and CS
+//   void transfer(const uint8_t* out, uint8_t* in, size_t count)  // in may be null
+//
+// I2C bus:
+//   void beginTransmission(uint8_t address)
+//   void write(const uint8_t* data, size_t count)
+//   void endTransmission(bool stop)
+//   size_t requestFrom(uint8_t address, uint8_t* out, size_t count)  // bytes read
+//
+// Stream (UART, half duplex UART):
+//   void write(const uint8_t* data, size_t count)
+//   size_t read(uint8_t* out, size_t count, uint32_t timeoutMs)       // bytes read
+//
+// 1-Wire bus:
+//   void reset()
+//   void write(const uint8_t* data, size_t count)
+//   void read(uint8_t* out, size_t count)
+
+class ByteCodeEngine {
+public:
+    static constexpr size_t ReadChunk = 64;
+    static constexpr uint32_t StreamReadTimeoutMs = 2000;
+
+    template <typename Bus>
+    static std::string runSpi(const ByteCodeProgram& program, Bus& bus) {
+        std::vector<uint8_t> read;
+        runSpi(program, bus, read);
+        return toHex(read);
+    }
+
+    template <typename Bus>
+    static void runSpi(const ByteCodeProgram& program, Bus& bus, std::vector<uint8_t>& read) {
+        static const uint8_t zeros[ReadChunk] = {};
+        read.clear();
+        bool selected = false;
+
+        for (const ByteCodeOp& op : program.ops()) {
+            switch (op.command) {
+                case ByteCodeEnum::Start:
+                    if (!selected) bus.select(true);
+                    selected = true;
+                    break;
+                case ByteCodeEnum::Stop:
+                    if (selected) bus.select(false);
+                    selected = false;
+                    break;
+                case ByteCodeEnum::Write:
+                    bus.transfer(program.bytes(op), nullptr, op.count);
+                    break;
+                case ByteCodeEnum::Read:
+                    for (uint32_t done = 0; done < op.count;) {
+                        size_t n = std::min<size_t>(ReadChunk, op.count - done);
+                        size_t at = read.size();
+                        read.resize(at + n);
+                        bus.transfer(zeros, read.data() + at, n);
+                        done += (uint32_t)n;
+                    }
+                    break;
+                default:
+                    runDelay(op, bus);
+                    break;
+            }
+        }
+
+        if (selected) bus.select(false);
+    }
+
+    // The first byte written after a Start is the 7 bit device address
+    template <typename Bus>
+    static std::string runI2c(const ByteCodeProgram& program, Bus& bus) {
+        std::vector<uint8_t> read;
+        runI2c(program, bus, read);
+        return toHex(read);
+    }
+
+    template <typename Bus>
+    static void runI2c(const ByteCodeProgram& program, Bus& bus, std::vector<uint8_t>& read) {
+        read.clear();
+        uint8_t address = 0;
+        bool started = false;
+        bool expectAddress = false;
+
+        for (const ByteCodeOp& op : program.ops()) {
+            switch (op.command) {
+                case ByteCodeEnum::Start:
+                    expectAddress = true;
+                    break;
+                case ByteCodeEnum::Stop:
+                    if (started) bus.endTransmission(true);
+                    started = false;
+                    break;
+                case ByteCodeEnum::Write: {
+                    const uint8_t* data = program.bytes(op);
+                    size_t count = op.count;
+                    if (expectAddress) {
+                        address = data[0];
+                        data++;
+                        count--;
+                        expectAddress = false;
+                        bus.beginTransmission(address);
+                        started = true;
+                    } else if (!started) {
+                        bus.beginTransmission(address);
+                        started = true;
+                    }
+                    if (count) bus.write(data, count);
+                    break;
+                }
+                case ByteCodeEnum::Read: {
+                    if (started) bus.endTransmission(false);
+                    started = false;
+                    size_t count = std::min<uint32_t>(op.count, 255);
+                    size_t at = read.size();
+                    read.resize(at + count);
+                    size_t n = bus.requestFrom(address, read.data() + at, count);
+                    read.resize(at + n);
+                    break;
+                }
+                default:
+                    runDelay(op, bus);
+                    break;
+            }
+        }
+
+        if (started) bus.endTransmission(true);
+    }
+
+    // Start and Stop mean nothing on a stream
+    template <typename Stream>
+    static std::string runStream(const ByteCodeProgram& program, Stream& stream) {
+        std::vector<uint8_t> read;
+        runStream(program, stream, read);
+        return std::string(read.begin(), read.end());
+    }
+
+    template <typename Stream>
+    static void runStream(const ByteCodeProgram& program, Stream& stream, std::vector<uint8_t>& read) {
+        read.clear();
+        for (const ByteCodeOp& op : program.ops()) {
+            switch (op.command) {
+                case ByteCodeEnum::Write:
+                    stream.write(program.bytes(op), op.count);
+                    break;
+                case ByteCodeEnum::Read: {
+                    size_t before = read.size();
+                    read.resize(before + op.count);
+                    size_t n = stream.read(read.data() + before, op.count, StreamReadTimeoutMs);
+                    read.resize(before + n);
+                    break;
+                }
+                default:
+                    runDelay(op, stream);
+                    break;
+            }
+        }
+    }
+
+    // Start and Stop both send a reset pulse
+    template <typename Bus>
+    static std::string runOneWire(const ByteCodeProgram& program, Bus& bus) {
+        std::vector<uint8_t> read;
+        runOneWire(program, bus, read);
+        return toHex(read);
+    }
+
+    template <typename Bus>
+    static void runOneWire(const ByteCodeProgram& program, Bus& bus, std::vector<uint8_t>& read) {
+        read.clear();
+        for (const ByteCodeOp& op : program.ops()) {
+            switch (op.command) {
+                case ByteCodeEnum::Start:
+                case ByteCodeEnum::Stop:
+                    bus.reset();
+                    break;
+                case ByteCodeEnum::Write:
+                    bus.write(program.bytes(op), op.count);
+                    break;
+                case ByteCodeEnum::Read:
+                    for (uint32_t done = 0; done < op.count;) {
+                        size_t n = std::min<size_t>(ReadChunk, op.count - done);
+                        size_t at = read.size();
+                        read.resize(at + n);
+                        bus.read(read.data() + at, n);
+                        done += (uint32_t)n;
+                    }
+                    break;
+                default:
+                    runDelay(op, bus);
+                    break;
+            }
+        }
+    }
+
+    static std::string toHex(const std::vector<uint8_t>& data) {
+        std::string out;
+        appendHex(out, data.data(), data.size());
+        return out;
+    }
+
+    static void appendHex(std::string& out, const uint8_t* data, size_t count) {
+        static const char digits[] = "0123456789ABCDEF";
+        size_t at = out.size();
+        out.resize(at + count * 3);
+        for (size_t i = 0; i < count; ++i) {
+            out[at++] = digits[data[i] >> 4];
+            out[at++] = digits[data[i] & 0x0F];
+            out[at++] = ' ';
+        }
+    }
+
+private:
+    template <typename Bus>
+    static void runDelay(const ByteCodeOp& op, Bus& bus) {
+        if (op.command == ByteCodeEnum::DelayUs) bus.delayUs(op.count);
+        else if (op.command == ByteCodeEnum::DelayMs) bus.delayMs(op.count);
+    }
+};
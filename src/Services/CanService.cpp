@@ -2,6 +2,7 @@
 #include <SPI.h>
 #include <cstdio>
 #include <cstring>
+#include <esp_timer.h>
 
 void CanService::configure(uint8_t cs, uint8_t sck, uint8_t miso, uint8_t mosi, uint32_t bitrateKbps) {
     // Save to use with reset()
@@ -224,3 +225,137 @@ bool CanService::probe() {
     mcp2515.setNormalMode();
     return false;
 }
+
+/*
+Capture
+*/
+void IRAM_ATTR CanService::onInterrupt() {
+    BaseType_t woken = pdFALSE;
+    if (drainTask) vTaskNotifyGiveFromISR(drainTask, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+// BIT MODIFY on CANINTF, the library only clears every flag at once and
+// would lose a frame received since the status read
+void CanService::clearRxFlag(uint8_t flag) {
+    static constexpr uint8_t InstructionBitModify = 0x05;
+    static constexpr uint8_t RegisterCanintf = 0x2C;
+
+    SPI.beginTransaction(SPISettings(10000000, MSBFIRST, SPI_MODE0));
+    digitalWrite(CAN_CS_PIN, LOW);
+    SPI.transfer(InstructionBitModify);
+    SPI.transfer(RegisterCanintf);
+    SPI.transfer(flag);     // mask
+    SPI.transfer(0x00);     // data
+    digitalWrite(CAN_CS_PIN, HIGH);
+    SPI.endTransaction();
+}
+
+void CanService::drainBuffers() {
+    // INT stays low while a flag is set, empty both buffers before returning
+    for (int pass = 0; pass < MaxDrainPasses; ++pass) {
+        uint8_t status = mcp2515.getStatus();
+        if (!(status & (MCP2515::CANINTF_RX0IF | MCP2515::CANINTF_RX1IF))) break;
+
+        const MCP2515::RXBn buffers[2] = {MCP2515::RXB0, MCP2515::RXB1};
+        const uint8_t flags[2] = {MCP2515::CANINTF_RX0IF, MCP2515::CANINTF_RX1IF};
+        for (int i = 0; i < 2; ++i) {
+            if (!(status & flags[i])) continue;
+
+            struct can_frame frame;
+            if (mcp2515.readMessage(buffers[i], &frame) != MCP2515::ERROR_OK) {
+                // DLC above 8, readMessage fails and leaves RXnIF set
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                clearRxFlag(flags[i]);
+                continue;
+            }
+
+            CanFrameRecord record;
+            record.timestampUs = (uint64_t)esp_timer_get_time();
+            record.flags = 0;
+            if (frame.can_id & CAN_EFF_FLAG) {
+                record.flags |= CAN_FRAME_EXTENDED;
+                record.id = frame.can_id & CAN_EFF_MASK;
+            } else {
+                record.id = frame.can_id & CAN_SFF_MASK;
+            }
+            if (frame.can_id & CAN_RTR_FLAG) record.flags |= CAN_FRAME_REMOTE;
+            record.dlc = frame.can_dlc;
+            memcpy(record.data, frame.data, 8);
+
+            if (!ring->push(record)) dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Frames the controller had no buffer for
+    uint8_t interrupts = mcp2515.getInterrupts();
+    if (interrupts & (MCP2515::CANINTF_ERRIF | MCP2515::CANINTF_MERRF)) {
+        uint8_t errors = mcp2515.getErrorFlags();
+        uint32_t lost = ((errors & MCP2515::EFLG_RX0OVR) ? 1 : 0) + ((errors & MCP2515::EFLG_RX1OVR) ? 1 : 0);
+        if (lost) {
+            overflows.fetch_add(lost, std::memory_order_relaxed);
+            mcp2515.clearRXnOVRFlags();
+        }
+        mcp2515.clearERRIF();
+        mcp2515.clearMERR();
+    }
+}
+
+void CanService::drainLoop(void*) {
+    // The timeout also catches an edge missed while draining
+    const TickType_t wait = capturePin == 0xFF ? 1 : pdMS_TO_TICKS(10);
+    while (capturing) {
+        ulTaskNotifyTake(pdTRUE, wait);
+        drainBuffers();
+    }
+    drainTask = nullptr;
+    vTaskDelete(nullptr);
+}
+
+bool CanService::beginCapture(uint8_t intPin) {
+    endCapture();
+    ring = allocateIsrRing<FrameRing>();
+    if (!ring) return false;
+    dropped.store(0, std::memory_order_relaxed);
+    overflows.store(0, std::memory_order_relaxed);
+    mcp2515.clearRXnOVR();
+
+    capturePin = intPin;
+    capturing = true;
+    if (xTaskCreatePinnedToCore(drainLoop, "CanDrain", 4096, nullptr, configMAX_PRIORITIES - 2, &drainTask, 0) != pdPASS) {
+        capturing = false;
+        drainTask = nullptr;
+        freeIsrRing(ring);
+        return false;
+    }
+
+    if (intPin != 0xFF) {
+        pinMode(intPin, INPUT_PULLUP);
+        attachInterrupt(digitalPinToInterrupt(intPin), onInterrupt, FALLING);
+    }
+    return true;
+}
+
+void CanService::stopCapture() {
+    if (capturePin != 0xFF) {
+        detachInterrupt(digitalPinToInterrupt(capturePin));
+        capturePin = 0xFF;
+    }
+    if (!capturing) return;
+
+    // Let the task see the flag and exit
+    capturing = false;
+    while (drainTask) {
+        xTaskNotifyGive(drainTask);
+        delay(1);
+    }
+}
+
+void CanService::endCapture() {
+    stopCapture();
+    freeIsrRing(ring);
+}
+
+size_t CanService::readFrames(CanFrameRecord* out, size_t max) {
+    return ring ? ring->pop(out, max) : 0;
+}
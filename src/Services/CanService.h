@@ -2,8 +2,12 @@
 
 #include <string>
 #include <vector>
+#include <atomic>
 #include <mcp2515.h>
 #include <Arduino.h>
+#include "Buffers/SpscRingBuffer.h"
+#include "Buffers/IsrRingAllocator.h"
+#include "Models/CanFrameRecord.h"
 
 // Must be global to work, cs pin needs to be set at compile time
 #ifdef DEVICE_TEMBEDS3CC1101
@@ -30,8 +34,35 @@ public:
 
     std::string getStatus();
     bool probe();
-    
+
+    // Capture: a task drains both RX buffers into a frame ring, woken by the
+    // MCP2515 INT pin (falling edge) or polling every tick when intPin is 0xFF.
+    // Nothing else may use the MCP2515 until endCapture(). The ring only
+    // exists between beginCapture() and endCapture(); stopCapture() stops the
+    // task and keeps it, for the frames still queued.
+    static constexpr size_t RingSize = 1024;
+    static constexpr int MaxDrainPasses = 32;           // the next wake picks up the rest
+    bool beginCapture(uint8_t intPin);
+    void stopCapture();
+    void endCapture();
+    size_t readFrames(CanFrameRecord* out, size_t max);
+    uint32_t droppedFrames() const { return dropped.load(std::memory_order_relaxed); }
+    uint32_t overflowCount() const { return overflows.load(std::memory_order_relaxed); }
+
 private:
+    using FrameRing = SpscRingBuffer<CanFrameRecord, RingSize>;
+    static inline FrameRing* ring = nullptr;
+    static inline std::atomic<uint32_t> dropped{0};
+    static inline std::atomic<uint32_t> overflows{0};    // RX0OVR/RX1OVR, lost in the controller
+    static inline TaskHandle_t drainTask = nullptr;
+    static inline volatile bool capturing = false;
+    static inline uint8_t capturePin = 0xFF;
+
+    static void IRAM_ATTR onInterrupt();
+    static void drainLoop(void* arg);
+    static void drainBuffers();
+    static void clearRxFlag(uint8_t flag);
+
     CAN_SPEED resolveBitrate(uint32_t kbps);
     uint8_t csPin, sckPin, misoPin, mosiPin;
     uint32_t kbps;
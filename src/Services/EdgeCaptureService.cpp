@@ -0,0 +1,107 @@
+#include "EdgeCaptureService.h"
+#include <soc/gpio_reg.h>
+
+/*
+Edges
+*/
+void IRAM_ATTR EdgeCaptureService::onEdge() {
+    EdgeEvent event;
+    event.ticks = ESP.getCycleCount();
+    uint8_t pin = edgePin;
+    uint32_t in = pin < 32 ? REG_READ(GPIO_IN_REG) >> pin : REG_READ(GPIO_IN1_REG) >> (pin - 32);
+    event.level = (uint8_t)(in & 1);
+    event.gap = gapPending ? 1 : 0;
+
+    if (ring->push(event)) {
+        gapPending = false;
+    } else {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        gapPending = true;
+    }
+}
+
+bool EdgeCaptureService::beginEdges(uint8_t pin) {
+    endEdges();
+    ring = allocateIsrRing<EdgeRing>();
+    if (!ring) return false;
+    dropped.store(0, std::memory_order_relaxed);
+    gapPending = false;
+    edgePin = pin;
+    pinMode(pin, INPUT);
+    attachInterrupt(digitalPinToInterrupt(pin), onEdge, CHANGE);
+    return true;
+}
+
+void EdgeCaptureService::endEdges() {
+    if (edgePin == 0xFF) return;
+    detachInterrupt(digitalPinToInterrupt(edgePin));
+    edgePin = 0xFF;
+    freeIsrRing(ring);
+}
+
+size_t EdgeCaptureService::readEdges(EdgeEvent* out, size_t max) {
+    return ring ? ring->pop(out, max) : 0;
+}
+
+uint32_t EdgeCaptureService::tickRate() const {
+    return getCpuFrequencyMhz() * 1000000UL;
+}
+
+/*
+Counter
+*/
+void IRAM_ATTR EdgeCaptureService::onCounterLimit(void*) {
+    // The unit resets to 0 when it reaches the high limit
+    counterWraps.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool EdgeCaptureService::beginCounter(uint8_t pin) {
+    endCounter();
+
+    pcnt_config_t config = {};
+    config.pulse_gpio_num = pin;
+    config.ctrl_gpio_num = PCNT_PIN_NOT_USED;
+    config.channel = PCNT_CHANNEL_0;
+    config.unit = CounterUnit;
+    config.pos_mode = PCNT_COUNT_INC;
+    config.neg_mode = PCNT_COUNT_DIS;
+    config.lctrl_mode = PCNT_MODE_KEEP;
+    config.hctrl_mode = PCNT_MODE_KEEP;
+    config.counter_h_lim = CounterLimit;
+    config.counter_l_lim = 0;
+    if (pcnt_unit_config(&config) != ESP_OK) return false;
+
+    // No glitch filter, it would cap the countable frequency
+    pcnt_filter_disable(CounterUnit);
+    pcnt_event_enable(CounterUnit, PCNT_EVT_H_LIM);
+
+    esp_err_t err = pcnt_isr_service_install(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) return false; // already installed is fine
+    pcnt_isr_handler_add(CounterUnit, onCounterLimit, nullptr);
+
+    counterWraps.store(0, std::memory_order_relaxed);
+    pcnt_counter_pause(CounterUnit);
+    pcnt_counter_clear(CounterUnit);
+    pcnt_counter_resume(CounterUnit);
+    counterActive = true;
+    return true;
+}
+
+void EdgeCaptureService::endCounter() {
+    if (!counterActive) return;
+    pcnt_counter_pause(CounterUnit);
+    pcnt_event_disable(CounterUnit, PCNT_EVT_H_LIM);
+    pcnt_isr_handler_remove(CounterUnit);
+    counterActive = false;
+}
+
+uint64_t EdgeCaptureService::counterValue() {
+    // Read again if the unit wrapped in between
+    uint32_t wraps;
+    int16_t count = 0;
+    do {
+        wraps = counterWraps.load(std::memory_order_acquire);
+        pcnt_get_counter_value(CounterUnit, &count);
+    } while (wraps != counterWraps.load(std::memory_order_acquire));
+    return (uint64_t)wraps * CounterLimit + (uint16_t)count;
+}
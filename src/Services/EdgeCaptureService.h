@@ -0,0 +1,49 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <Arduino.h>
+#include <driver/pcnt.h>
+#include "Buffers/SpscRingBuffer.h"
+#include "Buffers/IsrRingAllocator.h"
+#include "Models/EdgeEvent.h"
+
+// Edge capture on one pin for the DIO commands.
+// Edges: a GPIO interrupt on both edges stamps each transition with the CPU
+// cycle counter and pushes it to a lock-free ring, a full ring drops and
+// counts; the ring is allocated by beginEdges and freed by endEdges. Counter: a PCNT unit counts rising edges in hardware, independent
+// of interrupt latency, for frequencies up to tens of MHz.
+
+class EdgeCaptureService {
+public:
+    static constexpr size_t RingSize = 4096;
+
+    // Timestamped edges, false when the ring cannot be allocated
+    bool beginEdges(uint8_t pin);
+    void endEdges();
+    size_t readEdges(EdgeEvent* out, size_t max);
+    uint32_t droppedEdges() const { return dropped.load(std::memory_order_relaxed); }
+    uint32_t tickRate() const;
+
+    // Hardware rising edge counter
+    bool beginCounter(uint8_t pin);
+    void endCounter();
+    uint64_t counterValue();
+
+private:
+    static constexpr pcnt_unit_t CounterUnit = PCNT_UNIT_0;
+    static constexpr int16_t CounterLimit = 30000;
+
+    using EdgeRing = SpscRingBuffer<EdgeEvent, RingSize>;
+    static inline EdgeRing* ring = nullptr;
+    static inline std::atomic<uint32_t> dropped{0};
+    static inline bool gapPending = false;      // ISR only, tags the next pushed edge
+    static inline std::atomic<uint32_t> counterWraps{0};
+    static inline uint8_t edgePin = 0xFF;
+
+    bool counterActive = false;
+
+    static void IRAM_ATTR onEdge();
+    static void IRAM_ATTR onCounterLimit(void* arg);
+};
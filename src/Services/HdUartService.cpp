@@ -1,4 +1,25 @@
 #include "HdUartService.h"
+#include "Services/ByteCodeEngine.h"
+
+namespace {
+// Bytecode spans go to the driver in one write
+struct HdUartProgramStream {
+    HdUartService& uart;
+    void write(const uint8_t* data, size_t count) { uart.writeBytes(data, count); }
+    size_t read(uint8_t* out, size_t count, uint32_t timeoutMs) {
+        size_t received = 0;
+        uint32_t start = millis();
+        while (received < count && millis() - start < timeoutMs) {
+            size_t n = uart.readBytes(out + received, count - received);
+            if (n) received += n;
+            else delay(1);
+        }
+        return received;
+    }
+    void delayUs(uint32_t us) { delayMicroseconds(us); }
+    void delayMs(uint32_t ms) { delay(ms); }
+};
+}
 
 void HdUartService::configure(unsigned long baud, uint8_t dataBits, char parity, uint8_t stopBits, uint8_t ioPin, bool inverted) {
     // Build config from raw values
@@ -23,6 +44,7 @@ void HdUartService::configure(unsigned long baud, uint8_t dataBits, char parity,
 
     // Apply UART config
     uart_driver_install(HD_UART_PORT, UART_RX_BUFFER_SIZE, 0, 0, NULL, 0);
+    overrunCount = 0;
     uart_param_config(HD_UART_PORT, &uart_config);
 
     // Route UART signals to shared pin
@@ -45,10 +67,36 @@ void HdUartService::write(const std::string& str) {
     uart_wait_tx_done(HD_UART_PORT, pdMS_TO_TICKS(100));
 }
 
-bool HdUartService::available() const {
+size_t HdUartService::available() const {
     size_t len = 0;
     uart_get_buffered_data_len(HD_UART_PORT, &len);
-    return len > 0;
+    return len;
+}
+
+size_t HdUartService::readBytes(uint8_t* dst, size_t len) {
+    size_t avail = available();
+    if (avail >= UART_RX_BUFFER_SIZE) {
+        overrunCount++; // driver buffer full, the next bytes are lost
+    }
+    if (len > avail) len = avail;
+    if (len == 0) return 0;
+
+    int n = uart_read_bytes(HD_UART_PORT, dst, len, 0);
+    return n > 0 ? n : 0;
+}
+
+size_t HdUartService::writeBytes(const uint8_t* src, size_t len) {
+    int n = uart_write_bytes(HD_UART_PORT, reinterpret_cast<const char*>(src), len);
+    uart_wait_tx_done(HD_UART_PORT, pdMS_TO_TICKS(100));
+    return n > 0 ? n : 0;
+}
+
+size_t HdUartService::availableForWrite() {
+    return SOC_UART_FIFO_LEN; // no TX ring, writes go straight to the FIFO
+}
+
+uint32_t HdUartService::getOverrunCount() const {
+    return overrunCount;
 }
 
 char HdUartService::read() {
@@ -57,46 +105,14 @@ char HdUartService::read() {
     return (len == 1) ? static_cast<char>(c) : '\0';
 }
 
-std::string HdUartService::executeByteCode(const std::vector<ByteCode>& bytecodes) {
-    std::string result;
-    uint32_t timeout = 2000;
-    uint32_t received = 0;
-    uint32_t start;
-
-    for (const ByteCode& code : bytecodes) {
-        switch (code.getCommand()) {
-            case ByteCodeEnum::Write:
-                for (uint32_t i = 0; i < code.getRepeat(); ++i) {
-                    write(code.getData());
-                }
-                break;
-
-            case ByteCodeEnum::Read:
-                start = millis();
-                while (received < code.getRepeat() && (millis() - start < timeout)) {
-                    if (available()) {
-                        result += read();
-                        ++received;
-                    } else {
-                        delay(1);
-                    }
-                }
-                break;
-
-            case ByteCodeEnum::DelayMs:
-                delay(code.getRepeat());
-                break;
-
-            case ByteCodeEnum::DelayUs:
-                delayMicroseconds(code.getRepeat());
-                break;
-
-            default:
-                break;
-        }
-    }
+std::string HdUartService::executeProgram(const ByteCodeProgram& program) {
+    HdUartProgramStream stream{*this};
+    return ByteCodeEngine::runStream(program, stream);
+}
 
-    return result;
+void HdUartService::executeProgram(const ByteCodeProgram& program, std::vector<uint8_t>& read) {
+    HdUartProgramStream stream{*this};
+    ByteCodeEngine::runStream(program, stream, read);
 }
 
 uart_config_t HdUartService::buildUartConfig(unsigned long baud, uint8_t bits, char parity, uint8_t stop) {
@@ -7,20 +7,26 @@
 #include "esp_rom_gpio.h"
 #include "hal/uart_types.h"
 #include "soc/uart_periph.h"
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
+#include "Interfaces/IByteStream.h"
 
 #define HD_UART_PORT UART_NUM_2
-#define UART_RX_BUFFER_SIZE 256
+#define UART_RX_BUFFER_SIZE 2048
 
-class HdUartService {
+class HdUartService : public IByteStream {
 public:
     void configure(unsigned long baud, uint8_t dataBits, char parity, uint8_t stopBits, uint8_t ioPin, bool inverted);
     void write(uint8_t data);
     void write(const std::string& str);
-    bool available() const;
+    size_t available() const override;
+    size_t readBytes(uint8_t* dst, size_t len) override;
+    size_t writeBytes(const uint8_t* src, size_t len) override;
+    size_t availableForWrite() override;
+    uint32_t getOverrunCount() const override;
     char read();
     std::string readLine();
-    std::string executeByteCode(const std::vector<ByteCode>& bytecodes);
+    std::string executeProgram(const ByteCodeProgram& program);
+    void executeProgram(const ByteCodeProgram& program, std::vector<uint8_t>& read);
     void flush();
     uart_config_t buildUartConfig(unsigned long baud, uint8_t bits, char parity, uint8_t stop);
     void end();
@@ -30,5 +36,6 @@ private:
     unsigned long baudRate;
     uint32_t serialConfig;
     bool isInverted;
+    uint32_t overrunCount = 0;
 
 };
@@ -0,0 +1,51 @@
+#include "I2cDumpEngine.h"
+
+#include <cstdio>
+
+I2cHexLineStream::I2cHexLineStream(uint32_t start) {
+    reset(start);
+}
+
+void I2cHexLineStream::put(uint32_t reg, uint8_t value, bool ok) {
+    size_t index = reg - lineStart;
+    if (index >= 16) return;
+    values[index] = value;
+    valid[index] = ok;
+    filled = index + 1;
+}
+
+void I2cHexLineStream::reset(uint32_t start) {
+    lineStart = start;
+    filled = 0;
+    for (size_t i = 0; i < 16; ++i) {
+        values[i] = 0xFF;
+        valid[i] = false;
+    }
+}
+
+std::string I2cHexLineStream::formatLine(uint32_t address, const uint8_t* values, const bool* valid, size_t count) {
+    std::string line;
+    line.reserve(80);
+
+    char text[12];
+    snprintf(text, sizeof(text), "%02X:", (unsigned)address);
+    line += text;
+
+    for (size_t i = 0; i < 16; ++i) {
+        if (i < count && valid[i]) {
+            snprintf(text, sizeof(text), " %02X", values[i]);
+            line += text;
+        } else if (i < count) {
+            line += " ??";
+        } else {
+            line += "   ";
+        }
+    }
+
+    line += "  ";
+    for (size_t i = 0; i < 16; ++i) {
+        char c = (i < count && valid[i]) ? (char)values[i] : '.';
+        line += (c >= 32 && c <= 126) ? c : '.';
+    }
+    return line;
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+struct I2cDumpOptions {
+    uint8_t address = 0x50;
+    uint32_t start = 0;
+    uint32_t length = 256;
+    uint8_t addressBytes = 1;       // register pointer width, 0 raw current address reads
+    bool blockInAddress = false;    // pointer bits above addressBytes go in the device address (24x16, 24M01)
+    uint16_t maxChunk = 128;        // Wire buffer or page size
+    uint16_t minChunk = 1;
+};
+
+struct I2cDumpStats {
+    uint32_t bytesRead = 0;
+    uint32_t bytesSkipped = 0;      // given up after retries
+    uint32_t chunks = 0;
+    uint32_t nacks = 0;
+    uint32_t shrinks = 0;
+    uint32_t grows = 0;
+    uint16_t lastChunk = 0;
+    bool cancelled = false;
+    bool aborted = false;
+    uint32_t elapsedUs = 0;         // filled by the caller
+
+    double bytesPerSecond() const {
+        return elapsedUs ? bytesRead * 1e6 / elapsedUs : 0;
+    }
+};
+
+// Chunked I2C memory and register dump.
+// Each chunk sets the register pointer with a repeated start and reads as
+// many bytes as the controller buffer holds. A NACK or short read halves the
+// chunk and retries at the same offset; a run of good chunks doubles it back.
+// Bytes still failing at the minimum chunk are skipped, several skips in a
+// row abort. Cancellation is polled once per chunk, never per byte.
+// Raw reads (addressBytes 0) have no pointer to resend, where a failed read
+// left the device is unknown: the chunk is marked unreadable, not retried,
+// and the next one starts by writing the pointer again as one byte.
+//
+// Bus provides:
+//   bool setPointer(uint8_t address, uint32_t reg, uint8_t addressBytes)  // false on NACK
+//   size_t readBlock(uint8_t address, uint8_t* out, size_t count)        // bytes read
+// Sink is called in order: void(uint32_t reg, const uint8_t* data, size_t count),
+// data is null for skipped bytes. Cancel is bool(), true to stop.
+
+class I2cDumpEngine {
+public:
+    static constexpr uint16_t MaxChunk = 255;   // requestFrom length is 8 bits
+    static constexpr uint8_t GrowAfter = 4;     // good chunks before doubling
+    static constexpr uint8_t RetriesAtMin = 3;
+    static constexpr uint8_t MaxConsecutiveSkips = 3;
+
+    template <typename Bus, typename Sink, typename Cancel>
+    static bool dump(Bus& bus, const I2cDumpOptions& options, Sink&& sink, Cancel&& cancel, I2cDumpStats& stats) {
+        stats = I2cDumpStats();
+        const uint16_t maxChunk = std::max<uint16_t>(1, std::min(options.maxChunk, MaxChunk));
+        const uint16_t minChunk = std::max<uint16_t>(1, std::min(options.minChunk, maxChunk));
+        const uint32_t blockSize = options.addressBytes ? (1u << (8 * std::min<uint8_t>(options.addressBytes, 3))) : 0;
+
+        uint8_t buffer[MaxChunk];
+        uint16_t chunk = maxChunk;
+        uint32_t offset = 0;
+        uint8_t good = 0, failures = 0, skips = 0;
+        const bool raw = options.addressBytes == 0;
+        bool reseat = false;
+
+        // Raw reads follow the device own pointer, set once
+        if (raw && !bus.setPointer(options.address, options.start, 1)) {
+            stats.nacks++;
+            stats.aborted = true;
+            return false;
+        }
+
+        while (offset < options.length) {
+            if (cancel()) {
+                stats.cancelled = true;
+                return false;
+            }
+
+            uint32_t reg = options.start + offset;
+            uint32_t count = std::min<uint32_t>(chunk, options.length - offset);
+            uint8_t device = options.address;
+            if (options.blockInAddress && blockSize) {
+                device |= (uint8_t)((reg / blockSize) & 0x07);
+                count = std::min(count, blockSize - reg % blockSize);
+            }
+
+            bool ok = raw ? !reseat || bus.setPointer(device, reg, 1)
+                          : bus.setPointer(device, reg, options.addressBytes);
+            ok = ok && bus.readBlock(device, buffer, count) == count;
+
+            if (ok) {
+                reseat = false;
+                sink(reg, (const uint8_t*)buffer, (size_t)count);
+                offset += count;
+                stats.bytesRead += count;
+                stats.chunks++;
+                failures = 0;
+                skips = 0;
+                if (++good >= GrowAfter && chunk < maxChunk) {
+                    chunk = (uint16_t)std::min<uint32_t>(chunk * 2u, maxChunk);
+                    stats.grows++;
+                    good = 0;
+                }
+                stats.lastChunk = chunk;
+                continue;
+            }
+
+            stats.nacks++;
+            good = 0;
+            if (raw) {
+                reseat = true;
+            } else if (chunk > minChunk) {
+                chunk = std::max<uint16_t>(chunk / 2, minChunk);
+                stats.shrinks++;
+                continue;
+            } else if (++failures < RetriesAtMin) {
+                continue;
+            }
+
+            // Unreadable here, move on
+            sink(reg, (const uint8_t*)nullptr, (size_t)count);
+            offset += count;
+            stats.bytesSkipped += count;
+            failures = 0;
+            if (++skips >= MaxConsecutiveSkips) {
+                stats.aborted = true;
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Hex dump lines built as the bytes arrive, 16 per line like printHexDump:
+// "10: 41 00 ?? ...  A..."
+class I2cHexLineStream {
+public:
+    explicit I2cHexLineStream(uint32_t start);
+
+    // Add bytes at reg, data null for unreadable ones; complete lines are
+    // passed to emit(const std::string&)
+    template <typename Emit>
+    void add(uint32_t reg, const uint8_t* data, size_t count, Emit&& emit) {
+        for (size_t i = 0; i < count; ++i) {
+            put(reg + (uint32_t)i, data ? data[i] : 0, data != nullptr);
+            if (filled == 16) {
+                emit(line());
+                reset(lineStart + 16);
+            }
+        }
+    }
+
+    // Last partial line, if any
+    template <typename Emit>
+    void finish(Emit&& emit) {
+        if (filled) emit(line());
+        reset(lineStart + 16);
+    }
+
+    static std::string formatLine(uint32_t address, const uint8_t* values, const bool* valid, size_t count);
+
+private:
+    uint32_t lineStart;
+    size_t filled = 0;
+    uint8_t values[16];
+    bool valid[16];
+
+    void put(uint32_t reg, uint8_t value, bool ok);
+    void reset(uint32_t start);
+    std::string line() const { return formatLine(lineStart, values, valid, filled); }
+};
@@ -1,7 +1,22 @@
 #include "I2cService.h"
 #include "driver/gpio.h"
+#include "Services/ByteCodeEngine.h"
+
+namespace {
+// Bytecode spans go to Wire in one write
+struct I2cProgramBus {
+    I2cService& i2c;
+    void beginTransmission(uint8_t address) { Wire.beginTransmission(address); }
+    void write(const uint8_t* data, size_t count) { Wire.write(data, count); }
+    void endTransmission(bool stop) { Wire.endTransmission(stop); }
+    size_t requestFrom(uint8_t address, uint8_t* out, size_t count) { return i2c.readBlock(address, out, count); }
+    void delayUs(uint32_t us) { delayMicroseconds(us); }
+    void delayMs(uint32_t ms) { delay(ms); }
+};
+}
 
 void I2cService::configure(uint8_t sda, uint8_t scl, uint32_t frequency) {
+    if (frequency > MaxFrequency) frequency = MaxFrequency;
     Wire.end();
     Wire.begin(sda, scl, frequency);
 }
@@ -34,81 +49,14 @@ bool I2cService::end() const {
     return Wire.end();
 }
 
-std::string I2cService::executeByteCode(const std::vector<ByteCode>& bytecodes) {
-    std::string result;
-    uint8_t currentAddress = 0;
-    bool transmissionStarted = false;
-    bool expectAddress = false;
-
-    for (const auto& code : bytecodes) {
-        switch (code.getCommand()) {
-            case ByteCodeEnum::Start:
-                expectAddress = true;
-                break;
-
-            case ByteCodeEnum::Stop:
-                if (transmissionStarted) {
-                    Wire.endTransmission();
-                    transmissionStarted = false;
-                }
-                break;
-
-            case ByteCodeEnum::Write:
-                if (expectAddress) {
-                    currentAddress = code.getData();
-                    Wire.beginTransmission(currentAddress);
-                    transmissionStarted = true;
-                    expectAddress = false;
-                } else {
-                    if (!transmissionStarted) {
-                        Wire.beginTransmission(currentAddress);
-                        transmissionStarted = true;
-                    }
-                    for (uint32_t i = 0; i < code.getRepeat(); ++i) {
-                        Wire.write(code.getData());
-                    }
-                }
-                break;
-
-                case ByteCodeEnum::Read: {
-                    if (transmissionStarted) {
-                        Wire.endTransmission(false);  // release bus
-                        transmissionStarted = false;
-                    }
-
-                    uint8_t toRead = code.getRepeat();
-                    uint8_t readAddr = currentAddress;
-
-                    Wire.requestFrom(readAddr, toRead);
-                    
-                    for (uint8_t i = 0; i < toRead && Wire.available(); ++i) {
-                        uint8_t val = Wire.read();
-                        char hex[5];
-                        snprintf(hex, sizeof(hex), "%02X ", val);
-                        result += hex;
-                    }
-                    break;
-                }
-
-            case ByteCodeEnum::DelayMs:
-                delay(code.getRepeat());
-                break;
-
-            case ByteCodeEnum::DelayUs:
-                delayMicroseconds(code.getRepeat());
-                break;
-
-            default:
-                break;
-        }
-    }
-
-    // If no end stop
-    if (transmissionStarted) {
-        Wire.endTransmission();
-    }
+std::string I2cService::executeProgram(const ByteCodeProgram& program) {
+    I2cProgramBus bus{*this};
+    return ByteCodeEngine::runI2c(program, bus);
+}
 
-    return result;
+void I2cService::executeProgram(const ByteCodeProgram& program, std::vector<uint8_t>& read) {
+    I2cProgramBus bus{*this};
+    ByteCodeEngine::runI2c(program, bus, read);
 }
 
 bool I2cService::isReadableDevice(uint8_t addr, uint8_t startReg) {
@@ -124,6 +72,34 @@ bool I2cService::isReadableDevice(uint8_t addr, uint8_t startReg) {
     return true;
 }
 
+bool I2cService::setPointer(uint8_t address, uint32_t reg, uint8_t addressBytes) {
+    Wire.beginTransmission(address);
+    for (int8_t i = addressBytes - 1; i >= 0; --i) {
+        Wire.write((uint8_t)(reg >> (8 * i)));  // MSB first
+    }
+    return Wire.endTransmission(false) == 0;    // repeated start
+}
+
+bool I2cService::writeBlock(uint8_t address, const uint8_t* data, size_t count, bool sendStop) {
+    Wire.beginTransmission(address);
+    if (count) Wire.write(data, count);
+    return Wire.endTransmission(sendStop) == 0;
+}
+
+size_t I2cService::readBlock(uint8_t address, uint8_t* out, size_t count) {
+    size_t received = Wire.requestFrom(address, count, true);
+    size_t n = 0;
+    while (n < received && Wire.available()) {
+        out[n++] = Wire.read();
+    }
+    while (Wire.available()) Wire.read();   // Flush
+    return n;
+}
+
+uint16_t I2cService::maxReadChunk() const {
+    return I2C_BUFFER_LENGTH < 255 ? I2C_BUFFER_LENGTH : 255;
+}
+
 /*
 Slave
 */
@@ -3,7 +3,7 @@
 #include <Arduino.h>
 #include <Wire.h>
 #include <vector>
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
 #include <SparkFun_External_EEPROM.h>
 
 class I2cService {
@@ -19,6 +19,15 @@ public:
     bool end() const;
     bool isReadableDevice(uint8_t addr, uint8_t startReg);
 
+    // Block access for I2cDumpEngine
+    bool setPointer(uint8_t address, uint32_t reg, uint8_t addressBytes);
+    bool writeBlock(uint8_t address, const uint8_t* data, size_t count, bool sendStop = true);   // false on NACK
+    size_t readBlock(uint8_t address, uint8_t* out, size_t count);
+    uint16_t maxReadChunk() const;
+
+    // ESP32 controller limit, Fast-mode Plus
+    static constexpr uint32_t MaxFrequency = 1000000;
+
     // I2C Bit bang
     void i2cBitBangDelay(uint32_t delayUs);
     void i2cBitBangSetLevel(uint8_t pin, bool level);
@@ -50,7 +59,8 @@ public:
     void glitchAckInjection(uint8_t address, uint32_t freqHz, uint8_t sclPin, uint8_t sdaPin);
 
     // Instructions
-    std::string executeByteCode(const std::vector<ByteCode>& bytecodes);
+    std::string executeProgram(const ByteCodeProgram& program);
+    void executeProgram(const ByteCodeProgram& program, std::vector<uint8_t>& read);
 
     // EEPROM
     bool initEeprom(uint16_t chipSizeKb = 512, uint8_t addr=0x50);
@@ -5,6 +5,8 @@
 #include <vector>
 #include <algorithm>
 #include <ESP32Ping.h>
+#include "IcmpDiscoveryEngine.h"
+#include "IcmpSocketTransport.h"
 
 #include "lwip/inet.h"
 #include "lwip/netdb.h"
@@ -31,6 +33,7 @@ struct ICMPTaskParams
 struct DiscoveryTaskParams
 {
     std::string deviceIP;
+    std::string cidr;
     ICMPService *service;
 };
 
@@ -95,84 +98,44 @@ static int median_ms(std::vector<uint32_t> &v)
 
 void ICMPService::discoveryTask(void* params){
     auto* taskParams = static_cast<DiscoveryTaskParams*>(params);
-    std::string deviceIP = taskParams->deviceIP;
     ICMPService* service = taskParams->service;
-    ip4_addr_t targetIP;
-    uint32_t targetsResponded = 0;
+    uint32_t deviceIP = 0;
+    uint32_t first, count;
 
-    pushICMPLog("Discovery: Scanning network for devices... Press [ENTER] to stop.\r\n");
-
-    if (!ip4addr_aton(deviceIP.c_str(), &targetIP))
+    if (!IcmpDiscoveryEngine::parseCidr(taskParams->cidr, first, count))
     {
-        pushICMPLog("Discovery: failed to parse IP address " + deviceIP);
+        pushICMPLog("Discovery: failed to parse range " + taskParams->cidr);
+        service->discoveryReady = true;
         delete taskParams;
         vTaskDelete(nullptr);
         return;
     }
+    IcmpDiscoveryEngine::parseIpv4(taskParams->deviceIP, deviceIP);
 
-    // Octets of an IPv4 addr
-    uint8_t o1 = ip4_addr1(&targetIP);
-    uint8_t o2 = ip4_addr2(&targetIP);
-    uint8_t o3 = ip4_addr3(&targetIP);
-    uint8_t deviceIndex = ip4_addr4(&targetIP);
+    pushICMPLog("Discovery: Scanning " + taskParams->cidr + " (" + std::to_string(count) +
+        " hosts)... Press [ENTER] to stop.\r\n");
 
-    for (uint8_t targetIndex = 1; targetIndex < 255; targetIndex++)
-    {
-        if (ICMPService::getICMPServiceStatus() == true)
-        {
-            pushICMPLog("Discovery: Stopped by user\r\n");
-            delete taskParams;
-            vTaskDelete(nullptr);
-            return;
-        }
-
-        if (targetIndex == deviceIndex)
-            continue;
-
-        // Rebuild the target IP from octets
-        IP4_ADDR(&targetIP, o1, o2, o3, targetIndex);
-
-        // Convert to dotted string
-        char targetIPCStr[16];
-        ip4addr_ntoa_r(&targetIP, targetIPCStr, sizeof(targetIPCStr));
-        std::string targetIPStr(targetIPCStr);
-
-        service->cleanupICMPService();
-        auto *params = new ICMPTaskParams{targetIPStr, 2, 150, 100, service};
-
-        #ifndef DEVICE_M5STICK
-
-        xTaskCreatePinnedToCore(pingAPI, "ICMPPing", 4096, params, 1, nullptr, 1);
-
-        while (!service->pingReady)
-        {
-            vTaskDelay(pdMS_TO_TICKS(10));
-        }
-        if (service->pingRC == ping_rc_t::ping_ok){
-            pushICMPLog("Device found: " + targetIPStr);
-            targetsResponded++;
-        }
-
-        #else
-        // Using ESP32Ping library to avoid IRAM overflow
-        // Can't set timeout response for ping with the Ping lib
-        // This is quite unusable since it takes 5sec per ping
-        // TODO: find a better way
-        const unsigned long t0 = millis();
-        const bool ok = Ping.ping(targetIPStr.c_str(), 1);
-        const unsigned long t1 = millis();
-        if (ok) {
-            pushICMPLog("Device found: " + targetIPStr);
-            targetsResponded++;
-        } else {
-            pushICMPLog("Device not found: " + targetIPStr);
-        }
-
-        #endif
-    }
+    // Raw socket, many echo requests in flight, replies streamed as they arrive
+    IcmpSocketTransport transport;
+    IcmpDiscoveryEngine engine(transport);
+    IcmpDiscoveryEngine::Options options;
+    options.maxInFlight = DISCOVERY_IN_FLIGHT;
+    options.timeoutMs = DISCOVERY_TIMEOUT_MS;
+    options.retries = 1;
+
+    IcmpDiscoveryStats stats = engine.run(first, count, deviceIP, options,
+        [](uint32_t ip, uint32_t rttMs) {
+            pushICMPLog("Device found: " + IcmpDiscoveryEngine::ipToString(ip) + " (" + std::to_string(rttMs) + " ms)");
+        },
+        []() { return ICMPService::getICMPServiceStatus(); }
+    );
+
+    if (stats.stopped && stats.probes == 0)
+        pushICMPLog("Discovery: failed to open ICMP socket");
+    else if (stats.stopped)
+        pushICMPLog("Discovery: Stopped by user\r\n");
 
-    pushICMPLog(std::to_string(targetsResponded) + " devices up, pinged " + 
-        std::to_string(254 - targetsResponded) + " devices down");
+    pushICMPLog(engine.formatStats(stats));
 
     service->discoveryReady = true;
 
@@ -180,14 +143,14 @@ void ICMPService::discoveryTask(void* params){
     vTaskDelete(nullptr);
 }
 
-void ICMPService::startDiscoveryTask(const std::string deviceIP)
+void ICMPService::startDiscoveryTask(const std::string& deviceIP, const std::string& cidr)
 {
     report.clear();
     discoveryReady = false;
     stopICMPFlag = false;
 
     // Start job
-    auto* p = new DiscoveryTaskParams{deviceIP, this};
+    auto* p = new DiscoveryTaskParams{deviceIP, cidr, this};
     xTaskCreatePinnedToCore(discoveryTask, "ICMPDiscover", 8192, p, 1, nullptr, 0);
 }
 
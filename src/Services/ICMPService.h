@@ -24,8 +24,8 @@ public:
 
     // Normal ping
     void startPingTask(const std::string& host, int count = 5, int timeout_ms = 1000, int interval_ms = 200);
-    // Discovery of devices
-    void startDiscoveryTask(const std::string deviceIP);
+    // Discovery of devices in a CIDR range, deviceIP is skipped
+    void startDiscoveryTask(const std::string& deviceIP, const std::string& cidr);
     static void discoveryTask(void* params);
 
     // Results
@@ -60,6 +60,8 @@ private:
     static portMUX_TYPE icmpMux;
     static std::vector<std::string> icmpLog;
     static constexpr size_t ICMP_LOG_MAX = 200;
+    static constexpr size_t DISCOVERY_IN_FLIGHT = 32;
+    static constexpr uint32_t DISCOVERY_TIMEOUT_MS = 400;
     static bool stopICMPFlag;
 
     static void pushICMPLog(const std::string& line);
@@ -0,0 +1,226 @@
+#include "IcmpDiscoveryEngine.h"
+#include <algorithm>
+#include <deque>
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+IcmpDiscoveryEngine::IcmpDiscoveryEngine(IIcmpTransport& transport) : transport(transport) {
+    #ifdef ARDUINO
+        clock = []() { return (uint32_t)millis(); };
+    #else
+        clock = []() {
+            using namespace std::chrono;
+            return (uint32_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+        };
+    #endif
+    ident = (uint16_t)(clock() ^ 0xB5A5);
+}
+
+void IcmpDiscoveryEngine::setClock(std::function<uint32_t()> newClock) {
+    clock = std::move(newClock);
+}
+
+/*
+Run
+*/
+IcmpDiscoveryStats IcmpDiscoveryEngine::run(uint32_t first, uint32_t count, uint32_t skipIp, const Options& options,
+                                            HostUpCallback onHostUp, StopCallback shouldStop) {
+    IcmpDiscoveryStats stats;
+    std::deque<Probe> retries;      // timed out, sent again before new hosts
+    std::vector<Probe> inflight;    // ordered by deadline
+    size_t window = options.maxInFlight ? options.maxInFlight : 1;
+    uint32_t nextIndex = 0;
+
+    inflight.reserve(window);
+    uint32_t start = clock();
+
+    if (!transport.begin()) {
+        stats.stopped = true;
+        return stats;
+    }
+
+    while (nextIndex < count || !retries.empty() || !inflight.empty()) {
+        if (shouldStop && shouldStop()) {
+            stats.stopped = true;
+            break;
+        }
+
+        uint32_t now = clock();
+
+        // Fill the window, retries first
+        while (inflight.size() < window && (!retries.empty() || nextIndex < count)) {
+            Probe probe;
+            if (!retries.empty()) {
+                probe = retries.front();
+                retries.pop_front();
+            } else {
+                uint32_t ip = first + nextIndex++;
+                if (ip == skipIp) continue;
+                probe = {ip, 0, 0, 0, 0};
+                stats.hostsScanned++;
+            }
+
+            probe.seq = nextSeq++;
+            if (nextSeq == 0) nextSeq = 1;
+            probe.sentAt = now;
+            probe.deadline = now + options.timeoutMs;
+
+            if (!transport.sendEcho(probe.ipv4, ident, probe.seq)) {
+                // Out of buffers, try again once something completes
+                if (inflight.empty()) {
+                    probe.deadline = now; // counts as a lost probe
+                    insertByDeadline(inflight, probe);
+                } else {
+                    retries.push_front(probe);
+                }
+                break;
+            }
+            stats.probes++;
+            insertByDeadline(inflight, probe);
+        }
+
+        if (inflight.empty()) continue;
+
+        // Wait for a reply or the nearest deadline
+        now = clock();
+        int32_t waitMs = (int32_t)(inflight.front().deadline - now);
+        if (waitMs < 0) waitMs = 0;
+        if ((uint32_t)waitMs > MaxWaitMs) waitMs = MaxWaitMs;
+
+        uint32_t ip;
+        uint16_t replyIdent, replySeq;
+        if (transport.receiveEcho(ip, replyIdent, replySeq, (uint32_t)waitMs) && replyIdent == ident) {
+            auto it = std::find_if(inflight.begin(), inflight.end(), [&](const Probe& p) {
+                return p.seq == replySeq && p.ipv4 == ip;
+            });
+            if (it != inflight.end()) {
+                uint32_t rtt = clock() - it->sentAt;
+                inflight.erase(it);
+                stats.hostsUp++;
+                if (onHostUp) onHostUp(ip, rtt);
+            }
+        }
+
+        // Expired probes, front of the queue
+        now = clock();
+        while (!inflight.empty() && (int32_t)(now - inflight.front().deadline) >= 0) {
+            Probe p = inflight.front();
+            inflight.erase(inflight.begin());
+            if (p.tries < options.retries) {
+                p.tries++;
+                retries.push_back(p);
+            }
+        }
+    }
+
+    transport.end();
+    stats.elapsedMs = clock() - start;
+    return stats;
+}
+
+void IcmpDiscoveryEngine::insertByDeadline(std::vector<Probe>& queue, const Probe& probe) {
+    auto it = std::upper_bound(queue.begin(), queue.end(), probe, [](const Probe& a, const Probe& b) {
+        return (int32_t)(a.deadline - b.deadline) < 0;
+    });
+    queue.insert(it, probe);
+}
+
+/*
+Addresses
+*/
+bool IcmpDiscoveryEngine::parseIpv4(const std::string& text, uint32_t& ipv4) {
+    uint32_t value = 0;
+    int octets = 0;
+    const char* p = text.c_str();
+
+    while (octets < 4) {
+        if (*p < '0' || *p > '9') return false;
+        char* end;
+        unsigned long octet = strtoul(p, &end, 10);
+        if (octet > 255 || end - p > 3) return false;
+        value = (value << 8) | (uint32_t)octet;
+        octets++;
+        p = end;
+        if (octets < 4) {
+            if (*p != '.') return false;
+            ++p;
+        }
+    }
+    if (*p != '\0') return false;
+
+    ipv4 = value;
+    return true;
+}
+
+std::string IcmpDiscoveryEngine::ipToString(uint32_t ipv4) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u",
+             (unsigned)(ipv4 >> 24) & 0xFF, (unsigned)(ipv4 >> 16) & 0xFF,
+             (unsigned)(ipv4 >> 8) & 0xFF, (unsigned)ipv4 & 0xFF);
+    return std::string(buf);
+}
+
+int IcmpDiscoveryEngine::maskToPrefix(const std::string& mask) {
+    uint32_t value;
+    if (!parseIpv4(mask, value)) return -1;
+
+    int prefix = 0;
+    while (prefix < 32 && (value & (0x80000000u >> prefix))) prefix++;
+    uint32_t expected = prefix ? 0xFFFFFFFFu << (32 - prefix) : 0;
+    return value == expected ? prefix : -1;
+}
+
+bool IcmpDiscoveryEngine::parseCidr(const std::string& cidr, uint32_t& first, uint32_t& count) {
+    size_t slash = cidr.find('/');
+    uint32_t ip;
+    if (!parseIpv4(cidr.substr(0, slash), ip)) return false;
+
+    int prefix = 32;
+    if (slash != std::string::npos) {
+        std::string bits = cidr.substr(slash + 1);
+        if (bits.empty() || bits.size() > 2 || bits.find_first_not_of("0123456789") != std::string::npos)
+            return false;
+        prefix = atoi(bits.c_str());
+    }
+
+    // Up to 65534 hosts
+    if (prefix < 16 || prefix > 32) return false;
+
+    uint32_t mask = 0xFFFFFFFFu << (32 - prefix);
+    if (prefix == 32) mask = 0xFFFFFFFFu;
+    uint32_t network = ip & mask;
+
+    if (prefix == 32) {
+        first = ip;
+        count = 1;
+    } else if (prefix == 31) {
+        // Point to point, both addresses are hosts
+        first = network;
+        count = 2;
+    } else {
+        // Skip network and broadcast
+        first = network + 1;
+        count = (1u << (32 - prefix)) - 2;
+    }
+    return true;
+}
+
+/*
+Stats
+*/
+std::string IcmpDiscoveryEngine::formatStats(const IcmpDiscoveryStats& stats) const {
+    char line[128];
+    float secs = stats.elapsedMs / 1000.0f;
+    float rate = stats.elapsedMs ? stats.hostsScanned * 1000.0f / stats.elapsedMs : 0.0f;
+
+    snprintf(line, sizeof(line), "%u hosts up, %u scanned in %.1f s (%.1f hosts/s)",
+             (unsigned)stats.hostsUp, (unsigned)stats.hostsScanned, secs, rate);
+
+    return std::string(line);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include "Interfaces/IIcmpTransport.h"
+
+struct IcmpDiscoveryStats {
+    uint32_t hostsScanned = 0;
+    uint32_t hostsUp = 0;
+    uint32_t probes = 0;
+    uint32_t elapsedMs = 0;
+    bool stopped = false;
+};
+
+// Parallel ICMP sweep.
+// Keeps up to maxInFlight echo requests outstanding, replies are matched
+// by ident/sequence and reported through the callback as they arrive.
+
+class IcmpDiscoveryEngine {
+public:
+    struct Options {
+        size_t maxInFlight = 16;
+        uint32_t timeoutMs = 300;
+        uint8_t retries = 1;
+    };
+
+    using HostUpCallback = std::function<void(uint32_t ipv4, uint32_t rttMs)>;
+    using StopCallback = std::function<bool()>;
+
+    explicit IcmpDiscoveryEngine(IIcmpTransport& transport);
+
+    // Sweep count addresses from first (host order), skipping skipIp
+    IcmpDiscoveryStats run(uint32_t first, uint32_t count, uint32_t skipIp, const Options& options,
+                           HostUpCallback onHostUp, StopCallback shouldStop = nullptr);
+
+    // "192.168.1.0/24" -> usable host range, a bare address is a /32
+    static bool parseCidr(const std::string& cidr, uint32_t& first, uint32_t& count);
+
+    // Prefix length of a dotted netmask, -1 if not contiguous
+    static int maskToPrefix(const std::string& mask);
+
+    static bool parseIpv4(const std::string& text, uint32_t& ipv4);
+    static std::string ipToString(uint32_t ipv4);
+
+    // "3 hosts up, 254 scanned in 1.2 s (211.7 hosts/s)"
+    std::string formatStats(const IcmpDiscoveryStats& stats) const;
+
+    // Time source in ms, millis() by default
+    void setClock(std::function<uint32_t()> clock);
+
+private:
+    struct Probe {
+        uint32_t ipv4;
+        uint16_t seq;
+        uint8_t tries;
+        uint32_t sentAt;
+        uint32_t deadline;
+    };
+
+    IIcmpTransport& transport;
+    std::function<uint32_t()> clock;
+    uint16_t ident;
+    uint16_t nextSeq = 1;
+
+    static constexpr uint32_t MaxWaitMs = 50; // stop callback latency
+
+    void insertByDeadline(std::vector<Probe>& queue, const Probe& probe);
+};
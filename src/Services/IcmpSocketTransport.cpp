@@ -0,0 +1,72 @@
+#include "IcmpSocketTransport.h"
+#include <cstring>
+#include "lwip/sockets.h"
+#include "lwip/icmp.h"
+#include "lwip/ip.h"
+#include "lwip/inet_chksum.h"
+
+IcmpSocketTransport::~IcmpSocketTransport() {
+    end();
+}
+
+bool IcmpSocketTransport::begin() {
+    if (fd >= 0) return true;
+    fd = ::socket(AF_INET, SOCK_RAW, IP_PROTO_ICMP);
+    return fd >= 0;
+}
+
+void IcmpSocketTransport::end() {
+    if (fd < 0) return;
+    ::close(fd);
+    fd = -1;
+}
+
+bool IcmpSocketTransport::sendEcho(uint32_t ipv4, uint16_t ident, uint16_t seq) {
+    if (fd < 0) return false;
+
+    uint8_t packet[sizeof(icmp_echo_hdr) + PayloadSize];
+    auto* hdr = reinterpret_cast<icmp_echo_hdr*>(packet);
+    memset(packet, 0, sizeof(packet));
+
+    ICMPH_TYPE_SET(hdr, ICMP_ECHO);
+    ICMPH_CODE_SET(hdr, 0);
+    hdr->id = htons(ident);
+    hdr->seqno = htons(seq);
+    for (size_t i = 0; i < PayloadSize; ++i) packet[sizeof(icmp_echo_hdr) + i] = (uint8_t)('a' + i);
+    hdr->chksum = inet_chksum(packet, sizeof(packet));
+
+    sockaddr_in to{};
+    to.sin_family = AF_INET;
+    to.sin_addr.s_addr = htonl(ipv4);
+
+    return ::sendto(fd, packet, sizeof(packet), 0, (sockaddr*)&to, sizeof(to)) == (int)sizeof(packet);
+}
+
+bool IcmpSocketTransport::receiveEcho(uint32_t& ipv4, uint16_t& ident, uint16_t& seq, uint32_t timeoutMs) {
+    if (fd < 0) return false;
+
+    fd_set rfds;
+    FD_ZERO(&rfds);
+    FD_SET(fd, &rfds);
+    timeval tv{ (time_t)(timeoutMs / 1000), (suseconds_t)((timeoutMs % 1000) * 1000) };
+    if (::select(fd + 1, &rfds, nullptr, nullptr, &tv) <= 0) return false;
+
+    uint8_t buf[64];
+    sockaddr_in from{};
+    socklen_t fromLen = sizeof(from);
+    int n = ::recvfrom(fd, buf, sizeof(buf), 0, (sockaddr*)&from, &fromLen);
+    if (n < (int)sizeof(ip_hdr)) return false;
+
+    // Raw sockets get the IP header too
+    auto* ip = reinterpret_cast<ip_hdr*>(buf);
+    size_t ipLen = IPH_HL(ip) * 4;
+    if (n < (int)(ipLen + sizeof(icmp_echo_hdr))) return false;
+
+    auto* hdr = reinterpret_cast<icmp_echo_hdr*>(buf + ipLen);
+    if (ICMPH_TYPE(hdr) != ICMP_ER) return false;
+
+    ipv4 = ntohl(from.sin_addr.s_addr);
+    ident = ntohs(hdr->id);
+    seq = ntohs(hdr->seqno);
+    return true;
+}
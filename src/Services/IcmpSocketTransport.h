@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Interfaces/IIcmpTransport.h"
+
+// ICMP echo over an lwIP raw socket, one socket for the whole sweep
+
+class IcmpSocketTransport : public IIcmpTransport {
+public:
+    ~IcmpSocketTransport() override;
+
+    bool begin() override;
+    void end() override;
+    bool sendEcho(uint32_t ipv4, uint16_t ident, uint16_t seq) override;
+    bool receiveEcho(uint32_t& ipv4, uint16_t& ident, uint16_t& seq, uint32_t timeoutMs) override;
+
+private:
+    int fd = -1;
+    static constexpr size_t PayloadSize = 16;
+};
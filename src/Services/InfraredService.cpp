@@ -16,7 +16,6 @@ void InfraredService::stopReceiver() {
 
 void InfraredService::sendInfraredCommand(InfraredCommand command) {
     uint16_t vendorCode;
-    std::string protocolString = InfraredProtocolMapper::toString(command.getProtocol());
     uint8_t device = command.getDevice();
     uint8_t subdevice = command.getSubdevice() == -1 ? 0 : command.getSubdevice();
 
@@ -33,7 +32,7 @@ void InfraredService::sendInfraredCommand(InfraredCommand command) {
         case InfraredProtocolEnum::_PANASONIC:
         case InfraredProtocolEnum::PANASONIC2: {
             // Panasonic can be used by many manufacturers in the IRDB format, we check for vendor name
-            vendorCode = getKaseikyoVendorIdCode(protocolString);
+            vendorCode = getKaseikyoVendorIdCode(InfraredProtocolMapper::toString(command.getProtocol()));
             
             IrSender.sendKaseikyo(address, command.getFunction(), 0, vendorCode);
             break;
@@ -51,20 +50,13 @@ void InfraredService::sendInfraredCommand(InfraredCommand command) {
             break;
         }
         
-        // Handle by MakeHex
+        // Handle by the compiled MakeHex protocols
         default: {
-            int frequency = 38; // Default frequency, passed by reference to encodeRemoteCommand
-            std::vector<float> sequence = encodeRemoteCommand(command, protocolString.c_str(), frequency);
-
-            // Convert for sendRaw
-            uint16_t* raw = new uint16_t[sequence.size()];
-            for (size_t i = 0; i < sequence.size(); ++i) {
-                raw[i] = static_cast<uint16_t>(sequence[i]);
-            }
-            
+            int frequency = 38; // Default frequency, set by the protocol when it defines one
+            size_t count = irpEncoder.encode(command, irpTimings, IrpEncoder::MaxTimings, frequency);
+
             // Send the raw generated sequence with the correct frequency
-            IrSender.sendRaw(raw, sequence.size(), frequency);
-            delete[] raw;
+            if (count) IrSender.sendRaw(irpTimings, count, frequency);
         }
     }
 }
@@ -3,7 +3,7 @@
 #include <vector>
 #include <Models/InfraredCommand.h>
 #include <Models/InfraredFileRemoteCommand.h>
-#include <Vendors/MakeHex.h>
+#include <Vendors/IrpEncoder.h>
 #include "Enums/InfraredProtocolEnum.h"
 
 class InfraredService {
@@ -17,6 +17,10 @@ public:
     bool receiveRaw(std::vector<uint16_t>& timings, uint32_t& khz);
     void sendRaw(const std::vector<uint16_t>& timings, uint32_t khz);
 private:
+    // IRP protocols compiled on first use, timings built in place
+    IrpEncoder irpEncoder;
+    uint16_t irpTimings[IrpEncoder::MaxTimings];
+
     uint16_t getKaseikyoVendorIdCode(const std::string& input);
 };
 
@@ -0,0 +1,17 @@
+#include "JtagScanEngine.h"
+
+bool JtagScanEngine::isValidIdcode(uint32_t id) {
+    if (!(id & 1)) return false;
+    uint32_t manufacturer = (id & 0x7F) >> 1;
+    uint32_t bank = (id >> 8) & 0xF;
+    return manufacturer > 1 && manufacturer <= 126 && bank <= 8;
+}
+
+uint32_t JtagScanEngine::bitReverse(uint32_t n) {
+    uint32_t r = 0;
+    for (int i = 0; i < 32; ++i) {
+        r = (r << 1) | (n & 1);
+        n >>= 1;
+    }
+    return r;
+}
@@ -0,0 +1,297 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+struct JtagPinout {
+    uint8_t tck = 0xFF;
+    uint8_t tms = 0xFF;
+    uint8_t tdo = 0xFF;
+    uint8_t tdi = 0xFF;             // 0xFF when no TDI passed the BYPASS test
+    int trst = -1;
+    std::vector<uint32_t> ids;      // IDCODE per device, TDO side first
+};
+
+struct JtagScanStats {
+    uint32_t idcodePermutations = 0;    // TCK/TMS/TDO triples
+    uint32_t bypassPermutations = 0;    // TDI candidates
+    uint32_t trstPermutations = 0;
+    uint32_t exhaustivePermutations = 0; // fallback, TDI/TDO/TCK/TMS
+    uint32_t elapsedUs = 0;             // filled by the caller
+
+    uint32_t permutations() const {
+        return idcodePermutations + bypassPermutations + trstPermutations + exhaustivePermutations;
+    }
+    double permutationsPerSecond() const {
+        return elapsedUs ? permutations() * 1e6 / elapsedUs : 0;
+    }
+};
+
+// Staged JTAG pinout search, as done by JTAGulator.
+// 1. IDCODE: after a TAP reset most devices select IDCODE, so TCK, TMS and
+//    TDO are found by reading 32 bits from Shift-DR, without TDI.
+// 2. BYPASS: with those three known, each other pin is tried as TDI by
+//    counting the devices and sending a pattern through the bypass registers.
+// 3. TRST: each remaining pin is pulled low, the IDCODE read must change.
+// That is n(n-1)(n-2) + n short tries instead of n(n-1)(n-2)(n-3) long ones.
+// Without any IDCODE (devices resetting to BYPASS) the exhaustive BYPASS
+// search is the fallback.
+//
+// Port provides the bit bang layer:
+//   void select(uint8_t tck, uint8_t tms, uint8_t tdo, uint8_t tdi)  // tdi may be NoPin
+//   void setTms(bool level), void setTdi(bool level)
+//   bool clock()                         // TCK high, sample TDO, TCK low
+//   void pull(uint8_t pin, bool up)      // weak pull on an unused pin
+//   void release()                       // every pin back to input
+
+class JtagScanEngine {
+public:
+    static constexpr uint8_t NoPin = 0xFF;
+    static constexpr int MaxDevices = 32;
+    static constexpr int MaxIrLength = 32;
+    static constexpr int MaxIrChainLength = MaxDevices * MaxIrLength;
+
+    using Progress = void (*)(size_t, size_t);
+
+    template <typename Port>
+    static bool scan(Port& port, const std::vector<uint8_t>& pins, JtagPinout& out, JtagScanStats& stats,
+                     bool exhaustiveFallback = true, Progress onProgress = nullptr) {
+        out = JtagPinout();
+        stats = JtagScanStats();
+        const size_t n = pins.size();
+        if (n < 4) return false;
+
+        const size_t total = n * (n - 1) * (n - 2) + (n - 3);
+        size_t progress = 0;
+        bool partial = false;
+
+        // Stage 1, IDCODE
+        for (uint8_t tck : pins) {
+            for (uint8_t tms : pins) {
+                if (tms == tck) continue;
+                for (uint8_t tdo : pins) {
+                    if (tdo == tck || tdo == tms) continue;
+                    stats.idcodePermutations++;
+                    if (onProgress) onProgress(++progress, total);
+
+                    port.select(tck, tms, tdo, NoPin);
+                    uint32_t id = readIdcode(port);
+                    port.release();
+                    if (!isValidIdcode(id)) continue;
+
+                    // Stage 2, BYPASS
+                    JtagPinout candidate;
+                    candidate.tck = tck;
+                    candidate.tms = tms;
+                    candidate.tdo = tdo;
+                    candidate.ids.push_back(id);
+                    if (findTdi(port, pins, candidate, stats)) {
+                        findTrst(port, pins, candidate, stats);
+                        out = candidate;
+                        if (onProgress) onProgress(total, total);
+                        return true;
+                    }
+
+                    // IDCODE without a working TDI, kept if nothing better turns up
+                    if (!partial) {
+                        out = candidate;
+                        partial = true;
+                    }
+                }
+            }
+        }
+
+        if (!partial && exhaustiveFallback) partial = scanExhaustive(port, pins, out, stats);
+        if (onProgress) onProgress(total, total);
+        return partial;
+    }
+
+    // JEDEC manufacturer in bits 1..11, bit 0 always set
+    static bool isValidIdcode(uint32_t id);
+    static uint32_t bitReverse(uint32_t n);
+
+    // TAP primitives, public for the tests
+
+    template <typename Port>
+    static void resetTap(Port& port) {
+        port.setTms(true);
+        for (int i = 0; i < 5; ++i) port.clock();   // Test-Logic-Reset
+        port.setTms(false);
+        port.clock();                                // Run-Test/Idle
+    }
+
+    // First IDCODE after a TAP reset, TDO side device
+    template <typename Port>
+    static uint32_t readIdcode(Port& port) {
+        resetTap(port);
+        enterShiftDr(port);
+        port.setTdi(true);
+        uint32_t id = 0;
+        for (int i = 0; i < 32; ++i) id |= (uint32_t)port.clock() << i;
+        resetTap(port);
+        return id;
+    }
+
+    // Devices in the chain, all in BYPASS, 0 if none or no TDI path
+    template <typename Port>
+    static int countDevices(Port& port) {
+        resetTap(port);
+        enterShiftIr(port);
+        port.setTdi(true);
+        for (int i = 0; i < MaxIrChainLength; ++i) port.clock();
+        port.setTms(true); port.clock();    // Exit1-IR
+        port.setTms(true); port.clock();    // Update-IR
+        port.setTms(true); port.clock();    // Select-DR
+        port.setTms(false); port.clock();   // Capture-DR
+        port.setTms(false); port.clock();   // Shift-DR
+
+        for (int i = 0; i < MaxDevices; ++i) port.clock();
+
+        port.setTdi(false);
+        int count;
+        for (count = 0; count < MaxDevices; ++count) {
+            if (!port.clock()) break;
+        }
+        if (count >= MaxDevices) count = 0;
+
+        port.setTms(true); port.clock();    // Exit1-DR
+        port.setTms(true); port.clock();    // Update-DR
+        port.setTms(false); port.clock();   // Run-Test/Idle
+        return count;
+    }
+
+    // Pattern sent through count devices in BYPASS, returns what came out
+    template <typename Port>
+    static uint32_t bypassTest(Port& port, int count, uint32_t pattern) {
+        if (count <= 0 || count > MaxDevices) return 0;
+        resetTap(port);
+        enterShiftIr(port);
+        port.setTdi(true);
+        for (int i = 0; i < count * MaxIrLength; ++i) port.clock();
+        port.setTms(true); port.clock();    // Exit1-IR
+        port.setTms(true); port.clock();    // Update-IR
+        port.setTms(false); port.clock();   // Run-Test/Idle
+
+        enterShiftDr(port);
+        uint32_t result = 0;
+        const int bits = 32 + count;
+        for (int i = 1; i <= bits; ++i) {
+            if (i == bits) port.setTms(true);
+            port.setTdi(pattern & 1);
+            pattern >>= 1;
+            result = (result << 1) | (port.clock() ? 1 : 0);
+        }
+        port.setTms(true); port.clock();    // Update-DR
+        port.setTms(false); port.clock();   // Run-Test/Idle
+        return bitReverse(result);
+    }
+
+    template <typename Port>
+    static void readDeviceIds(Port& port, int count, std::vector<uint32_t>& ids) {
+        ids.clear();
+        resetTap(port);
+        enterShiftDr(port);
+        port.setTdi(true);
+        for (int i = 0; i < count; ++i) {
+            uint32_t id = 0;
+            for (int b = 0; b < 32; ++b) id |= (uint32_t)port.clock() << b;
+            ids.push_back(id);
+        }
+        resetTap(port);
+    }
+
+private:
+    static constexpr uint32_t BypassPattern = 0xA5C3E1F0 ^ 0x1234567;
+
+    template <typename Port>
+    static void enterShiftDr(Port& port) {
+        port.setTms(true); port.clock();    // Select-DR
+        port.setTms(false); port.clock();   // Capture-DR
+        port.setTms(false); port.clock();   // Shift-DR
+    }
+
+    template <typename Port>
+    static void enterShiftIr(Port& port) {
+        port.setTms(true); port.clock();    // Select-DR
+        port.setTms(true); port.clock();    // Select-IR
+        port.setTms(false); port.clock();   // Capture-IR
+        port.setTms(false); port.clock();   // Shift-IR
+    }
+
+    static bool isUsed(uint8_t pin, const JtagPinout& p) {
+        return pin == p.tck || pin == p.tms || pin == p.tdo || pin == p.tdi;
+    }
+
+    template <typename Port>
+    static bool findTdi(Port& port, const std::vector<uint8_t>& pins, JtagPinout& p, JtagScanStats& stats) {
+        for (uint8_t tdi : pins) {
+            if (isUsed(tdi, p)) continue;
+            stats.bypassPermutations++;
+
+            port.select(p.tck, p.tms, p.tdo, tdi);
+            int count = countDevices(port);
+            bool passed = count > 0 && bypassTest(port, count, BypassPattern) == BypassPattern;
+            if (passed) readDeviceIds(port, count, p.ids);
+            port.release();
+
+            if (passed) {
+                p.tdi = tdi;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename Port>
+    static void findTrst(Port& port, const std::vector<uint8_t>& pins, JtagPinout& p, JtagScanStats& stats) {
+        const uint32_t id = p.ids.empty() ? 0 : p.ids[0];
+        for (uint8_t trst : pins) {
+            if (isUsed(trst, p)) continue;
+            stats.trstPermutations++;
+
+            port.select(p.tck, p.tms, p.tdo, p.tdi);
+            port.pull(trst, false);
+            uint32_t held = readIdcode(port);
+            port.release();
+
+            if (held != id) {
+                p.trst = trst;
+                return;
+            }
+        }
+    }
+
+    // Every TDI/TDO/TCK/TMS permutation through BYPASS, for chains without IDCODE
+    template <typename Port>
+    static bool scanExhaustive(Port& port, const std::vector<uint8_t>& pins, JtagPinout& out, JtagScanStats& stats) {
+        for (uint8_t tdi : pins) {
+            for (uint8_t tdo : pins) {
+                if (tdo == tdi) continue;
+                for (uint8_t tck : pins) {
+                    if (tck == tdi || tck == tdo) continue;
+                    for (uint8_t tms : pins) {
+                        if (tms == tck || tms == tdo || tms == tdi) continue;
+                        stats.exhaustivePermutations++;
+
+                        port.select(tck, tms, tdo, tdi);
+                        int count = countDevices(port);
+                        bool passed = count > 0 && bypassTest(port, count, BypassPattern) == BypassPattern;
+                        port.release();
+
+                        if (passed) {
+                            out = JtagPinout();
+                            out.tck = tck;
+                            out.tms = tms;
+                            out.tdo = tdo;
+                            out.tdi = tdi;
+                            out.ids.assign(count, 0);   // BYPASS only, no IDCODE
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+};
@@ -36,17 +36,13 @@
 #include "JtagService.h"
 #include "driver/gpio.h"
 #include "esp_timer.h"
+#include <algorithm>
 
 #define SWD_DELAY_US 5
 #define LINE_RESET_CLK_CYCLES 52
 #define JTAG_TO_SWD_CMD 0xE79E
 #define SWD_TO_JTAG_CMD 0xE73C
 #define SWDP_ACTIVATION_CODE 0x1A
-#define MAX_DEVICES_LEN      32                             // Maximum number of devices allowed in a single JTAG chain
-#define MIN_IR_LEN           2                              // Minimum length of instruction register per IEEE Std. 1149.1
-#define MAX_IR_LEN           32                             // Maximum length of instruction register
-#define MAX_IR_CHAIN_LEN     MAX_DEVICES_LEN * MAX_IR_LEN   // Maximum total length of JTAG chain w/ IR selected
-#define MAX_DR_LEN           4096    
 
 // --- JTAG ---
 
@@ -69,280 +65,98 @@ void JtagService::configureJtag(uint8_t tck, uint8_t tms, uint8_t tdi, uint8_t t
     }
 }
 
-void JtagService::tckPulse() {
-    tdoRead();
-}
-
-void JtagService::tdiWrite(bool val) {
-    gpio_set_level((gpio_num_t)_pinTDI, val ? 1 : 0);
-}
-
-void JtagService::tmsWrite(bool val) {
-    gpio_set_level((gpio_num_t)_pinTMS, val ? 1 : 0);
-}
-
-bool JtagService::tdoRead() {
-    gpio_set_level((gpio_num_t)_pinTCK, 1);
-    bool val = gpio_get_level((gpio_num_t)_pinTDO);
-    gpio_set_level((gpio_num_t)_pinTCK, 0);
-    return val;
-}
-
-void JtagService::restoreIdle() {
-    tmsWrite(true);
-    for (int i = 0; i < 5; ++i) tckPulse();
-    tmsWrite(false);
-    tckPulse(); // Enter Run-Test/Idle
-}
-
-void JtagService::enterShiftDR() {
-    tmsWrite(true); tckPulse(); // Select DR
-    tmsWrite(false); tckPulse(); // Capture DR
-    tmsWrite(false); tckPulse(); // Shift DR
-}
-
-void JtagService::enterShiftIR() {
-    tmsWrite(true); tckPulse(); // Select DR
-    tmsWrite(true); tckPulse(); // Select IR
-    tmsWrite(false); tckPulse(); // Capture IR
-    tmsWrite(false); tckPulse(); // Shift IR
-}
-
-uint32_t JtagService::bitReverse(uint32_t n) {
-    uint32_t r = 0;
-    for (int i = 0; i < 32; ++i) {
-        r <<= 1;
-        r |= n & 1;
-        n >>= 1;
-    }
-    return r;
+bool JtagService::scanJtagDevice(
+    const std::vector<uint8_t>& pins,
+    JtagPinout& pinout,
+    JtagScanStats& stats,
+    bool exhaustiveFallback,
+    void (*onProgress)(size_t, size_t)
+) {
+    uint32_t start = micros();
+    jtagPort.begin(pins);
+    bool found = JtagScanEngine::scan(jtagPort, pins, pinout, stats, exhaustiveFallback, onProgress);
+    jtagPort.end();
+    stats.elapsedUs = micros() - start;
+    return found;
 }
 
-uint32_t JtagService::shiftArray(uint32_t pattern, int bits) {
-    uint32_t result = 0;
-    for (int i = 1; i <= bits; ++i) {
-        if (i == bits) tmsWrite(true);
-        tdiWrite(pattern & 1);
-        pattern >>= 1;
-        result <<= 1;
-        result |= tdoRead();
+// --- JTAG GPIO port ---
+
+JtagGpioPort::Line JtagGpioPort::line(uint8_t pin) {
+    Line l;
+    if (pin == JtagScanEngine::NoPin) return l;
+    if (pin < 32) {
+        l.set = GPIO_OUT_W1TS_REG;
+        l.clear = GPIO_OUT_W1TC_REG;
+        l.mask = 1UL << pin;
+    } else {
+        l.set = GPIO_OUT1_W1TS_REG;
+        l.clear = GPIO_OUT1_W1TC_REG;
+        l.mask = 1UL << (pin - 32);
     }
-    return result;
-}
-
-uint32_t JtagService::sendData(uint32_t pattern, int bits) {
-    enterShiftDR();
-    uint32_t out = shiftArray(pattern, bits);
-    tmsWrite(true); tckPulse(); // Update DR
-    tmsWrite(false); tckPulse(); // Run-Test/Idle
-    return out;
+    return l;
 }
 
-int JtagService::detectDevices() {
-    restoreIdle();
-    enterShiftIR();
-    tdiWrite(true);
-    for (int i = 0; i < MAX_IR_CHAIN_LEN; ++i) tckPulse();
-    tmsWrite(true); tckPulse(); // Exit1-IR
-    tmsWrite(true); tckPulse(); // Update-IR
-    tmsWrite(true); tckPulse(); // Select-DR
-    tmsWrite(false); tckPulse(); // Capture-DR
-    tmsWrite(false); tckPulse(); // Shift-DR
-
-    int x;
-    for(x = 0; x < MAX_DEVICES_LEN; x++)
-    {
-        tckPulse();
-    }
-
-    tdiWrite(false);
-    for(x = 0; x < (MAX_DEVICES_LEN - 1); x++) {
-        if(tdoRead() == false) {
-            break;
-        }
-    }
-
-    if (x > (MAX_DEVICES_LEN - 1))
-    {
-        x = 0;
-    }
+void JtagGpioPort::begin(const std::vector<uint8_t>& pins, uint32_t clockHz) {
+    scanPins = pins;
+    halfPeriod = std::max<uint32_t>(getCpuFrequencyMhz() * 1000000UL / (2 * clockHz), 1);
 
-    tmsWrite(true); tckPulse();
-    tmsWrite(true); tckPulse();
-    tmsWrite(false); tckPulse(); // Run-Test/Idle
-    return (x);
+    // Pins routed to the GPIO matrix once, the scan then only flips registers
+    for (uint8_t pin : scanPins) pinMode(pin, INPUT_PULLUP);
+    enabled = 0;
+    pulledDown = -1;
 }
 
-void JtagService::getDeviceIDs(int count, std::vector<uint32_t>& ids) {
-    ids.clear();
-    restoreIdle();
-    enterShiftDR();
-    tdiWrite(true);
-    tmsWrite(false);
-
-    for (int i = 0; i < count; ++i) {
-        uint32_t id = 0;
-        for (int b = 0; b < 32; ++b) {
-            id <<= 1;
-            id |= tdoRead();
-        }
-        ids.push_back(bitReverse(id));
-    }
-    restoreIdle();
+void JtagGpioPort::end() {
+    release();
+    for (uint8_t pin : scanPins) pinMode(pin, INPUT);
+    scanPins.clear();
 }
 
-uint32_t JtagService::bypassTest(int count, uint32_t pattern) {
-    if (count <= 0 || count > MAX_DEVICES_LEN) return 0;
-    restoreIdle();
-    enterShiftIR();
-    tdiWrite(true);
-    for (int i = 0; i < count * MAX_IR_LEN; ++i) tckPulse();
-    tmsWrite(true); tckPulse(); // Exit1 IR
-    tmsWrite(true); tckPulse(); // Update IR
-    tmsWrite(false); tckPulse(); // Run Test/Idle
-    return bitReverse(sendData(pattern, 32 + count));
+void JtagGpioPort::enableOutputs(uint64_t pins) {
+    uint64_t off = enabled & ~pins;
+    uint64_t on = pins & ~enabled;
+    if ((uint32_t)off) REG_WRITE(GPIO_ENABLE_W1TC_REG, (uint32_t)off);
+    if (off >> 32)     REG_WRITE(GPIO_ENABLE1_W1TC_REG, (uint32_t)(off >> 32));
+    if ((uint32_t)on)  REG_WRITE(GPIO_ENABLE_W1TS_REG, (uint32_t)on);
+    if (on >> 32)      REG_WRITE(GPIO_ENABLE1_W1TS_REG, (uint32_t)(on >> 32));
+    enabled = pins;
 }
 
-bool JtagService::isValidDeviceID(uint32_t id) {
-    int idcode = (id & 0x7F) >> 1;
-    int bank   = (id >> 8) & 0xF;
-    return idcode > 1 && idcode <= 126 && bank <= 8;
+void JtagGpioPort::select(uint8_t tckPin, uint8_t tmsPin, uint8_t tdoPin, uint8_t tdiPin) {
+    tck = line(tckPin);
+    tms = line(tmsPin);
+    tdi = line(tdiPin);
+    tdoIn = tdoPin < 32 ? GPIO_IN_REG : GPIO_IN1_REG;
+    tdoMask = 1UL << (tdoPin & 31);
+
+    // Idle levels before the drivers turn on
+    write(tck, false);
+    write(tms, true);
+    if (tdi.mask) write(tdi, true);
+
+    uint64_t outputs = (1ULL << tckPin) | (1ULL << tmsPin);
+    if (tdiPin != JtagScanEngine::NoPin) outputs |= 1ULL << tdiPin;
+    enableOutputs(outputs);
 }
 
-void JtagService::jtagInitChannels(const std::vector<uint8_t>& pins, bool pulsePins) {
-    for (auto pin : pins) {
-        gpio_set_direction((gpio_num_t)pin, GPIO_MODE_INPUT);
-        if (pulsePins) {
-            gpio_pulldown_en((gpio_num_t)pin);
-        } else {
-            gpio_pullup_en((gpio_num_t)pin);
-        }
+void JtagGpioPort::pull(uint8_t pin, bool up) {
+    if (up) {
+        gpio_pulldown_dis((gpio_num_t)pin);
+        gpio_pullup_en((gpio_num_t)pin);
+        if (pulledDown == pin) pulledDown = -1;
+    } else {
+        gpio_pullup_dis((gpio_num_t)pin);
+        gpio_pulldown_en((gpio_num_t)pin);
+        pulledDown = pin;
     }
 }
 
-void JtagService::jtagResetChannels(const std::vector<uint8_t>& pins, int trstPin, bool pulsePins) {
-    for (auto pin : pins) {
-        if (trstPin >= 0 && pin == trstPin) {
-            gpio_set_direction((gpio_num_t)pin, GPIO_MODE_INPUT);
-            if (pulsePins) {
-                gpio_pulldown_en((gpio_num_t)pin);
-            } else {
-                gpio_pullup_en((gpio_num_t)pin);
-            }
-        } else {
-            gpio_set_direction((gpio_num_t)pin, GPIO_MODE_INPUT);
-        }
-    }
+void JtagGpioPort::release() {
+    enableOutputs(0);
+    if (pulledDown >= 0) pull((uint8_t)pulledDown, true);
 }
 
-bool JtagService::scanJtagDevice(
-    const std::vector<uint8_t>& pins,
-    uint8_t& outTDI, uint8_t& outTDO,
-    uint8_t& outTCK, uint8_t& outTMS,
-    int& outTRST,
-    std::vector<uint32_t>& outDeviceIDs,
-    bool pulsePins,
-    void (*onProgress)(size_t, size_t)
-) {
-    int channelCount = pins.size();
-    uint32_t tempDeviceId;
-    bool volatile foundPinout = false;
-    outDeviceIDs.clear();
-    size_t progressCount = 0;
-    size_t maxPermutations = channelCount * (channelCount - 1) * (channelCount - 2) * (channelCount - 3);
-
-    for (auto tdi : pins) {
-        for (auto tdo : pins) {
-            if (tdi == tdo) continue;
-            for (auto tck : pins) {
-                if (tck == tdi || tck == tdo) continue;
-                for (auto tms : pins) {
-                    if (tms == tck || tms == tdo || tms == tdi) continue;
-
-                    if (onProgress) onProgress(++progressCount, maxPermutations);
-
-                    jtagInitChannels(pins, pulsePins);
-                    if (pulsePins) {
-                        for (auto ch : pins) {
-                            gpio_set_direction((gpio_num_t)ch, GPIO_MODE_INPUT);
-                            gpio_pullup_en((gpio_num_t)ch);
-                        }
-                    }
-
-                    configureJtag(tck, tms, tdi, tdo);
-                    int deviceCount = detectDevices();
-
-                    if (deviceCount <= 0) {
-                        continue;
-                    }
-
-                    uint32_t dataIn = esp_random();
-                    uint32_t dataOut = bypassTest(deviceCount, dataIn);
-
-                    if (dataIn == dataOut) {
-                        std::vector<uint32_t> ids;
-                        getDeviceIDs(deviceCount, ids);
-                        tempDeviceId = ids.empty() ? 0 : ids[0];
-
-                        if (ids.empty()) {
-                            Serial.println("       No device IDs read");
-                            continue;
-                        }
-
-                        if (!isValidDeviceID(tempDeviceId)) {
-                            continue;
-                        }
-
-                        foundPinout = true;
-                        outTDI = tdi;
-                        outTDO = tdo;
-                        outTCK = tck;
-                        outTMS = tms;
-                        outTRST = -1;
-                        outDeviceIDs = ids;
-
-                        for (auto trst : pins) {
-                            if (trst == tms || trst == tck || trst == tdo || trst == tdi) continue;
-
-                            if (onProgress) onProgress(++progressCount, maxPermutations);
-
-                            gpio_set_direction((gpio_num_t)trst, GPIO_MODE_INPUT);
-                            if (pulsePins) {
-                                gpio_pullup_en((gpio_num_t)trst);
-                            } else {
-                                gpio_pulldown_en((gpio_num_t)trst);
-                            }
-
-                            usleep(10);
-
-                            std::vector<uint32_t> tmpIDs;
-                            getDeviceIDs(1, tmpIDs);
-
-                            if (!tmpIDs.empty() && tmpIDs[0] != tempDeviceId) {
-                                outTRST = trst;
-                                break;
-                            }
-                        }
-
-                        jtagResetChannels(pins, outTRST, pulsePins);
-                        return true;
-                    }
-
-                    jtagResetChannels(pins, outTRST, pulsePins);
-                }
-            }
-        }
-    }
-
-    if (!foundPinout && onProgress) {
-        onProgress(maxPermutations, maxPermutations);
-    }
-
-    return false;
-}
-
-
-
 // --- SWD ---
 
 void JtagService::swdDelay() {
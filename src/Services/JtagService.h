@@ -38,18 +38,66 @@
 #include <Arduino.h>
 #include <cstdint>
 #include <vector>
+#include <soc/gpio_reg.h>
+#include "Services/JtagScanEngine.h"
+
+// Bit bang port of the JTAG scan, straight to the GPIO registers.
+// Levels go through the W1TS/W1TC registers and TDO is read from GPIO_IN,
+// TCK runs at a fixed rate paced by the CPU cycle counter.
+class JtagGpioPort {
+public:
+    static constexpr uint32_t DefaultClockHz = 1000000;
+
+    void begin(const std::vector<uint8_t>& pins, uint32_t clockHz = DefaultClockHz);
+    void end();
+
+    void select(uint8_t tck, uint8_t tms, uint8_t tdo, uint8_t tdi);
+    void pull(uint8_t pin, bool up);
+    void release();
+
+    inline void setTms(bool level) { write(tms, level); }
+    inline void setTdi(bool level) { if (tdi.mask) write(tdi, level); }
+
+    inline bool clock() {
+        uint32_t start = ESP.getCycleCount();
+        REG_WRITE(tck.set, tck.mask);
+        while (ESP.getCycleCount() - start < halfPeriod) {}
+        bool level = (REG_READ(tdoIn) & tdoMask) != 0;
+        REG_WRITE(tck.clear, tck.mask);
+        while (ESP.getCycleCount() - start < 2 * halfPeriod) {}
+        return level;
+    }
+
+private:
+    struct Line {
+        uint32_t set = 0;       // W1TS register
+        uint32_t clear = 0;     // W1TC register
+        uint32_t mask = 0;
+    };
+
+    std::vector<uint8_t> scanPins;
+    Line tck, tms, tdi;
+    uint32_t tdoIn = 0;
+    uint32_t tdoMask = 0;
+    uint32_t halfPeriod = 120;  // CPU cycles
+    uint64_t enabled = 0;       // pins with the output enabled
+    int pulledDown = -1;
+
+    static Line line(uint8_t pin);
+    inline void write(const Line& l, bool level) { REG_WRITE(level ? l.set : l.clear, l.mask); }
+    void enableOutputs(uint64_t pins);
+};
 
 class JtagService {
 public:
     void configureJtag(uint8_t tck, uint8_t tms, uint8_t tdi, uint8_t tdo, int trst = -1);
     
+    // Staged IDCODE/BYPASS pinout search, exhaustive BYPASS search as fallback
     bool scanJtagDevice(
         const std::vector<uint8_t>& pins,
-        uint8_t& outTDI, uint8_t& outTDO,
-        uint8_t& outTCK, uint8_t& outTMS,
-        int& outTRST,
-        std::vector<uint32_t>& outDeviceIDs,
-        bool pulsePins,
+        JtagPinout& pinout,
+        JtagScanStats& stats,
+        bool exhaustiveFallback,
         void (*onProgress)(size_t, size_t)
     );
 
@@ -67,23 +115,8 @@ private:
     int _pinSWDIO = -1;
     int _pinSWCLK = -1;
 
-    // JTAG helpers
-    void tckPulse();
-    void tdiWrite(bool val);
-    void tmsWrite(bool val);
-    bool tdoRead();
-    void restoreIdle();
-    void enterShiftDR();
-    void enterShiftIR();
-    uint32_t bitReverse(uint32_t n);
-    uint32_t shiftArray(uint32_t pattern, int bits);
-    uint32_t sendData(uint32_t pattern, int bits);
-    int detectDevices();
-    void getDeviceIDs(int count, std::vector<uint32_t>& ids);
-    uint32_t bypassTest(int count, uint32_t pattern);
-    bool isValidDeviceID(uint32_t id);
-    void jtagResetChannels(const std::vector<uint8_t>& pins, int trstPin, bool pulsePins);
-    void jtagInitChannels(const std::vector<uint8_t>& pins, bool pulsePins);
+    // JTAG bit bang
+    JtagGpioPort jtagPort;
 
     // SWD helpers
     void swdClockPulse();
@@ -7,11 +7,26 @@ extern CFastLED FastLED; // declare FastLED as global
 
 LedService::LedService() {}
 
+LedService::~LedService() {
+    releaseLeds();
+}
+
+void LedService::releaseLeds() {
+    if (!leds) return;
+    FastLED.clear(true);
+
+    // addLeds controllers are static and stay in FastLED list
+    for (CLEDController* controller = CLEDController::head(); controller; controller = controller->next()) {
+        controller->setLeds(nullptr, 0);
+    }
+    delete[] leds;
+    leds = nullptr;
+    ledCount = 0;
+}
+
 void LedService::configure(uint8_t dataPin, uint8_t clockPin, uint16_t length, const std::string& protocol, uint8_t brightness) {
     if (leds) {
-        FastLED.clear(true);
-        delete[] leds;
-        leds = nullptr;
+        releaseLeds();
         delay(20);
     }
     
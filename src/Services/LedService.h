@@ -8,6 +8,7 @@
 class LedService {
 public:
     LedService();
+    ~LedService();
 
     void configure(uint8_t dataPin, uint8_t clockPin, uint16_t length, const std::string& protocol, uint8_t brightness);
     void fill(const CRGB& color);
@@ -26,4 +27,7 @@ private:
     uint16_t ledCount = 0;
     bool usesClock = false;
     bool animationRunning = false;
+
+    // Strip off and every FastLED controller detached from the buffer
+    void releaseLeds();
 };
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "LogicSamplerService.h"
+#include <esp_heap_caps.h>
+
+bool LogicSamplerService::begin(const std::vector<uint8_t>& pins, uint32_t sampleRate) {
+    end();
+    if (pins.empty() || pins.size() > MaxChannels || sampleRate == 0) return false;
+
+    channelCount = (uint8_t)pins.size();
+    for (uint8_t i = 0; i < channelCount; ++i) {
+        channelPins[i] = pins[i];
+        pinMode(pins[i], INPUT);
+    }
+
+    #ifndef DEVICE_M5STICK
+        int gpios[MaxChannels];
+        for (uint8_t i = 0; i < channelCount; ++i) gpios[i] = pins[i];
+
+        dedic_gpio_bundle_config_t config = {};
+        config.gpio_array = gpios;
+        config.array_size = channelCount;
+        config.flags.in_en = 1;
+        if (dedic_gpio_new_bundle(&config, &bundle) != ESP_OK) {
+            bundle = nullptr;
+            channelCount = 0;
+            return false;
+        }
+    #endif
+
+    uint32_t cpuHz = getCpuFrequencyMhz() * 1000000UL;
+    periodCycles = (cpuHz + sampleRate / 2) / sampleRate;
+    if (periodCycles == 0) periodCycles = 1;
+    actualRate = cpuHz / periodCycles;
+    return true;
+}
+
+void LogicSamplerService::end() {
+    #ifndef DEVICE_M5STICK
+        if (bundle) {
+            dedic_gpio_del_bundle(bundle);
+            bundle = nullptr;
+        }
+    #endif
+    channelCount = 0;
+}
+
+LogicSamplerService::Source LogicSamplerService::source(std::function<bool()> stop) {
+    return Source(*this, periodCycles, std::move(stop));
+}
+
+uint8_t* LogicSamplerService::allocateBuffer(size_t depth) {
+    // Keep some internal RAM for the rest of the firmware
+    size_t internal = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (depth + 32768 < internal) {
+        void* p = heap_caps_malloc(depth, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+        if (p) return static_cast<uint8_t*>(p);
+    }
+    return static_cast<uint8_t*>(heap_caps_malloc(depth, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+}
+
+void LogicSamplerService::freeBuffer(uint8_t* buffer) {
+    heap_caps_free(buffer);
+}
+
+size_t LogicSamplerService::maxDepth() const {
+    size_t internal = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    size_t psram = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    size_t best = internal > 32768 ? internal - 32768 : 0;
+    return psram > best ? psram : best;
+}
+
+size_t LogicSamplerService::maxTraceRuns() const {
+    // The trace vector comes from malloc, the other half stays for the rest
+    return heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT) / 2 / sizeof(uint32_t);
+}
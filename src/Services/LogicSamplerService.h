@@ -0,0 +1,97 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <Arduino.h>
+#include <soc/gpio_reg.h>
+#ifndef DEVICE_M5STICK
+#include <driver/dedic_gpio.h>
+#endif
+
+// Samples up to 8 GPIOs at once for the logic analyzer.
+// On the S3 the pins form a dedicated GPIO bundle, read by the CPU in a
+// single access; the M5Stick (ESP32) gathers them from the GPIO input
+// register. Samples are paced with the CPU cycle counter, a sample taken
+// more than one period late resyncs the clock and is counted.
+
+class LogicSamplerService {
+public:
+    static constexpr uint8_t MaxChannels = 8;
+
+    class Source {
+    public:
+        __attribute__((always_inline)) inline uint8_t sample() {
+            while ((int32_t)(ESP.getCycleCount() - next) < 0) {}
+            uint8_t value = service.read();
+            uint32_t now = ESP.getCycleCount();
+            if ((int32_t)(now - next) > (int32_t)period) {
+                next = now;
+                late++;
+            }
+            next += period;
+            return value;
+        }
+
+        bool stopRequested() { return stop && stop(); }
+
+        uint32_t lateSamples() const { return late; }
+
+    private:
+        friend class LogicSamplerService;
+        Source(LogicSamplerService& service, uint32_t period, std::function<bool()> stop)
+            : service(service), period(period), next(ESP.getCycleCount()), stop(std::move(stop)) {}
+
+        LogicSamplerService& service;
+        uint32_t period;
+        uint32_t next;
+        uint32_t late = 0;
+        std::function<bool()> stop;
+    };
+
+    // Pins become inputs, false if the sampler cannot be set up
+    bool begin(const std::vector<uint8_t>& pins, uint32_t sampleRate);
+    void end();
+
+    // Paced sample source, stop is polled while waiting for the trigger
+    Source source(std::function<bool()> stop = nullptr);
+
+    // Rate actually used, the period is a whole number of CPU cycles
+    uint32_t sampleRate() const { return actualRate; }
+
+    // Internal RAM if it fits, PSRAM otherwise
+    uint8_t* allocateBuffer(size_t depth);
+    void freeBuffer(uint8_t* buffer);
+
+    // Largest capture that can be allocated now
+    size_t maxDepth() const;
+
+    // Runs a compressed trace may hold, half the largest malloc block
+    size_t maxTraceRuns() const;
+
+    __attribute__((always_inline)) inline uint8_t read() const {
+        #ifndef DEVICE_M5STICK
+            return (uint8_t)dedic_gpio_bundle_read_in(bundle);
+        #else
+            uint32_t low = REG_READ(GPIO_IN_REG);
+            uint32_t high = REG_READ(GPIO_IN1_REG);
+            uint8_t value = 0;
+            for (uint8_t i = 0; i < channelCount; ++i) {
+                uint8_t pin = channelPins[i];
+                uint32_t level = pin < 32 ? (low >> pin) : (high >> (pin - 32));
+                value |= (uint8_t)((level & 1) << i);
+            }
+            return value;
+        #endif
+    }
+
+private:
+    uint8_t channelPins[MaxChannels] = {0};
+    uint8_t channelCount = 0;
+    uint32_t periodCycles = 0;
+    uint32_t actualRate = 0;
+    #ifndef DEVICE_M5STICK
+        dedic_gpio_bundle_handle_t bundle = nullptr;
+    #endif
+};
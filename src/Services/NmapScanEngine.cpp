@@ -0,0 +1,322 @@
+#include "NmapScanEngine.h"
+#include <algorithm>
+#include <deque>
+#include <cerrno>
+#include <cstdio>
+#include <sys/ioctl.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#include "lwip/sockets.h"
+#define NMAP_MAX_PARALLEL 8 // lwIP socket pool is shared with the web server
+#else
+#include <chrono>
+#include <thread>
+#include <sys/socket.h>
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#define NMAP_MAX_PARALLEL 64
+#endif
+
+NmapScanEngine::NmapScanEngine(const NmapTiming& timing) : timing(timing) {
+    if (this->timing.maxParallel > NMAP_MAX_PARALLEL) this->timing.maxParallel = NMAP_MAX_PARALLEL;
+    if (this->timing.maxParallel == 0) this->timing.maxParallel = 1;
+}
+
+/*
+Timing templates, scaled down from nmap for a microcontroller
+*/
+NmapTiming NmapScanEngine::timingTemplate(int level) {
+    switch (level) {
+        case 0:  return {0, 1,  1000, 100, 10000, 3, 5000}; // paranoid
+        case 1:  return {1, 1,  1000, 100, 10000, 3, 1000}; // sneaky
+        case 2:  return {2, 1,  1000, 100, 10000, 2, 400};  // polite
+        case 4:  return {4, 16, 500,  100, 1250,  1, 0};    // aggressive
+        case 5:  return {5, 32, 250,  50,  300,   0, 0};    // insane
+        case 3:
+        default: return {3, 8,  CONNECT_TIMEOUT_MS, 100, 2000, 1, 0}; // normal
+    }
+}
+
+const NmapScanStats& NmapScanEngine::getStats() const {
+    return stats;
+}
+
+uint32_t NmapScanEngine::getTimeoutMs() const {
+    if (!hasRtt) return timing.initialRttMs;
+    uint32_t rto = srttMs + 4 * rttvarMs;
+    return std::min(std::max(rto, timing.minRttMs), timing.maxRttMs);
+}
+
+/*
+Scan
+*/
+std::vector<int> NmapScanEngine::scan(uint32_t ipv4, const std::vector<uint16_t>& ports, Layer4Protocol proto) {
+    std::vector<int> results(ports.size(), nmap_rc_enum::OTHER);
+    std::deque<std::pair<size_t, uint8_t>> pending; // port index, tries
+    std::vector<Probe> inflight;                    // ordered by deadline
+    size_t window = timing.maxParallel;
+
+    for (size_t i = 0; i < ports.size(); ++i) pending.push_back({i, 0});
+    inflight.reserve(window);
+
+    stats = NmapScanStats();
+    stats.ports = ports.size();
+    stats.parallel = window;
+    uint32_t start = nowMs();
+    uint32_t lastLaunch = start - timing.scanDelayMs;
+
+    while (!pending.empty() || !inflight.empty()) {
+        uint32_t now = nowMs();
+
+        // Fill the window
+        while (!pending.empty() && inflight.size() < window) {
+            if (timing.scanDelayMs && now - lastLaunch < timing.scanDelayMs) break;
+
+            size_t index = pending.front().first;
+            uint8_t tries = pending.front().second;
+            int fd = -1;
+            int rc = launch(ipv4, ports[index], proto, fd);
+
+            if (rc == NO_SOCKET) {
+                // Socket pool exhausted, shrink the window to what we got
+                if (inflight.empty()) {
+                    results[index] = nmap_rc_enum::OTHER;
+                    pending.pop_front();
+                } else {
+                    window = inflight.size();
+                }
+                break;
+            }
+
+            pending.pop_front();
+            stats.probes++;
+            lastLaunch = now;
+
+            if (rc != IN_PROGRESS) {
+                results[index] = rc; // answered right away
+                continue;
+            }
+            insertByDeadline(inflight, {fd, index, tries, now, now + getTimeoutMs()});
+        }
+
+        if (inflight.empty()) {
+            if (!pending.empty() && timing.scanDelayMs) {
+                uint32_t elapsed = nowMs() - lastLaunch;
+                if (elapsed < timing.scanDelayMs) sleepMs(timing.scanDelayMs - elapsed);
+            }
+            continue;
+        }
+
+        // Wait for any socket or the nearest deadline
+        fd_set rfds, wfds, efds;
+        FD_ZERO(&rfds); FD_ZERO(&wfds); FD_ZERO(&efds);
+        int maxFd = -1;
+        for (const Probe& p : inflight) {
+            if (proto == Layer4Protocol::TCP) FD_SET(p.fd, &wfds);
+            else FD_SET(p.fd, &rfds);
+            FD_SET(p.fd, &efds);
+            if (p.fd > maxFd) maxFd = p.fd;
+        }
+
+        now = nowMs();
+        int32_t waitMs = (int32_t)(inflight.front().deadline - now);
+        if (waitMs < 0) waitMs = 0;
+        if (!pending.empty() && timing.scanDelayMs && inflight.size() < window) {
+            int32_t untilLaunch = (int32_t)(lastLaunch + timing.scanDelayMs - now);
+            if (untilLaunch < waitMs) waitMs = untilLaunch < 0 ? 0 : untilLaunch;
+        }
+        timeval tv{ waitMs / 1000, (waitMs % 1000) * 1000 };
+
+        int ready = ::select(maxFd + 1, &rfds, &wfds, &efds, &tv);
+        now = nowMs();
+
+        // Answered probes
+        if (ready > 0) {
+            for (size_t k = 0; k < inflight.size();) {
+                Probe& p = inflight[k];
+                int rc;
+                bool done = poll(p, proto, FD_ISSET(p.fd, &rfds), FD_ISSET(p.fd, &wfds), FD_ISSET(p.fd, &efds), rc);
+                if (!done) { ++k; continue; }
+
+                if (rc != nmap_rc_enum::OTHER) updateRtt(now - p.sentAt);
+                results[p.index] = rc;
+                ::close(p.fd);
+                inflight.erase(inflight.begin() + k);
+            }
+        }
+
+        // Expired probes, front of the queue
+        while (!inflight.empty() && (int32_t)(now - inflight.front().deadline) >= 0) {
+            Probe p = inflight.front();
+            inflight.erase(inflight.begin());
+            ::close(p.fd);
+
+            if (p.tries < timing.maxRetries) {
+                pending.push_front({p.index, (uint8_t)(p.tries + 1)});
+                stats.retries++;
+            } else {
+                results[p.index] = (proto == Layer4Protocol::TCP)
+                    ? nmap_rc_enum::TCP_FILTERED
+                    : nmap_rc_enum::UDP_OPEN_FILTERED;
+            }
+        }
+    }
+
+    stats.elapsedMs = nowMs() - start;
+    stats.srttMs = srttMs;
+    return results;
+}
+
+/*
+Open a socket and start the probe
+*/
+int NmapScanEngine::launch(uint32_t ipv4, uint16_t port, Layer4Protocol proto, int& fd) {
+    bool tcp = proto == Layer4Protocol::TCP;
+    fd = ::socket(AF_INET, tcp ? SOCK_STREAM : SOCK_DGRAM, tcp ? IPPROTO_TCP : IPPROTO_UDP);
+    if (fd < 0) return NO_SOCKET;
+
+    int nb = 1;
+    if (ioctl(fd, FIONBIO, &nb) < 0) {
+        ::close(fd);
+        return nmap_rc_enum::OTHER;
+    }
+
+    sockaddr_in sa{};
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    sa.sin_addr.s_addr = ipv4;
+
+    int rc = ::connect(fd, (sockaddr*)&sa, sizeof(sa));
+    int e = errno;
+
+    if (tcp) {
+        if (rc == 0) {
+            ::close(fd);
+            return nmap_rc_enum::TCP_OPEN;
+        }
+        if (e == EINPROGRESS || e == EALREADY) return IN_PROGRESS;
+
+        ::close(fd);
+        if (e == ECONNREFUSED || e == ECONNRESET) return nmap_rc_enum::TCP_CLOSED;
+        if (e == ETIMEDOUT || e == EHOSTUNREACH || e == ENETUNREACH || e == EACCES || e == EPERM)
+            return nmap_rc_enum::TCP_FILTERED;
+        return nmap_rc_enum::OTHER;
+    }
+
+    // UDP, connected so ICMP unreachable comes back as ECONNREFUSED
+    if (rc < 0) {
+        ::close(fd);
+        if (e == EHOSTUNREACH || e == ENETUNREACH) return nmap_rc_enum::UDP_OPEN_FILTERED;
+        return nmap_rc_enum::OTHER;
+    }
+
+    static const char probe[] = "PING\n";
+    if (::send(fd, probe, sizeof(probe) - 1, 0) < 0) {
+        e = errno;
+        ::close(fd);
+        if (e == EHOSTUNREACH || e == ENETUNREACH) return nmap_rc_enum::UDP_OPEN_FILTERED;
+        if (e == ECONNREFUSED) return nmap_rc_enum::UDP_CLOSED;
+        return nmap_rc_enum::OTHER;
+    }
+    return IN_PROGRESS;
+}
+
+/*
+Check a probe after select, true when it has a final state
+*/
+bool NmapScanEngine::poll(Probe& probe, Layer4Protocol proto, bool readable, bool writable, bool error, int& rc) {
+    if (proto == Layer4Protocol::TCP) {
+        if (!writable && !error) return false;
+
+        int soerr = 0;
+        socklen_t len = sizeof(soerr);
+        if (getsockopt(probe.fd, SOL_SOCKET, SO_ERROR, &soerr, &len) < 0) {
+            rc = nmap_rc_enum::OTHER;
+            return true;
+        }
+        switch (soerr) {
+            case 0:            rc = nmap_rc_enum::TCP_OPEN; break;
+            case ECONNREFUSED:
+            case ECONNRESET:   rc = nmap_rc_enum::TCP_CLOSED; break;
+            case ETIMEDOUT:
+            case EHOSTUNREACH:
+            case ENETUNREACH:
+            case EACCES:
+            case EPERM:        rc = nmap_rc_enum::TCP_FILTERED; break;
+            default:           rc = nmap_rc_enum::OTHER; break;
+        }
+        return true;
+    }
+
+    if (!readable && !error) return false;
+
+    uint8_t buf[64];
+    ssize_t n = ::recv(probe.fd, buf, sizeof(buf), MSG_DONTWAIT);
+    if (n >= 0) {
+        rc = nmap_rc_enum::UDP_OPEN;
+        return true;
+    }
+
+    int e = errno;
+    if (e == EAGAIN || e == EWOULDBLOCK) return false;
+    if (e == ECONNREFUSED) rc = nmap_rc_enum::UDP_CLOSED;          // ICMP port unreachable
+    else if (e == EMSGSIZE) rc = nmap_rc_enum::UDP_OPEN;           // larger than our buffer
+    else if (e == EHOSTUNREACH || e == ENETUNREACH) rc = nmap_rc_enum::UDP_OPEN_FILTERED;
+    else rc = nmap_rc_enum::OTHER;
+    return true;
+}
+
+void NmapScanEngine::insertByDeadline(std::vector<Probe>& queue, const Probe& probe) {
+    auto it = std::upper_bound(queue.begin(), queue.end(), probe, [](const Probe& a, const Probe& b) {
+        return (int32_t)(a.deadline - b.deadline) < 0;
+    });
+    queue.insert(it, probe);
+}
+
+/*
+RFC 6298 smoothed RTT
+*/
+void NmapScanEngine::updateRtt(uint32_t sampleMs) {
+    if (!hasRtt) {
+        srttMs = sampleMs;
+        rttvarMs = sampleMs / 2;
+        hasRtt = true;
+        return;
+    }
+    uint32_t delta = srttMs > sampleMs ? srttMs - sampleMs : sampleMs - srttMs;
+    rttvarMs = (3 * rttvarMs + delta) / 4;
+    srttMs = (7 * srttMs + sampleMs) / 8;
+}
+
+std::string NmapScanEngine::formatStats() const {
+    char line[160];
+    float secs = stats.elapsedMs / 1000.0f;
+    float rate = stats.elapsedMs ? stats.ports * 1000.0f / stats.elapsedMs : 0.0f;
+
+    snprintf(line, sizeof(line),
+        "Scanned %u ports in %.2f s (%.1f ports/s), T%u, %u parallel, %u retries, srtt %u ms",
+        (unsigned)stats.ports, secs, rate, (unsigned)timing.level,
+        (unsigned)stats.parallel, (unsigned)stats.retries, (unsigned)stats.srttMs);
+
+    return std::string(line);
+}
+
+uint32_t NmapScanEngine::nowMs() {
+    #ifdef ARDUINO
+        return millis();
+    #else
+        using namespace std::chrono;
+        return (uint32_t)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+    #endif
+}
+
+void NmapScanEngine::sleepMs(uint32_t ms) {
+    #ifdef ARDUINO
+        delay(ms);
+    #else
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    #endif
+}
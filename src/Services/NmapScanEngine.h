@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Data/NmapUtils.h"
+
+// Timing template, nmap -T0..-T5
+struct NmapTiming {
+    uint8_t level;
+    size_t maxParallel;      // probes in flight
+    uint32_t initialRttMs;   // timeout before any RTT sample
+    uint32_t minRttMs;       // adaptive timeout bounds
+    uint32_t maxRttMs;
+    uint8_t maxRetries;      // retransmissions before filtered
+    uint32_t scanDelayMs;    // pause between probe launches
+};
+
+struct NmapScanStats {
+    size_t ports = 0;
+    uint32_t probes = 0;
+    uint32_t retries = 0;
+    uint32_t elapsedMs = 0;
+    uint32_t srttMs = 0;
+    size_t parallel = 0;
+};
+
+// Concurrent port scanner.
+// Keeps a window of non blocking sockets in flight, multiplexed with select()
+// and expired from a deadline ordered queue. Timeouts follow the measured RTT
+// (srtt + 4 * rttvar) within the template bounds.
+
+class NmapScanEngine {
+public:
+    explicit NmapScanEngine(const NmapTiming& timing);
+
+    // Template for -T<level>, level is clamped to 0..5
+    static NmapTiming timingTemplate(int level);
+
+    // Scan ports of an IPv4 address (network order), one nmap_rc_enum per port
+    std::vector<int> scan(uint32_t ipv4, const std::vector<uint16_t>& ports, Layer4Protocol proto);
+
+    const NmapScanStats& getStats() const;
+
+    // Current per probe timeout
+    uint32_t getTimeoutMs() const;
+
+    // "Scanned 100 ports in 1.20 s (83.3 ports/s) ..."
+    std::string formatStats() const;
+
+private:
+    struct Probe {
+        int fd;
+        size_t index;
+        uint8_t tries;
+        uint32_t sentAt;
+        uint32_t deadline;
+    };
+
+    enum LaunchResult {
+        IN_PROGRESS = 100,
+        NO_SOCKET = 101
+    };
+
+    NmapTiming timing;
+    NmapScanStats stats;
+    bool hasRtt = false;
+    uint32_t srttMs = 0;
+    uint32_t rttvarMs = 0;
+
+    int launch(uint32_t ipv4, uint16_t port, Layer4Protocol proto, int& fd);
+    bool poll(Probe& probe, Layer4Protocol proto, bool readable, bool writable, bool error, int& rc);
+    void insertByDeadline(std::vector<Probe>& queue, const Probe& probe);
+    void updateRtt(uint32_t sampleMs);
+    static uint32_t nowMs();
+    static void sleepMs(uint32_t ms);
+};
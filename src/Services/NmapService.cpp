@@ -9,6 +9,7 @@
 #include <freertos/task.h>
 #include <unordered_set>
 #include <ESP32Ping.h>
+#include "NmapScanEngine.h"
 
 extern "C" {
 #include <getopt.h>   // provides getopt_long
@@ -45,11 +46,13 @@ std::string NmapService::getHelpText() {
     "  -sU             UDP scan\r\n"
     "  -sn             Ping scan (disable port scan)\r\n"
     "  -v / -vv        Verbosity\r\n"
+    "  -T<0-5>         Timing template, 0 slowest, 5 fastest (default 3)\r\n"
     "\r\n"
     "Examples:\r\n"
     "  nmap 192.168.1.10 -p 22,80-90 -sT -vv\r\n"
     "  nmap example.com -sU -p 53,123\r\n"
-    "  nmap 10.0.0.5 -p 8080\r\n";
+    "  nmap 10.0.0.5 -p 8080\r\n"
+    "  nmap 10.0.0.5 -p 1-1024 -T4\r\n";
 }
 
 NmapOptions NmapService::parseNmapArgs(const std::vector<std::string>& tokens) {
@@ -74,11 +77,12 @@ NmapOptions NmapService::parseNmapArgs(const std::vector<std::string>& tokens) {
         {"help",  no_argument,       nullptr, 'h'},
         {"ports", required_argument, nullptr, 'p'},
         {"scan",  required_argument, nullptr, 's'}, // e.g. -sT / -sU
+        {"timing", required_argument, nullptr, 'T'}, // e.g. -T4
         {nullptr, 0,                 nullptr,  0 }
     };
 
     int option;
-    while ((option = getopt_long(argc, argv.data(), "hp:s:v", longopts, nullptr)) != -1) {
+    while ((option = getopt_long(argc, argv.data(), "hp:s:vT:", longopts, nullptr)) != -1) {
         switch (option) {
             case 'h': nmapOptions.help = true; break;
             case 'p':
@@ -102,6 +106,12 @@ NmapOptions NmapService::parseNmapArgs(const std::vector<std::string>& tokens) {
                 // If using double verbosity, it will add
                 ++nmapOptions.verbosity;
                 break;
+            case 'T': // -T0 .. -T5
+                if (optarg && optarg[0] >= '0' && optarg[0] <= '5' && optarg[1] == '\0')
+                    nmapOptions.timing = optarg[0] - '0';
+                else
+                    nmapOptions.hasTrash = true;
+                break;
             default:
                 // Unknown options
                 nmapOptions.hasTrash = true;
@@ -126,165 +136,6 @@ const std::string NmapService::getReport() {
     return this->report;
 }
 
-static int udp_probe_with_timeout(in_addr addr, uint16_t port, int timeout_ms,
-                                  const void* payload, size_t payload_len, int retries = 2)
-{
-    int s = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
-    if (s < 0) return nmap_rc_enum::OTHER;
-
-    int rcvbuf = 4096;
-    (void)setsockopt(s, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
-
-    sockaddr_in sa{
-        .sin_family = AF_INET,
-        .sin_port   = htons(port),
-        .sin_addr   = addr 
-    };
-
-    if (::connect(s, (sockaddr*)&sa, sizeof(sa)) < 0) {
-        int e = errno;
-        ::close(s);
-        if (e == EHOSTUNREACH || e == ENETUNREACH) 
-            return nmap_rc_enum::UDP_OPEN_FILTERED;
-        return nmap_rc_enum::OTHER;
-    }
-
-    timeval tv{
-        .tv_sec = timeout_ms / 1000,
-        .tv_usec = (timeout_ms % 1000) * 1000
-    };
-    setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
-
-    // Probe message
-    static const char kProbe[] = "PING\n";
-    const void* buf   = (payload && payload_len) ? payload : kProbe;
-    size_t      blen  = (payload && payload_len) ? payload_len : (sizeof(kProbe)-1);
-
-    uint8_t rbuf[512];
-
-    for (int attempt = 0; attempt <= retries; ++attempt) {
-        if (::send(s, buf, blen, 0) < 0) {
-            int e = errno; ::close(s);
-            if (e == EHOSTUNREACH || e == ENETUNREACH)
-                return nmap_rc_enum::UDP_OPEN_FILTERED;
-            return nmap_rc_enum::OTHER;
-        }
-
-        ssize_t n = ::recvfrom(s, rbuf, sizeof(rbuf), MSG_TRUNC, nullptr, nullptr);
-        if (n >= 0) {
-            ::close(s);
-            return nmap_rc_enum::UDP_OPEN;
-        }
-
-        int e = errno;
-        if (e == ECONNREFUSED) {           // ICMP Unreachable
-            ::close(s);
-            return nmap_rc_enum::UDP_CLOSED;
-        }
-        if (e == EMSGSIZE) {               // Datagram larger buffer
-            ::close(s);
-            return nmap_rc_enum::UDP_OPEN;
-        }
-        if (e == EAGAIN || e == EWOULDBLOCK) {
-            vTaskDelay(pdMS_TO_TICKS(10));
-            continue;                      // Retry
-        }
-        if (e == EHOSTUNREACH || e == ENETUNREACH) {
-            ::close(s);
-            return nmap_rc_enum::UDP_OPEN_FILTERED;
-        }
-        ::close(s);
-        return nmap_rc_enum::OTHER;
-    }
-
-    ::close(s);
-    return nmap_rc_enum::UDP_OPEN_FILTERED;
-}
-
-static int tcp_connect_with_timeout(in_addr addr, uint16_t port, int timeout_ms)
-{
-    int s = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-    if (s < 0) 
-        return nmap_rc_enum::OTHER;
-
-    // Make socket non-blocking to avoid blocking the thread
-    int nb = 1;
-    if (ioctl(s, FIONBIO, &nb) < 0) {
-        ::close(s);
-        return nmap_rc_enum::OTHER;
-    }
-
-    // Setup the sockaddr_in structure
-    sockaddr_in sa{
-        .sin_family = AF_INET,
-        .sin_port   = htons(port),
-        .sin_addr   = addr
-    };
-
-    int rc = ::connect(s, (sockaddr*)&sa, sizeof(sa));
-    if (rc == 0) {
-        ::close(s);
-        return nmap_rc_enum::TCP_OPEN;
-    }
-
-    // Check status of connection
-    if (errno != EINPROGRESS && errno != EALREADY) {
-        int e = errno;
-        ::close(s);
-        if (e == ECONNREFUSED || e == ECONNRESET) return nmap_rc_enum::TCP_CLOSED;     // RST
-        if (e == ETIMEDOUT || e == EHOSTUNREACH || e == ENETUNREACH || e == EACCES || e == EPERM)
-            return nmap_rc_enum::TCP_FILTERED;                                         // Silently dropped / blocked
-        return nmap_rc_enum::OTHER;
-    }
-
-    // Wait to write
-    fd_set wfds, efds;
-    FD_ZERO(&wfds); FD_ZERO(&efds);
-    FD_SET(s, &wfds); FD_SET(s, &efds);
-
-    struct timeval tv{
-        .tv_sec  = timeout_ms / 1000,
-        .tv_usec = (timeout_ms % 1000) * 1000
-    };
-
-    rc = ::select(s + 1, nullptr, &wfds, &efds, &tv);
-    if (rc == 0) {                 // handshake never completed -> should be filtered
-        ::close(s);
-        return nmap_rc_enum::TCP_FILTERED;
-    }
-    if (rc < 0)  {
-        ::close(s);
-        return nmap_rc_enum::OTHER;
-    }
-
-    int soerr = 0;
-    socklen_t len = sizeof(soerr);
-    if (getsockopt(s, SOL_SOCKET, SO_ERROR, &soerr, &len) < 0) {
-        ::close(s);
-        return nmap_rc_enum::OTHER;
-    }
-
-    ::close(s);
-    switch (soerr)
-    {
-    case 0:
-        /* code */
-        return nmap_rc_enum::TCP_OPEN;
-    case ECONNREFUSED:
-    case ECONNRESET:
-        return nmap_rc_enum::TCP_CLOSED;
-    case ETIMEDOUT:
-    case EHOSTUNREACH:
-    case ENETUNREACH: 
-    case EACCES:
-    case EPERM:
-        return nmap_rc_enum::TCP_FILTERED;
-    default:
-        return nmap_rc_enum::OTHER;
-    }
-    return nmap_rc_enum::OTHER;
-}
-
 static bool resolveIPv4(const std::string& host, in_addr& out)
 {
     struct addrinfo hints{};
@@ -385,51 +236,38 @@ void NmapService::scanTarget(const std::string &host, const std::vector<uint16_t
     header += "SERVICE\r\n";
     report += header;
 
+    // All probes run concurrently, results come back in port order
+    NmapScanEngine engine(NmapScanEngine::timingTemplate(this->_options.timing));
+    std::vector<int> states = engine.scan(ip.s_addr, ports, this->layer4Protocol);
+
     int closed_ports = ports.size();
-    for (uint16_t p : ports) {
+    for (size_t i = 0; i < ports.size(); ++i) {
+        uint16_t p = ports[i];
         std::string state;
 
-        if (this->layer4Protocol == Layer4Protocol::TCP) {
-            int st = tcp_connect_with_timeout(ip, p, CONNECT_TIMEOUT_MS);
-            switch (st) {
-                case nmap_rc_enum::TCP_OPEN:
-                    state = "open";
-                    closed_ports--;
-                    break;
-                case nmap_rc_enum::TCP_CLOSED:
-                    if (this->verbosity >= 1) 
-                        state = "closed";
-                    break;
-                case nmap_rc_enum::TCP_FILTERED:
-                    state = "filtered";
-                    closed_ports--;
-                    break;
-                default:
-                    if (this->verbosity >= 1)
-                        state = "error";
-                    break;
-            }
-        } else if (this->layer4Protocol == Layer4Protocol::UDP) {
-            int st = udp_probe_with_timeout(ip, p, CONNECT_TIMEOUT_MS, nullptr, 0);
-            switch (st) {
-                case nmap_rc_enum::UDP_OPEN:
-                    state = "open";
-                    closed_ports--;
-                    break;
-                case nmap_rc_enum::UDP_CLOSED:
-                    if (this->verbosity >= 1)
-                        state = "closed";
-                    break;
-                case nmap_rc_enum::UDP_OPEN_FILTERED:
-                    state = "open|filtered";
-                    closed_ports--;
-                    break;
-                default:
-                    if (this->verbosity >= 1) state = "error";
-                    break;
-            }
-        } else {
-            return;
+        switch (states[i]) {
+            case nmap_rc_enum::TCP_OPEN:
+            case nmap_rc_enum::UDP_OPEN:
+                state = "open";
+                closed_ports--;
+                break;
+            case nmap_rc_enum::TCP_CLOSED:
+            case nmap_rc_enum::UDP_CLOSED:
+                if (this->verbosity >= 1)
+                    state = "closed";
+                break;
+            case nmap_rc_enum::TCP_FILTERED:
+                state = "filtered";
+                closed_ports--;
+                break;
+            case nmap_rc_enum::UDP_OPEN_FILTERED:
+                state = "open|filtered";
+                closed_ports--;
+                break;
+            default:
+                if (this->verbosity >= 1)
+                    state = "error";
+                break;
         }
 
         if (!state.empty()) {
@@ -448,12 +286,11 @@ void NmapService::scanTarget(const std::string &host, const std::vector<uint16_t
 
             report.append(row).append("\r\n");
         }
-
-        vTaskDelay(pdMS_TO_TICKS(SMALL_DELAY_MS));
     }
 
     if (closed_ports > 0)
-        this->report.append("Not shown: ").append(std::to_string(closed_ports)).append(" ports\r\n\n");
+        this->report.append("Not shown: ").append(std::to_string(closed_ports)).append(" ports\r\n");
+    this->report.append(engine.formatStats()).append("\r\n\n");
 }
 
 void NmapService::setICMPService(ICMPService* icmpService){
@@ -475,12 +312,12 @@ void NmapService::scanTask(void *pvParams)
     auto *params = static_cast<NmapTaskParams *>(pvParams);
     auto &service = *params->service;
     auto &hosts = params->targetHosts;
+    service.verbosity = params->verbosity;
     for (auto host : hosts) {
         service.scanTarget(host, params->targetPorts);
     }
 
     service.ready = true;
-    service.verbosity = params->verbosity;
     delete params;
     vTaskDelete(nullptr);
 }
@@ -1,4 +1,23 @@
 #include "OneWireService.h"
+#include "Services/ByteCodeEngine.h"
+
+namespace {
+// Bytecode spans go out with write_bytes
+struct OneWireProgramBus {
+    OneWireService& oneWire;
+    void reset() { oneWire.reset(); }
+    void write(const uint8_t* data, size_t count) {
+        for (size_t done = 0; done < count; done += 255) {
+            oneWire.writeBytes(data + done, (uint8_t)std::min<size_t>(255, count - done));
+        }
+    }
+    void read(uint8_t* out, size_t count) {
+        for (size_t i = 0; i < count; ++i) out[i] = oneWire.read();
+    }
+    void delayUs(uint32_t us) { delayMicroseconds(us); }
+    void delayMs(uint32_t ms) { delay(ms); }
+};
+}
 
 OneWireService::OneWireService() {}
 
@@ -103,45 +122,14 @@ uint8_t OneWireService::crc8(const uint8_t* data, uint8_t len) {
     return OneWire::crc8(data, len);
 }
 
-std::string OneWireService::executeByteCode(const std::vector<ByteCode>& bytecodes) {
-    std::string result;
-
-    for (const auto& code : bytecodes) {
-        switch (code.getCommand()) {
-            case ByteCodeEnum::Start:
-            case ByteCodeEnum::Stop:
-                reset();
-                break;
-
-            case ByteCodeEnum::Write: {
-                uint8_t byte = static_cast<uint8_t>(code.getData());
-                oneWire->write(byte);
-                break;
-            }
-
-            case ByteCodeEnum::Read: {
-                for (uint32_t i = 0; i < code.getRepeat(); ++i) {
-                    uint8_t value = read();
-                    char hex[4];
-                    snprintf(hex, sizeof(hex), "%02X ", value);
-                    result += hex;
-                }
-                break;
-            }
-
-            case ByteCodeEnum::DelayMs:
-                delay(code.getRepeat());
-                break;
-
-            case ByteCodeEnum::DelayUs:
-                delayMicroseconds(code.getRepeat());
-                break;
+std::string OneWireService::executeProgram(const ByteCodeProgram& program) {
+    OneWireProgramBus bus{*this};
+    return ByteCodeEngine::runOneWire(program, bus);
+}
 
-            default:
-                break;
-        }
-    }
-    return result;
+void OneWireService::executeProgram(const ByteCodeProgram& program, std::vector<uint8_t>& read) {
+    OneWireProgramBus bus{*this};
+    ByteCodeEngine::runOneWire(program, bus, read);
 }
 
 void OneWireService::resetSearch() {
@@ -2,7 +2,7 @@
 
 #include <OneWire.h>
 #include <vector>
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
 
 #define DS2431_FAMILY 0x2D
 #define DS2433_FAMILY 0x23
@@ -24,7 +24,8 @@ public:
     uint8_t crc8(const uint8_t* data, uint8_t len);
     void resetSearch();
     bool search(uint8_t* rom);
-    std::string executeByteCode(const std::vector<ByteCode>& bytecodes);
+    std::string executeProgram(const ByteCodeProgram& program);
+    void executeProgram(const ByteCodeProgram& program, std::vector<uint8_t>& read);
 
     // RW1990
     void writeRw1990(uint8_t pin, uint8_t* data, size_t len);
@@ -1,5 +1,9 @@
 #include "Rf24Service.h"
 
+Rf24Service::~Rf24Service() {
+    delete radio_;
+}
+
 bool Rf24Service::configure(
         uint8_t csnPin,
         uint8_t cePin,
@@ -7,6 +7,8 @@
 
 class Rf24Service {
 public:
+    ~Rf24Service();
+
     // Configuration
     bool configure(
         uint8_t csnPin,
@@ -0,0 +1,614 @@
+#include "ScriptEngine.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+enum : uint8_t {
+    OpNeg, OpNot, OpInv,                                    // unary
+    OpMul, OpDiv, OpMod, OpAdd, OpSub, OpShl, OpShr,
+    OpLt, OpLe, OpGt, OpGe, OpEq, OpNe,
+    OpAnd, OpXor, OpOr, OpLogicAnd, OpLogicOr
+};
+
+struct BinaryOperator {
+    const char* text;
+    uint8_t op;
+    uint8_t precedence;     // higher binds tighter
+};
+
+// Longest first so "<=" wins over "<"
+const BinaryOperator binaryOperators[] = {
+    {"<<", OpShl, 7}, {">>", OpShr, 7}, {"<=", OpLe, 6}, {">=", OpGe, 6},
+    {"==", OpEq, 5}, {"!=", OpNe, 5}, {"&&", OpLogicAnd, 1}, {"||", OpLogicOr, 0},
+    {"*", OpMul, 9}, {"/", OpDiv, 9}, {"%", OpMod, 9}, {"+", OpAdd, 8}, {"-", OpSub, 8},
+    {"<", OpLt, 6}, {">", OpGt, 6}, {"&", OpAnd, 4}, {"^", OpXor, 3}, {"|", OpOr, 2},
+};
+
+bool isNameStart(char c) { return std::isalpha((unsigned char)c) || c == '_'; }
+bool isNameChar(char c) { return std::isalnum((unsigned char)c) || c == '_'; }
+
+std::string trim(const std::string& s) {
+    size_t a = 0, b = s.size();
+    while (a < b && std::isspace((unsigned char)s[a])) a++;
+    while (b > a && std::isspace((unsigned char)s[b - 1])) b--;
+    return s.substr(a, b - a);
+}
+
+}
+
+class ScriptCompiler {
+public:
+    ScriptCompiler(Script& script, InstructionTransformer& instructions)
+        : script(script), instructions(instructions) {}
+
+    bool compile(const std::string& source, std::string& error) {
+        size_t start = 0;
+        while (start <= source.size()) {
+            size_t end = source.find('\n', start);
+            if (end == std::string::npos) end = source.size();
+            lineNumber++;
+            if (!statement(trim(source.substr(start, end - start)))) {
+                error = "line " + std::to_string(lineNumber) + ": " + reason;
+                return false;
+            }
+            start = end + 1;
+        }
+        if (!blocks.empty()) {
+            error = "line " + std::to_string(blocks.back().line) + ": '" + blocks.back().keyword + "' without end";
+            return false;
+        }
+        for (size_t at : exits) script.ops[at].target = (uint32_t)script.ops.size();
+        return true;
+    }
+
+private:
+    struct Block {
+        std::string keyword;
+        uint16_t line;
+        size_t test;                // step jumped back to, or the if test
+        size_t elseJump;            // jump over the else part, if any
+        uint16_t counter;
+        std::vector<size_t> breaks;
+    };
+
+    Script& script;
+    InstructionTransformer& instructions;
+    uint16_t lineNumber = 0;
+    std::string reason;
+    std::vector<Block> blocks;
+    std::vector<size_t> exits;
+    int hiddenCount = 0;
+
+    // Expression parser state
+    const char* cursor = nullptr;
+    int depth = 0;
+    int maxDepth = 0;
+
+    bool fail(const std::string& why) {
+        reason = why;
+        return false;
+    }
+
+    size_t emit(Script::OpType type, uint16_t slot = 0, uint32_t expr = 0, uint32_t target = 0, uint16_t limit = 0) {
+        script.ops.push_back({type, lineNumber, slot, limit, expr, target});
+        return script.ops.size() - 1;
+    }
+
+    uint16_t variable(const std::string& name) {
+        for (size_t i = 0; i < script.variables.size(); ++i) {
+            if (script.variables[i] == name) return (uint16_t)i;
+        }
+        script.variables.push_back(name);
+        return (uint16_t)(script.variables.size() - 1);
+    }
+
+    uint16_t hiddenVariable() {
+        return variable("#" + std::to_string(hiddenCount++));
+    }
+
+    static bool keyword(const std::string& line, const char* word, std::string& rest) {
+        size_t n = strlen(word);
+        if (line.compare(0, n, word) != 0) return false;
+        if (line.size() > n && !std::isspace((unsigned char)line[n])) return false;
+        rest = trim(line.substr(n));
+        return true;
+    }
+
+    bool statement(const std::string& line) {
+        std::string rest;
+        if (line.empty() || line[0] == '#') return true;
+
+        if (line[0] == '[' || line[0] == '{' || line[0] == '>') {
+            if (line.find('$') == std::string::npos) {
+                script.programs.emplace_back();
+                instructions.compile(line, script.programs.back());
+                emit(Script::OpType::Instruction, 0, (uint32_t)(script.programs.size() - 1), 0, 0);
+                return true;
+            }
+            uint32_t text;
+            if (!textTemplate(line, text)) return false;
+            emit(Script::OpType::Instruction, 1, text);
+            return true;
+        }
+
+        if (keyword(line, "set", rest)) {
+            size_t n = 0;
+            while (n < rest.size() && isNameChar(rest[n])) n++;
+            if (n == 0 || !isNameStart(rest[0])) return fail("set needs a variable name");
+            std::string name = rest.substr(0, n);
+            if (isReadVariable(name)) return fail("'" + name + "' is read only");
+            std::string value = trim(rest.substr(n));
+            if (!value.empty() && value[0] == '=') value = trim(value.substr(1));
+            uint32_t expr;
+            if (!expression(value, expr)) return false;
+            emit(Script::OpType::Set, variable(name), expr);
+            return true;
+        }
+
+        if (keyword(line, "if", rest)) {
+            uint32_t expr;
+            if (!expression(rest, expr)) return false;
+            blocks.push_back({"if", lineNumber, emit(Script::OpType::JumpIfFalse, 0, expr), SIZE_MAX, 0, {}});
+            return true;
+        }
+
+        if (keyword(line, "else", rest)) {
+            if (blocks.empty() || blocks.back().keyword != "if" || blocks.back().elseJump != SIZE_MAX) {
+                return fail("else without if");
+            }
+            Block& block = blocks.back();
+            block.elseJump = emit(Script::OpType::Jump);
+            script.ops[block.test].target = (uint32_t)script.ops.size();
+            return true;
+        }
+
+        if (keyword(line, "loop", rest)) {
+            // loop <count> [counter]
+            uint16_t counter;
+            size_t space = rest.find_last_of(" \t");
+            std::string count = rest;
+            std::string name = space == std::string::npos ? "" : rest.substr(space + 1);
+            // The last word is the counter when what comes before is a whole operand
+            std::string before = space == std::string::npos ? "" : trim(rest.substr(0, space));
+            bool operandBefore = !before.empty() && (isNameChar(before.back()) || before.back() == ')');
+            if (operandBefore && isNameStart(name[0]) &&
+                std::all_of(name.begin(), name.end(), isNameChar) && !isReadVariable(name)) {
+                count = before;
+                counter = variable(name);
+            } else {
+                counter = hiddenVariable();
+            }
+            uint32_t expr;
+            if (!expression(count, expr)) return false;
+            uint16_t limit = hiddenVariable();
+            emit(Script::OpType::LoopInit, counter, expr, 0, limit);
+            size_t test = emit(Script::OpType::LoopTest, counter, 0, 0, limit);
+            blocks.push_back({"loop", lineNumber, test, SIZE_MAX, counter, {}});
+            return true;
+        }
+
+        if (keyword(line, "while", rest)) {
+            uint32_t expr;
+            if (!expression(rest, expr)) return false;
+            size_t test = emit(Script::OpType::JumpIfFalse, 0, expr);
+            blocks.push_back({"while", lineNumber, test, SIZE_MAX, 0, {}});
+            return true;
+        }
+
+        if (keyword(line, "end", rest)) {
+            if (blocks.empty()) return fail("end without block");
+            Block block = blocks.back();
+            blocks.pop_back();
+            if (block.keyword == "if") {
+                size_t patch = block.elseJump != SIZE_MAX ? block.elseJump : block.test;
+                script.ops[patch].target = (uint32_t)script.ops.size();
+                return true;
+            }
+            if (block.keyword == "loop") {
+                emit(Script::OpType::LoopNext, block.counter, 0, (uint32_t)block.test);
+            } else {
+                emit(Script::OpType::Jump, 0, 0, (uint32_t)block.test);
+            }
+            script.ops[block.test].target = (uint32_t)script.ops.size();
+            for (size_t at : block.breaks) script.ops[at].target = (uint32_t)script.ops.size();
+            return true;
+        }
+
+        if (keyword(line, "break", rest)) {
+            for (auto it = blocks.rbegin(); it != blocks.rend(); ++it) {
+                if (it->keyword == "if") continue;
+                it->breaks.push_back(emit(Script::OpType::Jump));
+                return true;
+            }
+            return fail("break outside a loop");
+        }
+
+        if (keyword(line, "exit", rest)) {
+            exits.push_back(emit(Script::OpType::Jump));
+            return true;
+        }
+
+        if (keyword(line, "delay", rest)) {
+            uint32_t expr;
+            if (!expression(rest, expr)) return false;
+            emit(Script::OpType::Delay, 0, expr);
+            return true;
+        }
+
+        if (keyword(line, "print", rest)) {
+            uint32_t text;
+            if (!textTemplate(rest, text)) return false;
+            emit(Script::OpType::Print, 0, text);
+            return true;
+        }
+
+        uint32_t text;
+        if (!textTemplate(line, text)) return false;
+        emit(Script::OpType::Command, 0, text);
+        return true;
+    }
+
+    // Text with $name and $(expr) parts
+    bool textTemplate(const std::string& text, uint32_t& index) {
+        std::vector<Script::Segment> segments;
+        std::string plain;
+        size_t i = 0;
+        while (i < text.size()) {
+            if (text[i] != '$') {
+                plain += text[i++];
+                continue;
+            }
+            if (i + 1 < text.size() && text[i + 1] == '$') {
+                plain += '$';
+                i += 2;
+                continue;
+            }
+
+            std::string source;
+            if (i + 1 < text.size() && text[i + 1] == '(') {
+                int open = 0;
+                size_t j = i + 1;
+                for (; j < text.size(); ++j) {
+                    if (text[j] == '(') open++;
+                    else if (text[j] == ')' && --open == 0) break;
+                }
+                if (j == text.size()) return fail("unclosed $(");
+                source = text.substr(i + 2, j - i - 2);
+                i = j + 1;
+            } else {
+                size_t j = i + 1;
+                while (j < text.size() && isNameChar(text[j])) j++;
+                if (j == i + 1 || !isNameStart(text[i + 1])) return fail("$ needs a name or (expression)");
+                source = text.substr(i + 1, j - i - 1);
+                i = j;
+            }
+
+            uint32_t expr;
+            if (!expression(source, expr)) return false;
+            if (!plain.empty()) segments.push_back({plain, Script::NoExpr});
+            plain.clear();
+            segments.push_back({std::string(), expr});
+        }
+        if (!plain.empty()) segments.push_back({plain, Script::NoExpr});
+
+        script.texts.push_back(std::move(segments));
+        index = (uint32_t)(script.texts.size() - 1);
+        return true;
+    }
+
+    static bool isReadVariable(const std::string& name) {
+        if (name == "reads") return true;
+        if (name.compare(0, 4, "read") != 0) return false;
+        return std::all_of(name.begin() + 4, name.end(), [](char c) { return std::isdigit((unsigned char)c); });
+    }
+
+    // Expression to postfix tokens
+    bool expression(const std::string& text, uint32_t& index) {
+        if (trim(text).empty()) return fail("missing expression");
+        uint32_t first = (uint32_t)script.tokens.size();
+        cursor = text.c_str();
+        depth = 0;
+        maxDepth = 0;
+        if (!binary(0)) return false;
+        skipSpaces();
+        if (*cursor) return fail(std::string("unexpected '") + cursor + "'");
+        if (maxDepth > (int)ScriptEngine::MaxStack) return fail("expression too deep");
+        script.exprs.push_back({first, (uint32_t)script.tokens.size() - first});
+        index = (uint32_t)(script.exprs.size() - 1);
+        return true;
+    }
+
+    void skipSpaces() {
+        while (*cursor && std::isspace((unsigned char)*cursor)) cursor++;
+    }
+
+    void push(Script::Token token) {
+        script.tokens.push_back(token);
+        if (token.kind == Script::Token::Binary) depth--;
+        else if (token.kind != Script::Token::Unary) depth++;
+        if (depth > maxDepth) maxDepth = depth;
+    }
+
+    // Precedence climbing, left associative
+    bool binary(int minPrecedence) {
+        if (!unary()) return false;
+        while (true) {
+            skipSpaces();
+            const BinaryOperator* found = nullptr;
+            for (const auto& candidate : binaryOperators) {
+                if (strncmp(cursor, candidate.text, strlen(candidate.text)) == 0) {
+                    found = &candidate;
+                    break;
+                }
+            }
+            if (!found || found->precedence < minPrecedence) return true;
+            cursor += strlen(found->text);
+            if (!binary(found->precedence + 1)) return false;
+            push({Script::Token::Binary, found->op, 0});
+        }
+    }
+
+    bool unary() {
+        skipSpaces();
+        char c = *cursor;
+        if (c == '-' || c == '!' || c == '~') {
+            cursor++;
+            if (!unary()) return false;
+            push({Script::Token::Unary, (uint8_t)(c == '-' ? OpNeg : c == '!' ? OpNot : OpInv), 0});
+            return true;
+        }
+        return primary();
+    }
+
+    bool primary() {
+        skipSpaces();
+        char c = *cursor;
+
+        if (c == '(') {
+            cursor++;
+            if (!binary(0)) return false;
+            skipSpaces();
+            if (*cursor != ')') return fail("missing )");
+            cursor++;
+            return true;
+        }
+
+        if (c == '\'' && cursor[1] && cursor[2] == '\'') {
+            push({Script::Token::Number, 0, (int32_t)(uint8_t)cursor[1]});
+            cursor += 3;
+            return true;
+        }
+
+        if (std::isdigit((unsigned char)c)) {
+            char* end = nullptr;
+            unsigned long value = strtoul(cursor, &end, 0);
+            if (isNameChar(*end)) return fail(std::string("bad number '") + cursor + "'");
+            cursor = end;
+            push({Script::Token::Number, 0, (int32_t)(uint32_t)value});
+            return true;
+        }
+
+        if (c == '$') c = *++cursor;
+        if (isNameStart(c)) {
+            const char* start = cursor;
+            while (isNameChar(*cursor)) cursor++;
+            std::string name(start, cursor);
+            if (name == "reads") push({Script::Token::ReadCount, 0, 0});
+            else if (isReadVariable(name)) push({Script::Token::ReadByte, 0, name.size() > 4 ? atoi(name.c_str() + 4) : 0});
+            else push({Script::Token::Variable, 0, variable(name)});
+            return true;
+        }
+
+        return fail(*cursor ? std::string("unexpected '") + cursor + "'" : "missing operand");
+    }
+};
+
+ScriptEngine::ScriptEngine(InstructionTransformer& instructionTransformer)
+    : instructionTransformer(instructionTransformer) {}
+
+bool ScriptEngine::compile(const std::string& source, Script& script, std::string& error) {
+    script = Script();
+    script.hash = hashSource(source);
+    ScriptCompiler compiler(script, instructionTransformer);
+    return compiler.compile(source, error);
+}
+
+const Script* ScriptEngine::load(const std::string& name, const std::string& source, std::string& error) {
+    uint32_t hash = hashSource(source);
+    auto it = cache.find(name);
+    if (it != cache.end() && it->second.hash == hash) return &it->second;
+
+    Script script;
+    if (!compile(source, script, error)) {
+        if (it != cache.end()) cache.erase(it);
+        return nullptr;
+    }
+    Script& slot = cache[name];
+    slot = std::move(script);
+    return &slot;
+}
+
+// FNV-1a
+uint32_t ScriptEngine::hashSource(const std::string& source) {
+    uint32_t hash = 2166136261u;
+    for (char c : source) hash = (hash ^ (uint8_t)c) * 16777619u;
+    return hash;
+}
+
+ScriptRunStats ScriptEngine::run(const Script& script, IScriptHost& host) {
+    ScriptRunStats stats;
+    values.assign(script.variables.size(), 0);
+    readBytes.clear();
+
+    auto failAt = [&](const Script::Op& op, const char* why) -> ScriptRunStats& {
+        stats.error = "line " + std::to_string(op.line) + ": " + why;
+        return stats;
+    };
+
+    size_t pc = 0;
+    int32_t value = 0;
+    bool ok = true;
+    while (pc < script.ops.size()) {
+        const Script::Op& op = script.ops[pc++];
+        stats.steps++;
+        if (stats.steps % StopPollSteps == 0 && host.stopRequested()) {
+            stats.stopped = true;
+            break;
+        }
+
+        switch (op.type) {
+            case Script::OpType::Set:
+                if (!evaluate(script, op.expr, value)) return failAt(op, "division by zero");
+                values[op.slot] = value;
+                break;
+
+            case Script::OpType::Jump:
+                pc = op.target;
+                break;
+
+            case Script::OpType::JumpIfFalse:
+                if (!evaluate(script, op.expr, value)) return failAt(op, "division by zero");
+                if (!value) pc = op.target;
+                break;
+
+            case Script::OpType::LoopInit:
+                if (!evaluate(script, op.expr, value)) return failAt(op, "division by zero");
+                values[op.slot] = 0;
+                values[op.limit] = value;
+                break;
+
+            case Script::OpType::LoopTest:
+                if (values[op.slot] >= values[op.limit]) pc = op.target;
+                break;
+
+            case Script::OpType::LoopNext:
+                values[op.slot]++;
+                pc = op.target;
+                break;
+
+            case Script::OpType::Instruction: {
+                const ByteCodeProgram* program = &script.programs[op.expr];
+                if (op.slot) {
+                    render(script, op.expr, rendered, ok);
+                    if (!ok) return failAt(op, "division by zero");
+                    instructionTransformer.compile(rendered, scratch);
+                    program = &scratch;
+                }
+                stats.instructions++;
+                if (!host.runInstruction(*program, readBytes)) {
+                    return failAt(op, "instructions are not available in this mode");
+                }
+                break;
+            }
+
+            case Script::OpType::Command:
+                render(script, op.expr, rendered, ok);
+                if (!ok) return failAt(op, "division by zero");
+                stats.commands++;
+                host.runCommand(rendered);
+                break;
+
+            case Script::OpType::Print:
+                render(script, op.expr, rendered, ok);
+                if (!ok) return failAt(op, "division by zero");
+                host.print(rendered);
+                break;
+
+            case Script::OpType::Delay:
+                if (!evaluate(script, op.expr, value)) return failAt(op, "division by zero");
+                if (value > 0) host.delayMs((uint32_t)value);
+                if (host.stopRequested()) {
+                    stats.stopped = true;
+                    return stats;
+                }
+                break;
+        }
+    }
+    return stats;
+}
+
+bool ScriptEngine::evaluate(const Script& script, uint32_t expr, int32_t& out) const {
+    int32_t stack[MaxStack];
+    size_t top = 0;
+    const auto& range = script.exprs[expr];
+    const Script::Token* token = script.tokens.data() + range.first;
+    const Script::Token* end = token + range.second;
+
+    for (; token < end; ++token) {
+        switch (token->kind) {
+            case Script::Token::Number:
+                stack[top++] = token->value;
+                break;
+            case Script::Token::Variable:
+                stack[top++] = values[token->value];
+                break;
+            case Script::Token::ReadByte:
+                stack[top++] = (size_t)token->value < readBytes.size() ? readBytes[token->value] : -1;
+                break;
+            case Script::Token::ReadCount:
+                stack[top++] = (int32_t)readBytes.size();
+                break;
+            case Script::Token::Unary: {
+                int32_t& a = stack[top - 1];
+                a = token->op == OpNeg ? (int32_t)(0u - (uint32_t)a) : token->op == OpNot ? !a : ~a;
+                break;
+            }
+            case Script::Token::Binary: {
+                int32_t b = stack[--top];
+                int32_t& a = stack[top - 1];
+                uint32_t ua = (uint32_t)a, ub = (uint32_t)b;
+                switch (token->op) {
+                    case OpMul: a = (int32_t)(ua * ub); break;
+                    case OpDiv:
+                    case OpMod:
+                        if (b == 0) return false;
+                        if (a == INT32_MIN && b == -1) a = token->op == OpDiv ? INT32_MIN : 0;
+                        else a = token->op == OpDiv ? a / b : a % b;
+                        break;
+                    case OpAdd: a = (int32_t)(ua + ub); break;
+                    case OpSub: a = (int32_t)(ua - ub); break;
+                    case OpShl: a = (int32_t)(ua << (ub & 31)); break;
+                    case OpShr: a = (int32_t)(ua >> (ub & 31)); break;
+                    case OpLt: a = a < b; break;
+                    case OpLe: a = a <= b; break;
+                    case OpGt: a = a > b; break;
+                    case OpGe: a = a >= b; break;
+                    case OpEq: a = a == b; break;
+                    case OpNe: a = a != b; break;
+                    case OpAnd: a &= b; break;
+                    case OpXor: a ^= b; break;
+                    case OpOr: a |= b; break;
+                    case OpLogicAnd: a = a && b; break;
+                    case OpLogicOr: a = a || b; break;
+                }
+                break;
+            }
+        }
+    }
+    out = stack[0];
+    return true;
+}
+
+void ScriptEngine::render(const Script& script, uint32_t text, std::string& out, bool& ok) const {
+    out.clear();
+    ok = true;
+    char number[12];
+    for (const auto& segment : script.texts[text]) {
+        if (segment.expr == Script::NoExpr) {
+            out += segment.text;
+            continue;
+        }
+        int32_t value;
+        if (!evaluate(script, segment.expr, value)) {
+            ok = false;
+            return;
+        }
+        snprintf(number, sizeof(number), "%ld", (long)value);
+        out += number;
+    }
+}
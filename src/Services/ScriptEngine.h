@@ -0,0 +1,113 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "Interfaces/IScriptHost.h"
+#include "Models/ByteCodeProgram.h"
+#include "Transformers/InstructionTransformer.h"
+
+// Small script language run on the device, one statement per line:
+//
+//   # comment
+//   set addr = 0x10              variables are 32 bit integers
+//   loop 16 i ... end            i counts 0..15, the name is optional
+//   while read & 0x01 ... end
+//   if read == 0xFF ... else ... end
+//   break, exit
+//   print Value at $addr: $(read0 + 1)
+//   delay 10                     milliseconds
+//   [0x50 $addr r:1]             instruction line in the current mode
+//   scan                         anything else is a terminal command
+//
+// Expressions use C operators and precedence, numbers are decimal, 0x hex or
+// 'c'. read is the first byte of the last instruction read (-1 when none),
+// readN its byte N and reads the count. In text, $name and $(expr) are
+// replaced by their decimal value.
+//
+// A script is compiled once into flat steps with jump targets and postfix
+// expressions. Instruction lines without $ are compiled to bytecode then too.
+
+struct ScriptRunStats {
+    uint32_t steps = 0;
+    uint32_t instructions = 0;
+    uint32_t commands = 0;
+    bool stopped = false;
+    std::string error;          // empty when the script ran to its end
+};
+
+class Script {
+public:
+    size_t stepCount() const { return ops.size(); }
+
+private:
+    friend class ScriptEngine;
+    friend class ScriptCompiler;
+
+    enum class OpType : uint8_t { Set, Jump, JumpIfFalse, LoopInit, LoopTest, LoopNext, Instruction, Command, Print, Delay };
+
+    struct Op {
+        OpType type;
+        uint16_t line;
+        uint16_t slot;          // variable, loop counter, 1 for an instruction with $
+        uint16_t limit;         // loop limit variable
+        uint32_t expr;          // expression, text or program index
+        uint32_t target;        // jump target step
+    };
+
+    struct Token {
+        enum Kind : uint8_t { Number, Variable, ReadByte, ReadCount, Unary, Binary } kind;
+        uint8_t op;             // operator code for Unary and Binary
+        int32_t value;          // number, variable slot or read index
+    };
+
+    struct Segment {
+        std::string text;
+        uint32_t expr;          // NoExpr for plain text
+    };
+
+    static constexpr uint32_t NoExpr = 0xFFFFFFFF;
+
+    std::vector<Op> ops;
+    std::vector<Token> tokens;
+    std::vector<std::pair<uint32_t, uint32_t>> exprs;              // first token, count
+    std::vector<std::vector<Segment>> texts;
+    std::vector<ByteCodeProgram> programs;
+    std::vector<std::string> variables;
+    uint32_t hash = 0;
+};
+
+class ScriptEngine {
+public:
+    static constexpr size_t MaxStack = 32;
+    static constexpr uint32_t StopPollSteps = 256;
+
+    explicit ScriptEngine(InstructionTransformer& instructionTransformer);
+
+    // Compile source, error is "line N: reason" on failure
+    bool compile(const std::string& source, Script& script, std::string& error);
+
+    // Compiled script for name, compiled again only when source changed
+    const Script* load(const std::string& name, const std::string& source, std::string& error);
+
+    ScriptRunStats run(const Script& script, IScriptHost& host);
+
+    size_t cachedScripts() const { return cache.size(); }
+    void clearCache() { cache.clear(); }
+
+    static uint32_t hashSource(const std::string& source);
+
+private:
+    InstructionTransformer& instructionTransformer;
+    std::map<std::string, Script> cache;
+
+    // Run state, kept to reuse the storage
+    std::vector<int32_t> values;
+    std::vector<uint8_t> readBytes;
+    ByteCodeProgram scratch;
+    std::string rendered;
+
+    bool evaluate(const Script& script, uint32_t expr, int32_t& out) const;
+    void render(const Script& script, uint32_t text, std::string& out, bool& ok) const;
+};
@@ -0,0 +1,37 @@
+#ifndef DEVICE_M5STICK
+
+#include "SdBlockDevice.h"
+#include "ff.h"
+#include "diskio_impl.h"
+#include "sd_diskio.h"
+
+void SdBlockDevice::begin(SDFS& fs) {
+    // SDFS keeps its drive number protected, find the drive the SD driver
+    // registered with the same card size
+    pdrv = 0xFF;
+    sectors = fs.numSectors();
+    for (uint8_t drive = 0; drive < FF_VOLUMES && sectors; ++drive) {
+        if (sdcard_num_sectors(drive) == sectors) {
+            pdrv = drive;
+            break;
+        }
+    }
+    if (pdrv == 0xFF) sectors = 0;
+}
+
+bool SdBlockDevice::readSectors(uint32_t lba, uint8_t* out, uint32_t count) {
+    if (pdrv == 0xFF) return false;
+    return ff_disk_read(pdrv, out, lba, count) == RES_OK;
+}
+
+bool SdBlockDevice::writeSectors(uint32_t lba, const uint8_t* data, uint32_t count) {
+    if (pdrv == 0xFF) return false;
+    return ff_disk_write(pdrv, data, lba, count) == RES_OK;
+}
+
+bool SdBlockDevice::sync() {
+    if (pdrv == 0xFF) return false;
+    return ff_disk_ioctl(pdrv, CTRL_SYNC, nullptr) == RES_OK;
+}
+
+#endif
@@ -0,0 +1,26 @@
+#pragma once
+
+#ifndef DEVICE_M5STICK
+
+#include <SD.h>
+#include "Interfaces/IBlockDevice.h"
+
+// SD card mounted by the SD library, accessed through its FatFs disk driver
+// so multi sector calls become CMD18/CMD25 multi block transfers
+
+class SdBlockDevice : public IBlockDevice {
+public:
+    // Call after SD.begin()
+    void begin(SDFS& fs);
+
+    uint32_t sectorCount() const override { return sectors; }
+    bool readSectors(uint32_t lba, uint8_t* out, uint32_t count) override;
+    bool writeSectors(uint32_t lba, const uint8_t* data, uint32_t count) override;
+    bool sync() override;
+
+private:
+    uint8_t pdrv = 0xFF;
+    uint32_t sectors = 0;
+};
+
+#endif
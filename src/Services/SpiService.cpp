@@ -1,10 +1,27 @@
 #include "Services/SpiService.h"
 #include <ESP32SPISlave.h>
 #include "driver/spi_slave.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "Services/ByteCodeEngine.h"
+
+namespace {
+// Bytecode spans go out with one transferBytes
+struct SpiProgramBus {
+    SpiService& spi;
+    void select(bool active) { active ? spi.beginTransaction() : spi.endTransaction(); }
+    void transfer(const uint8_t* out, uint8_t* in, size_t count) { SPI.transferBytes(out, in, count); }
+    void delayUs(uint32_t us) { delayMicroseconds(us); }
+    void delayMs(uint32_t ms) { delay(ms); }
+};
+}
 
 void SpiService::configure(uint8_t mosi, uint8_t miso, uint8_t sclk, uint8_t cs, uint32_t frequency) {
     end();
     csPin = cs;
+    mosiPin = mosi;
+    misoPin = miso;
+    sclkPin = sclk;
     spiFrequency = frequency;
     SPI.begin(sclk, miso, mosi, cs);
     pinMode(cs, OUTPUT);
@@ -29,6 +46,10 @@ uint8_t SpiService::transfer(uint8_t data) {
     return SPI.transfer(data);
 }
 
+void SpiService::transferBytes(const uint8_t* out, uint8_t* in, size_t count) {
+    SPI.transferBytes(out, in, count);
+}
+
 std::string SpiService::readFlashID() {
     uint8_t id[3] = {0};
 
@@ -62,18 +83,86 @@ uint32_t SpiService::calculateFlashCapacity(uint8_t code) {
 }
 
 void SpiService::readFlashData(uint32_t address, uint8_t* buffer, size_t length) {
+    if (flashDevice) {
+        // Bulk read, one DMA transaction, data on IO0/IO1 in dual mode
+        spi_transaction_t t = {};
+        t.flags = flashDualOutput ? SPI_TRANS_MODE_DIO : 0;
+        t.cmd = flashDualOutput ? 0x3B : 0x0B;  // Dual Output / Fast Read
+        t.addr = address;
+        t.rxlength = length * 8;
+        t.rx_buffer = buffer;
+        spi_device_transmit(flashDevice, &t);
+        return;
+    }
+
     beginTransaction();
-    SPI.transfer(0x03);  // Read Data command
+    SPI.transfer(0x0B);  // Fast Read command
     SPI.transfer((address >> 16) & 0xFF);
     SPI.transfer((address >> 8) & 0xFF);
     SPI.transfer(address & 0xFF);
+    SPI.transfer(0x00);  // Dummy byte
 
-    for (size_t i = 0; i < length; ++i) {
-        buffer[i] = SPI.transfer(0x00);
-    }
+    SPI.transferBytes(nullptr, buffer, length);
     endTransaction();
 }
 
+bool SpiService::beginBulkRead(size_t maxLength, bool dualOutput) {
+    // The IDF master driver takes the bus over from the Arduino SPI class
+    SPI.end();
+
+    spi_bus_config_t bus = {};
+    bus.mosi_io_num = mosiPin;
+    bus.miso_io_num = misoPin;
+    bus.sclk_io_num = sclkPin;
+    bus.quadwp_io_num = -1;
+    bus.quadhd_io_num = -1;
+    bus.max_transfer_sz = maxLength;
+
+    spi_device_interface_config_t dev = {};
+    dev.command_bits = 8;
+    dev.address_bits = 24;
+    dev.dummy_bits = 8;
+    dev.mode = 0;
+    dev.clock_speed_hz = spiFrequency;
+    dev.spics_io_num = csPin;
+    dev.flags = SPI_DEVICE_HALFDUPLEX;
+    dev.queue_size = 1;
+
+    if (spi_bus_initialize(SPI2_HOST, &bus, SPI_DMA_CH_AUTO) != ESP_OK) {
+        configure(mosiPin, misoPin, sclkPin, csPin, spiFrequency);
+        return false;
+    }
+    if (spi_bus_add_device(SPI2_HOST, &dev, &flashDevice) != ESP_OK) {
+        flashDevice = nullptr;
+        spi_bus_free(SPI2_HOST);
+        configure(mosiPin, misoPin, sclkPin, csPin, spiFrequency);
+        return false;
+    }
+
+    flashDualOutput = dualOutput;
+    return true;
+}
+
+void SpiService::endBulkRead() {
+    if (!flashDevice) return;
+
+    spi_bus_remove_device(flashDevice);
+    spi_bus_free(SPI2_HOST);
+    flashDevice = nullptr;
+    flashDualOutput = false;
+
+    // Back to the Arduino SPI class
+    configure(mosiPin, misoPin, sclkPin, csPin, spiFrequency);
+}
+
+uint8_t* SpiService::allocateReadBuffer(size_t length) {
+    return static_cast<uint8_t*>(heap_caps_malloc(length, MALLOC_CAP_DMA));
+}
+
+void SpiService::freeReadBuffer(uint8_t* buffer) {
+    heap_caps_free(buffer);
+}
+
 void SpiService::eraseFlashSector(uint32_t address, uint32_t freq) {
     enableFlashWrite(freq);  // 0x06
 
@@ -174,102 +263,89 @@ void SpiService::writeFlashPatch(uint32_t address, const std::vector<uint8_t>& d
     }
 }
 
-std::string SpiService::executeByteCode(const std::vector<ByteCode>& bytecodes) {
-    std::string result;
-    bool inTransaction = false;
-
-    for (const auto& code : bytecodes) {
-        switch (code.getCommand()) {
-            case ByteCodeEnum::Start:
-                if (!inTransaction) {
-                    beginTransaction();
-                    inTransaction = true;
-                }
-                break;
-
-            case ByteCodeEnum::Stop:
-                if (inTransaction) {
-                    endTransaction();
-                    inTransaction = false;
-                }
-                break;
-
-            case ByteCodeEnum::Write:
-                for (uint32_t i = 0; i < code.getRepeat(); ++i) {
-                    transfer(code.getData());
-                }
-                break;
-
-            case ByteCodeEnum::Read:
-                for (uint32_t i = 0; i < code.getRepeat(); ++i) {
-                    uint8_t val = transfer(0x00);  // dummy byte
-                    char hex[5];
-                    snprintf(hex, sizeof(hex), "%02X ", val);
-                    result += hex;
-                }
-                break;
-
-            case ByteCodeEnum::DelayMs:
-                delay(code.getRepeat());
-                break;
-
-            case ByteCodeEnum::DelayUs:
-                delayMicroseconds(code.getRepeat());
-                break;
-
-            default:
-                break;
-        }
-    }
-
-    // Close transaction if left open
-    if (inTransaction) {
-        endTransaction();
-    }
+std::string SpiService::executeProgram(const ByteCodeProgram& program) {
+    SpiProgramBus bus{*this};
+    return ByteCodeEngine::runSpi(program, bus);
+}
 
-    return result;
+void SpiService::executeProgram(const ByteCodeProgram& program, std::vector<uint8_t>& read) {
+    SpiProgramBus bus{*this};
+    ByteCodeEngine::runSpi(program, bus, read);
 }
 
 // #### SPI SLAVE ######
 
 static ESP32SPISlave spiSlave;
-static constexpr size_t SLAVE_BUFFER_SIZE = 8;
 static std::atomic<bool> slave{false};
 
-static uint8_t slave_tx_buf[SLAVE_BUFFER_SIZE] = {0};
-static uint8_t slave_rx_buf[SLAVE_BUFFER_SIZE] = {0};
+// Transactions queued to the driver, each one with its own DMA buffer
+static constexpr size_t SLAVE_QUEUE_SIZE = 4;
+static uint8_t* slave_rx_bufs[SLAVE_QUEUE_SIZE] = {nullptr};
+static uint8_t* slave_tx_buf = nullptr;
+static size_t slaveTransactionSize = 0;
 
-static std::deque<std::vector<uint8_t>> slaveBuffer;
-static std::mutex slaveBufferMutex;
+// Filled by the ISR, drained by getSlaveData()
+static RecordRingBuffer<SLAVE_RING_SIZE> slaveRing;
+static_assert(SLAVE_MAX_TRANSACTION % 4 == 0, "DMA rounding must stay within the ring record size");
 
 void IRAM_ATTR slaveTransactionCallback(spi_slave_transaction_t* trans, void* arg) {
     if (!slave) return;
 
-    // Copy to vector
-    size_t length_bytes = (trans->trans_len + 7) / 8; // trans_len in bits
-    std::vector<uint8_t> received(slave_rx_buf, slave_rx_buf + length_bytes);
+    // trans_len in bits, capped by the driver at the queued length: bytes
+    // clocked past it are not seen, so there is no truncation to report
+    size_t length_bytes = (trans->trans_len + 7) / 8;
+    slaveRing.push(static_cast<const uint8_t*>(trans->rx_buffer), length_bytes,
+                   (uint32_t)esp_timer_get_time());
+}
 
-    {
-        // Push thread safe
-        std::lock_guard<std::mutex> lock(slaveBufferMutex);
-        slaveBuffer.push_back(std::move(received));
+static void freeSlaveBuffers() {
+    heap_caps_free(slave_tx_buf);
+    slave_tx_buf = nullptr;
+    for (size_t i = 0; i < SLAVE_QUEUE_SIZE; ++i) {
+        heap_caps_free(slave_rx_bufs[i]);
+        slave_rx_bufs[i] = nullptr;
+    }
+}
 
-        // Limit
-        if (slaveBuffer.size() > 100) slaveBuffer.pop_front();
+static void queueSlaveTransactions() {
+    for (size_t i = 0; i < SLAVE_QUEUE_SIZE; ++i) {
+        spiSlave.queue(slave_tx_buf, slave_rx_bufs[i], slaveTransactionSize);
     }
+    spiSlave.trigger();
 }
 
-void SpiService::startSlave(int sclk, int miso, int mosi, int cs) {
-    if (slave) return;
+bool SpiService::startSlave(int sclk, int miso, int mosi, int cs, size_t transactionSize) {
+    if (slave) return true;
+
+    // DMA wants 4 bytes multiples
+    if (transactionSize < 4) transactionSize = 4;
+    if (transactionSize > (size_t)SLAVE_MAX_TRANSACTION) transactionSize = SLAVE_MAX_TRANSACTION;
+    slaveTransactionSize = (transactionSize + 3) & ~(size_t)3;
+
+    slave_tx_buf = static_cast<uint8_t*>(heap_caps_calloc(1, slaveTransactionSize, MALLOC_CAP_DMA));
+    for (size_t i = 0; i < SLAVE_QUEUE_SIZE; ++i) {
+        slave_rx_bufs[i] = static_cast<uint8_t*>(heap_caps_calloc(1, slaveTransactionSize, MALLOC_CAP_DMA));
+    }
+
+    // No DMA memory left, nothing handed to the driver
+    bool allocated = slave_tx_buf != nullptr;
+    for (size_t i = 0; i < SLAVE_QUEUE_SIZE; ++i) allocated = allocated && slave_rx_bufs[i];
+    if (!allocated) {
+        freeSlaveBuffers();
+        return false;
+    }
+
+    slaveRing.clear();
+    slaveRing.resetCounters();
     slave = true;
 
     spiSlave.setDataMode(SPI_MODE0);
-    spiSlave.setQueueSize(1);
+    spiSlave.setQueueSize(SLAVE_QUEUE_SIZE);
     spiSlave.setUserPostTransCbAndArg(slaveTransactionCallback, nullptr);
     spiSlave.begin(FSPI, sclk, miso, mosi, cs);
-    
-    spiSlave.queue(slave_tx_buf, slave_rx_buf, SLAVE_BUFFER_SIZE);
-    spiSlave.trigger();    
+
+    queueSlaveTransactions();
+    return true;
 }
 
 void SpiService::stopSlave(int sclk, int miso, int mosi, int cs) {
@@ -282,36 +358,32 @@ void SpiService::stopSlave(int sclk, int miso, int mosi, int cs) {
     }
     
     delay(100);
-    slaveBuffer.clear();
-    memset(slave_rx_buf, 0, SLAVE_BUFFER_SIZE);
-    memset(slave_tx_buf, 0, SLAVE_BUFFER_SIZE);
+    slaveRing.clear();
 
     spiSlave.end();
     spi_slave_free(SPI2_HOST);   // FSPI
+
+    freeSlaveBuffers();
 }
 
 bool SpiService::isSlave() const {
     return slave;
 }
 
-std::vector<std::vector<uint8_t>> SpiService::getSlaveData() {
-    std::vector<std::vector<uint8_t>> out;
+size_t SpiService::getSlaveData(RecordBatch& out) {
+    out.clear();
 
-    if (spiSlave.hasTransactionsCompletedAndAllResultsReady(1)) {
-        size_t receivedBytes = spiSlave.numBytesReceived();
-        if (receivedBytes > SLAVE_BUFFER_SIZE) receivedBytes = SLAVE_BUFFER_SIZE;
-
-        if (receivedBytes > 0) {
-            out.emplace_back(slave_rx_buf, slave_rx_buf + receivedBytes);
-        }
-
-        // relaunch
-        memset(slave_rx_buf, 0, SLAVE_BUFFER_SIZE);
-        spiSlave.queue(/*tx*/nullptr, /*rx*/slave_rx_buf, SLAVE_BUFFER_SIZE);
-        spiSlave.trigger();
+    // All queued transactions done, hand the buffers back to the driver
+    if (slave && spiSlave.hasTransactionsCompletedAndAllResultsReady(SLAVE_QUEUE_SIZE)) {
+        spiSlave.numBytesReceivedAll(); // consume results
+        queueSlaveTransactions();
     }
 
-    return out;
+    return slaveRing.drain(out);
+}
+
+uint32_t SpiService::getSlaveDroppedCount() const {
+    return slaveRing.droppedCount();
 }
 
 // #### EEPROM ######
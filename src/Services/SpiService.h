@@ -2,15 +2,20 @@
 
 #include <vector>
 #include <atomic>
-#include <deque>
-#include <mutex>
 #include <Arduino.h>
 #include <EEPROM_SPI_WE.h>
 #include <SPI.h>
 #include <Data/FlashDatabase.h>
-#include <Models/ByteCode.h>
+#include <Models/ByteCodeProgram.h>
+#include <Buffers/RecordRingBuffer.h>
+#include <Interfaces/IFlashReader.h>
+#include "driver/spi_master.h"
 
-class SpiService {
+#define SLAVE_RING_SIZE 16384        // captured transactions, bytes
+// Bytes per transaction, the largest record the ring stores whole
+#define SLAVE_MAX_TRANSACTION ((int)RecordRingBuffer<SLAVE_RING_SIZE>::MaxPayload)
+
+class SpiService : public IFlashReader {
 public:
     // Base
     void configure(uint8_t mosi, uint8_t miso, uint8_t sclk, uint8_t cs, uint32_t frequency = 1000000);
@@ -18,11 +23,16 @@ public:
     void beginTransaction();
     void endTransaction();
     uint8_t transfer(uint8_t data);
+    void transferBytes(const uint8_t* out, uint8_t* in, size_t count);   // in may be null
 
     // Flash
     std::string readFlashID();
     void readFlashIdRaw(uint8_t* buffer);
-    void readFlashData(uint32_t address, uint8_t* buffer, size_t length);
+    void readFlashData(uint32_t address, uint8_t* buffer, size_t length) override;
+    bool beginBulkRead(size_t maxLength, bool dualOutput) override;
+    void endBulkRead() override;
+    uint8_t* allocateReadBuffer(size_t length) override;
+    void freeReadBuffer(uint8_t* buffer) override;
     uint32_t calculateFlashCapacity(uint8_t code);
     void eraseFlashSector(uint32_t address, uint32_t freq);
     void enableFlashWrite(uint32_t freq);
@@ -49,15 +59,22 @@ public:
     void closeEeprom();
 
     // Slave
-    void startSlave(int sclk, int miso, int mosi, int cs);
+    bool startSlave(int sclk, int miso, int mosi, int cs, size_t transactionSize = 64); // false without DMA memory
     void stopSlave(int sclk, int miso, int mosi, int cs);
     bool isSlave() const;
-    std::vector<std::vector<uint8_t>> getSlaveData();
+    size_t getSlaveData(RecordBatch& out); // drains captured transactions, returns the count
+    uint32_t getSlaveDroppedCount() const;
 
     // Instructions
-    std::string executeByteCode(const std::vector<ByteCode>& bytecodes);
+    std::string executeProgram(const ByteCodeProgram& program);
+    void executeProgram(const ByteCodeProgram& program, std::vector<uint8_t>& read);
 private:
     uint8_t csPin;
+    uint8_t mosiPin;
+    uint8_t misoPin;
+    uint8_t sclkPin;
+    spi_device_handle_t flashDevice = nullptr; // bulk reads, DMA
+    bool flashDualOutput = false;
     uint32_t spiFrequency = 1000000;
     EEPROM_SPI_WE eeprom = EEPROM_SPI_WE(&SPI, SPI_CS_PIN, 999, 8000000);
     bool eepromInitialized = false;
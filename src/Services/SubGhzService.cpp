@@ -1,6 +1,7 @@
 #include "SubGhzService.h"
 #include "driver/rmt.h"
-#include <sstream>
+#include <algorithm>
+#include <esp_heap_caps.h>
 
 // Base
 
@@ -174,36 +175,19 @@ void SubGhzService::stopRawSniffer() {
     ELECHOUSE_cc1101.setSidle();
 }
 
-std::pair<std::string, size_t> SubGhzService::readRawPulses() {
-    if (!rb_) return {"", 0};
-
-    size_t rx_size = 0;
-    rmt_item32_t* item = (rmt_item32_t*) xRingbufferReceive(rb_, &rx_size, 0);
-    if (!item) return {"", 0};
-
-    size_t n = rx_size / sizeof(rmt_item32_t);
-    uint32_t totalDuration = 0;
-    for (size_t i = 0; i < n; i++) {
-        totalDuration += item[i].duration0;
-        totalDuration += item[i].duration1;
-    }
-
-    std::ostringstream oss;
-    oss << "[raw " << n << " pulses | freq=" << mhz_
-        << " MHz | dur=" << totalDuration << " ticks]\r\n";
-
-    int col = 0;
-    for (size_t i = 0; i < n; i++) {
-        oss << (item[i].level0 ? 'H' : 'L') << ":" << item[i].duration0
-            << " | "
-            << (item[i].level1 ? 'H' : 'L') << ":" << item[i].duration1
-            << "   ";
-        if (++col % 4 == 0) oss << "\r\n";
+uint32_t* SubGhzService::allocateCaptureBuffer(size_t& items) {
+    void* p = heap_caps_malloc(items * sizeof(uint32_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (!p) {
+        // Keep some internal RAM for the rest of the firmware
+        items = std::min<size_t>(items, RMT_BUFFER_SIZE);
+        p = heap_caps_malloc(items * sizeof(uint32_t), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
     }
-    oss << "\n\r";
+    if (!p) items = 0;
+    return static_cast<uint32_t*>(p);
+}
 
-    vRingbufferReturnItem(rb_, (void*)item); // Free memory
-    return {oss.str(), n};
+void SubGhzService::freeCaptureBuffer(uint32_t* buffer) {
+    heap_caps_free(buffer);
 }
 
 std::vector<rmt_item32_t> SubGhzService::readRawFrame() {
@@ -36,8 +36,24 @@ public:
 
     // RMT raw sniffer
     bool startRawSniffer(int pin);
-    std::pair<std::string, size_t> readRawPulses();
     std::vector<rmt_item32_t> readRawFrame();
+
+    // Hand the next received block to sink(const uint32_t* items, size_t count)
+    // straight from the RMT ring, no copy; false when none is pending
+    template <typename Sink>
+    bool readRawBlock(Sink&& sink) {
+        if (!rb_) return false;
+        size_t rx_size = 0;
+        rmt_item32_t* item = (rmt_item32_t*) xRingbufferReceive(rb_, &rx_size, 0);
+        if (!item) return false;
+        sink(reinterpret_cast<const uint32_t*>(item), rx_size / sizeof(rmt_item32_t));
+        vRingbufferReturnItem(rb_, (void*)item);
+        return true;
+    }
+
+    // Capture buffer in items, PSRAM first, smaller internal one without PSRAM
+    uint32_t* allocateCaptureBuffer(size_t& items);
+    void freeCaptureBuffer(uint32_t* buffer);
     bool isSnifferOverflowing() const;
     void drainSniffer();
     void stopRawSniffer();
@@ -1,8 +1,41 @@
 #include "UartService.h"
+#include "Services/ByteCodeEngine.h"
+
+namespace {
+// Bytecode spans go to Serial1 in one write
+struct UartProgramStream {
+    void write(const uint8_t* data, size_t count) { Serial1.write(data, count); }
+    size_t read(uint8_t* out, size_t count, uint32_t timeoutMs) {
+        size_t received = 0;
+        uint32_t start = millis();
+        while (received < count && millis() - start < timeoutMs) {
+            int available = Serial1.available();
+            if (available > 0) {
+                received += Serial1.read(out + received, std::min<size_t>(count - received, available));
+            } else {
+                delay(10);
+            }
+        }
+        return received;
+    }
+    void delayUs(uint32_t us) { delayMicroseconds(us); }
+    void delayMs(uint32_t ms) { delay(ms); }
+};
+}
+
+volatile uint32_t UartService::overrunCount = 0;
 
 void UartService::configure(unsigned long baud, uint32_t config, uint8_t rx, uint8_t tx, bool inverted) {
     Serial1.end(); // stop before reconfigure
+    Serial1.setRxBufferSize(UART_RX_RING_SIZE); // room for bridge/read at Mbaud rates
     Serial1.begin(baud, config, rx, tx, inverted);
+
+    overrunCount = 0;
+    Serial1.onReceiveError([](hardwareSerial_error_t err) {
+        if (err == UART_FIFO_OVF_ERROR || err == UART_BUFFER_FULL_ERROR) {
+            overrunCount++;
+        }
+    });
 }
 
 void UartService::end() {
@@ -55,10 +88,28 @@ void UartService::println(const std::string& msg) {
     Serial1.println(msg.c_str());
 }
 
-bool UartService::available() const {
+size_t UartService::available() const {
     return Serial1.available();
 }
 
+size_t UartService::readBytes(uint8_t* dst, size_t len) {
+    size_t avail = Serial1.available();
+    if (len > avail) len = avail;
+    return len ? Serial1.read(dst, len) : 0;
+}
+
+size_t UartService::writeBytes(const uint8_t* src, size_t len) {
+    return Serial1.write(src, len);
+}
+
+size_t UartService::availableForWrite() {
+    return Serial1.availableForWrite();
+}
+
+uint32_t UartService::getOverrunCount() const {
+    return overrunCount;
+}
+
 char UartService::read() {
     return Serial1.read();
 }
@@ -71,47 +122,14 @@ void UartService::write(const std::string& str) {
     Serial1.write(reinterpret_cast<const uint8_t*>(str.c_str()), str.length());
 }
 
-std::string UartService::executeByteCode(const std::vector<ByteCode>& bytecodes) {
-    std::string result;
-    uint32_t timeout = 2000; // 2 secondes
-    uint32_t start;
-    uint32_t received = 0;
-
-    for (const ByteCode& code : bytecodes) {
-        switch (code.getCommand()) {
-            case ByteCodeEnum::Write:
-                for (uint32_t i = 0; i < code.getRepeat(); ++i) {
-                    Serial1.write(code.getData());
-                }
-                break;
-
-            case ByteCodeEnum::Read:
-                start = millis();
-                while (received < code.getRepeat() && (millis() - start < timeout)) {
-                    if (Serial1.available()) {
-                        char c = Serial1.read();
-                        result += c;
-                        ++received;
-                    } else {
-                        delay(10);
-                    }
-                }
-                break;
-
-            case ByteCodeEnum::DelayMs:
-                delay(code.getRepeat());
-                break;
-
-            case ByteCodeEnum::DelayUs:
-                delayMicroseconds(code.getRepeat());
-                break;
-
-            default:
-                break;
-        }
-    }
+std::string UartService::executeProgram(const ByteCodeProgram& program) {
+    UartProgramStream stream;
+    return ByteCodeEngine::runStream(program, stream);
+}
 
-    return result;
+void UartService::executeProgram(const ByteCodeProgram& program, std::vector<uint8_t>& read) {
+    UartProgramStream stream;
+    ByteCodeEngine::runStream(program, stream, read);
 }
 
 void UartService::switchBaudrate(unsigned long newBaud) {
@@ -8,22 +8,29 @@
 #include "esp_rom_gpio.h"
 #include "hal/uart_types.h"
 #include "soc/uart_periph.h"
-#include "Models/ByteCode.h"
+#include "Models/ByteCodeProgram.h"
+#include "Interfaces/IByteStream.h"
 #include <SD.h>
 
 #define UART_PORT UART_NUM_1
+#define UART_RX_RING_SIZE 8192
 
-class UartService {
+class UartService : public IByteStream {
 public:
     void configure(unsigned long baud, uint32_t config, uint8_t rx, uint8_t tx, bool inverted);
     void print(const std::string& msg);
     void println(const std::string& msg);
     char read();
     std::string readLine();
-    bool available() const;
+    size_t available() const override;
+    size_t readBytes(uint8_t* dst, size_t len) override;
+    size_t writeBytes(const uint8_t* src, size_t len) override;
+    size_t availableForWrite() override;
+    uint32_t getOverrunCount() const override;
     void write(char c);
     void write(const std::string& str);
-    std::string executeByteCode(const std::vector<ByteCode>& bytecodes);
+    std::string executeProgram(const ByteCodeProgram& program);
+    void executeProgram(const ByteCodeProgram& program, std::vector<uint8_t>& read);
     void switchBaudrate(unsigned long newBaud);
     void flush();
     void clearUartBuffer();
@@ -45,6 +52,7 @@ public:
 private:
     XModem xmodem;
     static File* currentFile;
+    static volatile uint32_t overrunCount;
     int32_t xmodemBlockSize = 128;
     int8_t xmodemIdSize = 1;
     XModem::ProtocolType xmodemProtocol = XModem::ProtocolType::CRC_XMODEM;
@@ -3,6 +3,8 @@
 
 #include "UsbS3Service.h"
 
+UsbS3Service* UsbS3Service::storageInstance = nullptr;
+
 UsbS3Service::UsbS3Service()
   : keyboardActive(false), storageActive(false), initialized(false) {}
 
@@ -24,9 +26,30 @@ void UsbS3Service::storageBegin(uint8_t cs, uint8_t clk, uint8_t miso, uint8_t m
         return;
     }
 
-    // Setup MSC
+    // Setup MSC, sectors go through the cache
     uint32_t secSize = SD.sectorSize();
     uint32_t numSectors = SD.numSectors();
+    if (secSize != SectorCacheManager::SectorSize) {
+        SD.end();
+        storageActive = false;
+        return;
+    }
+
+    sdDevice.begin(SD);
+    if (!sdDevice.sectorCount()) {
+        SD.end();
+        storageActive = false;
+        return;
+    }
+    if (!sectorCache) sectorCache = new SectorCacheManager(sdDevice);
+    if (!cacheMutex) cacheMutex = xSemaphoreCreateMutex();
+    if (!flushTask) {
+        xTaskCreate(flushLoop, "mscFlush", 4096, this, 2, &flushTask);
+    }
+    if (!flushTimer && flushTask) {
+        flushTimer = xTimerCreate("mscFlush", pdMS_TO_TICKS(IdleFlushMs), pdFALSE, this, flushTimerCallback);
+    }
+    storageInstance = this;
 
     msc.vendorID("ESP32");
     msc.productID("USB_MSC");
@@ -173,41 +196,62 @@ bool UsbS3Service::isGamepadActive() const {
 }
 
 int32_t UsbS3Service::storageReadCallback(uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize) {
-    const uint32_t secSize = SD.sectorSize();
-    if (secSize == 0) return -1;
-
-    uint8_t* buf = reinterpret_cast<uint8_t*>(buffer);
-    for (uint32_t i = 0; i < bufsize / secSize; ++i) {
-        if (!SD.readRAW(buf + i * secSize, lba + i)) {
-            return -1;
-        }
-    }
-    return bufsize;
+    UsbS3Service* self = storageInstance;
+    if (!self || !self->sectorCache) return -1;
+
+    // Whole sectors, one call for the whole transfer
+    const uint32_t count = bufsize / SectorCacheManager::SectorSize;
+    xSemaphoreTake(self->cacheMutex, portMAX_DELAY);
+    bool ok = self->sectorCache->read(lba, reinterpret_cast<uint8_t*>(buffer), count);
+    xSemaphoreGive(self->cacheMutex);
+    return ok ? (int32_t)bufsize : -1;
 }
 
 int32_t UsbS3Service::storageWriteCallback(uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize) {
-    const uint32_t secSize = SD.sectorSize();
-    if (secSize == 0) return -1;
+    UsbS3Service* self = storageInstance;
+    if (!self || !self->sectorCache) return -1;
 
-    uint64_t freeSpace = SD.totalBytes() - SD.usedBytes();
-    if (bufsize > freeSpace) {
-        return -1;
-    }
+    const uint32_t count = bufsize / SectorCacheManager::SectorSize;
+    xSemaphoreTake(self->cacheMutex, portMAX_DELAY);
+    bool ok = self->sectorCache->write(lba, buffer, count);
+    xSemaphoreGive(self->cacheMutex);
 
-    for (uint32_t i = 0; i < bufsize / secSize; ++i) {
-        uint8_t blk[secSize];
-        memcpy(blk, buffer + i * secSize, secSize);
-        if (!SD.writeRAW(blk, lba + i)) {
-            return -1;
-        }
-    }
-    return bufsize;
+    // Restart the idle countdown
+    if (ok && self->flushTimer) xTimerReset(self->flushTimer, 0);
+    return ok ? (int32_t)bufsize : -1;
 }
 
 bool UsbS3Service::usbStartStopCallback(uint8_t power_condition, bool start, bool load_eject) {
+    // Eject, nothing may stay in the cache
+    if (load_eject && !start && storageInstance) {
+        return storageInstance->flushStorage();
+    }
     return true;
 }
 
+// Runs in the timer service task, which must not block, the flush is left
+// to the worker
+void UsbS3Service::flushTimerCallback(TimerHandle_t timer) {
+    auto* self = static_cast<UsbS3Service*>(pvTimerGetTimerID(timer));
+    if (self && self->flushTask) xTaskNotifyGive(self->flushTask);
+}
+
+void UsbS3Service::flushLoop(void* arg) {
+    auto* self = static_cast<UsbS3Service*>(arg);
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        self->flushStorage();
+    }
+}
+
+bool UsbS3Service::flushStorage() {
+    if (!sectorCache || !cacheMutex) return true;
+    xSemaphoreTake(cacheMutex, portMAX_DELAY);
+    bool ok = sectorCache->flush();
+    xSemaphoreGive(cacheMutex);
+    return ok;
+}
+
 void UsbS3Service::setupStorageEvent() {
     USB.onEvent([](void* arg, esp_event_base_t event_base, int32_t event_id, void* event_data) {
         if (event_base == ARDUINO_USB_EVENTS) {
@@ -234,6 +278,8 @@ void UsbS3Service::setupStorageEvent() {
 
 void UsbS3Service::reset() {
     if (initialized) {
+        if (flushTimer) xTimerStop(flushTimer, 0);
+        flushStorage();        // si stockage actif
         keyboard.releaseAll(); // si clavier actif
         msc.end();             // si stockage actif
         keyboard.end();
@@ -11,7 +11,10 @@
 #include <USBHIDMouse.h>
 #include <USBHIDKeyboard.h>
 #include <USBHIDGamepad.h>
+#include <freertos/timers.h>
 #include "Interfaces/IUsbService.h"
+#include "Managers/SectorCacheManager.h"
+#include "SdBlockDevice.h"
 
 // ###############################################################################
 // ⚠️  USB CDC (Serial over USB) can't be used at the same time as other USB modes
@@ -63,14 +66,27 @@ private:
     // Mass Storage
     USBMSC msc;
     SPIClass sdSPI;
+    SdBlockDevice sdDevice;
+    SectorCacheManager* sectorCache = nullptr;
+    SemaphoreHandle_t cacheMutex = nullptr;
+    TimerHandle_t flushTimer = nullptr;
+    TaskHandle_t flushTask = nullptr;
     bool storageActive;
 
+    // Dirty sectors are written after this much idle time
+    static constexpr uint32_t IdleFlushMs = 250;
+    static UsbS3Service* storageInstance;
+
     bool initialized;
 
     // USB MSC callbacks
     static int32_t storageReadCallback(uint32_t lba, uint32_t offset, void* buffer, uint32_t bufsize);
     static int32_t storageWriteCallback(uint32_t lba, uint32_t offset, uint8_t* buffer, uint32_t bufsize);
     static bool usbStartStopCallback(uint8_t power_condition, bool start, bool load_eject);
+    static void flushTimerCallback(TimerHandle_t timer);
+    static void flushLoop(void* arg);
+
+    bool flushStorage();
 
     void setupStorageEvent();
 };
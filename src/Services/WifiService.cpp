@@ -1,8 +1,9 @@
 #include "WifiService.h"
+#include "Transformers/WifiSniffTransformer.h"
+#include "esp_timer.h"
 
 // Static member
-std::vector<std::string> WifiService::sniffLog;
-portMUX_TYPE WifiService::sniffMux = portMUX_INITIALIZER_UNLOCKED;
+std::atomic<uint32_t> WifiService::sniffDropped{0};
 
 std::vector<std::array<uint8_t, 6>> WifiService::staList;
 uint8_t WifiService::apBSSID[6];
@@ -207,7 +208,11 @@ std::string WifiService::encryptionTypeToString(wifi_auth_mode_t enc) {
     }
 }
 
-void WifiService::startPassiveSniffing() {
+bool WifiService::startPassiveSniffing() {
+    freeIsrRing(sniffRing);
+    sniffRing = allocateIsrRing<SniffRing>();
+    if (!sniffRing) return false;
+
     disconnect();
 
     esp_wifi_set_promiscuous(false);
@@ -223,8 +228,11 @@ void WifiService::startPassiveSniffing() {
     esp_wifi_init(&cfg);
     esp_wifi_start();
 
+    sniffDropped.store(0, std::memory_order_relaxed);
+
     esp_wifi_set_promiscuous(true);
     esp_wifi_set_promiscuous_rx_cb(&WifiService::snifferCallback);
+    return true;
 }
 
 void WifiService::stopPassiveSniffing() {
@@ -232,51 +240,41 @@ void WifiService::stopPassiveSniffing() {
     esp_wifi_set_promiscuous_rx_cb(nullptr);
     esp_wifi_stop();
     esp_wifi_deinit();
-    sniffLog.clear();
+    freeIsrRing(sniffRing);
     WiFi.mode(WIFI_STA);
     WiFi.disconnect(true);
 }
 
+// Runs in the WiFi driver task, copy the frame and leave
 void WifiService::snifferCallback(void* buf, wifi_promiscuous_pkt_type_t) {
     const wifi_promiscuous_pkt_t* pkt = reinterpret_cast<wifi_promiscuous_pkt_t*>(buf);
-    const uint8_t* payload = pkt->payload;
-    int len = pkt->rx_ctrl.sig_len;
-
-    int8_t rssi = pkt->rx_ctrl.rssi;
-    uint8_t ch = pkt->rx_ctrl.channel;
-
-    uint8_t type = 0, subtype = 0;
-    extractTypeSubtype(payload, type, subtype);
-    std::string typeStr = getFrameTypeName(type, subtype);
-    std::string macStr = formatMac(payload + 10);
-
-    std::string line = "CH:" + std::to_string(ch) +
-                       " RSSI:" + std::to_string(rssi) +
-                       " Type:" + typeStr;
-
-    // Add SSID if possible
-    if (type == 0 && (subtype == 8 || subtype == 4)) {
-        std::string ssid = parseSsidFromPacket(payload, len, type, subtype);
-        if (!ssid.empty()) {
-            line += " SSID:\"" + ssid + "\"";
-        }
+
+    WifiSniffRecord* record = sniffRing->writeSlot();
+    if (!record) {
+        sniffDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
     }
 
-    line += " MAC:" + macStr;
+    // sig_len counts the 4 bytes FCS
+    uint16_t len = pkt->rx_ctrl.sig_len > 4 ? pkt->rx_ctrl.sig_len - 4 : pkt->rx_ctrl.sig_len;
+    uint16_t captured = len < WIFI_SNIFF_SNAPLEN ? len : WIFI_SNIFF_SNAPLEN;
 
-    portENTER_CRITICAL(&sniffMux);
-    if (sniffLog.size() < 200) sniffLog.push_back(line);
-    portEXIT_CRITICAL(&sniffMux);
-}
+    record->timestampUs = esp_timer_get_time();
+    record->length = len;
+    record->captured = captured;
+    record->rssi = pkt->rx_ctrl.rssi;
+    record->channel = pkt->rx_ctrl.channel;
+    memcpy(record->frame, pkt->payload, captured);
 
-std::vector<std::string> WifiService::getSniffLog() {
-    std::vector<std::string> copy;
+    sniffRing->commit();
+}
 
-    portENTER_CRITICAL(&sniffMux);
-    copy.swap(sniffLog);
-    portEXIT_CRITICAL(&sniffMux);
+size_t WifiService::readSniffRecords(WifiSniffRecord* out, size_t max) {
+    return sniffRing ? sniffRing->pop(out, max) : 0;
+}
 
-    return copy;
+uint32_t WifiService::getSniffDropCount() const {
+    return sniffDropped.load(std::memory_order_relaxed);
 }
 
 bool WifiService::switchChannel(uint8_t channel) {
@@ -285,10 +283,7 @@ bool WifiService::switchChannel(uint8_t channel) {
 }
 
 std::string WifiService::formatMac(const uint8_t* mac) {
-    char buf[18];
-    snprintf(buf, sizeof(buf), "%02X:%02X:%02X:%02X:%02X:%02X",
-             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
-    return std::string(buf);
+    return WifiSniffTransformer::formatMac(mac);
 }
 
 std::string WifiService::getFrameTypeSubtype(const uint8_t* payload, uint8_t& type, uint8_t& subtype) {
@@ -299,45 +294,11 @@ std::string WifiService::getFrameTypeSubtype(const uint8_t* payload, uint8_t& ty
 }
 
 std::string WifiService::parseSsidFromPacket(const uint8_t* payload, int len, uint8_t type, uint8_t subtype) {
-    int offset = 24;
-    if (type == 0 && subtype == 8) offset = 36;
-
-    while (offset + 2 <= len) {
-        uint8_t id = payload[offset];
-        uint8_t elen = payload[offset + 1];
-        if (offset + 2 + elen > len) break;
-
-        if (id == 0) {
-            return std::string(reinterpret_cast<const char*>(payload + offset + 2), elen);
-        }
-
-        offset += 2 + elen;
-    }
-
-    return "";
+    return WifiSniffTransformer::parseSsid(payload, len, type, subtype);
 }
 
 std::string WifiService::getFrameTypeName(uint8_t type, uint8_t subtype) {
-    if (type == 0) {
-        switch (subtype) {
-            case 0:  return "Assoc Req";
-            case 1:  return "Assoc Resp";
-            case 4:  return "Probe Req";
-            case 5:  return "Probe Resp";
-            case 8:  return "Beacon";
-            case 10: return "Disassoc";
-            case 11: return "Auth";
-            case 12: return "Deauth";
-            default: return "Mgmt/" + std::to_string(subtype);
-        }
-    } else if (type == 1) {
-        return "Ctrl/" + std::to_string(subtype);
-    } else if (type == 2) {
-        if (subtype == 0) return "Data";
-        if (subtype == 4) return "Null Data";
-        return "Data/" + std::to_string(subtype);
-    }
-    return "Unknown";
+    return WifiSniffTransformer::frameTypeName(type, subtype);
 }
 
 void WifiService::extractTypeSubtype(const uint8_t* payload, uint8_t& type, uint8_t& subtype) {
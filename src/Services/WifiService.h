@@ -4,6 +4,10 @@
 #include <string>
 #include <vector>
 #include <sstream>
+#include <atomic>
+#include "Models/WifiSniffRecord.h"
+#include "Buffers/SpscRingBuffer.h"
+#include "Buffers/IsrRingAllocator.h"
 
 extern "C" {
   #include "esp_wifi.h"
@@ -83,9 +87,10 @@ public:
     std::string encryptionTypeToString(wifi_auth_mode_t encryption);
 
     // Sniffing passif
-    void startPassiveSniffing();
+    bool startPassiveSniffing();    // false when the frame ring cannot be allocated
     void stopPassiveSniffing();
-    std::vector<std::string> getSniffLog();
+    size_t readSniffRecords(WifiSniffRecord* out, size_t max);
+    uint32_t getSniffDropCount() const;
     bool switchChannel(uint8_t channel);
     static std::string getFrameTypeSubtype(const uint8_t* payload, uint8_t& type, uint8_t& subtype);
     static std::string parseSsidFromPacket(const uint8_t* payload, int len, uint8_t type, uint8_t subtype);
@@ -98,8 +103,11 @@ public:
 
     bool connected;
     static void snifferCallback(void* buf, wifi_promiscuous_pkt_type_t type);
-    static std::vector<std::string> sniffLog;
-    static portMUX_TYPE sniffMux;
+    // Frames from the promiscuous callback, dropped (and counted) when full,
+    // allocated only while sniffing
+    using SniffRing = SpscRingBuffer<WifiSniffRecord, 64>;
+    static inline SniffRing* sniffRing = nullptr;
+    static std::atomic<uint32_t> sniffDropped;
 
     // --- Client sniffer ---
     static portMUX_TYPE staMux;
@@ -157,31 +157,55 @@ void I2cEepromShell::cmdDump(bool raw) {
         if (!confirm) return;
     }
 
-    const uint8_t bytesPerLine = 16;
-
+    // Sequential reads, as large as the Wire buffer, block bits in the device address
+    I2cDumpOptions options;
+    options.address = selectedI2cAddress;
+    options.start = addr;
+    options.length = count;
+    options.addressBytes = i2cService.eepromAddressBytes();
+    options.blockInAddress = true;
+    options.maxChunk = i2cService.maxReadChunk();
+
+    I2cDumpStats stats;
     if (raw) {
         // Mode RAW
-        for (uint32_t i = 0; i < count; ++i) {
-            uint8_t value = i2cService.eepromReadByte(addr + i);
-            terminalView.print(value); 
-        }
-    } else {
-        // Mode HEX/ASCII
-        terminalView.println("");
-        for (uint32_t i = 0; i < count; i += bytesPerLine) {
-            std::vector<uint8_t> line;
-            for (uint8_t j = 0; j < bytesPerLine && (i + j) < count; ++j) {
-                line.push_back(i2cService.eepromReadByte(addr + i + j));
-
-                char c = terminalInput.readChar();
-                if (c == '\n' || c == '\r') {
-                    terminalView.println("\n❌ Dump interrupted by user.");
-                    return;
+        I2cDumpEngine::dump(i2cService, options,
+            [&](uint32_t, const uint8_t* data, size_t n) {
+                for (size_t i = 0; i < n; ++i) terminalView.print(data ? data[i] : (uint8_t)0xFF);
+            },
+            []() { return false; },
+            stats);
+        return;
+    }
+
+    // Mode HEX/ASCII, lines printed while reading
+    const uint8_t bytesPerLine = 16;
+    std::vector<uint8_t> line;
+    line.reserve(bytesPerLine);
+    uint32_t lineStart = addr;
+
+    terminalView.println("");
+    I2cDumpEngine::dump(i2cService, options,
+        [&](uint32_t reg, const uint8_t* data, size_t n) {
+            for (size_t i = 0; i < n; ++i) {
+                line.push_back(data ? data[i] : 0xFF);
+                if (line.size() == bytesPerLine || reg + i + 1 == addr + count) {
+                    terminalView.println(argTransformer.toAsciiLine(lineStart, line));
+                    lineStart += bytesPerLine;
+                    line.clear();
                 }
             }
-            std::string formatted = argTransformer.toAsciiLine(addr + i, line);
-            terminalView.println(formatted);
-        }
+        },
+        [&]() {
+            char c = terminalInput.readChar();
+            return c == '\n' || c == '\r';
+        },
+        stats);
+
+    if (stats.cancelled) {
+        terminalView.println("\n❌ Dump interrupted by user.");
+    } else if (stats.aborted) {
+        terminalView.println("\n❌ Dump aborted, EEPROM stopped answering.");
     }
 }
 
@@ -5,6 +5,7 @@
 #include "Managers/UserInputManager.h"
 #include "Transformers/ArgTransformer.h"
 #include "Services/I2cService.h"
+#include "Services/I2cDumpEngine.h"
 #include "Managers/BinaryAnalyzeManager.h"
 
 class I2cEepromShell {
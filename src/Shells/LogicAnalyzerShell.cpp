@@ -0,0 +1,371 @@
+#include "LogicAnalyzerShell.h"
+
+LogicAnalyzerShell::LogicAnalyzerShell(
+    ITerminalView& terminalView,
+    IDeviceView& deviceView,
+    IInput& terminalInput,
+    UserInputManager& userInputManager,
+    ArgTransformer& argTransformer,
+    LogicSamplerService& samplerService,
+    LogicExportTransformer& exportTransformer,
+    SumpTransformer& sumpTransformer,
+    LittleFsService& littleFsService
+)
+    : terminalView(terminalView),
+      deviceView(deviceView),
+      terminalInput(terminalInput),
+      userInputManager(userInputManager),
+      argTransformer(argTransformer),
+      samplerService(samplerService),
+      exportTransformer(exportTransformer),
+      sumpTransformer(sumpTransformer),
+      littleFsService(littleFsService)
+{}
+
+/*
+Entry point
+*/
+void LogicAnalyzerShell::run() {
+    while (true) {
+        terminalView.println("\n=== Logic Analyzer Shell ===");
+
+        // Select action
+        int index = userInputManager.readValidatedChoiceIndex("Select a logic analyzer action", actions, 0);
+
+        // Quit
+        if (index == -1 || actions[index] == "🚪 Exit Shell") {
+            terminalView.println("Exiting Logic Analyzer Shell...\n");
+            break;
+        }
+
+        // Dispatch
+        switch (index) {
+            case 0: cmdCapture();     break;
+            case 1: cmdSummary();     break;
+            case 2: cmdPrint(false);  break;
+            case 3: cmdPrint(true);   break;
+            case 4: cmdSave(false);   break;
+            case 5: cmdSave(true);    break;
+            default:
+                terminalView.println("Unknown action.\n");
+                break;
+        }
+    }
+}
+
+/*
+Capture
+*/
+void LogicAnalyzerShell::cmdCapture() {
+    // Channels
+    auto selected = userInputManager.readValidatedPinGroup("Pins, CH0 first (max 8)", pins, state.getProtectedPins());
+    if (selected.empty() || selected.size() > LogicSamplerService::MaxChannels) {
+        terminalView.println("Logic Analyzer: 1 to 8 pins.\n");
+        return;
+    }
+    pins = selected;
+
+    // Rate and depth
+    int rateIndex = userInputManager.readValidatedChoiceIndex("Sample rate", rateLabels, 3);
+    uint32_t maxDepth = (uint32_t)samplerService.maxDepth();
+    uint32_t depth = userInputManager.readValidatedUint32("Samples (max " + std::to_string(maxDepth) + ")", 65536);
+    if (depth == 0 || depth > maxDepth) {
+        terminalView.println("Logic Analyzer: Invalid sample count.\n");
+        return;
+    }
+
+    LogicCaptureOptions options;
+    options.depth = depth;
+    if (!readTrigger(options.trigger)) return;
+    if (options.trigger.enabled()) {
+        uint8_t prePct = userInputManager.readValidatedUint8("Pre-trigger %", 10, 0, 90);
+        options.preTrigger = (uint32_t)((uint64_t)depth * prePct / 100);
+    }
+
+    if (!samplerService.begin(pins, rates[rateIndex])) {
+        terminalView.println("Logic Analyzer: Failed to set up the sampler.\n");
+        return;
+    }
+    uint8_t* buffer = samplerService.allocateBuffer(depth);
+    if (!buffer) {
+        samplerService.end();
+        terminalView.println("Logic Analyzer: Not enough memory for " + std::to_string(depth) + " samples.\n");
+        return;
+    }
+
+    terminalView.println("\nLogic Analyzer: Armed at " + std::to_string(samplerService.sampleRate()) +
+                         " Hz... Press [ENTER] to stop.");
+
+    auto source = samplerService.source([this]() { return enterPressed(); });
+    LogicCaptureStats stats = LogicCaptureManager::capture(source, options, buffer);
+    samplerService.end();
+
+    // Keep the compressed trace only
+    trace.pins = pins;
+    trace.sampleRate = samplerService.sampleRate();
+    LogicCaptureManager::toTrace(buffer, stats, trace, samplerService.maxTraceRuns());
+    drawTrace(buffer + stats.first, stats.samples, stats.triggerSample);
+    samplerService.freeBuffer(buffer);
+
+    if (trace.truncated()) {
+        terminalView.println("Logic Analyzer: Trace truncated at " + std::to_string(trace.sampleCount()) +
+                             " samples, not enough memory to keep it all.");
+    }
+
+    if (stats.stopped) terminalView.println("Logic Analyzer: Stopped before the trigger.");
+    if (source.lateSamples()) {
+        terminalView.println("Logic Analyzer: " + std::to_string(source.lateSamples()) +
+                             " samples taken late, try a lower rate.");
+    }
+    cmdSummary();
+}
+
+bool LogicAnalyzerShell::readTrigger(LogicTrigger& trigger) {
+    const std::vector<std::string> modes = {"None", "Rising edge", "Falling edge", "Any edge", "Pattern"};
+    int mode = userInputManager.readValidatedChoiceIndex("Trigger", modes, 0);
+    if (mode <= 0) return true;
+
+    if (mode < 4) {
+        uint8_t channel = userInputManager.readValidatedUint8("Trigger channel", 0, 0, (uint8_t)(pins.size() - 1));
+        trigger.edgeMask = (uint8_t)(1u << channel);
+        trigger.edge = mode == 1 ? LogicTrigger::Rising : mode == 2 ? LogicTrigger::Falling : LogicTrigger::Either;
+        return true;
+    }
+
+    // "1X0", CH0 first
+    terminalView.print("Pattern, one of 0 1 X per channel from CH0: ");
+    std::string pattern = userInputManager.getLine();
+    if (pattern.empty() || pattern.size() > pins.size()) {
+        terminalView.println("Logic Analyzer: Invalid pattern.\n");
+        return false;
+    }
+    for (size_t ch = 0; ch < pattern.size(); ++ch) {
+        char c = pattern[ch];
+        if (c == '1') {
+            trigger.patternMask |= (uint8_t)(1u << ch);
+            trigger.patternValue |= (uint8_t)(1u << ch);
+        } else if (c == '0') {
+            trigger.patternMask |= (uint8_t)(1u << ch);
+        } else if (c != 'x' && c != 'X') {
+            terminalView.println("Logic Analyzer: Invalid pattern.\n");
+            return false;
+        }
+    }
+    return true;
+}
+
+void LogicAnalyzerShell::drawTrace(const uint8_t* samples, uint32_t count, uint32_t triggerSample) {
+    // CH0 around the trigger on the device screen
+    const uint32_t width = 240;
+    uint32_t first = triggerSample > width / 4 ? triggerSample - width / 4 : 0;
+    std::vector<uint8_t> line;
+    line.reserve(width);
+    for (uint32_t i = first; i < count && line.size() < width; ++i) line.push_back(samples[i] & 1);
+
+    deviceView.clear();
+    deviceView.topBar("Logic Analyzer", false, false);
+    if (!line.empty()) deviceView.drawLogicTrace(pins[0], line);
+}
+
+/*
+Summary
+*/
+void LogicAnalyzerShell::cmdSummary() {
+    if (trace.sampleCount() == 0) {
+        terminalView.println("Logic Analyzer: No capture yet.\n");
+        return;
+    }
+
+    std::string channels;
+    for (uint8_t ch = 0; ch < trace.channelCount(); ++ch) {
+        if (ch) channels += " ";
+        channels += "CH" + std::to_string(ch) + "=" + LogicExportTransformer::channelName(trace, ch);
+    }
+
+    float ms = trace.sampleRate ? 1000.0f * trace.sampleCount() / trace.sampleRate : 0;
+    float ratio = trace.compressedBytes() ? (float)trace.sampleCount() / trace.compressedBytes() : 0;
+
+    terminalView.println("");
+    terminalView.println(" Channels:  " + channels);
+    terminalView.println(" Samples:   " + std::to_string(trace.sampleCount()) + " at " +
+                         std::to_string(trace.sampleRate) + " Hz (" + argTransformer.formatFloat(ms, 2) + " ms)");
+    terminalView.println(" Trigger:   " + (trace.triggered ? "sample " + std::to_string(trace.triggerSample) : std::string("none")));
+    terminalView.println(" Stored:    " + std::to_string(trace.runCount()) + " runs, " +
+                         std::to_string(trace.compressedBytes()) + " bytes (x" + argTransformer.formatFloat(ratio, 1) + ")");
+    terminalView.println("");
+}
+
+/*
+Export
+*/
+void LogicAnalyzerShell::cmdPrint(bool vcd) {
+    if (trace.sampleCount() == 0) {
+        terminalView.println("Logic Analyzer: No capture yet.\n");
+        return;
+    }
+
+    terminalView.println("");
+    LogicExportTransformer::Writer print = [this](const std::string& chunk) {
+        // Terminals want CRLF
+        std::string out;
+        out.reserve(chunk.size() + chunk.size() / 8);
+        for (char c : chunk) {
+            if (c == '\n') out += '\r';
+            out += c;
+        }
+        terminalView.print(out);
+    };
+    if (vcd) exportTransformer.toVcd(trace, print);
+    else exportTransformer.toOls(trace, print);
+    terminalView.println("");
+}
+
+void LogicAnalyzerShell::cmdSave(bool vcd) {
+    if (trace.sampleCount() == 0) {
+        terminalView.println("Logic Analyzer: No capture yet.\n");
+        return;
+    }
+    if (!littleFsService.mounted()) {
+        littleFsService.begin();
+    }
+
+    std::string def = vcd ? "capture.vcd" : "capture.ols";
+    terminalView.print("File name (default " + def + "): ");
+    std::string name = userInputManager.getLine();
+    if (name.empty()) name = def;
+    if (!littleFsService.isSafeRootFileName(name)) {
+        terminalView.println("Logic Analyzer: Invalid file name.\n");
+        return;
+    }
+    std::string path = "/" + name;
+    if (!littleFsService.write(path, "")) {
+        terminalView.println("Logic Analyzer: Failed to create " + path + "\n");
+        return;
+    }
+
+    bool failed = false;
+    LogicExportTransformer::Writer save = [&](const std::string& chunk) {
+        if (!failed && !littleFsService.write(path, chunk, true)) failed = true;
+    };
+    if (vcd) exportTransformer.toVcd(trace, save);
+    else exportTransformer.toOls(trace, save);
+
+    if (failed) {
+        terminalView.println("Logic Analyzer: Write failed, " + path + " is incomplete.\n");
+    } else {
+        terminalView.println("Logic Analyzer: Saved to " + path + " (" +
+                             std::to_string(littleFsService.getFileSize(path)) + " bytes)\n");
+    }
+}
+
+/*
+SUMP
+*/
+void LogicAnalyzerShell::runSump() {
+    if (state.getTerminalMode() != TerminalTypeEnum::Serial) {
+        terminalView.println("Logic Analyzer: SUMP mode needs the USB serial terminal.\n");
+        return;
+    }
+
+    auto selected = userInputManager.readValidatedPinGroup("Pins, CH0 first (max 8)", pins, state.getProtectedPins());
+    if (selected.empty() || selected.size() > LogicSamplerService::MaxChannels) {
+        terminalView.println("Logic Analyzer: 1 to 8 pins.\n");
+        return;
+    }
+    pins = selected;
+
+    terminalView.println("\nLogic Analyzer: SUMP mode, open this port in PulseView (Openbench Logic Sniffer)");
+    terminalView.println("or in the OLS client. Close it and press [ENTER] here to leave.\n");
+
+    SumpTransformer::Config config;
+    SumpCommand command;
+    sumpTransformer.resetParser();
+    sumpBacklog.clear();
+    char received[64];
+
+    while (true) {
+        size_t n;
+        if (!sumpBacklog.empty()) {
+            n = sumpBacklog.copy(received, sizeof(received));
+            sumpBacklog.erase(0, n);
+        } else {
+            n = terminalInput.readChars(received, sizeof(received));
+        }
+        if (n == 0) {
+            delay(1);
+            continue;
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            uint8_t b = (uint8_t)received[i];
+
+            // Not a SUMP opcode, the user is back on the terminal
+            if (sumpTransformer.idle() && (b == '\r' || b == '\n')) {
+                sumpBacklog.clear();
+                terminalView.println("Logic Analyzer: Leaving SUMP mode.\n");
+                return;
+            }
+            if (!sumpTransformer.feed(b, command)) continue;
+
+            switch (command.opcode) {
+                case SumpTransformer::QueryId: {
+                    std::string reply = sumpTransformer.idReply();
+                    terminalView.write(reinterpret_cast<const uint8_t*>(reply.data()), reply.size());
+                    break;
+                }
+                case SumpTransformer::QueryMetadata: {
+                    uint32_t memory = std::min<uint32_t>((uint32_t)samplerService.maxDepth(), MaxSumpDepth);
+                    std::string reply = sumpTransformer.metadataReply("ESP32 Bus Pirate", memory,
+                                                                      MaxSampleRate, (uint8_t)pins.size());
+                    terminalView.write(reinterpret_cast<const uint8_t*>(reply.data()), reply.size());
+                    break;
+                }
+                case SumpTransformer::Run:
+                    sumpRun(config);
+                    break;
+                default:
+                    sumpTransformer.apply(command, config);
+                    break;
+            }
+        }
+    }
+}
+
+void LogicAnalyzerShell::sumpRun(const SumpTransformer::Config& config) {
+    uint32_t maxDepth = std::min<uint32_t>((uint32_t)samplerService.maxDepth(), MaxSumpDepth);
+    LogicCaptureOptions options = sumpTransformer.captureOptions(config, maxDepth);
+    uint32_t rate = std::min(config.sampleRate, MaxSampleRate);
+
+    SumpTransformer::Writer send = [this](const std::string& chunk) {
+        terminalView.write(reinterpret_cast<const uint8_t*>(chunk.data()), chunk.size());
+    };
+
+    uint8_t* buffer = options.depth ? samplerService.allocateBuffer(options.depth) : nullptr;
+    if (!buffer || !samplerService.begin(pins, rate)) {
+        if (buffer) samplerService.freeBuffer(buffer);
+        sumpTransformer.sendSamples(nullptr, 0, config, send);
+        return;
+    }
+
+    // A reset from the client aborts a capture waiting for its trigger, every
+    // byte is kept for the command loop; a parser copy tells a Reset command
+    // from a 0x00 argument byte
+    SumpTransformer probe = sumpTransformer;
+    auto source = samplerService.source([this, &probe]() {
+        char c;
+        if (terminalInput.readChars(&c, 1) != 1) return false;
+        sumpBacklog.push_back(c);
+        SumpCommand command;
+        return probe.feed((uint8_t)c, command) && command.opcode == SumpTransformer::Reset;
+    });
+    LogicCaptureStats stats = LogicCaptureManager::capture(source, options, buffer);
+    samplerService.end();
+
+    sumpTransformer.sendSamples(buffer + stats.first, stats.samples, config, send);
+    samplerService.freeBuffer(buffer);
+}
+
+bool LogicAnalyzerShell::enterPressed() {
+    char c = terminalInput.readChar();
+    return c == '\r' || c == '\n';
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include "Interfaces/ITerminalView.h"
+#include "Interfaces/IDeviceView.h"
+#include "Interfaces/IInput.h"
+#include "Managers/UserInputManager.h"
+#include "Managers/LogicCaptureManager.h"
+#include "Transformers/ArgTransformer.h"
+#include "Transformers/LogicExportTransformer.h"
+#include "Transformers/SumpTransformer.h"
+#include "Services/LogicSamplerService.h"
+#include "Services/LittleFsService.h"
+#include "States/GlobalState.h"
+
+class LogicAnalyzerShell {
+public:
+    LogicAnalyzerShell(
+        ITerminalView& terminalView,
+        IDeviceView& deviceView,
+        IInput& terminalInput,
+        UserInputManager& userInputManager,
+        ArgTransformer& argTransformer,
+        LogicSamplerService& samplerService,
+        LogicExportTransformer& exportTransformer,
+        SumpTransformer& sumpTransformer,
+        LittleFsService& littleFsService
+    );
+
+    // Capture and export menu
+    void run();
+
+    // SUMP device on the serial port, for PulseView or the OLS client
+    void runSump();
+
+private:
+    const std::vector<std::string> actions = {
+        " ⏺️  Capture",
+        " 📋 Summary",
+        " 📤 Print OLS",
+        " 📤 Print VCD",
+        " 💾 Save OLS to LittleFS",
+        " 💾 Save VCD to LittleFS",
+        "🚪 Exit Shell"
+    };
+
+    const std::vector<std::string> rateLabels = {
+        "100 kHz", "250 kHz", "500 kHz", "1 MHz", "2 MHz", "4 MHz", "8 MHz"
+    };
+    const std::vector<uint32_t> rates = {
+        100000, 250000, 500000, 1000000, 2000000, 4000000, 8000000
+    };
+
+    static constexpr uint32_t MaxSampleRate = 8000000;
+    static constexpr uint32_t MaxSumpDepth = 262144;
+
+    ITerminalView& terminalView;
+    IDeviceView& deviceView;
+    IInput& terminalInput;
+    UserInputManager& userInputManager;
+    ArgTransformer& argTransformer;
+    LogicSamplerService& samplerService;
+    LogicExportTransformer& exportTransformer;
+    SumpTransformer& sumpTransformer;
+    LittleFsService& littleFsService;
+    GlobalState& state = GlobalState::getInstance();
+
+    std::vector<uint8_t> pins = {1, 2, 3, 4};
+    LogicTrace trace;
+    std::string sumpBacklog;    // client bytes received during a capture
+
+    void cmdCapture();
+    void cmdSummary();
+    void cmdPrint(bool vcd);
+    void cmdSave(bool vcd);
+    bool readTrigger(LogicTrigger& trigger);
+    void drawTrace(const uint8_t* samples, uint32_t count, uint32_t triggerSample);
+    void sumpRun(const SumpTransformer::Config& config);
+    bool enterPressed();
+};
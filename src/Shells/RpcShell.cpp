@@ -0,0 +1,353 @@
+#include "RpcShell.h"
+#include <esp_heap_caps.h>
+
+RpcShell::RpcShell(
+    ITerminalView& terminalView,
+    SpiService& spiService,
+    I2cService& i2cService,
+    UartService& uartService,
+    PinService& pinService,
+    FlashDumpManager& flashDumpManager,
+    RpcFrameTransformer& rpcTransformer
+)
+    : terminalView(terminalView),
+      spiService(spiService),
+      i2cService(i2cService),
+      uartService(uartService),
+      pinService(pinService),
+      flashDumpManager(flashDumpManager),
+      rpcTransformer(rpcTransformer)
+{}
+
+/*
+Entry point
+*/
+void RpcShell::run(const uint8_t* first, size_t firstCount) {
+    if (state.getTerminalMode() != TerminalTypeEnum::Serial) {
+        terminalView.println("Binary mode: needs the USB serial terminal.\n");
+        return;
+    }
+
+    // Entered by a command, the client still needs to know
+    if (!firstCount) {
+        terminalView.println("\nBinary mode: send framed requests, Exit request or [ENTER] to leave.\n");
+    }
+
+    rpcTransformer.resetParser();
+    rpcTransformer.resetStats();
+    rpcTransformer.setMaxPayload(payloadLimit());
+    activeBus = Bus::None;
+    spiSelected = false;
+
+    bool running = serve(first, firstCount);
+    uint8_t received[ReadChunk];
+    while (running) {
+        size_t n = Serial.available();
+        if (n == 0) {
+            delay(1);
+            continue;
+        }
+        n = Serial.read(received, std::min(n, sizeof(received)));
+        running = serve(received, n);
+    }
+
+    if (spiSelected) spiService.endTransaction();
+    spiSelected = false;
+    activeBus = Bus::None;
+
+    // Request and reply storage only held while in binary mode
+    rpcTransformer.resetParser();
+    std::vector<uint8_t>().swap(reply);
+
+    const RpcLinkStats& stats = rpcTransformer.stats();
+    terminalView.println("Binary mode: left, " + std::to_string(stats.frames) + " requests, " +
+                         std::to_string(stats.crcErrors + stats.headerErrors) + " errors.\n");
+}
+
+bool RpcShell::serve(const uint8_t* data, size_t count) {
+    const uint8_t* end = data + count;
+    RpcFrame frame;
+    while (data < end) {
+        // Back on the terminal
+        if (rpcTransformer.idle() && (*data == '\r' || *data == '\n')) return false;
+
+        if (!rpcTransformer.next(data, end, frame)) break;
+        if (!handle(frame)) return false;
+    }
+    return true;
+}
+
+/*
+Requests
+*/
+bool RpcShell::handle(const RpcFrame& frame) {
+    if (!frame.crcOk) {
+        send(frame, RpcFrameTransformer::CrcError, nullptr, 0);
+        return true;
+    }
+    if (frame.oversized) {
+        send(frame, RpcFrameTransformer::BadRequest, nullptr, 0);
+        return true;
+    }
+
+    uint8_t status = RpcFrameTransformer::Ok;
+    reply.clear();
+
+    switch (frame.type) {
+        case RpcFrameTransformer::Ping:
+            send(frame, status, frame.payload, frame.length);
+            return true;
+
+        case RpcFrameTransformer::Exit:
+            send(frame, status, nullptr, 0);
+            return false;
+
+        case RpcFrameTransformer::Info:
+            reply.resize(5);
+            reply[0] = RpcFrameTransformer::Version;
+            RpcFrameTransformer::putLe32(&reply[1], rpcTransformer.maxPayload());
+            break;
+
+        case RpcFrameTransformer::SpiTransfer:
+            spiTransfer(frame);
+            return true;
+
+        case RpcFrameTransformer::I2cWrite:    status = i2cWrite(frame);    break;
+        case RpcFrameTransformer::I2cRead:     status = i2cRead(frame);     break;
+        case RpcFrameTransformer::UartRead:    status = uartRead(frame);    break;
+
+        case RpcFrameTransformer::UartWrite:
+            useBus(Bus::Uart);
+            uartService.writeBytes(frame.payload, frame.length);
+            break;
+
+        case RpcFrameTransformer::GpioSet:
+        case RpcFrameTransformer::GpioGet:
+            status = gpio(frame);
+            break;
+
+        case RpcFrameTransformer::FlashRead:
+            flashRead(frame);
+            return true;
+
+        default:
+            status = RpcFrameTransformer::UnknownType;
+            break;
+    }
+
+    if (status != RpcFrameTransformer::Ok) reply.clear();
+    send(frame, status, reply.data(), (uint32_t)reply.size());
+    return true;
+}
+
+// flags, data out; the bytes clocked in come back, streamed chunk by chunk
+void RpcShell::spiTransfer(const RpcFrame& frame) {
+    if (frame.length < 1) {
+        send(frame, RpcFrameTransformer::BadRequest, nullptr, 0);
+        return;
+    }
+    useBus(Bus::Spi);
+
+    uint32_t count = frame.length - 1;
+    uint8_t header[RpcFrameTransformer::HeaderSize];
+    uint32_t crc = RpcFrameTransformer::putHeader(header, frame.type | RpcFrameTransformer::Response,
+                                                  RpcFrameTransformer::Ok, frame.id, count);
+    Serial.write(header, sizeof(header));
+
+    if (!spiSelected) spiService.beginTransaction();
+    spiSelected = true;
+    uint8_t in[SpiChunk];
+    for (uint32_t done = 0; done < count;) {
+        size_t n = std::min<size_t>(SpiChunk, count - done);
+        spiService.transferBytes(frame.payload + 1 + done, in, n);
+        Serial.write(in, n);
+        crc = RpcFrameTransformer::crc32(in, n, crc);
+        done += (uint32_t)n;
+    }
+
+    // Kept selected, the next transfer continues the same transaction
+    if (!(frame.payload[0] & RpcFrameTransformer::SpiKeepSelected)) {
+        spiService.endTransaction();
+        spiSelected = false;
+    }
+
+    uint8_t trailer[RpcFrameTransformer::TrailerSize];
+    RpcFrameTransformer::putTrailer(trailer, crc);
+    Serial.write(trailer, sizeof(trailer));
+}
+
+// address, data in one transaction
+uint8_t RpcShell::i2cWrite(const RpcFrame& frame) {
+    if (frame.length < 1 || frame.length - 1 > i2cService.maxReadChunk()) return RpcFrameTransformer::BadRequest;
+    useBus(Bus::I2c);
+    bool acked = i2cService.writeBlock(frame.payload[0], frame.payload + 1, frame.length - 1);
+    return acked ? RpcFrameTransformer::Ok : RpcFrameTransformer::BusError;
+}
+
+// address, count, register bytes written first with a repeated start
+uint8_t RpcShell::i2cRead(const RpcFrame& frame) {
+    if (frame.length < 3) return RpcFrameTransformer::BadRequest;
+    uint8_t address = frame.payload[0];
+    uint16_t count = RpcFrameTransformer::le16(frame.payload + 1);
+    uint32_t regBytes = frame.length - 3;
+    if (regBytes > i2cService.maxReadChunk() || count > rpcTransformer.maxPayload()) {
+        return RpcFrameTransformer::BadRequest;
+    }
+    useBus(Bus::I2c);
+
+    if (regBytes && !i2cService.writeBlock(address, frame.payload + 3, regBytes, false)) {
+        return RpcFrameTransformer::BusError;
+    }
+
+    // Sequential reads carry on past the controller buffer
+    reply.resize(count);
+    uint32_t done = 0;
+    while (done < count) {
+        size_t n = std::min<size_t>(i2cService.maxReadChunk(), count - done);
+        if (i2cService.readBlock(address, reply.data() + done, n) != n) return RpcFrameTransformer::BusError;
+        done += n;
+    }
+    return RpcFrameTransformer::Ok;
+}
+
+// count, timeout; what arrived before the timeout comes back
+uint8_t RpcShell::uartRead(const RpcFrame& frame) {
+    if (frame.length < 4) return RpcFrameTransformer::BadRequest;
+    uint16_t count = RpcFrameTransformer::le16(frame.payload);
+    uint32_t timeoutMs = std::min<uint32_t>(RpcFrameTransformer::le16(frame.payload + 2), MaxUartTimeoutMs);
+    if (count > rpcTransformer.maxPayload()) return RpcFrameTransformer::BadRequest;
+    useBus(Bus::Uart);
+
+    reply.resize(count);
+    size_t received = 0;
+    uint32_t start = millis();
+    while (received < count) {
+        size_t n = uartService.readBytes(reply.data() + received, count - received);
+        received += n;
+        if (n) continue;
+        if (millis() - start >= timeoutMs) break;
+        delay(1);
+    }
+    reply.resize(received);
+    return RpcFrameTransformer::Ok;
+}
+
+// GpioSet pin, level; GpioGet pin, the level comes back
+uint8_t RpcShell::gpio(const RpcFrame& frame) {
+    bool set = frame.type == RpcFrameTransformer::GpioSet;
+    if (frame.length < (set ? 2u : 1u)) return RpcFrameTransformer::BadRequest;
+    uint8_t pin = frame.payload[0];
+    if (state.isPinProtected(pin)) return RpcFrameTransformer::Protected;
+
+    if (set) {
+        pinService.setOutput(pin);
+        frame.payload[1] ? pinService.setHigh(pin) : pinService.setLow(pin);
+        return RpcFrameTransformer::Ok;
+    }
+    pinService.setInput(pin);
+    reply.push_back(pinService.read(pin) ? 1 : 0);
+    return RpcFrameTransformer::Ok;
+}
+
+// address, length; streamed from the double buffered dump as it is read.
+// A dump cut short is padded and its crc spoiled, the client reads it again.
+void RpcShell::flashRead(const RpcFrame& frame) {
+    if (frame.length < 8) {
+        send(frame, RpcFrameTransformer::BadRequest, nullptr, 0);
+        return;
+    }
+    uint32_t address = RpcFrameTransformer::le32(frame.payload);
+    uint32_t length = RpcFrameTransformer::le32(frame.payload + 4);
+    if (length > RpcFrameTransformer::MaxPayload) {
+        send(frame, RpcFrameTransformer::BadRequest, nullptr, 0);
+        return;
+    }
+    useBus(Bus::Spi);
+    if (spiSelected) spiService.endTransaction();
+    spiSelected = false;
+
+    uint8_t header[RpcFrameTransformer::HeaderSize];
+    uint32_t crc = RpcFrameTransformer::putHeader(header, frame.type | RpcFrameTransformer::Response,
+                                                  RpcFrameTransformer::Ok, frame.id, length);
+    Serial.write(header, sizeof(header));
+
+    uint32_t sent = 0;
+    if (length) {
+        FlashDumpManager::Options options;
+        options.blockSize = FlashBlockSize;
+        flashDumpManager.run(address, length, options, [&](uint32_t, const uint8_t* data, size_t len) {
+            Serial.write(data, len);
+            crc = RpcFrameTransformer::crc32(data, len, crc);
+            sent += (uint32_t)len;
+            return true;
+        });
+    }
+
+    if (sent < length) {
+        static const uint8_t padding[64] = {};
+        while (sent < length) {
+            size_t n = std::min<size_t>(sizeof(padding), length - sent);
+            Serial.write(padding, n);
+            sent += (uint32_t)n;
+        }
+        crc = ~crc;
+    }
+
+    uint8_t trailer[RpcFrameTransformer::TrailerSize];
+    RpcFrameTransformer::putTrailer(trailer, crc);
+    Serial.write(trailer, sizeof(trailer));
+}
+
+/*
+Limits
+*/
+// Room for a request and its reply in the largest free block, internal RAM
+// or PSRAM when the board has it; a failed allocation would abort
+uint32_t RpcShell::payloadLimit() const {
+    size_t block = heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT) / 3;
+    uint32_t limit = (uint32_t)std::min<size_t>(block, RpcFrameTransformer::MaxPayload);
+    return std::max(limit & ~(uint32_t)0xFF, MinPayload);
+}
+
+/*
+Bus
+*/
+// Pins may be shared between buses, configured again on each switch
+void RpcShell::useBus(Bus bus) {
+    if (bus == activeBus) return;
+
+    if (spiSelected) spiService.endTransaction();
+    spiSelected = false;
+
+    switch (bus) {
+        case Bus::Spi:
+            spiService.configure(state.getSpiMOSIPin(), state.getSpiMISOPin(), state.getSpiCLKPin(),
+                                 state.getSpiCSPin(), state.getSpiFrequency());
+            break;
+        case Bus::I2c:
+            i2cService.configure(state.getI2cSdaPin(), state.getI2cSclPin(), state.getI2cFrequency());
+            break;
+        case Bus::Uart:
+            uartService.configure(state.getUartBaudRate(), state.getUartConfig(), state.getUartRxPin(),
+                                  state.getUartTxPin(), state.isUartInverted());
+            break;
+        default:
+            break;
+    }
+    activeBus = bus;
+}
+
+/*
+Reply
+*/
+void RpcShell::send(const RpcFrame& request, uint8_t status, const uint8_t* data, uint32_t length) {
+    uint8_t header[RpcFrameTransformer::HeaderSize];
+    uint8_t trailer[RpcFrameTransformer::TrailerSize];
+    uint32_t crc = RpcFrameTransformer::putHeader(header, request.type | RpcFrameTransformer::Response,
+                                                  status, request.id, length);
+    RpcFrameTransformer::putTrailer(trailer, RpcFrameTransformer::crc32(data, length, crc));
+
+    Serial.write(header, sizeof(header));
+    if (length) Serial.write(data, length);
+    Serial.write(trailer, sizeof(trailer));
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include "Interfaces/ITerminalView.h"
+#include "Services/SpiService.h"
+#include "Services/I2cService.h"
+#include "Services/UartService.h"
+#include "Services/PinService.h"
+#include "Managers/FlashDumpManager.h"
+#include "Transformers/RpcFrameTransformer.h"
+#include "States/GlobalState.h"
+
+// Binary RPC mode on the USB serial port, for host automation.
+// Requests are RpcFrameTransformer frames, answered in the order received
+// with the same id, so a client can keep many in flight. Replies go straight
+// to the port, nothing is echoed or printed. Buses use the pins and speeds
+// of the state, set them from the text terminal before. On leaving, the
+// dispatcher configures the current mode again, pins may have moved.
+
+class RpcShell {
+public:
+    RpcShell(
+        ITerminalView& terminalView,
+        SpiService& spiService,
+        I2cService& i2cService,
+        UartService& uartService,
+        PinService& pinService,
+        FlashDumpManager& flashDumpManager,
+        RpcFrameTransformer& rpcTransformer
+    );
+
+    // Serve requests until Exit, or Enter between frames. first holds bytes
+    // already read, when the mode was entered by a frame start.
+    void run(const uint8_t* first = nullptr, size_t firstCount = 0);
+
+private:
+    enum class Bus : uint8_t { None, Spi, I2c, Uart };
+
+    static constexpr size_t ReadChunk = 4096;
+    static constexpr uint32_t FlashBlockSize = 4096;
+    static constexpr uint32_t MaxUartTimeoutMs = 10000;
+    static constexpr size_t SpiChunk = 512;
+    static constexpr uint32_t MinPayload = 1024;
+
+    ITerminalView& terminalView;
+    SpiService& spiService;
+    I2cService& i2cService;
+    UartService& uartService;
+    PinService& pinService;
+    FlashDumpManager& flashDumpManager;
+    RpcFrameTransformer& rpcTransformer;
+    GlobalState& state = GlobalState::getInstance();
+
+    Bus activeBus = Bus::None;
+    bool spiSelected = false;
+    std::vector<uint8_t> reply;             // reused by every response
+
+    // False when the request asked to leave
+    bool handle(const RpcFrame& frame);
+    bool serve(const uint8_t* data, size_t count);
+
+    void spiTransfer(const RpcFrame& frame);
+    uint8_t i2cWrite(const RpcFrame& frame);
+    uint8_t i2cRead(const RpcFrame& frame);
+    uint8_t uartRead(const RpcFrame& frame);
+    uint8_t gpio(const RpcFrame& frame);
+    void flashRead(const RpcFrame& frame);
+
+    uint32_t payloadLimit() const;
+    void useBus(Bus bus);
+    void send(const RpcFrame& request, uint8_t status, const uint8_t* data, uint32_t length);
+};
@@ -6,14 +6,20 @@ SpiFlashShell::SpiFlashShell(
     IInput& input,
     ArgTransformer& argTransformer,
     UserInputManager& userInputManager,
-    BinaryAnalyzeManager& binaryAnalyzeManager
+    BinaryAnalyzeManager& binaryAnalyzeManager,
+    FlashDumpManager& flashDumpManager,
+    XmodemTransformer& xmodemTransformer,
+    LittleFsService& littleFsService
 )
     : spiService(spiService),
       terminalView(view),
       terminalInput(input),
       argTransformer(argTransformer),
       userInputManager(userInputManager),
-      binaryAnalyzeManager(binaryAnalyzeManager)
+      binaryAnalyzeManager(binaryAnalyzeManager),
+      flashDumpManager(flashDumpManager),
+      xmodemTransformer(xmodemTransformer),
+      littleFsService(littleFsService)
 {
     // Nothing
 }
@@ -41,7 +47,9 @@ void SpiFlashShell::run() {
             case 5: cmdWrite();   break;
             case 6: cmdDump();    break;
             case 7: cmdDump(true); break;
-            case 8: cmdErase();   break;
+            case 8: cmdDumpXmodem(); break;
+            case 9: cmdDumpFile(); break;
+            case 10: cmdErase();  break;
             default:
                 terminalView.println("Unknown action.\n");
                 break;
@@ -232,11 +240,17 @@ void SpiFlashShell::cmdSearch() {
     terminalView.print("Enter string search pattern: ");
     std::string pattern = userInputManager.getLine();
 
+    PatternSpec spec = { pattern.data(), (uint8_t)pattern.size(), 0, nullptr };
+    PatternAutomaton automaton;
+    if (pattern.size() > PatternScanner::MaxPatternLength || !automaton.build(&spec, 1)) {
+        terminalView.println("SPI Flash Search: Pattern must be 1 to " +
+                             std::to_string(PatternScanner::MaxPatternLength) + " characters.\n");
+        return;
+    }
+
     terminalView.println("\nSearching for \"" + pattern + "\" in SPI flash from 0x" + argTransformer.toHex(startAddr, 6) + "... Press [ENTER] to stop.\n");
 
-    const uint32_t blockSize = 512;
     const uint32_t contextSize = 16;  // characters before and after
-    uint8_t buffer[blockSize + 32];
 
     // Get flash size
     uint8_t id[3];
@@ -244,62 +258,53 @@ void SpiFlashShell::cmdSearch() {
     const FlashChipInfo* chip = findFlashInfo(id[0], id[1], id[2]);
     uint32_t flashSize = chip ? chip->capacityBytes : spiService.calculateFlashCapacity(id[2]);
 
-    // Read flash in chunks
-    for (uint32_t addr = startAddr; addr < flashSize; addr += blockSize - pattern.size()) {
-        spiService.readFlashData(addr, buffer, blockSize + pattern.size() - 1);
-        
-        // Read block
-        for (uint32_t i = 0; i <= blockSize; ++i) {
-            if (i + pattern.size() > blockSize + pattern.size() - 1) break;
-
-            bool match = true;
-            for (size_t j = 0; j < pattern.size(); ++j) {
-                if (buffer[i + j] != pattern[j]) {
-                    match = false;
-                    break;
-                }
-            }
-            
-            // Found a matching string
-            if (match) {
-                uint32_t matchAddr = addr + i;
+    // One pass, the scanner keeps its state from one block to the next
+    PatternScanner scanner(automaton.table());
+    scanner.reset(startAddr);
+    std::string previousTail;   // end of the previous block, for the context
+
+    auto stats = flashDumpManager.run(startAddr, flashSize - startAddr, dumpOptions(),
+        [&](uint32_t blockAddress, const uint8_t* data, size_t len) {
+            scanner.scan(data, len, [&](uint8_t, uint32_t matchAddr) {
                 std::string context;
+                auto printable = [](uint8_t c) { return (char)(isprint(c) ? c : '.'); };
 
                 // Before the pattern
-                for (int j = (int)i - (int)contextSize; j < (int)i; ++j) {
-                    if (j >= 0) {
-                        char c = (char)buffer[j];
-                        context += (isprint(c) ? c : '.');
+                int64_t from = (int64_t)matchAddr - contextSize;
+                for (int64_t a = from; a < (int64_t)matchAddr; ++a) {
+                    if (a >= (int64_t)blockAddress) {
+                        context += printable(data[a - blockAddress]);
+                    } else if (a >= (int64_t)(blockAddress - previousTail.size())) {
+                        context += printable(previousTail[previousTail.size() - (blockAddress - a)]);
                     }
                 }
 
                 // Pattern
                 context += "[";
-                for (size_t j = 0; j < pattern.size(); ++j) {
-                    char c = (char)buffer[i + j];
-                    context += (isprint(c) ? c : '.');
-                }
+                for (char c : pattern) context += printable((uint8_t)c);
                 context += "]";
 
-                // After the pattern
-                for (uint32_t j = i + pattern.size(); j < i + pattern.size() + contextSize && j < blockSize + pattern.size(); ++j) {
-                    char c = (char)buffer[j];
-                    context += (isprint(c) ? c : '.');
+                // After the pattern, up to the end of the block
+                uint32_t after = matchAddr + pattern.size() - blockAddress;
+                for (uint32_t j = after; j < after + contextSize && j < len; ++j) {
+                    context += printable(data[j]);
                 }
 
                 terminalView.println("0x" + argTransformer.toHex(matchAddr, 6) + ": " + context);
-            }
+            });
 
-            // Allow user to interrupt
-            char c = terminalInput.readChar();
-            if (c == '\r' || c == '\n') {
-                terminalView.println("\nSPI Flash Search: Cancelled by user.\n");
-                return;
-            }
-        }
+            size_t keep = len < contextSize ? len : contextSize;
+            previousTail.assign(reinterpret_cast<const char*>(data + len - keep), keep);
+            return true;
+        },
+        [&]() { return enterPressed(); });
+
+    if (stats.stopped) {
+        terminalView.println("\nSPI Flash Search: Cancelled by user.\n");
+        return;
     }
 
-    terminalView.println("\nSearch complete.");
+    terminalView.println("\nSearch complete. " + flashDumpManager.formatStats(stats));
 }
 
 /*
@@ -323,69 +328,44 @@ void SpiFlashShell::cmdRead() {
 /*
 Flash Read In Chunks
 */
-void SpiFlashShell::readFlashInChunks(uint32_t address, uint32_t length) {
-    uint8_t buffer[1024];
-    uint32_t remaining = length;
-    uint32_t currentAddr = address;
-
-    // Display chunks
-    while (remaining > 0) {
-        uint32_t chunkSize = (remaining > 1024) ? 1024 : remaining;
-        spiService.readFlashData(currentAddr, buffer, chunkSize);
-
-        for (uint32_t i = 0; i < chunkSize; i += 16) {
-            std::stringstream line;
-
-            // Address
-            line << std::hex << std::uppercase << std::setfill('0')
-                 << std::setw(6) << (currentAddr + i) << ": ";
-
-            // Hex
-            for (uint32_t j = 0; j < 16; ++j) {
-                if (i + j < chunkSize) {
-                    line << std::setw(2) << (int)buffer[i + j] << " ";
-                } else {
-                    line << "   ";
-                }
-            }
+FlashDumpStats SpiFlashShell::readFlashInChunks(uint32_t address, uint32_t length) {
+    // One print per block, the next block is read meanwhile
+    auto stats = flashDumpManager.run(address, length, dumpOptions(),
+        [&](uint32_t blockAddress, const uint8_t* data, size_t len) {
+            hexBlock.clear();
+            FlashDumpManager::appendHexLines(hexBlock, blockAddress, data, len);
+            terminalView.print(hexBlock);
+            return true;
+        },
+        [&]() { return enterPressed(); });
+
+    if (stats.stopped) {
+        terminalView.println("\nRead interrupted by user.");
+    }
+    return stats;
+}
 
-            // ASCII
-            line << " ";
-            for (uint32_t j = 0; j < 16; ++j) {
-                if (i + j < chunkSize) {
-                    char c = static_cast<char>(buffer[i + j]);
-                    line << (isprint(c) ? c : '.');
-                }
-            }
-            terminalView.println(line.str());
+FlashDumpStats SpiFlashShell::readFlashInChunksRaw(uint32_t address, uint32_t length) {
+    return flashDumpManager.run(address, length, dumpOptions(),
+        [&](uint32_t, const uint8_t* data, size_t len) {
+            terminalView.write(data, len);
+            return true;
+        });
+}
 
-            // Check user ENTER to stop
-            char c = terminalInput.readChar();
-            if (c == '\r' || c == '\n') {
-                terminalView.println("\nRead interrupted by user.");
-                return;
-            }
-        }
+FlashDumpManager::Options SpiFlashShell::dumpOptions() {
+    uint8_t id[3];
+    spiService.readFlashIdRaw(id);
+    const FlashChipInfo* chip = findFlashInfo(id[0], id[1], id[2]);
 
-        currentAddr += chunkSize;
-        remaining -= chunkSize;
-    }
+    FlashDumpManager::Options options;
+    options.dualOutput = chip && chip->dualOutput;
+    return options;
 }
 
-void SpiFlashShell::readFlashInChunksRaw(uint32_t address, uint32_t length) {
-    uint8_t buffer[1024];
-    uint32_t remaining = length;
-    uint32_t current   = address;
-
-    while (remaining > 0) {
-        uint32_t n = (remaining > sizeof(buffer)) ? sizeof(buffer) : remaining;
-        spiService.readFlashData(current, buffer, n);
-        for (uint32_t i = 0; i < n; ++i) {
-            terminalView.print(buffer[i]);
-        }
-        current   += n;
-        remaining -= n;
-    }
+bool SpiFlashShell::enterPressed() {
+    char c = terminalInput.readChar();
+    return c == '\r' || c == '\n';
 }
 
 uint32_t SpiFlashShell::readFlashCapacity() {
@@ -488,6 +468,11 @@ void SpiFlashShell::cmdErase() {
 Flash Dump
 */
 void SpiFlashShell::cmdDump(bool raw) {
+    // Raw bytes would be turned into text by the other terminals
+    if (raw && state.getTerminalMode() != TerminalTypeEnum::Serial) {
+        terminalView.println("\nSPI Flash: raw dump needs the USB serial terminal.\n");
+        return;
+    }
     if (!checkFlashPresent()) return;
 
     terminalView.println("\nSPI Flash: Full dump from 0x000000... Press [ENTER] to stop.\n");
@@ -501,12 +486,150 @@ void SpiFlashShell::cmdDump(bool raw) {
     uint32_t flashSize = readFlashCapacity();
 
     // Chunk read
-    if (raw) readFlashInChunksRaw(0, flashSize); 
-    else readFlashInChunks(0, flashSize);
+    FlashDumpStats stats = raw ? readFlashInChunksRaw(0, flashSize) : readFlashInChunks(0, flashSize);
 
+    terminalView.println("");
+    terminalView.println("SPI Flash Dump: " + flashDumpManager.formatStats(stats));
     terminalView.println("\nSPI Flash Dump: Done.\n");
 }
 
+/*
+Flash Dump XMODEM
+*/
+void SpiFlashShell::cmdDumpXmodem() {
+    if (state.getTerminalMode() != TerminalTypeEnum::Serial) {
+        terminalView.println("\nSPI Flash: XMODEM needs the USB serial terminal.\n");
+        return;
+    }
+    if (!checkFlashPresent()) return;
+
+    uint32_t flashSize = readFlashCapacity();
+    terminalView.println("\nSPI Flash: XMODEM-1K dump of " + std::to_string(flashSize) + " bytes.");
+    terminalView.println("Start an XMODEM (CRC/1K) receive in your terminal now...");
+
+    if (!waitXmodemReceiver(60000)) {
+        terminalView.println("\nSPI Flash Dump: No XMODEM receiver, cancelled.\n");
+        return;
+    }
+
+    // 4 packets per flash block, sent while the next block is read
+    uint8_t blockNumber = 1;
+    bool accepted = true;
+    auto stats = flashDumpManager.run(0, flashSize, dumpOptions(),
+        [&](uint32_t, const uint8_t* data, size_t len) {
+            for (size_t offset = 0; offset < len; offset += XmodemTransformer::PayloadSize) {
+                size_t n = len - offset;
+                if (n > XmodemTransformer::PayloadSize) n = XmodemTransformer::PayloadSize;
+                size_t packetLen = xmodemTransformer.buildPacket(blockNumber, data + offset, n, xmodemPacket);
+                if (!sendXmodemPacket(xmodemPacket, packetLen)) {
+                    accepted = false;
+                    return false;
+                }
+                blockNumber++;
+            }
+            return true;
+        });
+
+    if (accepted) {
+        // End of transfer, the receiver ACKs the EOT
+        for (int attempt = 0; attempt < 10; ++attempt) {
+            uint8_t eot = XmodemTransformer::EOT;
+            if (sendXmodemPacket(&eot, 1)) break;
+        }
+    } else {
+        const uint8_t cancel[3] = {XmodemTransformer::CAN, XmodemTransformer::CAN, XmodemTransformer::CAN};
+        terminalView.write(cancel, sizeof(cancel));
+    }
+
+    delay(500); // let the receiver leave the transfer screen
+    terminalView.println("\nSPI Flash Dump: " + flashDumpManager.formatStats(stats));
+    terminalView.println(accepted ? "SPI Flash Dump: Done.\n" : "SPI Flash Dump: Transfer aborted.\n");
+}
+
+bool SpiFlashShell::waitXmodemReceiver(uint32_t timeoutMs) {
+    uint32_t start = millis();
+    while (millis() - start < timeoutMs) {
+        char c = terminalInput.readChar();
+        if (c == XmodemTransformer::CRC_REQUEST) return true;
+        if (c == XmodemTransformer::CAN || c == '\r' || c == '\n') return false;
+        delay(1);
+    }
+    return false;
+}
+
+bool SpiFlashShell::sendXmodemPacket(const uint8_t* packet, size_t len) {
+    for (int attempt = 0; attempt < 10; ++attempt) {
+        terminalView.write(packet, len);
+
+        // ACK, NAK or timeout
+        uint32_t start = millis();
+        while (millis() - start < 10000) {
+            char c = terminalInput.readChar();
+            if (c == XmodemTransformer::ACK) return true;
+            if (c == XmodemTransformer::CAN) return false;
+            if (c == XmodemTransformer::NAK) break;
+            if (c == KEY_NONE) delay(1);
+        }
+    }
+    return false;
+}
+
+/*
+Flash Dump LittleFS
+*/
+void SpiFlashShell::cmdDumpFile() {
+    if (!checkFlashPresent()) return;
+
+    if (!littleFsService.mounted()) {
+        littleFsService.begin();
+    }
+
+    terminalView.print("File name (default flash.bin): ");
+    std::string name = userInputManager.getLine();
+    if (name.empty()) name = "flash.bin";
+    if (!littleFsService.isSafeRootFileName(name)) {
+        terminalView.println("SPI Flash Dump: Invalid file name.\n");
+        return;
+    }
+    std::string path = "/" + name;
+
+    uint32_t flashSize = readFlashCapacity();
+    size_t freeBytes = littleFsService.freeBytes();
+    if (freeBytes < flashSize + 4096) {
+        terminalView.println("SPI Flash Dump: Not enough space on LittleFS (" +
+                             std::to_string(freeBytes) + " bytes free).\n");
+        return;
+    }
+    if (!littleFsService.write(path, "")) {
+        terminalView.println("SPI Flash Dump: Failed to create " + path + "\n");
+        return;
+    }
+
+    terminalView.println("\nSPI Flash: Dumping to " + path + "... Press [ENTER] to stop.");
+
+    // A dot every 64 KB
+    bool writeFailed = false;
+    auto stats = flashDumpManager.run(0, flashSize, dumpOptions(),
+        [&](uint32_t blockAddress, const uint8_t* data, size_t len) {
+            if (!littleFsService.write(path, data, len, true)) {
+                writeFailed = true;
+                return false;
+            }
+            if (((blockAddress + len) & 0xFFFF) < len) terminalView.print(".");
+            return true;
+        },
+        [&]() { return enterPressed(); });
+
+    terminalView.println("");
+    terminalView.println("SPI Flash Dump: " + flashDumpManager.formatStats(stats));
+    if (writeFailed) {
+        terminalView.println("SPI Flash Dump: Write failed, " + path + " is incomplete.\n");
+    } else if (stats.stopped) {
+        terminalView.println("SPI Flash Dump: Stopped, " + path + " is incomplete.\n");
+    } else {
+        terminalView.println("SPI Flash Dump: Saved to " + path + "\n");
+    }
+}
 
 /*
 Check Chip
@@ -6,6 +6,10 @@
 #include "Transformers/ArgTransformer.h"
 #include "Services/SpiService.h"
 #include "Managers/BinaryAnalyzeManager.h"
+#include "Managers/FlashDumpManager.h"
+#include "Managers/PatternScanner.h"
+#include "Services/LittleFsService.h"
+#include "Transformers/XmodemTransformer.h"
 #include "Models/TerminalCommand.h"
 #include "States/GlobalState.h"
 
@@ -17,7 +21,10 @@ public:
         IInput& input,
         ArgTransformer& argTransformer,
         UserInputManager& userInputManager,
-        BinaryAnalyzeManager& binaryAnalyzeManager
+        BinaryAnalyzeManager& binaryAnalyzeManager,
+        FlashDumpManager& flashDumpManager,
+        XmodemTransformer& xmodemTransformer,
+        LittleFsService& littleFsService
     );
 
     void run();
@@ -32,6 +39,8 @@ private:
         " ✏️  Write bytes",
         " 🗃️  Dump ASCII",
         " 🗃️  Dump RAW",
+        " 📦 Dump XMODEM",
+        " 💾 Dump to LittleFS",
         " 💣 Erase Flash",
         "🚪 Exit Shell"
     };
@@ -42,6 +51,9 @@ private:
     ArgTransformer& argTransformer;
     UserInputManager& userInputManager;
     BinaryAnalyzeManager& binaryAnalyzeManager;
+    FlashDumpManager& flashDumpManager;
+    XmodemTransformer& xmodemTransformer;
+    LittleFsService& littleFsService;
     GlobalState& state = GlobalState::getInstance();
 
     void cmdProbe();
@@ -52,8 +64,17 @@ private:
     void cmdWrite();
     void cmdErase();
     void cmdDump(bool raw = false);
-    void readFlashInChunks(uint32_t address, uint32_t length);
-    void readFlashInChunksRaw(uint32_t address, uint32_t length);
+    void cmdDumpXmodem();
+    void cmdDumpFile();
+    FlashDumpStats readFlashInChunks(uint32_t address, uint32_t length);
+    FlashDumpStats readFlashInChunksRaw(uint32_t address, uint32_t length);
+    FlashDumpManager::Options dumpOptions();
+    bool waitXmodemReceiver(uint32_t timeoutMs);
+    bool sendXmodemPacket(const uint8_t* packet, size_t len);
+    bool enterPressed();
+
+    std::string hexBlock;
+    uint8_t xmodemPacket[XmodemTransformer::PacketSize];
     uint32_t readFlashCapacity();
     bool checkFlashPresent();
 };
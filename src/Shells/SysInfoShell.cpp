@@ -7,13 +7,15 @@ SysInfoShell::SysInfoShell(ITerminalView& tv,
                            UserInputManager& uim,
                            ArgTransformer& at,
                            SystemService& sys,
-                           WifiService& wifi)
+                           WifiService& wifi,
+                           ModeFootprintManager& footprints)
     : terminalView(tv)
     , terminalInput(in)
     , userInputManager(uim)
     , argTransformer(at)
     , systemService(sys)
-    , wifiService(wifi) {}
+    , wifiService(wifi)
+    , modeFootprintManager(footprints) {}
 
 void SysInfoShell::run() {
     bool loop = true;
@@ -31,8 +33,9 @@ void SysInfoShell::run() {
             case 5: cmdNVS(false); break;
             case 6: cmdNVS(true); break;
             case 7: cmdNet(); break;
-            case 8: cmdReboot(); break;
-            case 9: // Exit
+            case 8: cmdModeMemory(); break;
+            case 9: cmdReboot(); break;
+            case 10: // Exit
             default:
                 loop = false;
                 break;
@@ -213,6 +216,13 @@ void SysInfoShell::cmdNet() {
     terminalView.println("Prov enabled : " + std::string(wifiService.isProvisioningEnabled() ? "Yes" : "No"));
 }
 
+void SysInfoShell::cmdModeMemory() {
+    terminalView.println("\n=== Mode Memory ===");
+    for (const auto& line : modeFootprintManager.formatLines()) {
+        terminalView.println(line);
+    }
+}
+
 void SysInfoShell::cmdReboot(bool hard) {
     auto confirmation = userInputManager.readYesNo("Reboot the device? (y/n)", false);
     if (confirmation) {
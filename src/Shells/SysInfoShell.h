@@ -8,6 +8,7 @@
 #include "Transformers/ArgTransformer.h"
 #include "Services/SystemService.h"
 #include "Services/WifiService.h"
+#include "Managers/ModeFootprintManager.h"
 #include "States/GlobalState.h"
 
 class SysInfoShell {
@@ -17,7 +18,8 @@ public:
                  UserInputManager& userInputManager,
                  ArgTransformer& argTransformer,
                  SystemService& systemService,
-                 WifiService& wifiService);
+                 WifiService& wifiService,
+                 ModeFootprintManager& modeFootprintManager);
 
     void run();
 
@@ -31,6 +33,7 @@ private:
         " 🧰 NVS stats",
         " 📒 NVS entries",
         " 🌐 Network",
+        " 🧱 Mode memory",
         " 🔄 Reboot",
         "🚪 Exit"
     };
@@ -71,6 +74,7 @@ private:
     void cmdFS();
     void cmdNVS(bool listEntries);
     void cmdNet();
+    void cmdModeMemory();
     void cmdReboot(bool hard = false);
 
     ITerminalView&     terminalView;
@@ -79,5 +83,6 @@ private:
     ArgTransformer&    argTransformer;
     SystemService&     systemService;
     WifiService&       wifiService;
+    ModeFootprintManager& modeFootprintManager;
     GlobalState&       state = GlobalState::getInstance();
 };
@@ -113,6 +113,7 @@ private:
     uint8_t canSiPin = 2;
     uint8_t canSoPin = 3;
     uint32_t canKbps = 120;
+    uint8_t canIntPin = 0xFF; // not wired, RX buffers are polled
 
     // Ethernet Default Configuration
     uint8_t ethernetCsPin = 5;
@@ -333,12 +334,14 @@ public:
     uint8_t getCanSiPin() const { return canSiPin; }
     uint8_t getCanSoPin() const { return canSoPin; }
     uint32_t getCanKbps() const { return canKbps; }
+    uint8_t getCanIntPin() const { return canIntPin; }
 
     void setCanCspin(uint8_t pin) { canCspin = pin; }
     void setCanSckPin(uint8_t pin) { canSckPin = pin; }
     void setCanSiPin(uint8_t pin) { canSiPin = pin; }
     void setCanSoPin(uint8_t pin) { canSoPin = pin; }
     void setCanKbps(uint32_t kbps) { canKbps = kbps; } 
+    void setCanIntPin(uint8_t pin) { canIntPin = pin; }
 
     // Ethernet
     uint8_t getEthernetCsPin() const { return ethernetCsPin; }
@@ -541,6 +544,9 @@ public:
         #ifdef CAN_KBPS
             canKbps = CAN_KBPS;
         #endif
+        #ifdef CAN_INT_PIN
+            canIntPin = CAN_INT_PIN;
+        #endif
         #ifdef ETHERNET_CS_PIN
             ethernetCsPin = ETHERNET_CS_PIN;
         #endif
@@ -9,6 +9,7 @@
 #include <stdexcept>
 #include <string>
 #include <algorithm>
+#include <array>
 
 class ArgTransformer {
 public:
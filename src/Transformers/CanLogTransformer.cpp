@@ -0,0 +1,49 @@
+#include "CanLogTransformer.h"
+
+#include <cstdio>
+
+void CanLogTransformer::appendCandump(std::string& out, const CanFrameRecord& frame) const {
+    char text[64];
+    snprintf(text, sizeof(text), "(%llu.%06llu) ",
+             (unsigned long long)(frame.timestampUs / 1000000ULL),
+             (unsigned long long)(frame.timestampUs % 1000000ULL));
+    out += text;
+    out += interfaceName;
+
+    snprintf(text, sizeof(text), frame.extended() ? " %08X#" : " %03X#", (unsigned)frame.id);
+    out += text;
+
+    if (frame.remote()) {
+        out += 'R';
+    } else {
+        static const char* hex = "0123456789ABCDEF";
+        uint8_t dlc = frame.dlc > 8 ? 8 : frame.dlc;
+        for (uint8_t i = 0; i < dlc; ++i) {
+            out += hex[frame.data[i] >> 4];
+            out += hex[frame.data[i] & 0x0F];
+        }
+    }
+    out += '\n';
+}
+
+std::string CanLogTransformer::savvyCanHeader() {
+    return "Time Stamp,ID,Extended,Dir,Bus,LEN,D1,D2,D3,D4,D5,D6,D7,D8\n";
+}
+
+void CanLogTransformer::appendSavvyCan(std::string& out, const CanFrameRecord& frame) const {
+    uint8_t dlc = frame.dlc > 8 ? 8 : frame.dlc;
+    char text[64];
+    snprintf(text, sizeof(text), "%llu,%08X,%s,Rx,0,%u",
+             (unsigned long long)frame.timestampUs, (unsigned)frame.id,
+             frame.extended() ? "true" : "false", (unsigned)dlc);
+    out += text;
+
+    for (uint8_t i = 0; i < 8; ++i) {
+        out += ',';
+        if (i < dlc && !frame.remote()) {
+            snprintf(text, sizeof(text), "%02X", frame.data[i]);
+            out += text;
+        }
+    }
+    out += '\n';
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include "Models/CanFrameRecord.h"
+
+// CAN log formats for captured frames.
+// candump -L: "(1436509052.249713) can0 123#DEADBEEF", read by can-utils
+// (canplayer, log2asc) and most CAN tools.
+// SavvyCAN CSV (GVRET): "Time Stamp,ID,Extended,Dir,Bus,LEN,D1..D8" with
+// microsecond time stamps.
+
+class CanLogTransformer {
+public:
+    explicit CanLogTransformer(const std::string& interfaceName = "can0") : interfaceName(interfaceName) {}
+
+    // Appends one line with its newline
+    void appendCandump(std::string& out, const CanFrameRecord& frame) const;
+
+    static std::string savvyCanHeader();
+    void appendSavvyCan(std::string& out, const CanFrameRecord& frame) const;
+
+private:
+    std::string interfaceName;
+};
@@ -0,0 +1,88 @@
+#include "I2cSniffTransformer.h"
+#include "PcapTransformer.h"
+
+#include <cstdio>
+
+std::string I2cSniffTransformer::toLine(const I2cTransaction& t) const {
+    std::string line;
+    line.reserve(32 + t.data.size() * 11);
+
+    line += "[S] ADDR ";
+    appendHex8(line, t.address);
+    line += t.read ? " R " : " W ";
+    line += t.addressAck ? "<ACK>" : "<NACK>";
+
+    for (size_t i = 0; i < t.data.size(); ++i) {
+        line += ' ';
+        appendHex8(line, t.data[i]);
+        line += (i < t.acks.size() && t.acks[i]) ? " <ACK>" : " <NACK>";
+    }
+
+    if (t.incomplete) line += " [!]";
+    line += t.repeatedStart ? " [Sr]" : " [P]";
+
+    char duration[24];
+    double us = ticksToNs(t.durationTicks) / 1000.0;
+    snprintf(duration, sizeof(duration), "  %.1f us", us);
+    line += duration;
+    return line;
+}
+
+std::string I2cSniffTransformer::csvHeader() {
+    return "start_ns,duration_ns,address,rw,addr_ack,data,nacks,end";
+}
+
+std::string I2cSniffTransformer::toCsv(const I2cTransaction& t) const {
+    char head[80];
+    snprintf(head, sizeof(head), "%llu,%llu,0x%02X,%c,%d,",
+             (unsigned long long)ticksToNs(t.startTicks),
+             (unsigned long long)ticksToNs(t.durationTicks),
+             t.address, t.read ? 'R' : 'W', t.addressAck ? 1 : 0);
+
+    std::string row = head;
+    static const char* hex = "0123456789ABCDEF";
+    uint32_t nacks = 0;
+    for (size_t i = 0; i < t.data.size(); ++i) {
+        row += hex[t.data[i] >> 4];
+        row += hex[t.data[i] & 0x0F];
+        if (i >= t.acks.size() || !t.acks[i]) nacks++;
+    }
+    row += ',';
+    row += std::to_string(nacks);
+    row += t.incomplete ? ",lost" : (t.repeatedStart ? ",Sr" : ",P");
+    return row;
+}
+
+std::string I2cSniffTransformer::pcapHeader() const {
+    return PcapTransformer::header(PcapLinkType);
+}
+
+void I2cSniffTransformer::appendPcapRecord(std::string& out, const I2cTransaction& t) const {
+    uint64_t us = ticksToNs(t.startTicks) / 1000;
+    uint32_t length = (uint32_t)(PseudoHeaderSize + 1 + t.data.size());
+
+    PcapTransformer::appendRecordHeader(out, us, length, length);
+
+    // Pseudo header: bus 0, flags with the read bit
+    out.push_back(0);
+    out.push_back(0);
+    out.push_back(0);
+    out.push_back(0);
+    out.push_back(t.read ? 1 : 0);
+
+    out.push_back((char)((t.address << 1) | (t.read ? 1 : 0)));
+    out.append(reinterpret_cast<const char*>(t.data.data()), t.data.size());
+}
+
+uint64_t I2cSniffTransformer::ticksToNs(uint64_t ticks) const {
+    if (!tickHz) return 0;
+    // Split to stay in 64 bits for long captures
+    return (ticks / tickHz) * 1000000000ULL + (ticks % tickHz) * 1000000000ULL / tickHz;
+}
+
+void I2cSniffTransformer::appendHex8(std::string& out, uint8_t v) {
+    static const char* hex = "0123456789ABCDEF";
+    out += "0x";
+    out += hex[v >> 4];
+    out += hex[v & 0x0F];
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include "Models/I2cTransaction.h"
+
+// Output formats for decoded I2C transactions.
+// Line: the terminal view. CSV: one row per transaction with times in ns,
+// for spreadsheets and scripts. PCAP: linktype 209 (I2C with the Linux
+// pseudo header), opened and decoded by Wireshark.
+
+class I2cSniffTransformer {
+public:
+    static constexpr uint32_t PcapLinkType = 209;
+    static constexpr size_t PseudoHeaderSize = 5;  // bus, flags (big endian)
+
+    explicit I2cSniffTransformer(uint32_t tickHz = 1000000) : tickHz(tickHz) {}
+
+    void setTickRate(uint32_t hz) { tickHz = hz; }
+
+    // "[S] ADDR 0x3C W <ACK> 0x00 <ACK> 0xAF <ACK> [P]  42.5 us"
+    std::string toLine(const I2cTransaction& t) const;
+
+    // "start_ns,duration_ns,address,rw,addr_ack,data,nacks,end"
+    static std::string csvHeader();
+    std::string toCsv(const I2cTransaction& t) const;
+
+    std::string pcapHeader() const;
+    void appendPcapRecord(std::string& out, const I2cTransaction& t) const;
+
+    uint64_t ticksToNs(uint64_t ticks) const;
+
+private:
+    uint32_t tickHz;
+
+    static void appendHex8(std::string& out, uint8_t v);
+};
@@ -1,5 +1,7 @@
 #include "InstructionTransformer.h"
 
+#include <cstring>
+
 std::vector<Instruction> InstructionTransformer::transform(const std::string& raw) {
     std::vector<Instruction> instructions;
     if (raw.empty()) return instructions;
@@ -156,6 +158,134 @@ std::vector<ByteCode> InstructionTransformer::transformByteCodes(const std::vect
     return allByteCodes;
 }
 
+void InstructionTransformer::compile(const std::string& raw, ByteCodeProgram& program) const {
+    program.clear();
+
+    char block = 0;         // prefix of the open block, 0 outside
+    char quote = 0;         // open char or string literal
+    size_t tokenStart = 0;
+    bool inToken = false;
+
+    auto flushToken = [&](size_t end) {
+        if (inToken && block) compileToken(raw.data() + tokenStart, end - tokenStart, program);
+        inToken = false;
+    };
+    auto closeBlock = [&]() {
+        if (block == '[') program.add(ByteCodeEnum::Stop);
+        block = 0;
+    };
+
+    for (size_t i = 0; i < raw.size(); ++i) {
+        char c = raw[i];
+
+        if (quote) {
+            if (c == quote) {
+                flushToken(i + 1);
+                quote = 0;
+            }
+            continue;
+        }
+
+        if (c == '\'' || c == '"') {
+            flushToken(i);
+            quote = c;
+            tokenStart = i;
+            inToken = true;
+            continue;
+        }
+
+        if (c == '[' || c == '{' || c == '>') {
+            flushToken(i);
+            closeBlock();
+            block = c;
+            if (c == '[') program.add(ByteCodeEnum::Start);
+            continue;
+        }
+
+        if (c == ']' || c == '}') {
+            flushToken(i);
+            closeBlock();
+            continue;
+        }
+
+        if (!block) continue;
+
+        if (std::isspace((unsigned char)c)) {
+            flushToken(i);
+        } else if (!inToken) {
+            tokenStart = i;
+            inToken = true;
+        }
+    }
+
+    // Unterminated literal is dropped, an open block ends with the line
+    if (!quote) flushToken(raw.size());
+    closeBlock();
+}
+
+void InstructionTransformer::compileToken(const char* token, size_t length, ByteCodeProgram& program) const {
+    const char first = token[0];
+    const char last = token[length - 1];
+
+    // 'A', "text" or 'text'
+    if (length >= 2 && (first == '"' || first == '\'') && last == first) {
+        for (size_t i = 1; i + 1 < length; ++i) program.addWrite((uint8_t)token[i]);
+        return;
+    }
+
+    // Hex or decimal byte, the low byte is kept like before
+    if (length > 2 && first == '0' && std::tolower((unsigned char)token[1]) == 'x') {
+        uint32_t value = 0;
+        for (size_t i = 2; i < length && std::isxdigit((unsigned char)token[i]); ++i) {
+            char d = std::tolower((unsigned char)token[i]);
+            value = (value << 4) | (uint32_t)(d <= '9' ? d - '0' : d - 'a' + 10);
+        }
+        program.addWrite((uint8_t)value);
+        return;
+    }
+    if (std::all_of(token, token + length, [](char d) { return std::isdigit((unsigned char)d); })) {
+        uint32_t value = 0;
+        for (size_t i = 0; i < length; ++i) value = value * 10 + (uint32_t)(token[i] - '0');
+        program.addWrite((uint8_t)value);
+        return;
+    }
+
+    if (!isSymbolChar(first)) return;
+    ByteCodeEnum command = parseSymbol(first).getCommand();
+
+    // r:16
+    const char* colon = (const char*)memchr(token, ':', length);
+    if (colon) {
+        const char* digits = colon + 1;
+        const char* end = token + length;
+        if (digits == end || !std::all_of(digits, end, [](char d) { return std::isdigit((unsigned char)d); })) return;
+        uint32_t repeat = 0;
+        for (const char* d = digits; d < end && repeat < 255; ++d) repeat = repeat * 10 + (uint32_t)(*d - '0');
+        program.add(command, std::min<uint32_t>(repeat, 255));
+        return;
+    }
+
+    // r or rrr
+    if (std::all_of(token, token + length, [first](char d) { return d == first; })) {
+        program.add(command, (uint32_t)std::min<size_t>(length, 255));
+    }
+}
+
+bool InstructionTransformer::isSymbolChar(char c) {
+    switch (c) {
+        case 'r':
+        case 'd':
+        case 'D':
+        case 's':
+        case 'S':
+        case 'h':
+        case 'l':
+            return true;
+        default:
+            return false;
+    }
+}
+
 bool InstructionTransformer::isHex(const std::string& token) const {
     return token.size() > 2 &&
            token[0] == '0' &&
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include "Models/ByteCode.h"
 #include "Models/Instruction.h"
+#include "Models/ByteCodeProgram.h"
 #include "Arduino.h"
 
 class InstructionTransformer {
@@ -15,6 +16,10 @@ public:
     std::vector<ByteCode> transformByteCode(const Instruction& instruction);
     std::vector<ByteCode> transformByteCodes(const std::vector<Instruction>& instructions);
 
+    // Compile a whole line in one pass without token strings, program is
+    // cleared first and reuses its capacity
+    void compile(const std::string& raw, ByteCodeProgram& program) const;
+
 private:
     bool isHex(const std::string& token) const;
     bool isDecimal(const std::string& token) const;
@@ -28,4 +33,6 @@ private:
     uint8_t parseCharLiteral(const std::string& token) const;
     ByteCode parseSymbol(char c) const;
     std::pair<ByteCodeEnum, uint8_t> parseSymbolWithRepeat(const std::string& token) const;
+    void compileToken(const char* token, size_t length, ByteCodeProgram& program) const;
+    static bool isSymbolChar(char c);
 };
@@ -0,0 +1,105 @@
+#include "LogicExportTransformer.h"
+#include <cstdio>
+
+std::string LogicExportTransformer::channelName(const LogicTrace& trace, uint8_t channel) {
+    if (channel < trace.pins.size()) return "GPIO" + std::to_string(trace.pins[channel]);
+    return "D" + std::to_string(channel);
+}
+
+uint64_t LogicExportTransformer::samplePeriodNs(uint32_t sampleRate) {
+    if (sampleRate == 0) return 0;
+    return (1000000000ull + sampleRate / 2) / sampleRate;
+}
+
+/*
+OLS
+*/
+void LogicExportTransformer::toOls(const LogicTrace& trace, const Writer& write) const {
+    uint8_t channels = trace.channelCount() ? trace.channelCount() : 8;
+    char line[64];
+    std::string out;
+    out.reserve(ChunkSize + sizeof(line));
+
+    out += ";Size: " + std::to_string(trace.sampleCount()) + "\n";
+    out += ";Rate: " + std::to_string(trace.sampleRate) + "\n";
+    out += ";Channels: " + std::to_string(channels) + "\n";
+    out += ";EnabledChannels: " + std::to_string((1u << channels) - 1) + "\n";
+    if (trace.triggered) out += ";TriggerPosition: " + std::to_string(trace.triggerSample) + "\n";
+    out += ";Compressed: true\n";
+    out += ";AbsoluteLength: " + std::to_string(trace.sampleCount()) + "\n";
+    out += ";CursorEnabled: false\n";
+
+    uint8_t last = 0;
+    uint32_t lastStart = 0;
+    trace.forEachRun([&](uint8_t value, uint32_t start, uint32_t) {
+        last = value;
+        lastStart = start;
+        snprintf(line, sizeof(line), "%08x@%u\n", value, start);
+        out += line;
+        if (out.size() >= ChunkSize) {
+            write(out);
+            out.clear();
+        }
+    });
+
+    // Last sample, so the client knows where the capture ends
+    if (trace.sampleCount() && lastStart != trace.sampleCount() - 1) {
+        snprintf(line, sizeof(line), "%08x@%u\n", last, trace.sampleCount() - 1);
+        out += line;
+    }
+    if (!out.empty()) write(out);
+}
+
+/*
+VCD
+*/
+void LogicExportTransformer::toVcd(const LogicTrace& trace, const Writer& write) const {
+    uint8_t channels = trace.channelCount() ? trace.channelCount() : 8;
+    uint64_t period = samplePeriodNs(trace.sampleRate);
+    if (period == 0) period = 1;
+    char line[64];
+    std::string out;
+    out.reserve(ChunkSize + 128);
+
+    out += "$version ESP32 Bus Pirate logic analyzer $end\n";
+    out += "$comment\n  " + std::to_string(trace.sampleCount()) + " samples at " +
+           std::to_string(trace.sampleRate) + " Hz";
+    if (trace.triggered) out += ", trigger at sample " + std::to_string(trace.triggerSample);
+    out += "\n$end\n";
+    out += "$timescale 1 ns $end\n";
+    out += "$scope module logic $end\n";
+    for (uint8_t ch = 0; ch < channels; ++ch) {
+        out += "$var wire 1 " + std::string(1, (char)('!' + ch)) + " " + channelName(trace, ch) + " $end\n";
+    }
+    out += "$upscope $end\n";
+    out += "$enddefinitions $end\n";
+
+    // Only the channels that changed, all of them at time 0
+    bool firstRun = true;
+    uint8_t previous = 0;
+    trace.forEachRun([&](uint8_t value, uint32_t start, uint32_t) {
+        uint8_t changed = firstRun ? 0xFF : (uint8_t)(value ^ previous);
+        if (!changed) return;
+        snprintf(line, sizeof(line), "#%llu", (unsigned long long)(start * period));
+        out += line;
+        for (uint8_t ch = 0; ch < channels; ++ch) {
+            if (!(changed & (1u << ch))) continue;
+            out += ' ';
+            out += (value & (1u << ch)) ? '1' : '0';
+            out += (char)('!' + ch);
+        }
+        out += '\n';
+        firstRun = false;
+        previous = value;
+        if (out.size() >= ChunkSize) {
+            write(out);
+            out.clear();
+        }
+    });
+
+    if (trace.sampleCount()) {
+        snprintf(line, sizeof(line), "#%llu\n", (unsigned long long)(trace.sampleCount() * period));
+        out += line;
+    }
+    if (!out.empty()) write(out);
+}
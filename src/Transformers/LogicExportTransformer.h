@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <functional>
+#include "Managers/LogicCaptureManager.h"
+
+// Text exports of a logic trace, written in chunks so a long capture never
+// needs the whole file in memory.
+// OLS: the OpenBench Logic Sniffer client format, one "value@sample" line per
+// change. VCD: value change dump, imported by sigrok/PulseView and GTKWave.
+
+class LogicExportTransformer {
+public:
+    using Writer = std::function<void(const std::string& chunk)>;
+
+    static constexpr size_t ChunkSize = 1024;
+
+    void toOls(const LogicTrace& trace, const Writer& write) const;
+    void toVcd(const LogicTrace& trace, const Writer& write) const;
+
+    // "GPIO4", channel names used by both formats
+    static std::string channelName(const LogicTrace& trace, uint8_t channel);
+
+    // Sample period in ns, 0 if the rate is 0
+    static uint64_t samplePeriodNs(uint32_t sampleRate);
+};
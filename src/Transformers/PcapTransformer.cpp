@@ -0,0 +1,32 @@
+#include "PcapTransformer.h"
+
+std::string PcapTransformer::header(uint32_t linkType, uint32_t snapLen) {
+    std::string out;
+    out.reserve(HeaderSize);
+    putLe32(out, 0xA1B2C3D4);           // magic, microsecond timestamps
+    putLe16(out, 2);                    // version 2.4
+    putLe16(out, 4);
+    putLe32(out, 0);                    // thiszone
+    putLe32(out, 0);                    // sigfigs
+    putLe32(out, snapLen);
+    putLe32(out, linkType);
+    return out;
+}
+
+void PcapTransformer::appendRecordHeader(std::string& out, uint64_t timestampUs,
+                                         uint32_t captured, uint32_t length) {
+    putLe32(out, (uint32_t)(timestampUs / 1000000ULL));
+    putLe32(out, (uint32_t)(timestampUs % 1000000ULL));
+    putLe32(out, captured);
+    putLe32(out, length);
+}
+
+void PcapTransformer::putLe16(std::string& out, uint16_t v) {
+    out.push_back((char)(v & 0xFF));
+    out.push_back((char)(v >> 8));
+}
+
+void PcapTransformer::putLe32(std::string& out, uint32_t v) {
+    putLe16(out, (uint16_t)(v & 0xFFFF));
+    putLe16(out, (uint16_t)(v >> 16));
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+// Classic PCAP file layout shared by the sniffers: global header for a
+// given linktype and record headers, microsecond timestamps, little endian.
+
+class PcapTransformer {
+public:
+    static constexpr size_t HeaderSize = 24;
+    static constexpr size_t RecordHeaderSize = 16;
+
+    // Global header, version 2.4
+    static std::string header(uint32_t linkType, uint32_t snapLen = 65535);
+
+    // Record header, the packet bytes are appended by the caller
+    static void appendRecordHeader(std::string& out, uint64_t timestampUs,
+                                   uint32_t captured, uint32_t length);
+
+    static void putLe16(std::string& out, uint16_t v);
+    static void putLe32(std::string& out, uint32_t v);
+};
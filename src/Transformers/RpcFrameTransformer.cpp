@@ -0,0 +1,185 @@
+#include "RpcFrameTransformer.h"
+
+#include <algorithm>
+#include <cstring>
+#include "Managers/FlashDumpManager.h"
+
+/*
+Parse
+*/
+bool RpcFrameTransformer::next(const uint8_t*& data, const uint8_t* end, RpcFrame& out) {
+    while (true) {
+        // Bytes of a rejected header first, they may hold the next frame start
+        if (replayAt < replayLength) {
+            uint8_t b = replay[replayAt++];
+            const uint8_t* p = &b;
+            if (step(p, p + 1, out)) return true;
+            continue;
+        }
+        if (data >= end) return false;
+        if (step(data, end, out)) return true;
+    }
+}
+
+bool RpcFrameTransformer::step(const uint8_t*& data, const uint8_t* end, RpcFrame& out) {
+    switch (stage) {
+        case Stage::Sync0: {
+            const uint8_t* found = (const uint8_t*)memchr(data, Magic0, (size_t)(end - data));
+            if (!found) {
+                linkStats.droppedBytes += (uint32_t)(end - data);
+                data = end;
+                return false;
+            }
+            linkStats.droppedBytes += (uint32_t)(found - data);
+            data = found + 1;
+            header[0] = Magic0;
+            stage = Stage::Sync1;
+            return false;
+        }
+
+        case Stage::Sync1: {
+            uint8_t b = *data++;
+            if (b == Magic1) {
+                header[1] = Magic1;
+                filled = 2;
+                stage = Stage::Header;
+            } else if (b != Magic0) {
+                linkStats.droppedBytes += 2;
+                stage = Stage::Sync0;
+            } else {
+                linkStats.droppedBytes++;    // A5 A5 5A, the second one may start
+            }
+            return false;
+        }
+
+        case Stage::Header: {
+            size_t n = std::min(HeaderSize - filled, (size_t)(end - data));
+            memcpy(header + filled, data, n);
+            data += n;
+            filled += n;
+            if (filled < HeaderSize) return false;
+
+            if (!headerValid()) {
+                resync();
+                return false;
+            }
+            length = le32(header + 6);
+            skipping = length > limit;
+            if (!skipping) payload.resize(length);
+            runningCrc = crc32(header + 2, 8, 0);
+            filled = 0;
+            stage = length ? Stage::Payload : Stage::Trailer;
+            return false;
+        }
+
+        case Stage::Payload: {
+            size_t n = std::min<size_t>(length - filled, (size_t)(end - data));
+            if (!skipping) memcpy(payload.data() + filled, data, n);
+            runningCrc = crc32(data, n, runningCrc);
+            data += n;
+            filled += n;
+            if (filled == length) {
+                filled = 0;
+                stage = Stage::Trailer;
+            }
+            return false;
+        }
+
+        case Stage::Trailer: {
+            size_t n = std::min(TrailerSize - filled, (size_t)(end - data));
+            memcpy(trailer + filled, data, n);
+            data += n;
+            filled += n;
+            if (filled < TrailerSize) return false;
+
+            out.type = header[2];
+            out.status = header[3];
+            out.id = le16(header + 4);
+            out.payload = skipping ? nullptr : payload.data();
+            out.length = skipping ? 0 : length;
+            out.crcOk = runningCrc == le32(trailer);
+            out.oversized = skipping;
+
+            if (out.crcOk) linkStats.frames++;
+            else linkStats.crcErrors++;
+            filled = 0;
+            stage = Stage::Sync0;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool RpcFrameTransformer::headerValid() {
+    uint8_t sum = 0;
+    for (size_t i = 2; i < 10; ++i) sum += header[i];
+    return (uint8_t)~sum == header[10] && le32(header + 6) <= MaxPayload;
+}
+
+// Look for a frame start again in the header, after its first magic byte
+void RpcFrameTransformer::resync() {
+    linkStats.headerErrors++;
+    linkStats.droppedBytes++;
+    size_t keep = HeaderSize - 1;
+    size_t left = replayLength - replayAt;
+
+    // Replay bytes not consumed yet go after the header ones
+    uint8_t pending[sizeof(replay)];
+    memcpy(pending, replay + replayAt, left);
+    memcpy(replay, header + 1, keep);
+    memcpy(replay + keep, pending, left);
+    replayAt = 0;
+    replayLength = keep + left;
+    filled = 0;
+    stage = Stage::Sync0;
+}
+
+void RpcFrameTransformer::resetParser() {
+    stage = Stage::Sync0;
+    filled = 0;
+    replayAt = replayLength = 0;
+    std::vector<uint8_t>().swap(payload);
+}
+
+void RpcFrameTransformer::setMaxPayload(uint32_t max) {
+    limit = std::min(max, MaxPayload);
+}
+
+/*
+Encode
+*/
+void RpcFrameTransformer::encode(std::string& out, uint8_t type, uint8_t status, uint16_t id,
+                                 const uint8_t* data, uint32_t count) {
+    uint8_t head[HeaderSize];
+    uint8_t tail[TrailerSize];
+    uint32_t crc = putHeader(head, type, status, id, count);
+    crc = crc32(data, count, crc);
+    putTrailer(tail, crc);
+
+    out.reserve(out.size() + HeaderSize + count + TrailerSize);
+    out.append((const char*)head, HeaderSize);
+    if (count) out.append((const char*)data, count);
+    out.append((const char*)tail, TrailerSize);
+}
+
+uint32_t RpcFrameTransformer::putHeader(uint8_t* out, uint8_t type, uint8_t status, uint16_t id, uint32_t count) {
+    out[0] = Magic0;
+    out[1] = Magic1;
+    out[2] = type;
+    out[3] = status;
+    out[4] = (uint8_t)id;
+    out[5] = (uint8_t)(id >> 8);
+    putLe32(out + 6, count);
+    uint8_t sum = 0;
+    for (size_t i = 2; i < 10; ++i) sum += out[i];
+    out[10] = (uint8_t)~sum;
+    return crc32(out + 2, 8, 0);
+}
+
+void RpcFrameTransformer::putTrailer(uint8_t* out, uint32_t crc) {
+    putLe32(out, crc);
+}
+
+uint32_t RpcFrameTransformer::crc32(const uint8_t* data, size_t count, uint32_t crc) {
+    return FlashDumpManager::crc32(data, count, crc);
+}
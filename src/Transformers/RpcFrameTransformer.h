@@ -0,0 +1,131 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+struct RpcFrame {
+    uint8_t type = 0;
+    uint8_t status = 0;
+    uint16_t id = 0;
+    const uint8_t* payload = nullptr;   // valid until the next call to next()
+    uint32_t length = 0;
+    bool crcOk = false;
+    bool oversized = false;             // over maxPayload(), read through and not kept
+};
+
+struct RpcLinkStats {
+    uint32_t frames = 0;
+    uint32_t crcErrors = 0;
+    uint32_t headerErrors = 0;          // bad header check or oversized length
+    uint32_t droppedBytes = 0;          // skipped while looking for a frame
+};
+
+// Framing of the binary RPC mode, little endian:
+//
+//   A5 5A | type | status | id:2 | length:4 | check | payload | crc32:4
+//
+// check is the complement of the sum of type..length, so a damaged length
+// is caught before waiting for its payload; the parser then resyncs on the
+// next A5 5A. crc32 (IEEE) covers type..length and the payload. A frame
+// with a good header and a bad crc is still returned, with crcOk false, so
+// its id can be answered. Responses use the request type | 0x80.
+// MaxPayload is the protocol limit; a receiver short of memory lowers its
+// own with setMaxPayload(), longer frames are then skipped without being
+// stored and returned with oversized set, so they can be refused.
+
+class RpcFrameTransformer {
+public:
+    static constexpr uint8_t Magic0 = 0xA5;
+    static constexpr uint8_t Magic1 = 0x5A;
+    static constexpr size_t HeaderSize = 11;
+    static constexpr size_t TrailerSize = 4;
+    static constexpr uint32_t MaxPayload = 65536;
+    static constexpr uint8_t Version = 1;
+
+    // Requests
+    static constexpr uint8_t Ping = 0x01;           // payload echoed
+    static constexpr uint8_t Exit = 0x02;           // back to the text terminal
+    static constexpr uint8_t Info = 0x03;           // version, max request payload kept:4
+    static constexpr uint8_t SpiTransfer = 0x10;    // flags, data out -> data in
+    static constexpr uint8_t I2cWrite = 0x20;       // address, data
+    static constexpr uint8_t I2cRead = 0x21;        // address, count:2, register bytes -> data
+    static constexpr uint8_t UartWrite = 0x30;      // data
+    static constexpr uint8_t UartRead = 0x31;       // count:2, timeout ms:2 -> data
+    static constexpr uint8_t GpioSet = 0x40;        // pin, level
+    static constexpr uint8_t GpioGet = 0x41;        // pin -> level
+    static constexpr uint8_t FlashRead = 0x50;      // address:4, length:4 -> data
+    static constexpr uint8_t Response = 0x80;
+
+    // SpiTransfer flags
+    static constexpr uint8_t SpiKeepSelected = 0x01;
+
+    // Status
+    static constexpr uint8_t Ok = 0x00;
+    static constexpr uint8_t BadRequest = 0x01;
+    static constexpr uint8_t UnknownType = 0x02;
+    static constexpr uint8_t CrcError = 0x03;
+    static constexpr uint8_t BusError = 0x04;
+    static constexpr uint8_t Protected = 0x05;      // pin used by the device
+
+    // Parse from data, advanced past what was used; true when out holds a frame
+    bool next(const uint8_t*& data, const uint8_t* end, RpcFrame& out);
+
+    // Drop a partly received frame and the payload storage
+    void resetParser();
+
+    // Longest payload kept, at most MaxPayload
+    void setMaxPayload(uint32_t max);
+    uint32_t maxPayload() const { return limit; }
+
+    // Nothing partly received
+    bool idle() const { return stage == Stage::Sync0 && replayAt == replayLength; }
+
+    const RpcLinkStats& stats() const { return linkStats; }
+    void resetStats() { linkStats = RpcLinkStats(); }
+
+    // Whole frame appended to out
+    static void encode(std::string& out, uint8_t type, uint8_t status, uint16_t id,
+                       const uint8_t* payload, uint32_t length);
+
+    // Streamed frame: header, payload chunks through crc32(), trailer
+    static uint32_t putHeader(uint8_t* out, uint8_t type, uint8_t status, uint16_t id, uint32_t length);
+    static void putTrailer(uint8_t* out, uint32_t crc);
+    static uint32_t crc32(const uint8_t* data, size_t length, uint32_t crc);
+
+    static uint16_t le16(const uint8_t* p) { return (uint16_t)(p[0] | (p[1] << 8)); }
+    static uint32_t le32(const uint8_t* p) {
+        return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+    static void putLe32(uint8_t* p, uint32_t v) {
+        p[0] = (uint8_t)v;
+        p[1] = (uint8_t)(v >> 8);
+        p[2] = (uint8_t)(v >> 16);
+        p[3] = (uint8_t)(v >> 24);
+    }
+
+private:
+    enum class Stage : uint8_t { Sync0, Sync1, Header, Payload, Trailer };
+
+    Stage stage = Stage::Sync0;
+    uint8_t header[HeaderSize];
+    uint8_t trailer[TrailerSize];
+    size_t filled = 0;
+    std::vector<uint8_t> payload;
+    uint32_t length = 0;
+    uint32_t limit = MaxPayload;
+    uint32_t runningCrc = 0;            // type..length, then the payload as it arrives
+    bool skipping = false;              // payload over limit, not stored
+
+    // Header bytes given back after a bad header check
+    uint8_t replay[2 * HeaderSize];
+    size_t replayAt = 0;
+    size_t replayLength = 0;
+
+    RpcLinkStats linkStats;
+
+    bool step(const uint8_t*& data, const uint8_t* end, RpcFrame& out);
+    bool headerValid();
+    void resync();
+};
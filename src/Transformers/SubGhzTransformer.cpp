@@ -2,6 +2,7 @@
 #include <sstream>
 #include <algorithm>
 #include <cctype>
+#include <cstdio>
 
 bool SubGhzTransformer::isValidSubGhzFile(const std::string& content) {
     if (content.empty()) return false;
@@ -256,6 +257,37 @@ SubGhzTransformer::extractSummaries(const std::vector<SubGhzFileCommand>& cmds)
     return out;
 }
 
+std::string SubGhzTransformer::transformToFileFormat(const SubGhzFileCommand& cmd) {
+    std::string out = rawFileHeader(cmd.frequency_hz, cmd.preset);
+    const auto& t = cmd.raw_timings;
+    for (size_t i = 0; i < t.size(); i += TimingsPerLine) {
+        appendRawDataLine(out, t.data() + i, std::min(TimingsPerLine, t.size() - i));
+    }
+    return out;
+}
+
+std::string SubGhzTransformer::rawFileHeader(uint32_t frequencyHz, const std::string& preset) {
+    std::string out;
+    out += "Filetype: Flipper SubGhz RAW File\n";
+    out += "Version: 1\n";
+    out += "Frequency: " + std::to_string(frequencyHz) + "\n";
+    out += "Preset: " + (preset.empty() ? std::string("FuriHalSubGhzPresetOok650Async") : preset) + "\n";
+    out += "Protocol: RAW\n";
+    return out;
+}
+
+void SubGhzTransformer::appendRawDataLine(std::string& out, const int32_t* timings, size_t count) {
+    if (!count) return;
+    out += "RAW_Data:";
+    char text[16];
+    for (size_t i = 0; i < count; ++i) {
+        if (!timings[i]) continue; // 0 is skipped by the parser
+        snprintf(text, sizeof(text), " %ld", (long)timings[i]);
+        out += text;
+    }
+    out += '\n';
+}
+
 std::string SubGhzTransformer::mapPreset(const std::string& presetStr) {
     std::string p; p = presetStr;
     return p;
@@ -37,6 +37,15 @@ public:
     // Extract readable summaries of commands
     std::vector<std::string> extractSummaries(const std::vector<SubGhzFileCommand>& cmds);
 
+    // Flipper RAW file from a RAW command, signed timings in us
+    std::string transformToFileFormat(const SubGhzFileCommand& cmd);
+
+    // Same file written in parts, for captures too large to hold as one string:
+    // the header, then RAW_Data lines of at most TimingsPerLine values
+    static constexpr size_t TimingsPerLine = 512;
+    std::string rawFileHeader(uint32_t frequencyHz, const std::string& preset);
+    void appendRawDataLine(std::string& out, const int32_t* timings, size_t count);
+
 private:
     // Helpers
     static void trim(std::string& s);
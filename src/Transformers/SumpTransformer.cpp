@@ -0,0 +1,124 @@
+#include "SumpTransformer.h"
+
+/*
+Commands
+*/
+bool SumpTransformer::feed(uint8_t byte, SumpCommand& out) {
+    pending[pendingLength++] = byte;
+
+    if (!(pending[0] & 0x80)) {
+        out.opcode = pending[0];
+        out.argument = 0;
+        pendingLength = 0;
+        return true;
+    }
+    if (pendingLength < 5) return false;
+
+    out.opcode = pending[0];
+    out.argument = (uint32_t)pending[1] | ((uint32_t)pending[2] << 8) |
+                   ((uint32_t)pending[3] << 16) | ((uint32_t)pending[4] << 24);
+    pendingLength = 0;
+    return true;
+}
+
+void SumpTransformer::apply(const SumpCommand& command, Config& config) const {
+    switch (command.opcode) {
+        case SetDivider:
+            config.sampleRate = BaseClock / ((command.argument & 0xFFFFFF) + 1);
+            break;
+        case SetReadDelayCount:
+            config.readCount = ((command.argument & 0xFFFF) + 1) * 4;
+            config.delayCount = ((command.argument >> 16) + 1) * 4;
+            break;
+        case SetFlags:
+            config.flags = command.argument;
+            break;
+        case SetTriggerMask:
+            config.triggerMask = command.argument;
+            break;
+        case SetTriggerValues:
+            config.triggerValues = command.argument;
+            break;
+        case Reset:
+            config = Config();
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+Replies
+*/
+std::string SumpTransformer::idReply() const {
+    return "1ALS";
+}
+
+std::string SumpTransformer::metadataReply(const std::string& name, uint32_t sampleMemory,
+                                           uint32_t maxSampleRate, uint8_t probes) const {
+    std::string out;
+    out += (char)0x01;
+    out += name;
+    out += '\0';
+    out += (char)0x21;
+    putBe32(out, sampleMemory);
+    out += (char)0x23;
+    putBe32(out, maxSampleRate);
+    out += (char)0x40;
+    out += (char)probes;
+    out += (char)0x41;
+    out += (char)0x02;
+    out += (char)0x00;
+    return out;
+}
+
+LogicCaptureOptions SumpTransformer::captureOptions(const Config& config, uint32_t maxDepth) const {
+    LogicCaptureOptions options;
+    options.depth = std::min(config.readCount, maxDepth);
+    uint32_t after = std::min(config.delayCount, options.depth);
+    options.preTrigger = options.depth - after;
+
+    // Stage 0 parallel trigger on the 8 channels
+    options.trigger.patternMask = (uint8_t)config.triggerMask;
+    options.trigger.patternValue = (uint8_t)(config.triggerValues & config.triggerMask);
+    return options;
+}
+
+void SumpTransformer::sendSamples(const uint8_t* samples, uint32_t count, const Config& config,
+                                  const Writer& write) const {
+    uint8_t groups = groupCount(config.flags);
+    if (groups == 0) return;
+
+    // Group 0 carries the channels, the others read 0
+    bool firstGroup = !(config.flags & (1u << 2));
+    std::string out;
+    out.reserve(ChunkSize + 4);
+
+    // Newest first, missing samples padded with 0
+    for (uint32_t sent = 0; sent < config.readCount; ++sent) {
+        uint8_t value = 0;
+        if (firstGroup && sent < count) value = samples[count - 1 - sent];
+        out += (char)value;
+        if (groups > 1) out.append(groups - 1, '\0');
+        if (out.size() >= ChunkSize) {
+            write(out);
+            out.clear();
+        }
+    }
+    if (!out.empty()) write(out);
+}
+
+uint8_t SumpTransformer::groupCount(uint32_t flags) {
+    uint8_t count = 0;
+    for (int group = 0; group < 4; ++group) {
+        if (!(flags & (1u << (2 + group)))) count++;
+    }
+    return count;
+}
+
+void SumpTransformer::putBe32(std::string& out, uint32_t v) {
+    out += (char)(v >> 24);
+    out += (char)(v >> 16);
+    out += (char)(v >> 8);
+    out += (char)v;
+}
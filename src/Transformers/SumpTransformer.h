@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <functional>
+#include "Managers/LogicCaptureManager.h"
+
+struct SumpCommand {
+    uint8_t opcode;
+    uint32_t argument;  // long commands only
+};
+
+// SUMP protocol, as spoken by the OpenBench Logic Sniffer client and the
+// sigrok "ols" driver. Short commands are one byte, commands with the high
+// bit set carry a 4 byte little endian argument. Captured samples are sent
+// newest first, one byte per enabled channel group.
+
+class SumpTransformer {
+public:
+    using Writer = std::function<void(const std::string& chunk)>;
+
+    static constexpr uint8_t Reset = 0x00;
+    static constexpr uint8_t Run = 0x01;
+    static constexpr uint8_t QueryId = 0x02;
+    static constexpr uint8_t QueryMetadata = 0x04;
+    static constexpr uint8_t XOn = 0x11;
+    static constexpr uint8_t XOff = 0x13;
+    static constexpr uint8_t SetDivider = 0x80;
+    static constexpr uint8_t SetReadDelayCount = 0x81;
+    static constexpr uint8_t SetFlags = 0x82;
+    static constexpr uint8_t SetTriggerMask = 0xC0;
+    static constexpr uint8_t SetTriggerValues = 0xC1;
+    static constexpr uint8_t SetTriggerConfig = 0xC2;
+
+    static constexpr uint32_t BaseClock = 100000000;  // divider reference
+    static constexpr size_t ChunkSize = 1024;
+
+    struct Config {
+        uint32_t sampleRate = 1000000;
+        uint32_t readCount = 4096;      // samples sent back
+        uint32_t delayCount = 4096;     // samples after the trigger
+        uint32_t flags = 0;
+        uint32_t triggerMask = 0;
+        uint32_t triggerValues = 0;
+    };
+
+    // True when byte completes a command
+    bool feed(uint8_t byte, SumpCommand& out);
+    void resetParser() { pendingLength = 0; }
+
+    // No long command partly received
+    bool idle() const { return pendingLength == 0; }
+
+    // Settings commands, others are left to the caller
+    void apply(const SumpCommand& command, Config& config) const;
+
+    // "1ALS"
+    std::string idReply() const;
+
+    // Name, sample memory, max sample rate, probe count, protocol version 2
+    std::string metadataReply(const std::string& name, uint32_t sampleMemory,
+                              uint32_t maxSampleRate, uint8_t probes) const;
+
+    // Depth and trigger of the requested capture, depth limited to maxDepth
+    LogicCaptureOptions captureOptions(const Config& config, uint32_t maxDepth) const;
+
+    // readCount samples newest first, missing samples sent as 0
+    void sendSamples(const uint8_t* samples, uint32_t count, const Config& config, const Writer& write) const;
+
+    // Bytes per sample for the enabled groups
+    static uint8_t groupCount(uint32_t flags);
+
+private:
+    uint8_t pending[5];
+    uint8_t pendingLength = 0;
+
+    static void putBe32(std::string& out, uint32_t v);
+};
@@ -0,0 +1,112 @@
+#include "WifiSniffTransformer.h"
+#include "PcapTransformer.h"
+#include <cstdio>
+
+/*
+Text
+*/
+std::string WifiSniffTransformer::toLine(const WifiSniffRecord& record) const {
+    uint8_t type = record.type();
+    uint8_t subtype = record.subtype();
+
+    std::string line = "CH:" + std::to_string(record.channel) +
+                       " RSSI:" + std::to_string(record.rssi) +
+                       " Type:" + frameTypeName(type, subtype);
+
+    // Add SSID if possible
+    if (type == 0 && (subtype == 8 || subtype == 4)) {
+        std::string ssid = parseSsid(record.frame, record.captured, type, subtype);
+        if (!ssid.empty()) {
+            line += " SSID:\"" + ssid + "\"";
+        }
+    }
+
+    const uint8_t* mac = record.addr2();
+    if (mac) line += " MAC:" + formatMac(mac);
+
+    return line;
+}
+
+std::string WifiSniffTransformer::frameTypeName(uint8_t type, uint8_t subtype) {
+    if (type == 0) {
+        switch (subtype) {
+            case 0:  return "Assoc Req";
+            case 1:  return "Assoc Resp";
+            case 4:  return "Probe Req";
+            case 5:  return "Probe Resp";
+            case 8:  return "Beacon";
+            case 10: return "Disassoc";
+            case 11: return "Auth";
+            case 12: return "Deauth";
+            default: return "Mgmt/" + std::to_string(subtype);
+        }
+    } else if (type == 1) {
+        return "Ctrl/" + std::to_string(subtype);
+    } else if (type == 2) {
+        if (subtype == 0) return "Data";
+        if (subtype == 4) return "Null Data";
+        return "Data/" + std::to_string(subtype);
+    }
+    return "Unknown";
+}
+
+std::string WifiSniffTransformer::parseSsid(const uint8_t* frame, int len, uint8_t type, uint8_t subtype) {
+    int offset = 24;
+    if (type == 0 && subtype == 8) offset = 36;
+
+    while (offset + 2 <= len) {
+        uint8_t id = frame[offset];
+        uint8_t elen = frame[offset + 1];
+        if (offset + 2 + elen > len) break;
+
+        if (id == 0) {
+            return std::string(reinterpret_cast<const char*>(frame + offset + 2), elen);
+        }
+
+        offset += 2 + elen;
+    }
+
+    return "";
+}
+
+std::string WifiSniffTransformer::formatMac(const uint8_t* mac) {
+    char buf[18];
+    snprintf(buf, sizeof(buf), "%02X:%02X:%02X:%02X:%02X:%02X",
+             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    return std::string(buf);
+}
+
+uint16_t WifiSniffTransformer::channelToMhz(uint8_t channel) {
+    if (channel == 14) return 2484;
+    if (channel >= 1 && channel <= 13) return 2407 + 5 * channel;
+    return 5000 + 5 * channel; // 5 GHz numbering
+}
+
+/*
+PCAP
+*/
+std::string WifiSniffTransformer::pcapHeader() const {
+    return PcapTransformer::header(PcapLinkType, WIFI_SNIFF_SNAPLEN + RadiotapSize);
+}
+
+void WifiSniffTransformer::appendPcapRecord(std::string& out, const WifiSniffRecord& record) const {
+    uint32_t captured = record.captured;
+    uint32_t length = record.length;
+
+    PcapTransformer::appendRecordHeader(out, record.timestampUs,
+                                        captured + RadiotapSize, length + RadiotapSize);
+
+    // Radiotap: flags, channel, antenna signal
+    out.push_back(0);                    // version
+    out.push_back(0);                    // pad
+    PcapTransformer::putLe16(out, RadiotapSize);
+    PcapTransformer::putLe32(out, (1u << 1) | (1u << 3) | (1u << 5));
+    out.push_back(0);                    // flags, FCS already stripped
+    out.push_back(0);                    // align channel on 2 bytes
+    PcapTransformer::putLe16(out, channelToMhz(record.channel));
+    PcapTransformer::putLe16(out, record.channel > 14 ? 0x0100 : 0x0080); // 5 GHz / 2 GHz spectrum
+    out.push_back((char)record.rssi);
+    out.push_back(0);                    // pad to RadiotapSize
+
+    out.append(reinterpret_cast<const char*>(record.frame), captured);
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include "Models/WifiSniffRecord.h"
+
+// Consumer side decoding of captured 802.11 frames:
+// one line summaries for the terminal and PCAP (radiotap + 802.11) export.
+
+class WifiSniffTransformer {
+public:
+    // "CH:6 RSSI:-52 Type:Beacon SSID:"home" MAC:AA:BB:CC:DD:EE:FF"
+    std::string toLine(const WifiSniffRecord& record) const;
+
+    // PCAP global header, linktype 127 (IEEE802_11_RADIOTAP)
+    std::string pcapHeader() const;
+
+    // Append one PCAP record (record header, radiotap header, frame)
+    void appendPcapRecord(std::string& out, const WifiSniffRecord& record) const;
+
+    static std::string frameTypeName(uint8_t type, uint8_t subtype);
+    static std::string parseSsid(const uint8_t* frame, int len, uint8_t type, uint8_t subtype);
+    static std::string formatMac(const uint8_t* mac);
+    static uint16_t channelToMhz(uint8_t channel);
+
+    static constexpr uint32_t PcapLinkType = 127;
+    static constexpr size_t RadiotapSize = 16;
+};
@@ -0,0 +1,29 @@
+#include "XmodemTransformer.h"
+#include <cstring>
+
+size_t XmodemTransformer::buildPacket(uint8_t blockNumber, const uint8_t* data, size_t len, uint8_t* out) const {
+    if (len > PayloadSize) len = PayloadSize;
+
+    out[0] = STX;
+    out[1] = blockNumber;
+    out[2] = (uint8_t)(255 - blockNumber);
+    memcpy(out + 3, data, len);
+    memset(out + 3 + len, PAD, PayloadSize - len);
+
+    uint16_t crc = crc16(out + 3, PayloadSize);
+    out[3 + PayloadSize] = (uint8_t)(crc >> 8);
+    out[4 + PayloadSize] = (uint8_t)(crc & 0xFF);
+
+    return PacketSize;
+}
+
+uint16_t XmodemTransformer::crc16(const uint8_t* data, size_t len) {
+    uint16_t crc = 0;
+    for (size_t i = 0; i < len; ++i) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int k = 0; k < 8; ++k) {
+            crc = (crc & 0x8000) ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// XMODEM-1K framing (CRC variant) for binary transfers over the terminal.
+// Packet: STX, block number, 255 - block number, 1024 data bytes padded
+// with SUB, CRC-16/XMODEM big endian.
+
+class XmodemTransformer {
+public:
+    static constexpr uint8_t SOH = 0x01;
+    static constexpr uint8_t STX = 0x02;
+    static constexpr uint8_t EOT = 0x04;
+    static constexpr uint8_t ACK = 0x06;
+    static constexpr uint8_t NAK = 0x15;
+    static constexpr uint8_t CAN = 0x18;
+    static constexpr uint8_t PAD = 0x1A;
+    static constexpr uint8_t CRC_REQUEST = 'C';
+
+    static constexpr size_t PayloadSize = 1024;
+    static constexpr size_t PacketSize = PayloadSize + 5;
+
+    // Build the packet for up to PayloadSize bytes into out, returns PacketSize
+    size_t buildPacket(uint8_t blockNumber, const uint8_t* data, size_t len, uint8_t* out) const;
+
+    // CRC-16/XMODEM, poly 0x1021, init 0
+    static uint16_t crc16(const uint8_t* data, size_t len);
+};
@@ -0,0 +1,461 @@
+// Copyright 2005 John S. Fine, see IrpEncoder.h
+
+#include "IrpEncoder.h"
+#include "MakeHex.h"
+
+namespace {
+constexpr size_t ProtocolCount = sizeof(protocolDefinitions) / sizeof(protocolDefinitions[0]);
+
+unsigned int reverseBits(unsigned int n) {
+    n = ((n & 0x55555555) << 1) + ((n >> 1) & 0x55555555);
+    n = ((n & 0x33333333) << 2) + ((n >> 2) & 0x33333333);
+    n = ((n & 0xF0F0F0F)  << 4) + ((n >> 4) & 0xF0F0F0F);
+    n = ((n & 0xFF00FF)   << 8) + ((n >> 8) & 0xFF00FF);
+    return (n >> 16) + (n << 16);
+}
+
+unsigned int bitMask(int bits) {
+    return bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1;
+}
+}
+
+/*
+Generator, IRP::generate and IRP::genHex over the compiled tables
+*/
+template <typename T>
+class IrpGenerator {
+public:
+    using Node = IrpEncoder::Node;
+    using Item = IrpEncoder::Item;
+    using Pattern = IrpEncoder::Pattern;
+    using Program = IrpEncoder::Program;
+
+    struct Value {
+        double val;
+        int bits;
+    };
+
+    IrpGenerator(const IrpEncoder& encoder, const Program& program, const int* values, bool dropS, T* out, size_t max)
+        : e(encoder), p(program), values(values), dropS(dropS), out(out), max(max) {}
+
+    size_t run() {
+        cumulative = 0.0;
+        pendingBits = p.msb ? 1 : p.bitGroup;
+        runPattern(p.form);
+        if (cumulative < p.messageTime) emit(cumulative - p.messageTime);
+        if (count & 1) emit(-1.0);
+        return count > max ? 0 : count;
+    }
+
+private:
+    const IrpEncoder& e;
+    const Program& p;
+    const int* values;
+    bool dropS;
+    T* out;
+    size_t max;
+    size_t count = 0;
+    float last = 0;
+    double cumulative = 0;
+    int pendingBits = 0;
+
+    void store() {
+        if (count <= max) out[count - 1] = static_cast<T>(last);
+    }
+
+    void emit(float number) {
+        if (number == 0.0) return;
+        if (number > 0) {
+            cumulative += number;
+            if (count & 1) last += number;
+            else { count++; last = number; }
+            store();
+        } else if (count) {
+            cumulative -= number;
+            if (count & 1) { count++; last = -number; }
+            else last -= number;
+            store();
+        }
+    }
+
+    Value eval(int16_t index) const {
+        const Node& n = e.nodes[index];
+        Value r, v2;
+        switch (n.op) {
+            case IrpEncoder::Num:
+                return {n.value, 0};
+            case IrpEncoder::Var:
+                if (n.a >= 0 && !(dropS && n.var == 'S' - 'A')) return eval(n.a);
+                return {(double)values[n.var], 0};
+            case IrpEncoder::Neg:
+                r = eval(n.a);
+                r.val = -r.val;
+                if (r.bits > 0) r.bits = 0;
+                return r;
+            case IrpEncoder::Not:
+                r = eval(n.a);
+                r.val = -(r.val + 1);
+                if (r.bits > 0) r.val = (double)(((int)r.val) & bitMask(r.bits));
+                return r;
+            case IrpEncoder::Milli:
+                r = eval(n.a);
+                r.val *= 1000;
+                r.bits = -1;
+                return r;
+            case IrpEncoder::Micro:
+                r = eval(n.a);
+                r.bits = -1;
+                return r;
+            case IrpEncoder::Mul:
+            case IrpEncoder::Add:
+            case IrpEncoder::Sub:
+                r = eval(n.a);
+                v2 = eval(n.b);
+                if (n.op == IrpEncoder::Mul) r.val *= v2.val;
+                else if (n.op == IrpEncoder::Add) r.val += v2.val;
+                else r.val -= v2.val;
+                if (r.bits > 0) r.bits = 0;
+                return r;
+            case IrpEncoder::Xor:
+                r = eval(n.a);
+                v2 = eval(n.b);
+                r.val = ((int)r.val) ^ ((int)v2.val);
+                if (r.bits > 0 && (v2.bits <= 0 || v2.bits > r.bits)) r.bits = v2.bits;
+                return r;
+            case IrpEncoder::Field:
+                r = eval(n.a);
+                v2 = eval(n.b);
+                r.bits = v2.val;
+                if (n.c >= 0) r.val = (double)(((int)r.val) >> ((int)eval(n.c).val));
+                if (r.bits < 0) {
+                    r.bits = -r.bits;
+                    r.val = (double)(reverseBits((int)r.val) >> (32 - r.bits));
+                }
+                r.val = (double)(((int)r.val) & bitMask(r.bits));
+                return r;
+        }
+        return {0, 0};
+    }
+
+    int runPattern(int16_t id) {
+        if (id < 0) return -1;
+        const Pattern& pattern = e.patterns[id];
+        int result = pattern.leadingSection ? 0 : -1;
+
+        for (uint16_t i = 0; i < pattern.count; ++i) {
+            const Item& item = e.items[pattern.first + i];
+            switch (item.kind) {
+                case IrpEncoder::Prefix:
+                    runPattern((result >= 0 && p.rPrefix >= 0) ? p.rPrefix : p.prefix);
+                    break;
+                case IrpEncoder::Suffix:
+                    runPattern((result >= 0 && p.rSuffix >= 0) ? p.rSuffix : p.suffix);
+                    if (cumulative < p.messageTime) emit(cumulative - p.messageTime);
+                    break;
+                case IrpEncoder::PadTo: {
+                    Value v = eval(item.expr);
+                    if (v.bits == 0) v.val *= p.timeBase;
+                    if (cumulative < v.val) emit(cumulative - v.val);
+                    break;
+                }
+                case IrpEncoder::Value: {
+                    Value v = eval(item.expr);
+                    if (v.bits == 0) v.val *= p.timeBase;
+                    if (v.bits <= 0) emit(v.val);
+                    else emitBits(v);
+                    break;
+                }
+            }
+
+            if (item.sectionEnd) {
+                if (cumulative < p.messageTime) emit(cumulative - p.messageTime);
+                if (count & 1) emit(-1.0);
+                result = (int)count;
+                cumulative = 0.0;
+            }
+        }
+        return result;
+    }
+
+    void emitBits(Value v) {
+        int number = (int)v.val;
+        if (p.msb) number = reverseBits(number) >> (32 - v.bits);
+        while (--v.bits >= 0) {
+            if (p.msb) {
+                pendingBits = (pendingBits << 1) + (number & 1);
+                if (pendingBits & p.bitGroup) {
+                    runPattern(p.digits[pendingBits - p.bitGroup]);
+                    pendingBits = 1;
+                }
+            } else {
+                pendingBits = (pendingBits >> 1) + (number & 1) * p.bitGroup;
+                if (pendingBits & 1) {
+                    runPattern(p.digits[pendingBits >> 1]);
+                    pendingBits = p.bitGroup;
+                }
+            }
+            number >>= 1;
+        }
+    }
+};
+
+/*
+Lookup
+*/
+IrpEncoder::IrpEncoder() : programs(ProtocolCount) {
+    memset(hashTable, 0, sizeof(hashTable));
+    for (size_t i = 0; i < ProtocolCount; ++i) {
+        size_t slot = hash(protocolDefinitions[i].name) % HashSize;
+        while (hashTable[slot]) slot = (slot + 1) % HashSize;
+        hashTable[slot] = (uint8_t)(i + 1);
+    }
+}
+
+uint32_t IrpEncoder::hash(const char* name) {
+    uint32_t h = 2166136261u;   // FNV-1a
+    while (*name) {
+        h ^= (uint8_t)*name++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+int IrpEncoder::findProtocol(const char* name) const {
+    size_t slot = hash(name) % HashSize;
+    while (hashTable[slot]) {
+        int index = hashTable[slot] - 1;
+        if (strcmp(protocolDefinitions[index].name, name) == 0) return index;
+        slot = (slot + 1) % HashSize;
+    }
+    return -1;
+}
+
+IrpEncoder::Resolved IrpEncoder::resolve(const char* name) const {
+    Resolved r;
+    r.known = true;
+    r.index = findProtocol(name);
+    if (r.index >= 0) return r;
+
+    // Special protocols, same rules as encodeRemoteCommand
+    char upper[100];
+    strncpy(upper, name, sizeof(upper));
+    upper[sizeof(upper) - 1] = '\0';
+    for (char* c = upper; *c; ++c) *c = toupper(*c);
+
+    int m = 0, l = 0;
+    if (sscanf(upper, "RC6-%d-%d", &m, &l) == 2) {
+        r.index = findProtocol("rc6-M-L");
+        r.m = m;
+        r.l = l;
+        r.rc6ml = true;
+    } else if (strcmp("NEC", upper) == 0) {
+        r.index = findProtocol("nec2");
+    } else if (strcmp("NECX", upper) == 0) {
+        r.index = findProtocol("NECx2");
+    }
+
+    // NEC2 by default, it sends the full frame on repeats
+    if (r.index < 0) {
+        r.index = findProtocol("nec2");
+        r.rc6ml = false;
+    }
+    return r;
+}
+
+/*
+Compile
+*/
+const IrpEncoder::Program* IrpEncoder::program(int index) {
+    if (index < 0 || index >= (int)programs.size()) return nullptr;
+    Program& p = programs[index];
+    if (!p.compiled) compile(index, p);
+    return p.valid ? &p : nullptr;
+}
+
+void IrpEncoder::compile(int index, Program& p) {
+    p.compiled = true;
+
+    const char* def = protocolDefinitions[index].def;
+    const char* freq = strstr(def, "Frequency=");
+    if (freq) {
+        int hz;
+        if (sscanf(freq, "Frequency=%d", &hz) == 1) p.frequencyKhz = hz / 1000;
+    }
+
+    std::vector<char> text(def, def + strlen(def) + 1);
+    IRP irp;
+    if (!irp.readIrpString(text.data())) return;
+
+    p.timeBase = irp.m_timeBase;
+    p.messageTime = irp.m_messageTime;
+    p.msb = irp.m_msb;
+    p.bitGroup = irp.m_bitGroup;
+    p.prefix = compilePattern(irp, irp.m_prefix);
+    p.suffix = compilePattern(irp, irp.m_suffix);
+    p.rPrefix = compilePattern(irp, irp.m_rPrefix);
+    p.rSuffix = compilePattern(irp, irp.m_rSuffix);
+    for (int d = 0; d < 16; ++d) p.digits[d] = compilePattern(irp, irp.m_digits[d]);
+    p.form = compilePattern(irp, irp.m_form);
+    p.valid = p.form >= 0;
+}
+
+int16_t IrpEncoder::addNode(Op op, int16_t a, int16_t b, int16_t c, double value, uint8_t var) {
+    nodes.push_back({op, var, a, b, c, value});
+    return (int16_t)(nodes.size() - 1);
+}
+
+// IRP::parseVal, building nodes instead of values
+int16_t IrpEncoder::compileValue(const IRP& irp, const char*& in, int prec) {
+    int16_t node;
+    if (*in >= 'A' && *in <= 'Z') {
+        int ndx = *(in++) - 'A';
+        int16_t definition = -1;
+        if (irp.m_def[ndx]) {
+            const char* in2 = irp.m_def[ndx];
+            definition = compileValue(irp, in2, 0);
+        }
+        node = addNode(Var, definition, -1, -1, 0, (uint8_t)ndx);
+    } else if (*in >= '0' && *in <= '9') {
+        double val = 0.0;
+        do {
+            val = val * 10 + *(in++) - '0';
+        } while (*in >= '0' && *in <= '9');
+        node = addNode(Num, -1, -1, -1, val);
+    } else switch (*in) {
+        case '-':
+            ++in;
+            node = addNode(Neg, compileValue(irp, in, 1));
+            break;
+        case '~':
+            ++in;
+            node = addNode(Not, compileValue(irp, in, 1));
+            break;
+        case '(':
+            ++in;
+            node = compileValue(irp, in, 0);
+            if (*in == ')') ++in;
+            break;
+        default:
+            node = addNode(Num);
+            break;
+    }
+
+    if (*in == 'M') {
+        node = addNode(Milli, node);
+        ++in;
+    } else if (*in == 'U') {
+        node = addNode(Micro, node);
+        ++in;
+    }
+
+    for (;;) {
+        if (prec < 2 && *in == '*') {
+            ++in;
+            int16_t rhs = compileValue(irp, in, 2);
+            node = addNode(Mul, node, rhs);
+            continue;
+        }
+        if (prec < 1 && (*in == '+' || *in == '-' || *in == '^')) {
+            Op op = *in == '+' ? Add : (*in == '-' ? Sub : Xor);
+            ++in;
+            int16_t rhs = compileValue(irp, in, 1);
+            node = addNode(op, node, rhs);
+            continue;
+        }
+        if (prec < 3 && *in == ':') {
+            ++in;
+            int16_t bits = compileValue(irp, in, 3);
+            int16_t shift = -1;
+            if (*in == ':') {
+                ++in;
+                shift = compileValue(irp, in, 3);
+            }
+            node = addNode(Field, node, bits, shift);
+            continue;
+        }
+        break;
+    }
+    return node;
+}
+
+// The item list IRP::genHex walks through
+int16_t IrpEncoder::compilePattern(const IRP& irp, const char* in) {
+    if (!in) return -1;
+
+    Pattern pattern = {(uint16_t)items.size(), 0, false};
+    if (*in == ';') {
+        pattern.leadingSection = true;
+        in++;
+    }
+    while (*in) {
+        Item item = {Value, false, -1};
+        if (*in == '*') {
+            item.kind = Prefix;
+            in++;
+        } else if (*in == '_') {
+            item.kind = Suffix;
+            in++;
+        } else if (*in == '^') {
+            in++;
+            item.kind = PadTo;
+            item.expr = compileValue(irp, in, 0);
+        } else {
+            item.expr = compileValue(irp, in, 0);
+        }
+
+        item.sectionEnd = *in == ';';
+        items.push_back(item);
+        pattern.count++;
+        if (!item.sectionEnd && *in != ',') break;
+        in++;
+    }
+
+    patterns.push_back(pattern);
+    return (int16_t)(patterns.size() - 1);
+}
+
+/*
+Encode
+*/
+template <typename T>
+size_t IrpEncoder::encodeResolved(const InfraredCommand& cmd, const Resolved& r, T* out, size_t max, int& frequency) {
+    const Program* p = program(r.index);
+    if (!p) return 0;
+    if (p->frequencyKhz >= 0) frequency = p->frequencyKhz;
+
+    int values[26] = {0};
+    values['D' - 'A'] = cmd.getDevice();
+    values['S' - 'A'] = cmd.getSubdevice();
+    values['F' - 'A'] = cmd.getFunction();
+    values['N' - 'A'] = -1;
+    if (r.rc6ml) {
+        values['M' - 'A'] = r.m;
+        values['L' - 'A'] = r.l;
+    }
+
+    // Device=D.S in the IRP drops the default of S
+    IrpGenerator<T> generator(*this, *p, values, cmd.getSubdevice() >= 0, out, max);
+    return generator.run();
+}
+
+size_t IrpEncoder::encode(const InfraredCommand& cmd, const char* protocolName, float* out, size_t max, int& frequency) {
+    return encodeResolved(cmd, resolve(protocolName), out, max, frequency);
+}
+
+size_t IrpEncoder::encode(const InfraredCommand& cmd, const char* protocolName, uint16_t* out, size_t max, int& frequency) {
+    return encodeResolved(cmd, resolve(protocolName), out, max, frequency);
+}
+
+size_t IrpEncoder::encode(const InfraredCommand& cmd, float* out, size_t max, int& frequency) {
+    size_t e = (size_t)cmd.getProtocol();
+    if (e >= EnumCount) return 0;
+    if (!byEnum[e].known) byEnum[e] = resolve(InfraredProtocolMapper::toString(cmd.getProtocol()).c_str());
+    return encodeResolved(cmd, byEnum[e], out, max, frequency);
+}
+
+size_t IrpEncoder::encode(const InfraredCommand& cmd, uint16_t* out, size_t max, int& frequency) {
+    size_t e = (size_t)cmd.getProtocol();
+    if (e >= EnumCount) return 0;
+    if (!byEnum[e].known) byEnum[e] = resolve(InfraredProtocolMapper::toString(cmd.getProtocol()).c_str());
+    return encodeResolved(cmd, byEnum[e], out, max, frequency);
+}
@@ -0,0 +1,112 @@
+/*
+
+    Compiled form of the MakeHex IRP encoder (MakeHex.h), by John Fine.
+    The IRP grammar is read once per protocol with IRP::readIrpString, the
+    expressions and patterns are compiled to tables, then every send only
+    evaluates them, with the same float/double arithmetic as IRP::generate.
+
+*/
+
+// Copyright 2005 John S. Fine
+
+// You may use, copy, modify and/or distribute this program for private or commercial use provided that:
+// 1) You do not hold me responsible for any damage or negative consequences resulting from those activities.
+// 2) You include this copyright notice and disclaimer in any copy of any part or all of this program.
+// I do not provide any warranty of the correctness, safety, or suitibility of this program for any purpose.
+// If you do not agree to these conditions, you have no permission to use, copy, modify or distribute this program.
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <Models/InfraredCommand.h>
+#include <Enums/InfraredProtocolEnum.h>
+
+class IRP;
+
+class IrpEncoder {
+public:
+    static constexpr size_t MaxTimings = 256;
+
+    IrpEncoder();
+
+    // Mark/space durations in microseconds, written to out, 0 if unknown or
+    // more than max. frequency is set in kHz when the protocol defines one.
+    size_t encode(const InfraredCommand& cmd, float* out, size_t max, int& frequency);
+    size_t encode(const InfraredCommand& cmd, uint16_t* out, size_t max, int& frequency);
+
+    // Same with the protocol name, resolved like encodeRemoteCommand
+    size_t encode(const InfraredCommand& cmd, const char* protocolName, float* out, size_t max, int& frequency);
+    size_t encode(const InfraredCommand& cmd, const char* protocolName, uint16_t* out, size_t max, int& frequency);
+
+    // Index in protocolDefinitions, -1 if unknown
+    int findProtocol(const char* name) const;
+
+private:
+    enum Op : uint8_t { Num, Var, Neg, Not, Milli, Micro, Mul, Add, Sub, Xor, Field };
+    enum Kind : uint8_t { Prefix, Suffix, PadTo, Value };
+
+    struct Node {
+        Op op;
+        uint8_t var;
+        int16_t a, b, c;    // operands, -1 none; a of Var is the definition
+        double value;
+    };
+
+    struct Item {
+        Kind kind;
+        bool sectionEnd;    // followed by ';'
+        int16_t expr;
+    };
+
+    struct Pattern {
+        uint16_t first;
+        uint16_t count;
+        bool leadingSection; // starts with ';', the single part is empty
+    };
+
+    struct Program {
+        bool compiled = false;
+        bool valid = false;
+        int frequencyKhz = -1;
+        int timeBase = 1;
+        int messageTime = 0;
+        bool msb = false;
+        int bitGroup = 2;
+        int16_t form = -1, prefix = -1, suffix = -1, rPrefix = -1, rSuffix = -1;
+        int16_t digits[16];
+    };
+
+    // Protocol picked for a name, with the rc6-M-L parameters
+    struct Resolved {
+        bool known = false;
+        int16_t index = -1;
+        int16_t m = 0, l = 0;
+        bool rc6ml = false;
+    };
+
+    static constexpr size_t HashSize = 128;
+    static constexpr size_t EnumCount = RAW + 1;
+
+    uint8_t hashTable[HashSize];        // protocol index + 1, 0 empty
+    std::vector<Program> programs;
+    std::vector<Node> nodes;
+    std::vector<Item> items;
+    std::vector<Pattern> patterns;
+    Resolved byEnum[EnumCount];
+
+    static uint32_t hash(const char* name);
+    Resolved resolve(const char* name) const;
+    const Program* program(int index);
+    void compile(int index, Program& p);
+    int16_t compileValue(const IRP& irp, const char*& in, int prec);
+    int16_t compilePattern(const IRP& irp, const char* pattern);
+    int16_t addNode(Op op, int16_t a = -1, int16_t b = -1, int16_t c = -1, double value = 0, uint8_t var = 0);
+
+    template <typename T>
+    size_t encodeResolved(const InfraredCommand& cmd, const Resolved& r, T* out, size_t max, int& frequency);
+
+    template <typename T>
+    friend class IrpGenerator;
+};
@@ -27,7 +27,8 @@ std::vector<float> encodeRemoteCommand(const InfraredCommand& cmd, const char* p
     // https://github.com/probonopd/MakeHex/tree/master
     // By John Fine
 
-    char irp[512] = ""; // IRP string, will contains all necessary infos to generate the IR sequence
+    const int protocolCount = sizeof(protocolDefinitions) / sizeof(protocolDefinitions[0]);
+    char irp[1024] = ""; // IRP string, will contains all necessary infos to generate the IR sequence
 
     // Device
     if (cmd.getSubdevice() >= 0)
@@ -37,7 +38,7 @@ std::vector<float> encodeRemoteCommand(const InfraredCommand& cmd, const char* p
 
     // Protocol
     int p = -1;
-    for (int i = 0; i < 62; i++) {
+    for (int i = 0; i < protocolCount; i++) {
         if (strcmp(protocolString, protocolDefinitions[i].name) == 0) {
             p = i;
             break;
@@ -65,7 +66,7 @@ std::vector<float> encodeRemoteCommand(const InfraredCommand& cmd, const char* p
         }
 
         // Search again for protocol
-        for (int i = 0; i < 62; i++) {
+        for (int i = 0; i < protocolCount; i++) {
             if (strcmp(protocolString, protocolDefinitions[i].name) == 0) {
                 p = i;
                 break;
@@ -76,7 +77,7 @@ std::vector<float> encodeRemoteCommand(const InfraredCommand& cmd, const char* p
         // NEC2 for reliabity which continuously sends the full command frame
         if (p < 0) {
             protocolString = "nec2";
-            for (int i = 0; i < 62; i++) {
+            for (int i = 0; i < protocolCount; i++) {
                 if (strcmp(protocolString, protocolDefinitions[i].name) == 0) {
                     p = i;
                     break;
@@ -42,6 +42,8 @@ public:
     void generate(int* s, int* r, float* raw);
 
 private:
+    friend class IrpEncoder;
+
     struct Value {
         double m_val;
         int m_bits;
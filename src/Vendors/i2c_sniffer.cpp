@@ -32,10 +32,13 @@
 
 #include "i2c_sniffer.h"
 #include <Arduino.h>
+#include <atomic>
 #include "driver/gpio.h"
+#include "Buffers/SpscRingBuffer.h"
 
-// --- Minimal internal notes (added): ISR pushes compact events into an event ring.
-// The main context converts events into ASCII and exposes them via read()/available().
+// --- Minimal internal notes (added): ISR pushes timestamped events into a
+// lock-free ring, a full ring drops the new event and counts it. The main
+// context reads them in bulk with i2c_sniffer_read_events().
 
 static uint8_t sniffer_scl_pin = 1; // override by i2c_sniffer_begin()
 static uint8_t sniffer_sda_pin = 2;
@@ -43,34 +46,11 @@ static uint8_t sniffer_sda_pin = 2;
 #define I2C_IDLE 0
 #define I2C_TRX  2
 
-// ---- Event tags (4 bits) ----
-#define TAG_START 0x1
-#define TAG_STOP  0x2
-#define TAG_DATA  0x3
-#define TAG_ADDR  0x4
-#define TAG_ACK   0x5
-
-static inline uint16_t PACK_EVENT(uint16_t tag, uint16_t value) {
-    return (uint16_t)((tag << 12) | (value & 0x0FFF));
-}
-static inline uint8_t  EVENT_TAG(uint16_t ev) { return (uint8_t)((ev >> 12) & 0x0F); }
-static inline uint16_t EVENT_VAL(uint16_t ev) { return (uint16_t)(ev & 0x0FFF); }
-
 // ---- Event ring (ISR -> main) ----
-#define EVENT_RING_ORDER 11
-#define EVENT_RING_SIZE  (1u << EVENT_RING_ORDER)   // 2048 events
-#define EVENT_RING_MASK  (EVENT_RING_SIZE - 1u)
-static volatile uint16_t eventRing[EVENT_RING_SIZE];
-static volatile uint16_t eventW = 0;
-static volatile uint16_t eventR = 0;
-
-// ---- Output char ring (main -> user read()) ----
-#define CHAR_RING_ORDER 13
-#define CHAR_RING_SIZE  (1u << CHAR_RING_ORDER)     // 8192 chars
-#define CHAR_RING_MASK  (CHAR_RING_SIZE - 1u)
-static volatile char charRing[CHAR_RING_SIZE];
-static volatile uint16_t charW = 0;
-static volatile uint16_t charR = 0;
+#define EVENT_RING_SIZE 2048
+static SpscRingBuffer<I2cSnifferEvent, EVENT_RING_SIZE> eventRing;
+static std::atomic<uint32_t> eventDropped{0};
+static bool gapPending = false;     // ISR only, tags the next pushed event
 
 // ---- I2C state (ISR) ----
 static volatile uint8_t i2cStatus = I2C_IDLE;
@@ -86,13 +66,18 @@ static volatile uint16_t sdaUpCnt = 0;
 static volatile uint16_t sdaDownCnt = 0;
 
 // ---- Helpers (ISR-safe) ----
-static inline void IRAM_ATTR push_event(uint16_t ev) {
-    uint16_t next = (uint16_t)((eventW + 1u) & EVENT_RING_MASK);
-    if (next == eventR) { // full -> drop oldest
-        eventR = (uint16_t)((eventR + 1u) & EVENT_RING_MASK);
+static inline void IRAM_ATTR push_event(I2cSnifferEventType type, uint8_t value) {
+    I2cSnifferEvent ev;
+    ev.ticks = ESP.getCycleCount();
+    ev.type = type;
+    ev.value = value;
+    ev.gap = gapPending ? 1 : 0;
+    if (eventRing.push(ev)) {
+        gapPending = false;
+    } else {
+        eventDropped.fetch_add(1, std::memory_order_relaxed);
+        gapPending = true;
     }
-    eventRing[eventW] = ev;
-    eventW = next;
 }
 
 static inline uint8_t IRAM_ATTR fast_gpio_read(uint8_t pin) {
@@ -109,7 +94,7 @@ void IRAM_ATTR i2cTriggerOnRaisingSCL() {
 
     if (expectingAck) {
         uint8_t ackBit = fast_gpio_read(sniffer_sda_pin); // 0 = ACK, 1 = NACK
-        push_event(PACK_EVENT(TAG_ACK, (uint16_t)ackBit));
+        push_event(I2cSnifferEventType::Ack, ackBit);
         expectingAck = 0;
         bitCount = 0;
         currentByte = 0;
@@ -121,8 +106,7 @@ void IRAM_ATTR i2cTriggerOnRaisingSCL() {
     bitCount++;
 
     if (bitCount >= 8) {
-        uint16_t tag = (byteCountInFrame == 0) ? TAG_ADDR : TAG_DATA;
-        push_event(PACK_EVENT(tag, currentByte));
+        push_event(byteCountInFrame == 0 ? I2cSnifferEventType::Address : I2cSnifferEventType::Data, currentByte);
         byteCountInFrame++;
         expectingAck = 1;
     }
@@ -137,7 +121,7 @@ void IRAM_ATTR i2cTriggerOnChangeSDA() {
         sdaUpCnt++;
         uint8_t scl = fast_gpio_read(sniffer_scl_pin);
         if (i2cStatus != I2C_IDLE && scl == 1) {
-            push_event(PACK_EVENT(TAG_STOP, 0));
+            push_event(I2cSnifferEventType::Stop, 0);
             i2cStatus = I2C_IDLE;
             bitCount = 0;
             currentByte = 0;
@@ -147,8 +131,9 @@ void IRAM_ATTR i2cTriggerOnChangeSDA() {
     } else {
         sdaDownCnt++;
         uint8_t scl = fast_gpio_read(sniffer_scl_pin);
-        if (i2cStatus == I2C_IDLE && scl == 1) {
-            push_event(PACK_EVENT(TAG_START, 0));
+        // START, or repeated START inside a transfer
+        if (scl == 1) {
+            push_event(I2cSnifferEventType::Start, 0);
             i2cStatus = I2C_TRX;
             bitCount = 0;
             currentByte = 0;
@@ -172,9 +157,10 @@ static void reset_state_and_buffers() {
     currentByte = 0;
     byteCountInFrame = 0;
     expectingAck = 0;
-    // rings
-    eventW = eventR = 0;
-    charW  = charR  = 0;
+    // ring
+    eventRing.clear();
+    eventDropped.store(0, std::memory_order_relaxed);
+    gapPending = false;
     interrupts();
 }
 
@@ -194,110 +180,16 @@ void i2c_sniffer_stop() {
     interrupts();
 }
 
-// ---- Output char ring helpers (main context) ----
-static inline void char_push(char c) {
-    uint16_t next = (uint16_t)((charW + 1u) & CHAR_RING_MASK);
-    if (next == charR) { // full -> drop oldest
-        charR = (uint16_t)((charR + 1u) & CHAR_RING_MASK);
-    }
-    charRing[charW] = c;
-    charW = next;
+size_t i2c_sniffer_read_events(I2cSnifferEvent* out, size_t max) {
+    return eventRing.pop(out, max);
 }
 
-static void text_push_str(const char* s) {
-    while (*s) { char_push(*s++); }
+uint32_t i2c_sniffer_dropped() {
+    return eventDropped.load(std::memory_order_relaxed);
 }
 
-static void text_push_hex8(uint8_t v) {
-    const char* hex = "0123456789ABCDEF";
-    char_push('0'); char_push('x');
-    char_push(hex[(v >> 4) & 0x0F]);
-    char_push(hex[(v     ) & 0x0F]);
-}
-
-// ---- Convert pending events into ASCII (called on demand) ----
-// Format example:
-//   [S]                      (START)
-//   ADDR 0x3C W <ACK>
-//   0x00 <ACK> 0xAB <ACK>  (DATA ...)
-//   [P]\n                    (STOP + newline)
-static void pump_events_to_text() {
-    // Process a bounded number of events per call to avoid long critical sections
-    // (added) keeps latency low while ensuring steady drain.
-    const uint16_t MAX_EVENTS_PER_PUMP = 128;
-    uint16_t processed = 0;
-
-    while (processed < MAX_EVENTS_PER_PUMP) {
-        uint16_t ev;
-        noInterrupts();
-        if (eventR == eventW) { interrupts(); break; }
-        ev = eventRing[eventR];
-        eventR = (uint16_t)((eventR + 1u) & EVENT_RING_MASK);
-        interrupts();
-
-        uint8_t tag = EVENT_TAG(ev);
-        uint16_t val = EVENT_VAL(ev);
-
-        switch (tag) {
-            case TAG_START:
-                text_push_str("[S] ");
-                break;
-
-            case TAG_STOP:
-                text_push_str("[P]");
-                char_push('\r\n'); // newline to separate frames
-                break;
-
-            case TAG_ADDR: {
-                uint8_t b = (uint8_t)val;
-                uint8_t addr = (uint8_t)((b >> 1) & 0x7F);
-                uint8_t rw   = (uint8_t)(b & 0x01);
-                text_push_str("ADDR ");
-                text_push_hex8(addr);
-                char_push(' ');
-                char_push(rw ? 'R' : 'W');
-                char_push(' ');
-                break;
-            }
-
-            case TAG_DATA: {
-                uint8_t b = (uint8_t)val;
-                text_push_hex8(b);
-                char_push(' ');
-                break;
-            }
-
-            case TAG_ACK:
-                text_push_str((val == 0) ? "<ACK> " : "<NACK> ");
-                break;
-
-            default:
-                // ignore
-                break;
-        }
-        processed++;
-    }
-}
-
-bool i2c_sniffer_available() {
-    // If no chars ready, try pumping events into ASCII
-    if (charR == charW) {
-        pump_events_to_text();
-    }
-    return (charR != charW);
-}
-
-char i2c_sniffer_read() {
-    // Ensure at least one char is present
-    if (charR == charW) {
-        pump_events_to_text();
-    }
-    char out = '\0';
-    if (charR != charW) {
-        out = charRing[charR];
-        charR = (uint16_t)((charR + 1u) & CHAR_RING_MASK);
-    }
-    return out;
+uint32_t i2c_sniffer_tick_rate() {
+    return getCpuFrequencyMhz() * 1000000UL;
 }
 
 void i2c_sniffer_reset_buffer() {
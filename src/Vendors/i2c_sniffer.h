@@ -26,6 +26,7 @@
  *                   https://github.com/WhitehawkTailor/I2C-sniffer/
  */
 #include <Arduino.h>
+#include "Models/I2cSnifferEvent.h"
 
 #pragma once
 
@@ -36,10 +37,17 @@ extern "C" {
 void i2c_sniffer_begin(uint8_t scl, uint8_t sda);
 void i2c_sniffer_setup();
 void i2c_sniffer_stop();
-bool i2c_sniffer_available();
-char i2c_sniffer_read();
 void i2c_sniffer_reset_buffer();
 
+// Bulk read of timestamped events, returns the number copied into out
+size_t i2c_sniffer_read_events(I2cSnifferEvent* out, size_t max);
+
+// Events lost because the ring was full, since setup
+uint32_t i2c_sniffer_dropped();
+
+// Event tick rate in Hz (CPU cycle counter)
+uint32_t i2c_sniffer_tick_rate();
+
 #ifdef __cplusplus
 }
 #endif
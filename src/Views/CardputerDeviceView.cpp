@@ -3,8 +3,14 @@
 #include "CardputerDeviceView.h"
 
 // Reuse the M5DeviceView implementation
+void CardputerDeviceView::clear() {
+    M5DeviceView::clear();
+    SharedPanel::markDrawn();
+}
+
 void CardputerDeviceView::drawLogicTrace(uint8_t pin, const std::vector<uint8_t>& buffer) {
     M5DeviceView::drawLogicTrace(pin, buffer);
+    SharedPanel::markDrawn();
 }
 
 #endif // DEVICE_CARDPUTER
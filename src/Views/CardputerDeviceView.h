@@ -3,6 +3,7 @@
 #pragma once
 
 #include "M5DeviceView.h"
+#include "SharedPanel.h"
 
 class CardputerDeviceView : public M5DeviceView {
 public:
@@ -19,7 +20,8 @@ public:
                              const std::string& /*description2*/) override {}
     void loading() override {}
 
-    // Only this one is implemented
+    // Only these draw, on the LCD the terminal view also uses
+    void clear() override;
     void drawLogicTrace(uint8_t pin, const std::vector<uint8_t>& buffer) override;
 };
 
@@ -15,16 +15,6 @@ void CardputerTerminalView::initialize() {
     scrW = M5Cardputer.Display.width();
     scrH = M5Cardputer.Display.height();
 
-    // Sprite 1 bpp (4 KB for 240x135)
-    termSprite.setColorDepth(1); // 1 bit / pixel
-    spriteReady = termSprite.createSprite(scrW, scrH);  
-    if (spriteReady) {
-        termSprite.setPaletteColor(0, BACKGROUND_COLOR);
-        termSprite.setPaletteColor(1, TEXT_COLOR);
-        termSprite.setTextWrap(false);
-        termSprite.setTextSize(1);
-    }
-
     originX = 0;
     originY = 0;
 
@@ -54,22 +44,18 @@ void CardputerTerminalView::print(const std::string& text) {
     filtered.reserve(decoded.size());
     for (unsigned char b : decoded) {
         if (b == (unsigned char)CARDPUTER_SPECIAL_ARROW_UP) {
-            int maxScroll = (int)history.size();
-            if (scrollOffset < maxScroll) scrollOffset++;
+            cells.setScrollOffset(cells.scrollOffset() + 1);
             sawScroll = true;
             continue;
         }
         if (b == (unsigned char)CARDPUTER_SPECIAL_ARROW_DOWN) {
-            if (scrollOffset > 0) scrollOffset--;
+            cells.setScrollOffset(cells.scrollOffset() - 1);
             sawScroll = true;
             continue;
         }
 
         // Normal text, reset the scroll
-        if (scrollOffset > 0) { 
-            scrollOffset = 0; 
-            sawScroll = true;
-        }
+        if (cells.setScrollOffset(0)) sawScroll = true;
 
         filtered.push_back((char)b);
     }
@@ -119,19 +105,16 @@ void CardputerTerminalView::waitPress() {
 }
 
 void CardputerTerminalView::clear() {
-    if (spriteReady) termSprite.fillScreen(0);
-    M5Cardputer.Display.fillScreen(BACKGROUND_COLOR);
     u8_cp = 0; u8_rem = 0;
-    history.clear();
-    scrollOffset = 0;
+    cells.clearHistory();
     termReset();
-    renderAll();
+    repaintPanel();
 }
 
 // --------------------- Terminal core ---------------------
 
 void CardputerTerminalView::termReset() {
-    lines.assign(rows, std::string(cols, ' '));
+    cells.clearScreen();
     curRow = 0;
     curCol = 0;
     ansiReset();
@@ -139,7 +122,7 @@ void CardputerTerminalView::termReset() {
 
 void CardputerTerminalView::termPutChar(char c) {
     if (c >= ' ') {
-        lines[curRow][curCol] = c; // overwrite
+        cells.put(curRow, curCol, c); // overwrite
         curCol++;
         if (curCol >= cols) {
             curCol = 0;
@@ -172,43 +155,36 @@ void CardputerTerminalView::termCarriageReturn() {
 void CardputerTerminalView::termBackspace() {
     if (curCol > 0) {
         curCol--;
-        lines[curRow][curCol] = ' ';
+        cells.put(curRow, curCol, ' ');
     }
 }
 
 void CardputerTerminalView::termScrollUp() {
-    // Save to history
-    history.push_back(std::move(lines[0]));
-    if ((int)history.size() > historyMax) history.pop_front();
-
-    // Scroll
-    for (int r = 1; r < rows; ++r) lines[r - 1] = std::move(lines[r]);
-    lines[rows - 1].assign(cols, ' ');
-
-    if (scrollOffset > 0) scrollOffset++;
+    // The top line goes to the history, nothing is copied
+    cells.scrollUp();
 }
 
 void CardputerTerminalView::termEraseInLine(int mode) {
     if (mode == 0) { // cursor -> EOL
-        for (int c = curCol; c < cols; ++c) lines[curRow][c] = ' ';
+        cells.clear(curRow, curCol, cols);
     } else if (mode == 1) { // SOL -> cursor
-        for (int c = 0; c <= curCol; ++c) lines[curRow][c] = ' ';
+        cells.clear(curRow, 0, curCol + 1);
     } else if (mode == 2) { // whole line
-        lines[curRow].assign(cols, ' ');
+        cells.clear(curRow, 0, cols);
     }
 }
 
 void CardputerTerminalView::termEraseInDisplay(int mode) {
     if (mode == 2) { // all
-        for (int r = 0; r < rows; ++r) lines[r].assign(cols, ' ');
+        cells.clearScreen();
         curRow = 0; curCol = 0;
         return;
     }
     if (mode == 0) { // cursor -> end
         termEraseInLine(0);
-        for (int r = curRow + 1; r < rows; ++r) lines[r].assign(cols, ' ');
+        for (int r = curRow + 1; r < rows; ++r) cells.clear(r, 0, cols);
     } else if (mode == 1) { // start -> cursor
-        for (int r = 0; r < curRow; ++r) lines[r].assign(cols, ' ');
+        for (int r = 0; r < curRow; ++r) cells.clear(r, 0, cols);
         termEraseInLine(1);
     }
 }
@@ -302,75 +278,48 @@ void CardputerTerminalView::ansiFeed(char c) {
 
 // --------------------- Rendering ---------------------
 
-void CardputerTerminalView::drawLine(const std::string& s, int16_t y, bool keepTrailingSpaces) {
-    size_t end = s.size();
-
-    if (!keepTrailingSpaces) {
-        while (end > 0 && s[end - 1] == ' ') --end;
+void CardputerTerminalView::DisplaySurface::drawRow(int row, const char* text, int length, int span, int cursorCol) {
+    auto& display = M5Cardputer.Display;
+    int16_t y = view.originY + row * view.charH;
+
+    // Only the columns that hold text now or did before
+    display.startWrite();
+    display.fillRect(view.originX, y, span * view.charW, view.charH, BACKGROUND_COLOR);
+    if (length > 0) {
+        // The device view may have changed them on the shared LCD
+        display.setFont(&fonts::Font0);
+        display.setTextSize(1);
+        display.setTextColor(TEXT_COLOR);
+        display.setCursor(view.originX, y);
+        display.printf("%.*s", length, text);
     }
-
-    if (spriteReady) {
-        termSprite.setCursor(originX, y);
-        termSprite.printf("%.*s", (int)end, s.c_str());
-    } else {
-        M5Cardputer.Display.setCursor(originX, y);
-        M5Cardputer.Display.printf("%.*s", (int)end, s.c_str());
+    if (cursorCol >= 0) {
+        display.fillRect(view.originX + cursorCol * view.charW, y + view.charH - 2, view.charW, 2, TEXT_COLOR);
     }
+    display.endWrite();
 }
 
-void CardputerTerminalView::renderAll() {
-    if (spriteReady) {
-        termSprite.fillScreen(0);
-        termSprite.setTextColor(1);
-        termSprite.setTextSize(1);
-    } else {
-        M5Cardputer.Display.fillScreen(BACKGROUND_COLOR);
-        M5Cardputer.Display.setTextColor(TEXT_COLOR);
-        M5Cardputer.Display.setTextSize(1);
-    }
-
-    const int H = (int)history.size();
-    if (scrollOffset > H) scrollOffset = H;
-
-    // H (history) + rows (buffer)
-    const int total   = H + rows;
-    int endIdx        = total - 1 - scrollOffset;   // index virtuel
-    if (endIdx < 0) endIdx = 0;
-    int startIdx      = endIdx - (rows - 1);
-    if (startIdx < 0) startIdx = 0;
-
-    // Render lines
-    int16_t y = originY;
-    for (int i = 0; i < rows; ++i) {
-        int idx = startIdx + i;
-
-        bool isActiveBufferLine =
-            (scrollOffset == 0) && (idx >= H) && ((idx - H) == curRow);
-
-        if (idx < H) {
-            // History lines -> trim
-            drawLine(history[idx], y, /*keepTrailingSpaces=*/false);
-        } else {
-            int li = idx - H;
-            if (li >= 0 && li < rows) {
-                // Active buffer line, keep trailing spaces
-                drawLine(lines[li], y, /*keepTrailingSpaces=*/isActiveBufferLine);
-            }
-        }
-        y += charH;
-    }
+bool CardputerTerminalView::DisplaySurface::scroll(int /*lines*/) {
+    // The ST7789 scrolls along its 240 px axis, horizontal in landscape
+    return false;
+}
 
-    if (scrollOffset == 0) {
-        int16_t cx = originX + curCol * charW;
-        int16_t cy = originY + curRow * charH + charH - 2;
-        if (spriteReady) termSprite.fillRect(cx, cy, charW, 2, 1);
-        else M5Cardputer.Display.fillRect(cx, cy, charW, 2, TEXT_COLOR);
+void CardputerTerminalView::renderAll() {
+    if (SharedPanel::takeDrawn()) {
+        repaintPanel();
+        return;
     }
-
-    if (spriteReady) termSprite.pushSprite(0, 0);
+    int cursorRow = cells.scrollOffset() == 0 ? curRow : -1;
+    renderer.render(cells, surface, cursorRow, curCol);
 }
 
 void CardputerTerminalView::maybeRender() {
+    if (SharedPanel::takeDrawn()) {
+        repaintPanel();
+        lastRenderMs = millis();
+        dirty = false;
+        return;
+    }
     if (!dirty) return;
     uint32_t now = millis();
     if (now - lastRenderMs >= frameIntervalMs) {
@@ -380,6 +329,15 @@ void CardputerTerminalView::maybeRender() {
     }
 }
 
+// Whole panel from the cells, after the device view or a clear drew on it
+void CardputerTerminalView::repaintPanel() {
+    SharedPanel::takeDrawn();
+    M5Cardputer.Display.fillScreen(BACKGROUND_COLOR);
+    renderer.invalidate();
+    cells.markAllDirty();
+    renderAll();
+}
+
 void CardputerTerminalView::recomputeMetrics() {
     // Char size
     charW = 6;
@@ -403,7 +361,8 @@ void CardputerTerminalView::recomputeMetrics() {
     originY = padY + leftover / 2;
 
     // Reset buffer
-    lines.assign(rows, std::string(cols, ' '));
+    cells.resize(rows, cols, historyMax);
+    renderer.reset(rows, cols);
     curRow = 0; curCol = 0;
 }
 
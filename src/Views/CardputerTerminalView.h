@@ -4,7 +4,6 @@
 
 #include <string>
 #include <vector>
-#include <deque>
 #include <stdint.h>
 
 #include <M5Cardputer.h>
@@ -12,6 +11,9 @@
 #include "Interfaces/ITerminalView.h"
 #include "Inputs/InputKeys.h"
 #include "States/GlobalState.h"
+#include "Buffers/TerminalCellBuffer.h"
+#include "Views/TerminalRowRenderer.h"
+#include "Views/SharedPanel.h"
 
 #define BACKGROUND_COLOR TFT_BLACK
 #define PRIMARY_COLOR 0xfa03
@@ -55,10 +57,10 @@ private:
     void ansiReset();
     void ansiFinalizeCSI(char final);
 
-    // Rendering
-    void drawLine(const std::string& s, int16_t y, bool keepIfContent);
+    // Rendering, only the rows that changed
     void renderAll();
     void maybeRender();
+    void repaintPanel();
     void recomputeMetrics();
     std::string htmlDecodeBasic(const std::string& s) const;
     std::string mapCodepointToASCII(uint32_t cp) const;
@@ -67,8 +69,17 @@ private:
     void feedFilteredBytes(const uint8_t* data, size_t n);
 
 private:
-    // Screen buffer
-    std::vector<std::string> lines;
+    // Draws rows straight on the display, the renderer picks which
+    struct DisplaySurface {
+        CardputerTerminalView& view;
+        void drawRow(int row, const char* text, int length, int span, int cursorCol);
+        bool scroll(int lines);
+    };
+
+    // Screen buffer and scrollback
+    TerminalCellBuffer cells;
+    TerminalRowRenderer<DisplaySurface> renderer;
+    DisplaySurface surface{*this};
     int rows = 10;
     int cols = 34;
 
@@ -90,10 +101,6 @@ private:
     // Options
     bool useMonospace = true;   // try a monospace font for stable grid
 
-    // Double buffer monochrome
-    LGFX_Sprite termSprite{ &M5Cardputer.Display };
-    bool spriteReady = false;
-
     // UTF-8 decode state
     uint32_t u8_cp = 0;
     int      u8_rem = 0;
@@ -107,9 +114,7 @@ private:
     bool instantRender = false;
 
     // Scrollback
-    std::deque<std::string> history;
-    size_t historyMax = 256;
-    int scrollOffset = 0;
+    int historyMax = 256;
     bool padBeforeErase = false;
 
 };
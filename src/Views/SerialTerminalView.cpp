@@ -34,6 +34,10 @@ void SerialTerminalView::print(const uint8_t data) {
     Serial.write(data);
 }
 
+void SerialTerminalView::write(const uint8_t* data, size_t len) {
+    Serial.write(data, len);
+}
+
 void SerialTerminalView::println(const std::string& text) {
     Serial.println(text.c_str());
 }
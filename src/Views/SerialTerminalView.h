@@ -14,6 +14,7 @@ public:
     void print(const std::string& text) override;
     void print(const uint8_t data) override;
     void println(const std::string& text) override;
+    void write(const uint8_t* data, size_t len) override;
     void printPrompt(const std::string& mode = "HIZ") override;
     void clear() override;
     void waitPress() override;
@@ -0,0 +1,20 @@
+#pragma once
+
+// Display shared by a terminal view and a device view, as on the Cardputer.
+// The device view marks it when it draws; the terminal view, which only
+// redraws rows it believes changed, then repaints the whole panel.
+
+class SharedPanel {
+public:
+    static void markDrawn() { drawn = true; }
+
+    // True once after markDrawn()
+    static bool takeDrawn() {
+        bool was = drawn;
+        drawn = false;
+        return was;
+    }
+
+private:
+    static inline bool drawn = false;
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <vector>
+#include <cstring>
+#include <algorithm>
+#include "Buffers/TerminalCellBuffer.h"
+
+// Incremental renderer for a TerminalCellBuffer.
+// Keeps a copy of what the display shows and redraws only the dirty rows
+// whose text or cursor really changed, over the span of columns that holds
+// text now or did before, not the full width. A scroll is handed to the
+// display first when it can shift the picture itself.
+//
+// Surface provides:
+//   void drawRow(int row, const char* text, int length, int span, int cursorCol)
+//       // text[0..length) then blanks up to span columns, cursor underline at
+//       // cursorCol or none when -1
+//   bool scroll(int lines)     // shift the text area up, false when unsupported
+
+template <typename Surface>
+class TerminalRowRenderer {
+public:
+    void reset(int rows, int cols) {
+        rowCount = rows;
+        colCount = cols;
+        shown.assign((size_t)rows * cols, ' ');
+        shownLength.assign(rows, 0);
+        shownCursorRow = -1;
+        shownCursorCol = -1;
+    }
+
+    // Call after the display was cleared outside the renderer
+    void invalidate() { reset(rowCount, colCount); }
+
+    // Draw what changed, cursorRow -1 hides the cursor; returns the rows drawn
+    int render(TerminalCellBuffer& cells, Surface& surface, int cursorRow, int cursorCol) {
+        if (cells.rows() != rowCount || cells.cols() != colCount) {
+            reset(cells.rows(), cells.cols());
+        }
+
+        uint32_t scrolled = cells.scrolledLines();
+        if (scrolled && (int)scrolled < rowCount && surface.scroll((int)scrolled)) {
+            shiftShown((int)scrolled);
+        }
+
+        int drawn = 0;
+        for (int row = 0; row < rowCount; ++row) {
+            bool cursorHere = row == cursorRow;
+            bool cursorWas = row == shownCursorRow;
+            if (!cells.isDirty(row) && !cursorHere && !cursorWas) continue;
+
+            const char* text = cells.visibleLine(row);
+            char* before = &shown[(size_t)row * colCount];
+            int cursor = cursorHere ? cursorCol : -1;
+            int oldCursor = cursorWas ? shownCursorCol : -1;
+            if (cursor == oldCursor && memcmp(before, text, (size_t)colCount) == 0) continue;
+
+            int length = colCount;
+            while (length > 0 && text[length - 1] == ' ') --length;
+
+            int span = std::max(length, shownLength[row]);
+            if (cursor >= 0) span = std::max(span, cursor + 1);
+            if (oldCursor >= 0) span = std::max(span, oldCursor + 1);
+            span = std::min(span, colCount);
+
+            surface.drawRow(row, text, length, span, cursor);
+            memcpy(before, text, (size_t)colCount);
+            shownLength[row] = std::max(length, cursor + 1);
+            drawn++;
+        }
+
+        shownCursorRow = cursorRow;
+        shownCursorCol = cursorCol;
+        cells.clearDirty();
+        return drawn;
+    }
+
+private:
+    int rowCount = 0;
+    int colCount = 0;
+    std::vector<char> shown;
+    std::vector<int> shownLength;
+    int shownCursorRow = -1;
+    int shownCursorCol = -1;
+
+    // The display moved its rows up, blank ones came in at the bottom
+    void shiftShown(int lines) {
+        memmove(shown.data(), shown.data() + (size_t)lines * colCount, (size_t)(rowCount - lines) * colCount);
+        memset(shown.data() + (size_t)(rowCount - lines) * colCount, ' ', (size_t)lines * colCount);
+        std::move(shownLength.begin() + lines, shownLength.end(), shownLength.begin());
+        std::fill(shownLength.end() - lines, shownLength.end(), 0);
+        if (shownCursorRow >= 0) shownCursorRow = shownCursorRow >= lines ? shownCursorRow - lines : -1;
+    }
+};
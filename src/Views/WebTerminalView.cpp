@@ -33,4 +33,8 @@ void WebTerminalView::clear() {
 
 void WebTerminalView::waitPress() {
     server.sendText("\n\nPress any key to start...");
+}
+
+void WebTerminalView::flush() {
+    server.flush();
 }
\ No newline at end of file
@@ -16,7 +16,8 @@ public:
     void printPrompt(const std::string& mode) override;
     void clear() override;
     void waitPress() override;
+    void flush() override;
     
 private:
-    WebSocketServer server;
+    WebSocketServer& server;
 };
@@ -126,8 +126,11 @@ void setup() {
 
             // Build the provider for serial type and run the dispatcher loop
             // too big to fit on the stack anymore, allocated on the heap
+            uint32_t heapBefore = ESP.getFreeHeap();
+            uint32_t buildStart = micros();
             DependencyProvider* provider = new DependencyProvider(serialView, deviceView, serialInput, deviceInput, 
                                                                   usb.usbService, usb.usbController, littleFsService);
+            provider->getModeFootprintManager().setStartup(micros() - buildStart, heapBefore - ESP.getFreeHeap(), millis());
             ActionDispatcher dispatcher(*provider);
             dispatcher.setup(terminalType, baud);
             dispatcher.run(); // Forever
@@ -161,8 +164,11 @@ void setup() {
 
             // Build the provider for webui type and run the dispatcher loop
             // too big to fit on the stack anymore, allocated on the heap
+            uint32_t heapBefore = ESP.getFreeHeap();
+            uint32_t buildStart = micros();
             DependencyProvider* provider = new DependencyProvider(webView, deviceView, webInput, deviceInput, 
                                                                   usb.usbService, usb.usbController, littleFsService);
+            provider->getModeFootprintManager().setStartup(micros() - buildStart, heapBefore - ESP.getFreeHeap(), millis());
             ActionDispatcher dispatcher(*provider);
             
             dispatcher.setup(terminalType, webIp);
@@ -183,8 +189,11 @@ void setup() {
             auto usb = UsbConfigurator::configure(standaloneView, standaloneInput, deviceInput);
 
             // Build the provider for cardputer standalone and run the dispatcher loop
+            uint32_t heapBefore = ESP.getFreeHeap();
+            uint32_t buildStart = micros();
             DependencyProvider* provider = new DependencyProvider(standaloneView, deviceView, standaloneInput, deviceInput, 
                                                                 usb.usbService, usb.usbController, littleFsService);
+            provider->getModeFootprintManager().setStartup(micros() - buildStart, heapBefore - ESP.getFreeHeap(), millis());
             ActionDispatcher dispatcher(*provider);
             dispatcher.setup(terminalType, "standalone");
             dispatcher.run(); // Forever
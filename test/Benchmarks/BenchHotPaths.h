@@ -0,0 +1,166 @@
+#ifndef BENCH_HOT_PATHS_H
+#define BENCH_HOT_PATHS_H
+
+#include <unity.h>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "BenchmarkRunner.h"
+#include "../src/Transformers/ArgTransformer.h"
+#include "../src/Transformers/InstructionTransformer.h"
+#include "../src/Transformers/WifiSniffTransformer.h"
+#include "../src/Transformers/CanLogTransformer.h"
+#include "../src/Transformers/SubGhzTransformer.h"
+#include "../src/Managers/BinaryAnalyzeManager.h"
+#include "../src/Managers/SubGhzAnalyzeManager.h"
+#include "../src/Managers/SubGhzCaptureManager.h"
+#include "../src/Managers/I2cSniffManager.h"
+#include "../src/Managers/CanStatsManager.h"
+#include "../Views/MockTerminalView.h"
+#include "../Inputs/MockInput.h"
+
+// Command parsing, protocol decoding and export formats, the code running
+// for every line typed or every frame captured
+void test_benchmarks_hot_paths() {
+    BenchmarkRunner bench;
+
+    ArgTransformer args;
+    const std::string hexList = "DE AD BE EF 01 02 03 04 0A 0B 0C 0D 10 20 30 40";
+    bench.run("arg.parseHexList", hexList.size(), [&] {
+        benchDoNotOptimize(args.parseHexList(hexList));
+    });
+
+    InstructionTransformer instructions;
+    const std::string line = "[0xA0 0x00 0x10 r:16] {0x3C \"hello\" 0x55:4 d:10}";
+    bench.run("instruction.transform", line.size(), [&] {
+        auto parsed = instructions.transform(line);
+        benchDoNotOptimize(instructions.transformByteCodes(parsed));
+    });
+    ByteCodeProgram program;
+    bench.run("instruction.compile", line.size(), [&] {
+        instructions.compile(line, program);
+        benchDoNotOptimize(program);
+    });
+
+    // Mixed firmware like image, strings and signatures in places
+    std::vector<uint8_t> image(64 * 1024);
+    uint32_t seed = 0x12345678;
+    for (size_t i = 0; i < image.size(); ++i) {
+        seed = seed * 1664525 + 1013904223;
+        image[i] = (i / 4096) % 3 == 0 ? (uint8_t)(0x20 + (seed >> 24) % 0x5F) : (uint8_t)(seed >> 24);
+    }
+    memcpy(&image[8192], "\x89PNG\r\n\x1a\n", 8);
+    memcpy(&image[20000], "password=hunter2", 16);
+    MockTerminalView view;
+    MockInput input;
+    BinaryAnalyzeManager binary(view, input);
+    bench.run("binary.analyze_64k", image.size(), [&] {
+        benchDoNotOptimize(binary.analyze(0, image.size(), [&](uint32_t addr, uint8_t* buf, uint32_t len) {
+            memcpy(buf, image.data() + addr, len);
+        }, 512));
+    });
+
+    std::vector<rmt_item32_t> rf;
+    for (int i = 23; i >= 0; --i) {
+        bool one = (0xA5C3F0 >> i) & 1;
+        rmt_item32_t item;
+        item.level0 = 1;
+        item.duration0 = one ? 1050 : 350;
+        item.level1 = 0;
+        item.duration1 = one ? 350 : 1050;
+        rf.push_back(item);
+    }
+    SubGhzAnalyzeManager rfAnalyzer;
+    bench.run("subghz.analyzeFrame", rf.size() * sizeof(rmt_item32_t), [&] {
+        benchDoNotOptimize(rfAnalyzer.analyzeFrame(rf, 1.0f));
+    });
+
+    const size_t rfFrames = 64;
+    std::vector<uint32_t> storage(rfFrames * rf.size());
+    SubGhzCaptureManager capture(storage.data(), storage.size(), 1, rfFrames);
+    SubGhzTransformer subTransformer;
+    for (size_t f = 0; f < rfFrames; ++f) {
+        capture.addFrame((const uint32_t*)rf.data(), rf.size(), (uint64_t)f * 40000 + 40000);
+    }
+    std::string sub;
+    bench.run("subghz.capture_to_sub", storage.size() * sizeof(uint32_t), [&] {
+        std::vector<int32_t> timings = capture.timings();
+        sub = subTransformer.rawFileHeader(433920000, "FuriHalSubGhzPresetOok650Async");
+        for (size_t i = 0; i < timings.size(); i += SubGhzTransformer::TimingsPerLine) {
+            size_t n = std::min(SubGhzTransformer::TimingsPerLine, timings.size() - i);
+            subTransformer.appendRawDataLine(sub, timings.data() + i, n);
+        }
+        benchDoNotOptimize(sub);
+    });
+
+    // Register read, 2 bytes back, as the sniffer ISR records it
+    std::vector<I2cSnifferEvent> events;
+    uint32_t ticks = 0;
+    auto push = [&](I2cSnifferEventType type, uint8_t value) { events.push_back({ticks += 90, type, value, 0}); };
+    for (int t = 0; t < 64; ++t) {
+        push(I2cSnifferEventType::Start, 0);
+        push(I2cSnifferEventType::Address, 0x68 << 1);
+        push(I2cSnifferEventType::Ack, 0);
+        push(I2cSnifferEventType::Data, (uint8_t)t);
+        push(I2cSnifferEventType::Ack, 0);
+        push(I2cSnifferEventType::Start, 0);
+        push(I2cSnifferEventType::Address, (0x68 << 1) | 1);
+        push(I2cSnifferEventType::Ack, 0);
+        push(I2cSnifferEventType::Data, 0x12);
+        push(I2cSnifferEventType::Ack, 0);
+        push(I2cSnifferEventType::Data, 0x34);
+        push(I2cSnifferEventType::Ack, 1);
+        push(I2cSnifferEventType::Stop, 0);
+    }
+    size_t transactions = 0;
+    I2cSniffManager i2c([&](const I2cTransaction&) { transactions++; });
+    bench.run("i2c.sniff_decode_64", events.size() * sizeof(I2cSnifferEvent), [&] {
+        i2c.add(events.data(), events.size());
+    });
+
+    std::vector<CanFrameRecord> frames(256);
+    for (size_t i = 0; i < frames.size(); ++i) {
+        CanFrameRecord& f = frames[i];
+        f.timestampUs = i * 500;
+        f.id = 0x100 + (uint32_t)(i % 24);
+        f.dlc = 8;
+        f.flags = 0;
+        for (int b = 0; b < 8; ++b) f.data[b] = (uint8_t)(i * (b + 1));
+    }
+    CanStatsManager canStats;
+    CanLogTransformer canLog;
+    std::string candump;
+    bench.run("can.stats_candump_256", frames.size() * sizeof(CanFrameRecord), [&] {
+        candump.clear();
+        canStats.add(frames.data(), frames.size());
+        for (const auto& f : frames) canLog.appendCandump(candump, f);
+        benchDoNotOptimize(candump);
+    });
+
+    WifiSniffRecord beacon = {};
+    beacon.timestampUs = 1234567;
+    beacon.length = beacon.captured = 200;
+    beacon.rssi = -52;
+    beacon.channel = 6;
+    beacon.frame[0] = 0x80;
+    WifiSniffTransformer wifi;
+    std::string pcap;
+    pcap.reserve(4096);
+    bench.run("wifi.appendPcapRecord", beacon.captured, [&] {
+        pcap.clear();
+        wifi.appendPcapRecord(pcap, beacon);
+        benchDoNotOptimize(pcap);
+    });
+
+    bench.print();
+    TEST_ASSERT_TRUE(transactions > 0);
+    TEST_ASSERT_TRUE(sub.find("RAW_Data: 1050 -350") != std::string::npos);
+    TEST_ASSERT_EQUAL_UINT32(9, bench.all().size());
+    for (const auto& r : bench.all()) TEST_ASSERT_TRUE(r.nsPerOp > 0);
+
+    auto regressions = bench.checkBaseline();
+    for (const auto& name : regressions) printf("  regression: %s\n", name.c_str());
+    TEST_ASSERT_TRUE(regressions.empty());
+}
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef BENCHMARK_RUNNER_H
+#define BENCHMARK_RUNNER_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <map>
+
+// Micro benchmarks of the hot paths, run with the host tests.
+// Each case is repeated until a run takes about 20 ms, the best of 3 runs is
+// kept. Names have no spaces, they are the keys of the baseline file.
+// Results print as ns/op and MB/s when the case moves bytes.
+//
+// BENCH_SAVE=file writes "name ns_per_op" lines, BENCH_BASELINE=file compares
+// against such a file and fails a case slower by more than BENCH_TOLERANCE
+// percent (25 by default). Without a baseline nothing fails, host timings
+// are too noisy for absolute limits.
+
+template <typename T>
+inline void benchDoNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+class BenchmarkRunner {
+public:
+    struct Result {
+        std::string name;
+        double nsPerOp;
+        double bytesPerSecond;     // 0 when the case has no byte count
+        uint64_t iterations;
+    };
+
+    // body() runs one operation, bytesPerOp is what it processes
+    template <typename Body>
+    const Result& run(const std::string& name, size_t bytesPerOp, Body&& body) {
+        uint64_t iterations = 1;
+        double ns = timeRun(iterations, body);
+        while (ns < TargetNs && iterations < (1ULL << 30)) {
+            uint64_t scale = ns > 0 ? (uint64_t)(TargetNs / ns) + 1 : 10;
+            iterations *= scale < 2 ? 2 : (scale > 10 ? 10 : scale);
+            ns = timeRun(iterations, body);
+        }
+        double best = ns;
+        for (int i = 1; i < Repeats; ++i) {
+            double again = timeRun(iterations, body);
+            if (again < best) best = again;
+        }
+
+        double perOp = best / iterations;
+        double bps = bytesPerOp ? bytesPerOp * 1e9 / perOp : 0;
+        results.push_back({name, perOp, bps, iterations});
+        return results.back();
+    }
+
+    void print() const {
+        printf("  %-34s %12s %10s\n", "benchmark", "ns/op", "MB/s");
+        for (const auto& r : results) {
+            if (r.bytesPerSecond > 0) printf("  %-34s %12.1f %10.1f\n", r.name.c_str(), r.nsPerOp, r.bytesPerSecond / 1e6);
+            else printf("  %-34s %12.1f %10s\n", r.name.c_str(), r.nsPerOp, "-");
+        }
+    }
+
+    // Saves when asked, then the names slower than the baseline allows
+    std::vector<std::string> checkBaseline() const {
+        if (const char* path = getenv("BENCH_SAVE")) save(path);
+
+        std::vector<std::string> regressions;
+        const char* path = getenv("BENCH_BASELINE");
+        if (!path) return regressions;
+
+        const char* tol = getenv("BENCH_TOLERANCE");
+        double tolerance = tol ? atof(tol) : 25.0;
+        std::map<std::string, double> baseline = load(path);
+        for (const auto& r : results) {
+            auto it = baseline.find(r.name);
+            if (it == baseline.end()) continue;
+            double change = (r.nsPerOp / it->second - 1) * 100;
+            printf("  %-34s %+7.1f%% vs baseline\n", r.name.c_str(), change);
+            if (change > tolerance) regressions.push_back(r.name);
+        }
+        return regressions;
+    }
+
+    const std::vector<Result>& all() const { return results; }
+
+private:
+    static constexpr double TargetNs = 20e6;
+    static constexpr int Repeats = 3;
+    std::vector<Result> results;
+
+    template <typename Body>
+    static double timeRun(uint64_t iterations, Body& body) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < iterations; ++i) body();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - start).count();
+    }
+
+    void save(const char* path) const {
+        FILE* f = fopen(path, "w");
+        if (!f) return;
+        for (const auto& r : results) fprintf(f, "%s %.3f\n", r.name.c_str(), r.nsPerOp);
+        fclose(f);
+    }
+
+    static std::map<std::string, double> load(const char* path) {
+        std::map<std::string, double> values;
+        FILE* f = fopen(path, "r");
+        if (!f) return values;
+        char name[128];
+        double ns;
+        while (fscanf(f, "%127s %lf", name, &ns) == 2) values[name] = ns;
+        fclose(f);
+        return values;
+    }
+};
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef TEST_RECORD_RING_BUFFER_H
+#define TEST_RECORD_RING_BUFFER_H
+
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include "../src/Buffers/RecordRingBuffer.h"
+
+void test_record_ring_variable_lengths() {
+    RecordRingBuffer<256> ring;
+    const uint8_t a[3] = {1, 2, 3};
+    const uint8_t b[11] = {9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 7};
+
+    TEST_ASSERT_TRUE(ring.push(a, sizeof(a), 100));
+    TEST_ASSERT_TRUE(ring.push(b, sizeof(b), 250, 0x10));
+    TEST_ASSERT_TRUE(ring.push(nullptr, 0, 300));
+
+    RecordBatch batch;
+    TEST_ASSERT_EQUAL(3, ring.drain(batch));
+    TEST_ASSERT_TRUE(ring.empty());
+
+    TEST_ASSERT_EQUAL(100, batch.records[0].timestampUs);
+    TEST_ASSERT_EQUAL(3, batch.records[0].length);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(a, batch.data(batch.records[0]), 3);
+
+    TEST_ASSERT_EQUAL(250, batch.records[1].timestampUs);
+    TEST_ASSERT_EQUAL(0x10, batch.records[1].flags);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(b, batch.data(batch.records[1]), 11);
+
+    TEST_ASSERT_EQUAL(0, batch.records[2].length);
+    TEST_ASSERT_EQUAL(14, batch.bytes.size());
+}
+
+void test_record_ring_records_never_wrap() {
+    RecordRingBuffer<128> ring;
+    RecordBatch batch;
+    uint8_t payload[24];
+
+    // Sizes that do not divide the capacity, the end gets padded over and over
+    for (uint32_t i = 0; i < 500; ++i) {
+        size_t len = 1 + (i * 7) % 24;
+        for (size_t k = 0; k < len; ++k) payload[k] = (uint8_t)(i + k);
+        TEST_ASSERT_TRUE(ring.push(payload, len, i));
+
+        batch.clear();
+        TEST_ASSERT_EQUAL(1, ring.drain(batch));
+        TEST_ASSERT_EQUAL(i, batch.records[0].timestampUs);
+        TEST_ASSERT_EQUAL(len, batch.records[0].length);
+        const uint8_t* got = batch.data(batch.records[0]);
+        for (size_t k = 0; k < len; ++k) TEST_ASSERT_EQUAL((uint8_t)(i + k), got[k]);
+    }
+    TEST_ASSERT_EQUAL(0, ring.droppedCount());
+}
+
+void test_record_ring_counts_drops_and_truncation() {
+    RecordRingBuffer<128> ring;
+    uint8_t big[200] = {0};
+
+    // Larger than a quarter of the ring, kept but cut
+    TEST_ASSERT_TRUE(ring.push(big, sizeof(big), 1));
+    TEST_ASSERT_EQUAL(1, ring.truncatedCount());
+
+    RecordBatch batch;
+    ring.drain(batch);
+    TEST_ASSERT_EQUAL(RecordRingBuffer<128>::MaxPayload, batch.records[0].length);
+    TEST_ASSERT_TRUE(batch.records[0].flags & RecordRingBuffer<128>::FlagTruncated);
+
+    // 16 bytes per record, 8 fit
+    int accepted = 0;
+    for (int i = 0; i < 12; ++i) accepted += ring.push(big, 8, i) ? 1 : 0;
+    TEST_ASSERT_EQUAL(8, accepted);
+    TEST_ASSERT_EQUAL(4, ring.droppedCount());
+
+    ring.resetCounters();
+    TEST_ASSERT_EQUAL(0, ring.droppedCount());
+}
+
+void test_record_ring_drain_reuses_batch() {
+    RecordRingBuffer<4096> ring;
+    uint8_t payload[32] = {0};
+    RecordBatch batch;
+    batch.bytes.reserve(2048);
+    batch.records.reserve(64);
+    const uint8_t* storage = batch.bytes.data();
+
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 40; ++i) ring.push(payload, sizeof(payload), i);
+        batch.clear();
+
+        // Payload budget, at least one record per call
+        TEST_ASSERT_EQUAL(20, ring.drain(batch, 20 * 32));
+        TEST_ASSERT_EQUAL(20, ring.drain(batch, 20 * 32));
+        TEST_ASSERT_EQUAL(40, batch.records.size());
+    }
+    TEST_ASSERT_TRUE(storage == batch.bytes.data()); // no reallocation
+}
+
+void test_record_ring_simulated_producer() {
+    // Producer as fast as it can go, like back to back transactions
+    static RecordRingBuffer<16384> ring;
+    const uint32_t total = 2000000;
+    std::atomic<bool> done{false};
+
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&]() {
+        uint8_t payload[16];
+        for (uint32_t seq = 0; seq < total; ++seq) {
+            size_t len = 4 + (seq & 7);
+            memcpy(payload, &seq, 4);
+            ring.push(payload, len, seq);
+            if ((seq & 255) == 255) std::this_thread::yield(); // single core hosts
+        }
+        done = true;
+    });
+
+    RecordBatch batch;
+    batch.bytes.reserve(16384);
+    batch.records.reserve(2048);
+    uint32_t received = 0;
+    uint32_t last = 0;
+    bool ordered = true;
+    bool intact = true;
+
+    while (!done || !ring.empty()) {
+        batch.clear();
+        if (ring.drain(batch) == 0) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (const auto& r : batch.records) {
+            uint32_t seq;
+            memcpy(&seq, batch.data(r), 4);
+            if (seq != r.timestampUs || r.length != 4 + (seq & 7)) intact = false;
+            if (received && seq <= last) ordered = false;
+            last = seq;
+            received++;
+        }
+    }
+    producer.join();
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    TEST_ASSERT_TRUE(intact);
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_EQUAL(total, received + ring.droppedCount());
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "Record ring: %.2f M records/s, %u received, %u dropped",
+             total / secs / 1e6, received, ring.droppedCount());
+    TEST_MESSAGE(msg);
+}
+
+#endif // TEST_RECORD_RING_BUFFER_H
@@ -0,0 +1,213 @@
+#ifndef TEST_SPSC_RING_BUFFER_H
+#define TEST_SPSC_RING_BUFFER_H
+
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "../src/Buffers/SpscRingBuffer.h"
+#include "../src/Buffers/RingNotifier.h"
+
+void test_spsc_ring_push_pop_wraps() {
+    SpscRingBuffer<uint8_t, 8> ring;
+    uint8_t in[6] = {1, 2, 3, 4, 5, 6};
+    uint8_t out[8] = {0};
+
+    TEST_ASSERT_EQUAL(6, ring.push(in, 6));
+    TEST_ASSERT_EQUAL(4, ring.pop(out, 4));
+    TEST_ASSERT_EQUAL(6, ring.push(in, 6)); // wraps around the end
+    TEST_ASSERT_EQUAL(8, ring.size());
+
+    TEST_ASSERT_EQUAL(8, ring.pop(out, 8));
+    const uint8_t expected[8] = {5, 6, 1, 2, 3, 4, 5, 6};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, out, 8);
+    TEST_ASSERT_TRUE(ring.empty());
+}
+
+void test_spsc_ring_partial_push_when_full() {
+    SpscRingBuffer<char, 4> ring;
+    TEST_ASSERT_EQUAL(4, ring.push("abcdef", 6));
+    TEST_ASSERT_FALSE(ring.push('x'));
+    TEST_ASSERT_EQUAL(0, ring.freeSpace());
+
+    char c;
+    TEST_ASSERT_TRUE(ring.peek(c));
+    TEST_ASSERT_EQUAL('a', c);
+    ring.clear();
+    TEST_ASSERT_FALSE(ring.pop(c));
+}
+
+void test_spsc_ring_write_slot_in_place() {
+    SpscRingBuffer<uint32_t, 2> ring;
+    uint32_t* slot = ring.writeSlot();
+    TEST_ASSERT_NOT_NULL(slot);
+    *slot = 7;
+    TEST_ASSERT_TRUE(ring.empty()); // not visible before commit
+    ring.commit();
+    *ring.writeSlot() = 8;
+    ring.commit();
+    TEST_ASSERT_NULL(ring.writeSlot());
+
+    uint32_t v;
+    TEST_ASSERT_TRUE(ring.pop(v));
+    TEST_ASSERT_EQUAL(7, v);
+    TEST_ASSERT_TRUE(ring.pop(v));
+    TEST_ASSERT_EQUAL(8, v);
+}
+
+void test_spsc_ring_threaded_order() {
+    static SpscRingBuffer<uint32_t, 1024> ring;
+    const uint32_t total = 1000000;
+    bool ordered = true;
+
+    std::thread producer([&] {
+        uint32_t next = 0, chunk[37];
+        while (next < total) {
+            size_t n = 0;
+            while (n < 37 && next + n < total) { chunk[n] = next + n; n++; }
+            size_t pushed = ring.push(chunk, n);
+            if (!pushed) std::this_thread::yield();
+            next += pushed;
+        }
+    });
+
+    uint32_t expected = 0, chunk[64];
+    while (expected < total) {
+        size_t n = ring.pop(chunk, 64);
+        if (!n) std::this_thread::yield();
+        for (size_t i = 0; i < n; ++i) {
+            if (chunk[i] != expected++) ordered = false;
+        }
+    }
+    producer.join();
+
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_TRUE(ring.empty());
+}
+
+void test_spsc_ring_throughput_vs_deque() {
+    const size_t total = 16 * 1024 * 1024;
+    char msg[160];
+
+    // Ring, bulk push/pop of 64 bytes
+    static SpscRingBuffer<char, 4096> ring;
+    auto start = std::chrono::steady_clock::now();
+    std::thread producer([&] {
+        char chunk[64] = {0};
+        size_t sent = 0;
+        while (sent < total) {
+            size_t n = ring.push(chunk, sizeof(chunk) < total - sent ? sizeof(chunk) : total - sent);
+            if (!n) std::this_thread::yield();
+            sent += n;
+        }
+    });
+    size_t received = 0;
+    char out[256];
+    while (received < total) {
+        size_t n = ring.pop(out, sizeof(out));
+        if (!n) std::this_thread::yield();
+        received += n;
+    }
+    producer.join();
+    double ringSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Previous path, std::deque<char> char by char (with the lock it was missing)
+    std::deque<char> deque;
+    std::mutex mtx;
+    start = std::chrono::steady_clock::now();
+    std::thread dequeProducer([&] {
+        for (size_t i = 0; i < total; ++i) {
+            std::lock_guard<std::mutex> lock(mtx);
+            deque.push_back('x');
+        }
+    });
+    received = 0;
+    while (received < total) {
+        bool got = false;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (!deque.empty()) {
+                deque.pop_front();
+                got = true;
+            }
+        }
+        if (got) received++;
+        else std::this_thread::yield();
+    }
+    dequeProducer.join();
+    double dequeSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    snprintf(msg, sizeof(msg), "Throughput: ring %.1f MB/s, deque %.1f MB/s (x%.1f)",
+             total / ringSecs / 1e6, total / dequeSecs / 1e6, dequeSecs / ringSecs);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_EQUAL(total, received);
+}
+
+void test_spsc_ring_wakeup_latency_vs_polling() {
+    using Clock = std::chrono::steady_clock;
+    const int rounds = 50;
+    char msg[160];
+
+    // Ring with notifier
+    static SpscRingBuffer<char, 64> ring;
+    RingNotifier notifier;
+    std::atomic<int64_t> sentAt{0};
+    std::atomic<int> consumed{0};
+    double ringTotalUs = 0;
+
+    // Ping-pong, one byte in flight at a time
+    std::thread producer([&] {
+        for (int i = 0; i < rounds; ++i) {
+            while (consumed < i) std::this_thread::yield();
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            sentAt = Clock::now().time_since_epoch().count();
+            ring.push('x');
+            notifier.notify();
+        }
+    });
+    for (int i = 0; i < rounds; ++i) {
+        char c;
+        while (!ring.pop(c)) notifier.wait(1000);
+        ringTotalUs += (Clock::now().time_since_epoch().count() - sentAt) / 1000.0;
+        consumed++;
+    }
+    producer.join();
+
+    // Previous path, poll the deque with a 10 ms delay
+    std::deque<char> deque;
+    std::mutex mtx;
+    double dequeTotalUs = 0;
+    consumed = 0;
+    std::thread dequeProducer([&] {
+        for (int i = 0; i < rounds; ++i) {
+            while (consumed < i) std::this_thread::yield();
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            std::lock_guard<std::mutex> lock(mtx);
+            sentAt = Clock::now().time_since_epoch().count();
+            deque.push_back('x');
+        }
+    });
+    for (int i = 0; i < rounds; ++i) {
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (!deque.empty()) { deque.pop_front(); break; }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        dequeTotalUs += (Clock::now().time_since_epoch().count() - sentAt) / 1000.0;
+        consumed++;
+    }
+    dequeProducer.join();
+
+    snprintf(msg, sizeof(msg), "Wakeup latency: ring %.1f us, polled deque %.1f us",
+             ringTotalUs / rounds, dequeTotalUs / rounds);
+    TEST_MESSAGE(msg);
+    TEST_ASSERT_TRUE(ringTotalUs < dequeTotalUs);
+}
+
+#endif // TEST_SPSC_RING_BUFFER_H
@@ -0,0 +1,102 @@
+#ifndef HAL_ARDUINO_H
+#define HAL_ARDUINO_H
+
+// Arduino core subset for the native build, over HalSim.h
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <algorithm>
+#include "HalSim.h"
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define IRAM_ATTR
+
+inline unsigned long millis() { return (unsigned long)(hal::clock.us / 1000); }
+inline unsigned long micros() { return (unsigned long)hal::clock.us; }
+inline void delay(uint32_t ms) { hal::clock.advance((uint64_t)ms * 1000); }
+inline void delayMicroseconds(uint32_t us) { hal::clock.advance(us); }
+inline void yield() {}
+
+inline void pinMode(uint8_t pin, uint8_t mode) {
+    if (pin >= hal::Gpio::Pins) return;
+    hal::gpio.mode[pin] = mode;
+    if (mode == INPUT_PULLUP) hal::gpio.set(pin, 1);
+}
+inline void digitalWrite(uint8_t pin, uint8_t value) { hal::gpio.set(pin, value); }
+inline int digitalRead(uint8_t pin) { return pin < hal::Gpio::Pins ? hal::gpio.level[pin] : 0; }
+
+inline int digitalPinToInterrupt(int pin) { return pin; }
+inline void attachInterrupt(int pin, void (*isr)(), int mode) {
+    if (pin < 0 || pin >= hal::Gpio::Pins) return;
+    hal::gpio.isr[pin] = isr;
+    hal::gpio.isrMode[pin] = mode;
+}
+inline void detachInterrupt(int pin) {
+    if (pin < 0 || pin >= hal::Gpio::Pins) return;
+    hal::gpio.isr[pin] = nullptr;
+}
+
+inline uint32_t getCpuFrequencyMhz() { return hal::CpuMhz; }
+
+class EspClass {
+public:
+    uint32_t getCycleCount() const { return (uint32_t)(hal::clock.us * hal::CpuMhz); }
+    uint32_t getFreeHeap() const { return 320 * 1024; }
+};
+inline EspClass ESP;
+
+class HardwareSerial {
+public:
+    explicit HardwareSerial(int port) : port(port) {}
+
+    void begin(unsigned long baud, uint32_t = 0, int8_t = -1, int8_t = -1) {
+        hal::uart[port].baud = (uint32_t)baud;
+        hal::uart[port].open = true;
+    }
+    void end() { hal::uart[port].open = false; }
+    int available() const { return (int)hal::uart[port].rx.size(); }
+    int peek() const { return hal::uart[port].rx.empty() ? -1 : hal::uart[port].rx.front(); }
+    int read() {
+        auto& rx = hal::uart[port].rx;
+        if (rx.empty()) return -1;
+        int c = rx.front();
+        rx.pop_front();
+        return c;
+    }
+    size_t read(uint8_t* out, size_t count) {
+        size_t n = 0;
+        while (n < count && available()) out[n++] = (uint8_t)read();
+        return n;
+    }
+    size_t write(uint8_t byte) {
+        hal::uart[port].send(byte);
+        return 1;
+    }
+    size_t write(const uint8_t* data, size_t count) {
+        for (size_t i = 0; i < count; ++i) hal::uart[port].send(data[i]);
+        return count;
+    }
+    size_t print(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+    void flush() {}
+    explicit operator bool() const { return true; }
+
+private:
+    int port;
+};
+inline HardwareSerial Serial(0);
+inline HardwareSerial Serial1(1);
+inline HardwareSerial Serial2(2);
+
+#endif // HAL_ARDUINO_H
@@ -0,0 +1,153 @@
+#ifndef HAL_SIM_H
+#define HAL_SIM_H
+
+#include <cstdint>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+// Simulated ESP32 peripherals for the native build, behind the Arduino and
+// IDF headers of this folder. Time is virtual: it only moves when firmware
+// code waits (delay) or a bus charges its transfer time, so runs are
+// deterministic. Tests set the backends up through hal:: and reset() them.
+
+namespace hal {
+
+constexpr uint32_t CpuMhz = 240;
+
+struct Clock {
+    uint64_t us = 0;
+    void advance(uint64_t delta) { us += delta; }
+};
+inline Clock clock;
+
+// Bus time in us for bits at frequency, rounded up
+inline uint64_t bitTimeUs(uint64_t bits, uint32_t frequency) {
+    return frequency ? (bits * 1000000ULL + frequency - 1) / frequency : 0;
+}
+
+// GPIO, levels and edge interrupts
+struct Gpio {
+    static constexpr int Pins = 49;
+    uint8_t level[Pins] = {};
+    uint8_t mode[Pins] = {};
+    void (*isr[Pins])() = {};
+    int isrMode[Pins] = {};     // RISING 1, FALLING 2, CHANGE 3
+
+    // Pin driven by the firmware or by the outside, fires its interrupt
+    void set(int pin, uint8_t value) {
+        if (pin < 0 || pin >= Pins) return;
+        uint8_t old = level[pin];
+        level[pin] = value ? 1 : 0;
+        if (!isr[pin] || old == level[pin]) return;
+        bool rising = level[pin];
+        if (isrMode[pin] == 3 || (isrMode[pin] == 1 && rising) || (isrMode[pin] == 2 && !rising)) isr[pin]();
+    }
+};
+inline Gpio gpio;
+
+// I2C, devices attached by 7 bit address
+struct I2cDevice {
+    virtual ~I2cDevice() = default;
+    virtual bool write(const uint8_t* data, size_t count) = 0;  // false to NACK
+    virtual size_t read(uint8_t* out, size_t count) = 0;
+};
+
+// Memory behind a register pointer, like an EEPROM or a sensor
+struct RegisterI2cDevice : I2cDevice {
+    std::vector<uint8_t> memory;
+    uint8_t addressBytes;
+    uint32_t pointer = 0;
+
+    explicit RegisterI2cDevice(size_t size, uint8_t addressBytes = 1) : memory(size), addressBytes(addressBytes) {}
+
+    bool write(const uint8_t* data, size_t count) override {
+        size_t i = 0;
+        if (count >= addressBytes) {
+            pointer = 0;
+            for (; i < addressBytes; ++i) pointer = (pointer << 8) | data[i];
+        }
+        for (; i < count; ++i) memory[pointer++ % memory.size()] = data[i];
+        return true;
+    }
+
+    size_t read(uint8_t* out, size_t count) override {
+        for (size_t i = 0; i < count; ++i) out[i] = memory[pointer++ % memory.size()];
+        return count;
+    }
+};
+
+struct I2cBus {
+    std::map<uint8_t, I2cDevice*> devices;
+    uint32_t frequency = 100000;
+
+    void attach(uint8_t address, I2cDevice& device) { devices[address] = &device; }
+    I2cDevice* find(uint8_t address) const {
+        auto it = devices.find(address);
+        return it == devices.end() ? nullptr : it->second;
+    }
+    // Start, address, bytes with ACK, stop
+    void charge(size_t bytes) { clock.advance(bitTimeUs(2 + 9 * (bytes + 1), frequency)); }
+};
+inline I2cBus i2c;
+
+// SPI, the device answers each byte
+struct SpiBus {
+    std::function<uint8_t(uint8_t)> device;
+    uint32_t frequency = 1000000;
+    uint64_t bytes = 0;
+
+    uint8_t transfer(uint8_t out) {
+        bytes++;
+        clock.advance(bitTimeUs(8, frequency));
+        return device ? device(out) : 0xFF;
+    }
+};
+inline SpiBus spi;
+
+// UART, rx is what the firmware reads, tx what it wrote; 10 bits per byte
+struct Uart {
+    std::deque<uint8_t> rx;
+    std::string tx;
+    uint32_t baud = 115200;
+    bool open = false;
+
+    void inject(const std::string& data) { rx.insert(rx.end(), data.begin(), data.end()); }
+    void send(uint8_t byte) {
+        tx.push_back((char)byte);
+        clock.advance(bitTimeUs(10, baud));
+    }
+};
+inline Uart uart[3];
+
+// RMT receiver, blocks of rmt_item32_t words as the receive ring hands them
+struct Rmt {
+    std::deque<std::vector<uint32_t>> blocks;
+    std::vector<uint32_t> current;  // block given out, until returned
+    size_t ringBytes = 0;
+    bool receiving = false;
+
+    void inject(const std::vector<uint32_t>& block) { blocks.push_back(block); }
+    size_t queuedBytes() const {
+        size_t n = 0;
+        for (const auto& b : blocks) n += b.size() * sizeof(uint32_t);
+        return n;
+    }
+};
+inline Rmt rmt;
+
+inline void reset() {
+    clock = Clock();
+    gpio = Gpio();
+    i2c = I2cBus();
+    spi = SpiBus();
+    for (auto& u : uart) u = Uart();
+    rmt = Rmt();
+}
+
+} // namespace hal
+
+#endif // HAL_SIM_H
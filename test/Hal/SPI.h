@@ -0,0 +1,45 @@
+#ifndef HAL_SPI_H
+#define HAL_SPI_H
+
+// Arduino SPI for the native build, bytes go to hal::spi
+
+#include "Arduino.h"
+
+#define MSBFIRST 1
+#define LSBFIRST 0
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+class SPISettings {
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0)
+        : clock(clock), bitOrder(bitOrder), dataMode(dataMode) {}
+    uint32_t clock;
+    uint8_t bitOrder;
+    uint8_t dataMode;
+};
+
+class SPIClass {
+public:
+    void begin(int8_t = -1, int8_t = -1, int8_t = -1, int8_t = -1) {}
+    void end() {}
+    void setFrequency(uint32_t frequency) { hal::spi.frequency = frequency; }
+    void beginTransaction(const SPISettings& settings) { hal::spi.frequency = settings.clock; }
+    void endTransaction() {}
+    uint8_t transfer(uint8_t data) { return hal::spi.transfer(data); }
+    uint16_t transfer16(uint16_t data) {
+        uint16_t high = transfer((uint8_t)(data >> 8));
+        return (uint16_t)((high << 8) | transfer((uint8_t)data));
+    }
+    void transferBytes(const uint8_t* out, uint8_t* in, uint32_t count) {
+        for (uint32_t i = 0; i < count; ++i) {
+            uint8_t b = transfer(out ? out[i] : 0xFF);
+            if (in) in[i] = b;
+        }
+    }
+};
+inline SPIClass SPI;
+
+#endif // HAL_SPI_H
@@ -0,0 +1,136 @@
+#ifndef TEST_HAL_SIM_H
+#define TEST_HAL_SIM_H
+
+#include <unity.h>
+#include <string>
+#include <vector>
+#include <Arduino.h>
+#include <Wire.h>
+#include <SPI.h>
+#include "driver/rmt.h"
+#include "HalSim.h"
+#include "../src/Managers/SubGhzAnalyzeManager.h"
+#include "../src/Selectors/HorizontalSelector.h"
+#include "../Views/MockView.h"
+#include "../Inputs/MockInput.h"
+
+static int halSimIsrCount = 0;
+static void halSimIsr() { halSimIsrCount++; }
+
+void test_hal_sim_virtual_clock_and_gpio() {
+    hal::reset();
+    TEST_ASSERT_EQUAL_UINT32(0, millis());
+    delay(5);
+    delayMicroseconds(250);
+    TEST_ASSERT_EQUAL_UINT32(5, millis());
+    TEST_ASSERT_EQUAL_UINT32(5250, micros());
+    TEST_ASSERT_EQUAL_UINT32(5250 * hal::CpuMhz, ESP.getCycleCount());
+
+    halSimIsrCount = 0;
+    pinMode(4, INPUT);
+    attachInterrupt(digitalPinToInterrupt(4), halSimIsr, RISING);
+    hal::gpio.set(4, 1);
+    hal::gpio.set(4, 1);    // no edge
+    hal::gpio.set(4, 0);
+    hal::gpio.set(4, 1);
+    TEST_ASSERT_EQUAL_INT(2, halSimIsrCount);
+    TEST_ASSERT_EQUAL_INT(HIGH, digitalRead(4));
+
+    detachInterrupt(4);
+    digitalWrite(4, LOW);
+    digitalWrite(4, HIGH);
+    TEST_ASSERT_EQUAL_INT(2, halSimIsrCount);
+
+    // Selector timeout runs in virtual time, no wall clock wait
+    MockView view;
+    MockInput input;
+    HorizontalSelector selector(view, input);
+    TEST_ASSERT_EQUAL_INT(1, selector.selectHeadless());
+    TEST_ASSERT_TRUE(millis() >= 3005);
+}
+
+void test_hal_sim_wire_spi_and_uart() {
+    hal::reset();
+    hal::RegisterI2cDevice eeprom(256);
+    for (int i = 0; i < 256; ++i) eeprom.memory[i] = (uint8_t)(i ^ 0x5A);
+    hal::i2c.attach(0x50, eeprom);
+
+    Wire.begin(-1, -1, 400000);
+    Wire.beginTransmission(0x50);
+    Wire.write(0x10);
+    TEST_ASSERT_EQUAL_UINT8(0, Wire.endTransmission(false));
+    TEST_ASSERT_EQUAL_UINT32(4, Wire.requestFrom(0x50, 4));
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_EQUAL_INT((0x10 + i) ^ 0x5A, Wire.read());
+    TEST_ASSERT_EQUAL_INT(-1, Wire.read());
+
+    Wire.beginTransmission(0x51);
+    TEST_ASSERT_EQUAL_UINT8(2, Wire.endTransmission());
+    TEST_ASSERT_EQUAL_UINT32(0, Wire.requestFrom(0x51, 1));
+
+    // 2 + 9 * 2 bits, then 2 + 9 * 5, then 2 + 9, 2 + 9 * 2 at 400 kHz
+    TEST_ASSERT_EQUAL_UINT32(50 + 118 + 28 + 50, micros());
+
+    hal::spi.device = [](uint8_t b) { return (uint8_t)~b; };
+    SPI.beginTransaction(SPISettings(8000000, MSBFIRST, SPI_MODE0));
+    TEST_ASSERT_EQUAL_UINT16(0xEDCB, SPI.transfer16(0x1234));
+    SPI.endTransaction();
+    TEST_ASSERT_EQUAL_UINT64(2, hal::spi.bytes);
+
+    uint64_t before = hal::clock.us;
+    Serial1.begin(9600);
+    hal::uart[1].inject("AT\r");
+    std::string line;
+    while (Serial1.available()) line += (char)Serial1.read();
+    TEST_ASSERT_EQUAL_STRING("AT\r", line.c_str());
+    for (int i = 0; i < 96; ++i) Serial1.write('x');
+    TEST_ASSERT_EQUAL_UINT32(96, hal::uart[1].tx.size());
+    TEST_ASSERT_EQUAL_UINT64(96 * 1042, hal::clock.us - before);   // 10 bits at 9600 baud
+}
+
+void test_hal_sim_rmt_ring_feeds_analyzer() {
+    hal::reset();
+    // PT2262 like frame, T = 350 us, 1 = 3T high T low, 0 = T high 3T low
+    std::vector<uint32_t> block;
+    for (int i = 23; i >= 0; --i) {
+        bool one = (0xA5C3F0 >> i) & 1;
+        rmt_item32_t item;
+        item.level0 = 1;
+        item.duration0 = one ? 1050 : 350;
+        item.level1 = 0;
+        item.duration1 = one ? 350 : 1050;
+        block.push_back(item.val);
+    }
+    hal::rmt.inject(block);
+    hal::rmt.inject(std::vector<uint32_t>(block.begin(), block.begin() + 4));
+
+    rmt_config_t config = {};
+    config.rmt_mode = RMT_MODE_RX;
+    rmt_config(&config);
+    rmt_driver_install(RMT_CHANNEL_4, 4096, 0);
+    RingbufHandle_t ring = nullptr;
+    rmt_get_ringbuf_handle(RMT_CHANNEL_4, &ring);
+    rmt_rx_start(RMT_CHANNEL_4, true);
+    TEST_ASSERT_EQUAL_UINT32(4096 - 28 * 4, xRingbufferGetCurFreeSize(ring));
+
+    size_t size = 0;
+    auto* items = (rmt_item32_t*)xRingbufferReceive(ring, &size, pdMS_TO_TICKS(10));
+    TEST_ASSERT_NOT_NULL(items);
+    TEST_ASSERT_EQUAL_UINT32(24 * sizeof(rmt_item32_t), size);
+
+    // One block out at a time, like the IDF ring
+    size_t other = 0;
+    TEST_ASSERT_NULL(xRingbufferReceive(ring, &other, 0));
+
+    std::vector<rmt_item32_t> frame(items, items + size / sizeof(rmt_item32_t));
+    vRingbufferReturnItem(ring, items);
+    TEST_ASSERT_EQUAL_UINT32(1050, frame[0].duration0);
+
+    SubGhzAnalyzeManager analyzer;
+    std::string report = analyzer.analyzeFrame(frame, 1.0f);
+    TEST_ASSERT_TRUE(report.find("A5C3F0") != std::string::npos);
+
+    TEST_ASSERT_NOT_NULL(xRingbufferReceive(ring, &size, 0));
+    TEST_ASSERT_EQUAL_UINT32(16, size);
+}
+
+#endif
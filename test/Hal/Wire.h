@@ -0,0 +1,69 @@
+#ifndef HAL_WIRE_H
+#define HAL_WIRE_H
+
+// Arduino Wire for the native build, transactions go to hal::i2c devices
+
+#include <vector>
+#include "Arduino.h"
+
+#define I2C_BUFFER_LENGTH 128
+
+class TwoWire {
+public:
+    bool begin(int = -1, int = -1, uint32_t frequency = 0) {
+        if (frequency) hal::i2c.frequency = frequency;
+        return true;
+    }
+    bool end() { return true; }
+    bool setClock(uint32_t frequency) {
+        hal::i2c.frequency = frequency;
+        return true;
+    }
+
+    void beginTransmission(uint8_t address) {
+        target = address;
+        pending.clear();
+    }
+    size_t write(uint8_t data) {
+        if (pending.size() >= I2C_BUFFER_LENGTH) return 0;
+        pending.push_back(data);
+        return 1;
+    }
+    size_t write(const uint8_t* data, size_t count) {
+        size_t n = 0;
+        while (n < count && write(data[n])) n++;
+        return n;
+    }
+
+    // 0 ok, 2 address NACK, 3 data NACK
+    uint8_t endTransmission(bool = true) {
+        hal::i2c.charge(pending.size());
+        hal::I2cDevice* device = hal::i2c.find(target);
+        if (!device) return 2;
+        return device->write(pending.data(), pending.size()) ? 0 : 3;
+    }
+
+    size_t requestFrom(uint8_t address, size_t count, bool = true) {
+        received.clear();
+        readIndex = 0;
+        count = std::min<size_t>(count, I2C_BUFFER_LENGTH);
+        hal::i2c.charge(count);
+        hal::I2cDevice* device = hal::i2c.find(address);
+        if (!device) return 0;
+        received.resize(count);
+        received.resize(device->read(received.data(), count));
+        return received.size();
+    }
+
+    int available() const { return (int)(received.size() - readIndex); }
+    int read() { return readIndex < received.size() ? received[readIndex++] : -1; }
+
+private:
+    uint8_t target = 0;
+    std::vector<uint8_t> pending;
+    std::vector<uint8_t> received;
+    size_t readIndex = 0;
+};
+inline TwoWire Wire;
+
+#endif // HAL_WIRE_H
@@ -0,0 +1,73 @@
+#ifndef HAL_RMT_H
+#define HAL_RMT_H
+
+// IDF legacy RMT driver for the native build, receive side over hal::rmt
+
+#include <cstdint>
+#include <cstddef>
+#include "freertos/ringbuf.h"
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+typedef int gpio_num_t;
+
+typedef enum {
+    RMT_CHANNEL_0, RMT_CHANNEL_1, RMT_CHANNEL_2, RMT_CHANNEL_3,
+    RMT_CHANNEL_4, RMT_CHANNEL_5, RMT_CHANNEL_6, RMT_CHANNEL_7,
+} rmt_channel_t;
+
+typedef enum { RMT_MODE_TX, RMT_MODE_RX } rmt_mode_t;
+
+typedef struct {
+    union {
+        struct {
+            uint32_t duration0 : 15;
+            uint32_t level0 : 1;
+            uint32_t duration1 : 15;
+            uint32_t level1 : 1;
+        };
+        uint32_t val;
+    };
+} rmt_item32_t;
+
+typedef struct {
+    uint16_t idle_threshold;
+    uint8_t filter_ticks_thresh;
+    bool filter_en;
+} rmt_rx_config_t;
+
+typedef struct {
+    rmt_mode_t rmt_mode;
+    rmt_channel_t channel;
+    gpio_num_t gpio_num;
+    uint8_t clk_div;
+    uint8_t mem_block_num;
+    uint32_t flags;
+    rmt_rx_config_t rx_config;
+} rmt_config_t;
+
+inline esp_err_t rmt_config(const rmt_config_t*) { return ESP_OK; }
+inline esp_err_t rmt_driver_install(rmt_channel_t, size_t ringBytes, int) {
+    hal::rmt.ringBytes = ringBytes;
+    return ESP_OK;
+}
+inline esp_err_t rmt_driver_uninstall(rmt_channel_t) {
+    hal::rmt.receiving = false;
+    return ESP_OK;
+}
+inline esp_err_t rmt_get_ringbuf_handle(rmt_channel_t, RingbufHandle_t* handle) {
+    *handle = &hal::rmt;
+    return ESP_OK;
+}
+inline esp_err_t rmt_rx_start(rmt_channel_t, bool) {
+    hal::rmt.receiving = true;
+    return ESP_OK;
+}
+inline esp_err_t rmt_rx_stop(rmt_channel_t) {
+    hal::rmt.receiving = false;
+    return ESP_OK;
+}
+
+#endif // HAL_RMT_H
@@ -0,0 +1,15 @@
+#ifndef HAL_FREERTOS_H
+#define HAL_FREERTOS_H
+
+// FreeRTOS types for the native build, ticks are milliseconds
+
+#include <cstdint>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+
+#endif // HAL_FREERTOS_H
@@ -0,0 +1,32 @@
+#ifndef HAL_RINGBUF_H
+#define HAL_RINGBUF_H
+
+// IDF ring buffer for the native build, only the RMT receive ring exists
+
+#include <cstddef>
+#include "freertos/FreeRTOS.h"
+#include "../HalSim.h"
+
+typedef void* RingbufHandle_t;
+
+inline void* xRingbufferReceive(RingbufHandle_t, size_t* size, TickType_t) {
+    if (!hal::rmt.current.empty() || hal::rmt.blocks.empty()) {
+        *size = 0;
+        return nullptr;
+    }
+    hal::rmt.current = std::move(hal::rmt.blocks.front());
+    hal::rmt.blocks.pop_front();
+    *size = hal::rmt.current.size() * sizeof(uint32_t);
+    return hal::rmt.current.data();
+}
+
+inline void vRingbufferReturnItem(RingbufHandle_t, void*) {
+    hal::rmt.current.clear();
+}
+
+inline size_t xRingbufferGetCurFreeSize(RingbufHandle_t) {
+    size_t used = hal::rmt.queuedBytes();
+    return used < hal::rmt.ringBytes ? hal::rmt.ringBytes - used : 0;
+}
+
+#endif // HAL_RINGBUF_H
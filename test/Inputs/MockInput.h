@@ -0,0 +1,43 @@
+#ifndef MOCK_INPUT_H
+#define MOCK_INPUT_H
+
+#include <deque>
+#include "../src/Interfaces/IInput.h"
+
+// Scripted input, keys are returned in order, KEY_NONE once empty.
+// idleReads makes the first reads return KEY_NONE.
+class MockInput : public IInput {
+public:
+    void enqueueKey(char key) { keys.push_back(key); }
+    void enqueueKeys(const std::string& s) { for (char c : s) keys.push_back(c); }
+    void setIdleReads(size_t n) { idleReads = n; }
+
+    char handler() override {
+        return keys.empty() ? KEY_NONE : next();
+    }
+
+    char readChar() override {
+        readCount++;
+        if (idleReads > 0) {
+            idleReads--;
+            return KEY_NONE;
+        }
+        return keys.empty() ? KEY_NONE : next();
+    }
+
+    void waitPress() override {}
+
+    size_t readCount = 0;
+
+private:
+    std::deque<char> keys;
+    size_t idleReads = 0;
+
+    char next() {
+        char c = keys.front();
+        keys.pop_front();
+        return c;
+    }
+};
+
+#endif // MOCK_INPUT_H
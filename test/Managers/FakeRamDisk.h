@@ -0,0 +1,51 @@
+#ifndef FAKE_RAM_DISK_H
+#define FAKE_RAM_DISK_H
+
+#include <vector>
+#include <cstring>
+#include "../src/Interfaces/IBlockDevice.h"
+
+// RAM backed block device with an SD over SPI cost model: each command pays
+// a fixed latency, each sector its transfer time, in virtual microseconds
+class FakeRamDisk : public IBlockDevice {
+public:
+    static constexpr uint32_t CommandUs = 800;
+    static constexpr uint32_t SectorUs = 210;
+
+    std::vector<uint8_t> data;
+    uint32_t commands = 0;
+    uint32_t syncs = 0;
+    uint64_t elapsedUs = 0;
+    bool failWrites = false;
+
+    explicit FakeRamDisk(uint32_t sectors) : data((size_t)sectors * 512) {
+        for (size_t i = 0; i < data.size(); ++i) data[i] = (uint8_t)(i * 31 + (i >> 9));
+    }
+
+    uint32_t sectorCount() const override { return (uint32_t)(data.size() / 512); }
+
+    bool readSectors(uint32_t lba, uint8_t* out, uint32_t count) override {
+        charge(count);
+        memcpy(out, &data[(size_t)lba * 512], (size_t)count * 512);
+        return true;
+    }
+
+    bool writeSectors(uint32_t lba, const uint8_t* in, uint32_t count) override {
+        if (failWrites) return false;
+        charge(count);
+        memcpy(&data[(size_t)lba * 512], in, (size_t)count * 512);
+        return true;
+    }
+
+    bool sync() override { syncs++; return true; }
+
+    void resetCounters() { commands = 0; syncs = 0; elapsedUs = 0; }
+
+private:
+    void charge(uint32_t count) {
+        commands++;
+        elapsedUs += CommandUs + (uint64_t)SectorUs * count;
+    }
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef SIMULATED_FLASH_CHIP_H
+#define SIMULATED_FLASH_CHIP_H
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "../src/Interfaces/IFlashReader.h"
+
+// Flash chip model: a deterministic image, reads take the time the bus would
+// (command, address, dummy byte and data at busHz, data twice as fast in dual)
+class SimulatedFlashChip : public IFlashReader {
+public:
+    std::vector<uint8_t> image;
+    uint32_t busHz = 0;             // 0 = no delay
+    bool bulk = false;
+    bool dual = false;
+    int bulkSessions = 0;
+    int buffersLive = 0;
+    uint32_t reads = 0;
+    uint32_t outOfRange = 0;
+
+    explicit SimulatedFlashChip(size_t size) : image(size) {
+        uint32_t x = 0x12345678;
+        for (auto& b : image) {
+            x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+            b = (uint8_t)x;
+        }
+    }
+
+    bool beginBulkRead(size_t /*maxLength*/, bool dualOutput) override {
+        bulk = true;
+        dual = dualOutput;
+        bulkSessions++;
+        return true;
+    }
+
+    void endBulkRead() override { bulk = false; }
+
+    void readFlashData(uint32_t address, uint8_t* buffer, size_t length) override {
+        reads++;
+        for (size_t i = 0; i < length; ++i) {
+            size_t at = address + i;
+            if (at >= image.size()) outOfRange++;
+            buffer[i] = at < image.size() ? image[at] : 0xFF;
+        }
+        if (busHz) {
+            double bits = 40 + (dual ? length * 4.0 : length * 8.0);
+            std::this_thread::sleep_for(std::chrono::duration<double>(bits / busHz));
+        }
+    }
+
+    uint8_t* allocateReadBuffer(size_t length) override {
+        buffersLive++;
+        return new uint8_t[length];
+    }
+
+    void freeReadBuffer(uint8_t* buffer) override {
+        buffersLive--;
+        delete[] buffer;
+    }
+};
+
+#endif // SIMULATED_FLASH_CHIP_H
@@ -0,0 +1,146 @@
+#ifndef TEST_BLOCK_STATS_KERNEL_H
+#define TEST_BLOCK_STATS_KERNEL_H
+
+#include <unity.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../src/Managers/BlockStatsKernel.h"
+
+// analyzeBlock before the kernel, float entropy and per byte tests
+static BlockCounts referenceBlockCounts(const uint8_t* buffer, size_t size, float& entropy) {
+    uint32_t printable = 0, nulls = 0, ff = 0, counts[256] = {0};
+    entropy = 0;
+    for (size_t i = 0; i < size; ++i) {
+        uint8_t b = buffer[i];
+        counts[b]++;
+        if (b >= 32 && b <= 126) printable++;
+        if (b == 0x00) nulls++;
+        if (b == 0xFF) ff++;
+    }
+    for (int i = 0; i < 256; ++i) {
+        if (counts[i]) {
+            float p = (float)counts[i] / size;
+            entropy -= p * log2(p);
+        }
+    }
+    return {0, printable, nulls, ff};
+}
+
+// Flash like image: erased pages, zero padding, text and random data
+static std::vector<uint8_t> makeStatsImage(size_t size) {
+    std::vector<uint8_t> image(size);
+    uint32_t x = 0x1234567;
+    for (size_t i = 0; i < size; ++i) {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        switch ((i / 4096) % 4) {
+            case 0: image[i] = 0xFF; break;
+            case 1: image[i] = (x & 7) ? 0x00 : (uint8_t)x; break;
+            case 2: image[i] = (uint8_t)(' ' + x % 95); break;
+            default: image[i] = (uint8_t)x; break;
+        }
+    }
+    return image;
+}
+
+void test_block_stats_log2_fixed_point() {
+    TEST_ASSERT_EQUAL_UINT32(0, BlockStatsKernel::log2Q16(1));
+    TEST_ASSERT_EQUAL_UINT32(9u << 16, BlockStatsKernel::log2Q16(512));
+    TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)BlockStatsKernel::nLog2nQ16(0));
+    TEST_ASSERT_EQUAL_UINT32(0, (uint32_t)BlockStatsKernel::nLog2nQ16(1));
+
+    // Rounded down, within two Q16 steps of the real value
+    for (uint32_t n = 1; n < 70000; n += 7) {
+        double exact = std::log2((double)n) * 65536.0;
+        double got = BlockStatsKernel::log2Q16(n);
+        TEST_ASSERT_TRUE(got <= exact + 1e-6 && exact - got < 2.0);
+    }
+
+    // Table and direct computation agree at the boundary
+    uint32_t n = BlockStatsKernel::LutSize - 1;
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)((uint64_t)n * BlockStatsKernel::log2Q16(n)),
+                             (uint32_t)BlockStatsKernel::nLog2nQ16(n));
+}
+
+void test_block_stats_exact_cases() {
+    uint8_t block[512];
+
+    memset(block, 0xFF, sizeof(block));
+    BlockCounts c = BlockStatsKernel::compute(block, sizeof(block));
+    TEST_ASSERT_EQUAL_UINT32(0, c.entropyQ16);
+    TEST_ASSERT_EQUAL_UINT32(512, c.ff);
+    TEST_ASSERT_EQUAL_UINT32(0, c.printable);
+
+    // Every value twice, 8 bits
+    for (int i = 0; i < 512; ++i) block[i] = (uint8_t)i;
+    c = BlockStatsKernel::compute(block, sizeof(block));
+    TEST_ASSERT_EQUAL_UINT32(8u << 16, c.entropyQ16);
+    TEST_ASSERT_EQUAL_UINT32(2, c.nulls);
+    TEST_ASSERT_EQUAL_UINT32(2, c.ff);
+    TEST_ASSERT_EQUAL_UINT32(2 * 95, c.printable);
+
+    // Two values, 1 bit, 8 bit histogram path
+    for (int i = 0; i < 32; ++i) block[i] = (i & 1) ? 'A' : 0x00;
+    c = BlockStatsKernel::compute(block, 32);
+    TEST_ASSERT_EQUAL_UINT32(1u << 16, c.entropyQ16);
+    TEST_ASSERT_EQUAL_UINT32(16, c.printable);
+    TEST_ASSERT_EQUAL_UINT32(16, c.nulls);
+
+    TEST_ASSERT_EQUAL_UINT32(0, BlockStatsKernel::compute(block, 0).entropyQ16);
+}
+
+void test_block_stats_matches_float_reference() {
+    std::vector<uint8_t> image = makeStatsImage(256 * 1024);
+    const size_t sizes[] = {32, 255, 256, 512, 4096};
+
+    for (size_t size : sizes) {
+        for (size_t off = 0; off + size <= image.size(); off += size * 3 + 1) {
+            float expected;
+            BlockCounts ref = referenceBlockCounts(&image[off], size, expected);
+            BlockCounts got = BlockStatsKernel::compute(&image[off], size);
+
+            TEST_ASSERT_EQUAL_UINT32(ref.printable, got.printable);
+            TEST_ASSERT_EQUAL_UINT32(ref.nulls, got.nulls);
+            TEST_ASSERT_EQUAL_UINT32(ref.ff, got.ff);
+            TEST_ASSERT_FLOAT_WITHIN(1e-3f, expected, BlockStatsKernel::entropy(got));
+        }
+    }
+}
+
+void test_block_stats_throughput_vs_float() {
+    std::vector<uint8_t> image = makeStatsImage(8 * 1024 * 1024);
+    const size_t block = 512;
+    const int rounds = 4;
+
+    auto t0 = std::chrono::steady_clock::now();
+    double floatSum = 0;
+    for (int r = 0; r < rounds; ++r) {
+        for (size_t off = 0; off < image.size(); off += block) {
+            float e;
+            referenceBlockCounts(&image[off], block, e);
+            floatSum += e;
+        }
+    }
+    double floatSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    t0 = std::chrono::steady_clock::now();
+    uint64_t fixedSum = 0;
+    for (int r = 0; r < rounds; ++r) {
+        for (size_t off = 0; off < image.size(); off += block) {
+            fixedSum += BlockStatsKernel::compute(&image[off], block).entropyQ16;
+        }
+    }
+    double kernelSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    TEST_ASSERT_FLOAT_WITHIN(1e-3 * image.size() / block * rounds, floatSum, fixedSum / 65536.0);
+
+    double mb = (double)image.size() * rounds / (1024.0 * 1024.0);
+    char msg[160];
+    snprintf(msg, sizeof(msg), "Block stats: kernel %.0f MB/s, float %.0f MB/s (x%.1f)",
+             mb / kernelSecs, mb / floatSecs, floatSecs / kernelSecs);
+    TEST_MESSAGE(msg);
+}
+
+#endif // TEST_BLOCK_STATS_KERNEL_H
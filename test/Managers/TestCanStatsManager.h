@@ -0,0 +1,116 @@
+#ifndef TEST_CAN_STATS_MANAGER_H
+#define TEST_CAN_STATS_MANAGER_H
+
+#include <unity.h>
+#include <string>
+#include <vector>
+#include <cstring>
+#include "../src/Managers/CanStatsManager.h"
+#include "../src/Transformers/CanLogTransformer.h"
+
+static CanFrameRecord makeCanFrame(uint64_t us, uint32_t id, std::vector<uint8_t> data, uint8_t flags = 0) {
+    CanFrameRecord frame{};
+    frame.timestampUs = us;
+    frame.id = id;
+    frame.flags = flags;
+    frame.dlc = (uint8_t)data.size();
+    memcpy(frame.data, data.data(), data.size());
+    return frame;
+}
+
+void test_can_stats_counts_rates_and_changed_bytes() {
+    CanStatsManager stats;
+
+    // 0x100 every 10 ms with a counter in byte 1, 0x200 every 100 ms constant
+    for (uint32_t i = 0; i < 100; ++i) {
+        uint64_t us = 1000000ULL + i * 10000ULL;
+        stats.add(makeCanFrame(us, 0x100, {0x11, (uint8_t)i, 0x33, 0x44}));
+        if (i % 10 == 0) stats.add(makeCanFrame(us + 500, 0x200, {0xAA, 0xBB}));
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(110, stats.totals().frames);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.ids().size());
+
+    const CanIdStats* fast = stats.find(0x100, false);
+    TEST_ASSERT_NOT_NULL(fast);
+    TEST_ASSERT_EQUAL_UINT32(100, fast->count);
+    TEST_ASSERT_EQUAL_UINT32(10000, fast->periodUs);
+    TEST_ASSERT_FLOAT_WITHIN(0.5, 100.0, fast->rate());
+    TEST_ASSERT_EQUAL_UINT8(0x02, fast->changedMask);
+    TEST_ASSERT_EQUAL_UINT8(0x02, fast->everChangedMask);
+    TEST_ASSERT_EQUAL_UINT8(99, fast->data[1]);
+
+    const CanIdStats* slow = stats.find(0x200, false);
+    TEST_ASSERT_NOT_NULL(slow);
+    TEST_ASSERT_EQUAL_UINT32(10, slow->count);
+    TEST_ASSERT_FLOAT_WITHIN(0.5, 10.0, slow->rate());
+    TEST_ASSERT_EQUAL_UINT8(0, slow->everChangedMask);
+
+    // Same ID number as extended is another ID
+    TEST_ASSERT_NULL(stats.find(0x100, true));
+    TEST_ASSERT_FLOAT_WITHIN(1.0, 111.0, stats.frameRate());
+}
+
+void test_can_stats_dlc_change_and_id_limit() {
+    CanStatsManager stats;
+    stats.add(makeCanFrame(0, 0x7DF, {0x02, 0x01, 0x0C}));
+    stats.add(makeCanFrame(1000, 0x7DF, {0x02, 0x01, 0x0C, 0x00}));
+    TEST_ASSERT_EQUAL_UINT8(0x08, stats.find(0x7DF, false)->changedMask);
+    stats.add(makeCanFrame(2000, 0x7DF, {0x02, 0x01, 0x0D, 0x00}));
+    TEST_ASSERT_EQUAL_UINT8(0x04, stats.find(0x7DF, false)->changedMask);
+    TEST_ASSERT_EQUAL_UINT8(0x0C, stats.find(0x7DF, false)->everChangedMask);
+
+    // The table is bounded, later IDs are only counted
+    for (uint32_t id = 0; id < CanStatsManager::MaxIds + 10; ++id) {
+        stats.add(makeCanFrame(3000 + id, 0x18DA0000 + id, {0x01}, CAN_FRAME_EXTENDED));
+    }
+    TEST_ASSERT_EQUAL_UINT32(CanStatsManager::MaxIds, stats.ids().size());
+    TEST_ASSERT_EQUAL_UINT32(11, stats.totals().untracked);
+
+    // Sorted by key, standard IDs first
+    TEST_ASSERT_EQUAL_UINT32(0x7DF, stats.ids().front().id);
+    TEST_ASSERT_TRUE(stats.ids().back().extended);
+}
+
+void test_can_stats_top_view() {
+    CanStatsManager stats;
+    stats.add(makeCanFrame(0, 0x123, {0xDE, 0xAD}));
+    stats.add(makeCanFrame(1000, 0x456, {0x01}));
+    stats.add(makeCanFrame(2000, 0x456, {0x02}));
+    stats.add(makeCanFrame(3000, 0x18FEF100, {0x10, 0x20}, CAN_FRAME_EXTENDED));
+    stats.addOverflows(3);
+
+    auto lines = stats.formatTop(2);
+    TEST_ASSERT_EQUAL_UINT32(5, lines.size());
+    TEST_ASSERT_TRUE(lines[0].find("4 frames, 3 IDs") != std::string::npos);
+    TEST_ASSERT_TRUE(lines[0].find("3 overflows") != std::string::npos);
+
+    // Busiest first, the changed byte marked
+    TEST_ASSERT_TRUE(lines[3].find("456") != std::string::npos);
+    TEST_ASSERT_TRUE(lines[3].find("02*") != std::string::npos);
+    TEST_ASSERT_TRUE(lines[4].find("123") != std::string::npos);
+    TEST_ASSERT_TRUE(lines[4].find("DE AD") != std::string::npos);
+}
+
+void test_can_log_transformer_formats() {
+    CanLogTransformer transformer;
+    std::string out;
+
+    transformer.appendCandump(out, makeCanFrame(1436509052249713ULL, 0x123, {0xDE, 0xAD, 0xBE, 0xEF}));
+    transformer.appendCandump(out, makeCanFrame(5000001ULL, 0x18DAF110, {0x02, 0x10}, CAN_FRAME_EXTENDED));
+    transformer.appendCandump(out, makeCanFrame(7ULL, 0x7FF, {}, CAN_FRAME_REMOTE));
+    TEST_ASSERT_EQUAL_STRING(
+        "(1436509052.249713) can0 123#DEADBEEF\n"
+        "(5.000001) can0 18DAF110#0210\n"
+        "(0.000007) can0 7FF#R\n", out.c_str());
+
+    out = CanLogTransformer::savvyCanHeader();
+    transformer.appendSavvyCan(out, makeCanFrame(1234567ULL, 0x2E, {0x00, 0x01, 0xFF}));
+    transformer.appendSavvyCan(out, makeCanFrame(1234999ULL, 0x18DAF110, {1, 2, 3, 4, 5, 6, 7, 8}, CAN_FRAME_EXTENDED));
+    TEST_ASSERT_EQUAL_STRING(
+        "Time Stamp,ID,Extended,Dir,Bus,LEN,D1,D2,D3,D4,D5,D6,D7,D8\n"
+        "1234567,0000002E,false,Rx,0,3,00,01,FF,,,,,\n"
+        "1234999,18DAF110,true,Rx,0,8,01,02,03,04,05,06,07,08\n", out.c_str());
+}
+
+#endif
@@ -0,0 +1,173 @@
+#ifndef TEST_EDGE_STATS_MANAGER_H
+#define TEST_EDGE_STATS_MANAGER_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../src/Managers/EdgeStatsManager.h"
+
+// PWM edge stream, period and high time in ticks, +-jitter ticks on each edge
+static std::vector<EdgeEvent> makePwmEdges(uint32_t start, uint32_t period, uint32_t high,
+                                           size_t cycles, uint32_t jitter = 0) {
+    std::vector<EdgeEvent> edges;
+    uint32_t x = 0xC0FFEE;
+    auto noise = [&]() -> int32_t {
+        if (!jitter) return 0;
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        return (int32_t)(x % (2 * jitter + 1)) - (int32_t)jitter;
+    };
+    for (size_t i = 0; i < cycles; ++i) {
+        uint32_t t = start + (uint32_t)(i * period);
+        edges.push_back({t + (uint32_t)noise(), 1, 0});
+        edges.push_back({t + high + (uint32_t)noise(), 0, 0});
+    }
+    return edges;
+}
+
+void test_edge_stats_pwm_duty_and_period() {
+    // 1 kHz at 25 %, 1 MHz ticks
+    EdgeStatsManager manager(1000000);
+    auto edges = makePwmEdges(0, 1000, 250, 100);
+    manager.add(edges.data(), edges.size());
+
+    const EdgeStats& s = manager.stats();
+    TEST_ASSERT_EQUAL_UINT32(100, s.rising);
+    TEST_ASSERT_EQUAL_UINT32(100, s.falling);
+    TEST_ASSERT_EQUAL_UINT32(0, s.gaps);
+    TEST_ASSERT_EQUAL_UINT32(99, s.periods);
+    TEST_ASSERT_EQUAL_UINT32(1000, s.minPeriod);
+    TEST_ASSERT_EQUAL_UINT32(1000, s.maxPeriod);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, 1000.0, s.meanPeriod);
+    TEST_ASSERT_FLOAT_WITHIN(1e-9, 0.0, s.jitterRms());
+    // 100 high intervals, 99 low intervals
+    TEST_ASSERT_FLOAT_WITHIN(0.01, 100.0 * 25000 / (25000 + 99 * 750), s.dutyPercent());
+    TEST_ASSERT_FLOAT_WITHIN(1e-6, 1000000.0, manager.ticksToNs(1000));
+}
+
+void test_edge_stats_jitter_and_histogram() {
+    // 80 MHz ticks, 10 kHz, +-40 ticks of edge jitter
+    EdgeStatsManager manager(80000000);
+    auto edges = makePwmEdges(0, 8000, 4000, 3000, 40);
+    manager.add(edges.data(), edges.size());
+
+    const EdgeStats& s = manager.stats();
+    TEST_ASSERT_EQUAL_UINT32(2999, s.periods);
+    TEST_ASSERT_TRUE(s.minPeriod >= 8000 - 80 && s.maxPeriod <= 8000 + 80);
+    TEST_ASSERT_FLOAT_WITHIN(2.0, 8000.0, s.meanPeriod);
+    // Difference of two uniform +-40 values, sigma = 40 * sqrt(2/3) * ~1
+    TEST_ASSERT_FLOAT_WITHIN(4.0, 33.2, s.jitterRms());
+    TEST_ASSERT_FLOAT_WITHIN(1.0, 50.0, s.dutyPercent());
+
+    uint32_t low, high;
+    auto counts = manager.periodHistogram(8, low, high);
+    TEST_ASSERT_EQUAL_UINT32(8, counts.size());
+    uint32_t sum = 0;
+    for (uint32_t c : counts) sum += c;
+    TEST_ASSERT_EQUAL_UINT32(EdgeStatsManager::MaxHistogramSamples, sum);
+    TEST_ASSERT_TRUE(low >= s.minPeriod && high <= s.maxPeriod);
+    // Triangular distribution, middle bins hold more than the outer ones
+    TEST_ASSERT_TRUE(counts[3] + counts[4] > counts[0] + counts[7]);
+}
+
+void test_edge_stats_tick_wraparound() {
+    // Cycle counter wraps in the middle of the stream
+    EdgeStatsManager manager(240000000);
+    auto edges = makePwmEdges(0xFFFFFFFFu - 50000, 2400, 600, 100);
+    manager.add(edges.data(), edges.size());
+
+    const EdgeStats& s = manager.stats();
+    TEST_ASSERT_EQUAL_UINT32(99, s.periods);
+    TEST_ASSERT_EQUAL_UINT32(2400, s.minPeriod);
+    TEST_ASSERT_EQUAL_UINT32(2400, s.maxPeriod);
+    TEST_ASSERT_EQUAL_UINT64(100ull * 600, s.highTicks);
+    TEST_ASSERT_EQUAL_UINT64(99ull * 1800, s.lowTicks);
+}
+
+void test_edge_stats_gaps_break_intervals() {
+    EdgeStatsManager manager(1000000);
+    auto edges = makePwmEdges(0, 1000, 500, 20);
+
+    // Lost falling edge: two rising edges in a row
+    std::vector<EdgeEvent> missed(edges.begin(), edges.begin() + 5);
+    missed.insert(missed.end(), edges.begin() + 6, edges.end());
+    manager.add(missed.data(), missed.size());
+    TEST_ASSERT_EQUAL_UINT32(1, manager.stats().gaps);
+    // The interval across the gap is not a period
+    TEST_ASSERT_EQUAL_UINT32(1000, manager.stats().maxPeriod);
+    TEST_ASSERT_EQUAL_UINT32(2 + 16, manager.stats().periods);
+
+    // Dropped by the capture ring
+    manager.reset(1000000);
+    manager.add(edges.data(), 10);
+    manager.markGap();
+    manager.add(edges.data() + 30 - 10, 20);  // far later, same phase
+    manager.markGap();
+    manager.markGap();                        // nothing since the last gap
+    const EdgeStats& s = manager.stats();
+    TEST_ASSERT_EQUAL_UINT32(2, s.gaps);
+    TEST_ASSERT_EQUAL_UINT32(4 + 9, s.periods);
+    TEST_ASSERT_EQUAL_UINT32(1000, s.maxPeriod);
+    // 5 + 10 high intervals, 4 + 9 low intervals, none across the gap
+    TEST_ASSERT_EQUAL_UINT64(15ull * 500, s.highTicks);
+    TEST_ASSERT_EQUAL_UINT64(13ull * 500, s.lowTicks);
+
+    // Gap flagged on the first event after the drop, inside a batch
+    manager.reset(1000000);
+    std::vector<EdgeEvent> tagged(edges.begin(), edges.begin() + 10);
+    tagged.insert(tagged.end(), edges.begin() + 20, edges.end());
+    tagged[10].gap = 1;
+    manager.add(tagged.data(), tagged.size());
+    TEST_ASSERT_EQUAL_UINT32(1, manager.stats().gaps);
+    TEST_ASSERT_EQUAL_UINT32(4 + 9, manager.stats().periods);
+    TEST_ASSERT_EQUAL_UINT32(1000, manager.stats().maxPeriod);
+}
+
+void test_edge_stats_report_text() {
+    EdgeStatsManager manager(1000000);
+    auto report = manager.formatReport();
+    TEST_ASSERT_EQUAL_UINT32(1, report.size());
+    TEST_ASSERT_EQUAL_STRING("  • Period:          not enough edges", report[0].c_str());
+
+    auto edges = makePwmEdges(0, 1000, 250, 10);
+    edges[10].ticks += 20;  // one slower and one faster period
+    manager.add(edges.data(), edges.size());
+    report = manager.formatReport(4);
+
+    std::string text;
+    for (const auto& line : report) text += line + "\n";
+    TEST_ASSERT_TRUE(text.find("Duty cycle:      2") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("Period:          1.000 ms (min 980.000 us, max 1.020 ms)") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("Edge frequency:  1000.000 Hz") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("40.000 us p-p") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("Period histogram:") != std::string::npos);
+    TEST_ASSERT_TRUE(text.find("Gaps") == std::string::npos);
+    TEST_ASSERT_EQUAL_UINT32(5 + 4, report.size());
+
+    TEST_ASSERT_EQUAL_STRING("12.5 ns", EdgeStatsManager::formatDuration(12.5).c_str());
+    TEST_ASSERT_EQUAL_STRING("1.250 us", EdgeStatsManager::formatDuration(1250).c_str());
+    TEST_ASSERT_EQUAL_STRING("2.000 s", EdgeStatsManager::formatDuration(2e9).c_str());
+}
+
+void test_edge_stats_throughput() {
+    // The DIO loop drains the ring in batches, this must stay far above
+    // the edge rate the interrupt can deliver
+    auto edges = makePwmEdges(0, 2400, 1200, 500000, 20);
+    EdgeStatsManager manager(240000000);
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t off = 0; off < edges.size(); off += 128) {
+        size_t n = std::min<size_t>(128, edges.size() - off);
+        manager.add(&edges[off], n);
+    }
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    TEST_ASSERT_EQUAL_UINT32(500000 - 1, manager.stats().periods);
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "Edge stats: %.1f M edges/s", edges.size() / secs / 1e6);
+    TEST_MESSAGE(msg);
+}
+
+#endif
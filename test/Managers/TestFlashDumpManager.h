@@ -0,0 +1,156 @@
+#ifndef TEST_FLASH_DUMP_MANAGER_H
+#define TEST_FLASH_DUMP_MANAGER_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include "../src/Managers/FlashDumpManager.h"
+#include "../src/Transformers/XmodemTransformer.h"
+#include "SimulatedFlashChip.h"
+
+void test_flash_dump_crc32_reference() {
+    const char* check = "123456789";
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, FlashDumpManager::crc32((const uint8_t*)check, 9));
+
+    // Continued over two calls
+    uint32_t crc = FlashDumpManager::crc32((const uint8_t*)check, 4);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, FlashDumpManager::crc32((const uint8_t*)check + 4, 5, crc));
+}
+
+void test_flash_dump_full_image() {
+    // Length not a multiple of the block size
+    SimulatedFlashChip chip(100000);
+    FlashDumpManager dump(chip);
+    FlashDumpManager::Options options;
+    options.blockSize = 4096;
+    options.dualOutput = true;
+
+    std::vector<uint8_t> out;
+    uint32_t expectedAddress = 0x100;
+    bool ordered = true;
+    auto stats = dump.run(0x100, 100000 - 0x100, options, [&](uint32_t address, const uint8_t* data, size_t len) {
+        if (address != expectedAddress) ordered = false;
+        expectedAddress += len;
+        out.insert(out.end(), data, data + len);
+        return true;
+    });
+
+    TEST_ASSERT_TRUE(ordered);
+    TEST_ASSERT_FALSE(stats.stopped);
+    TEST_ASSERT_EQUAL(100000 - 0x100, stats.bytes);
+    TEST_ASSERT_EQUAL(0, chip.outOfRange);
+    TEST_ASSERT_EQUAL_MEMORY(chip.image.data() + 0x100, out.data(), out.size());
+    TEST_ASSERT_EQUAL_HEX32(FlashDumpManager::crc32(chip.image.data() + 0x100, out.size()), stats.crc32);
+
+    // Bulk session opened with dual output, closed, buffers given back
+    TEST_ASSERT_EQUAL(1, chip.bulkSessions);
+    TEST_ASSERT_TRUE(chip.dual);
+    TEST_ASSERT_FALSE(chip.bulk);
+    TEST_ASSERT_EQUAL(0, chip.buffersLive);
+}
+
+void test_flash_dump_stop_from_output() {
+    SimulatedFlashChip chip(64 * 1024);
+    FlashDumpManager dump(chip);
+    FlashDumpManager::Options options;
+    options.blockSize = 1024;
+
+    int blocks = 0;
+    auto stats = dump.run(0, 64 * 1024, options, [&](uint32_t, const uint8_t*, size_t) {
+        return ++blocks < 3;
+    });
+
+    TEST_ASSERT_TRUE(stats.stopped);
+    TEST_ASSERT_EQUAL(3, blocks);
+    TEST_ASSERT_EQUAL(3 * 1024, stats.bytes);
+
+    // CRC of what was handed out, not of what the reader got ahead
+    TEST_ASSERT_EQUAL_HEX32(FlashDumpManager::crc32(chip.image.data(), 3 * 1024), stats.crc32);
+    TEST_ASSERT_TRUE(chip.reads <= 5);
+    TEST_ASSERT_EQUAL(0, chip.buffersLive);
+
+    // Stop callback
+    int calls = 0;
+    stats = dump.run(0, 64 * 1024, options, [](uint32_t, const uint8_t*, size_t) { return true; },
+                     [&]() { return ++calls > 4; });
+    TEST_ASSERT_TRUE(stats.stopped);
+    TEST_ASSERT_TRUE(stats.bytes < 64 * 1024);
+}
+
+void test_flash_dump_hex_lines() {
+    const uint8_t data[20] = {'H', 'e', 'l', 'l', 'o', 0x00, 0xFF, 0x7F, 0x20, 0x41, 0, 0, 0, 0, 0, 0x10,
+                              0xDE, 0xAD, 0xBE, 0xEF};
+    std::string out;
+    FlashDumpManager::appendHexLines(out, 0x00FF00, data, sizeof(data));
+
+    TEST_ASSERT_EQUAL_STRING(
+        "00FF00: 48 65 6C 6C 6F 00 FF 7F 20 41 00 00 00 00 00 10  Hello... A......\r\n"
+        "00FF10: DE AD BE EF                                      ....\r\n",
+        out.c_str());
+}
+
+void test_flash_dump_xmodem_packet() {
+    const char* check = "123456789";
+    TEST_ASSERT_EQUAL_HEX32(0x31C3, XmodemTransformer::crc16((const uint8_t*)check, 9));
+
+    XmodemTransformer xmodem;
+    uint8_t packet[XmodemTransformer::PacketSize];
+    size_t len = xmodem.buildPacket(0xFF, (const uint8_t*)check, 9, packet);
+
+    TEST_ASSERT_EQUAL(1029, len);
+    TEST_ASSERT_EQUAL_HEX8(XmodemTransformer::STX, packet[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, packet[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, packet[2]);
+    TEST_ASSERT_EQUAL_MEMORY(check, packet + 3, 9);
+    TEST_ASSERT_EQUAL_HEX8(XmodemTransformer::PAD, packet[3 + 9]);
+    TEST_ASSERT_EQUAL_HEX8(XmodemTransformer::PAD, packet[3 + 1023]);
+
+    uint16_t crc = XmodemTransformer::crc16(packet + 3, 1024);
+    TEST_ASSERT_EQUAL_HEX8(crc >> 8, packet[1027]);
+    TEST_ASSERT_EQUAL_HEX8(crc & 0xFF, packet[1028]);
+}
+
+void test_flash_dump_overlaps_read_and_output() {
+    // 512 KB at 20 MHz, output as slow as the bus (a busy terminal)
+    const uint32_t size = 512 * 1024;
+    const size_t block = 4096;
+    SimulatedFlashChip chip(size);
+    chip.busHz = 20000000;
+    auto outputCost = std::chrono::microseconds(1600);
+
+    // Old way, read then output
+    std::vector<uint8_t> buffer(block);
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t address = 0; address < size; address += block) {
+        chip.readFlashData(address, buffer.data(), block);
+        std::this_thread::sleep_for(outputCost);
+    }
+    double sequentialSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    // Double buffered
+    FlashDumpManager dump(chip);
+    FlashDumpManager::Options options;
+    options.blockSize = block;
+    t0 = std::chrono::steady_clock::now();
+    auto stats = dump.run(0, size, options, [&](uint32_t, const uint8_t*, size_t) {
+        std::this_thread::sleep_for(outputCost);
+        return true;
+    });
+    double overlappedSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    TEST_ASSERT_EQUAL(size, stats.bytes);
+    TEST_ASSERT_EQUAL_HEX32(FlashDumpManager::crc32(chip.image.data(), size), stats.crc32);
+    TEST_ASSERT_TRUE(overlappedSecs < sequentialSecs);
+
+    double mb = size / 1048576.0;
+    char msg[200];
+    snprintf(msg, sizeof(msg), "Flash dump @20 MHz: sequential %.2f MB/s, double buffered %.2f MB/s (x%.2f), %s",
+             mb / sequentialSecs, mb / overlappedSecs, sequentialSecs / overlappedSecs,
+             dump.formatStats(stats).c_str());
+    TEST_MESSAGE(msg);
+}
+
+#endif // TEST_FLASH_DUMP_MANAGER_H
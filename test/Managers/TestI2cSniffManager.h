@@ -0,0 +1,200 @@
+#ifndef TEST_I2C_SNIFF_MANAGER_H
+#define TEST_I2C_SNIFF_MANAGER_H
+
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "../src/Managers/I2cSniffManager.h"
+#include "../src/Transformers/I2cSniffTransformer.h"
+
+// Recorded bus events, 100 kHz bus on a 1 MHz tick: 90 ticks per byte with its ACK
+struct I2cEventRecorder {
+    std::vector<I2cSnifferEvent> events;
+    uint32_t ticks;
+
+    explicit I2cEventRecorder(uint32_t start = 1000) : ticks(start) {}
+
+    void push(I2cSnifferEventType type, uint8_t value, uint32_t after) {
+        ticks += after;
+        events.push_back({ticks, type, value, 0});
+    }
+    void start() { push(I2cSnifferEventType::Start, 0, 10); }
+    void stop() { push(I2cSnifferEventType::Stop, 0, 10); }
+    void byte(I2cSnifferEventType type, uint8_t value, bool ack) {
+        push(type, value, 80);
+        push(I2cSnifferEventType::Ack, ack ? 0 : 1, 10);
+    }
+    void address(uint8_t addr, bool read, bool ack = true) {
+        byte(I2cSnifferEventType::Address, (uint8_t)((addr << 1) | (read ? 1 : 0)), ack);
+    }
+    void data(uint8_t value, bool ack = true) { byte(I2cSnifferEventType::Data, value, ack); }
+};
+
+struct I2cTransactionLog {
+    std::vector<I2cTransaction> items;
+    I2cSniffManager::Handler handler() {
+        return [this](const I2cTransaction& t) { items.push_back(t); };
+    }
+};
+
+void test_i2c_sniff_register_read_with_repeated_start() {
+    // Write register 0x0F then read 2 bytes, master NACKs the last one
+    I2cEventRecorder rec;
+    rec.start();
+    rec.address(0x68, false);
+    rec.data(0x0F);
+    rec.start();
+    rec.address(0x68, true);
+    rec.data(0x12);
+    rec.data(0x34, false);
+    rec.stop();
+
+    I2cTransactionLog log;
+    I2cSniffManager decoder(log.handler());
+    decoder.add(rec.events.data(), rec.events.size());
+
+    TEST_ASSERT_EQUAL_UINT32(2, log.items.size());
+    const I2cTransaction& w = log.items[0];
+    TEST_ASSERT_EQUAL_UINT8(0x68, w.address);
+    TEST_ASSERT_FALSE(w.read);
+    TEST_ASSERT_TRUE(w.addressAck);
+    TEST_ASSERT_TRUE(w.repeatedStart);
+    TEST_ASSERT_FALSE(w.incomplete);
+    TEST_ASSERT_EQUAL_UINT32(1, w.data.size());
+    TEST_ASSERT_EQUAL_UINT8(0x0F, w.data[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, w.startTicks);
+    TEST_ASSERT_EQUAL_UINT32(190, w.durationTicks);
+
+    const I2cTransaction& r = log.items[1];
+    TEST_ASSERT_TRUE(r.read);
+    TEST_ASSERT_FALSE(r.repeatedStart);
+    TEST_ASSERT_EQUAL_UINT32(2, r.data.size());
+    TEST_ASSERT_TRUE(r.acks[0]);
+    TEST_ASSERT_FALSE(r.acks[1]);
+    TEST_ASSERT_EQUAL_UINT32(280, r.durationTicks);
+
+    TEST_ASSERT_EQUAL_UINT32(2, decoder.stats().transactions);
+    TEST_ASSERT_EQUAL_UINT32(3, decoder.stats().bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, decoder.stats().nacks);
+}
+
+void test_i2c_sniff_address_nack_and_tick_wraparound() {
+    // Probe of an absent device, recorded across the counter wrap
+    I2cEventRecorder rec(0xFFFFFFF0u);
+    rec.start();
+    rec.address(0x50, false, false);
+    rec.stop();
+    rec.start();
+    rec.address(0x3C, false);
+    rec.data(0x00);
+    rec.data(0xAF);
+    rec.stop();
+
+    I2cTransactionLog log;
+    I2cSniffManager decoder(log.handler());
+    for (const auto& e : rec.events) decoder.add(e);
+
+    TEST_ASSERT_EQUAL_UINT32(2, log.items.size());
+    TEST_ASSERT_FALSE(log.items[0].addressAck);
+    TEST_ASSERT_EQUAL_UINT32(0, log.items[0].data.size());
+    TEST_ASSERT_EQUAL_UINT32(100, log.items[0].durationTicks);
+    TEST_ASSERT_EQUAL_UINT32(110, log.items[1].startTicks);
+    TEST_ASSERT_EQUAL_UINT32(280, log.items[1].durationTicks);
+    TEST_ASSERT_FALSE(decoder.inTransaction());
+}
+
+void test_i2c_sniff_gaps_and_stray_events() {
+    I2cEventRecorder rec;
+    rec.address(0x20, false);          // no START seen, capture began mid frame
+    rec.stop();
+    rec.start();
+    rec.address(0x20, false);
+    rec.data(0x01);
+
+    I2cTransactionLog log;
+    I2cSniffManager decoder(log.handler());
+    decoder.add(rec.events.data(), rec.events.size());
+    TEST_ASSERT_EQUAL_UINT32(3, decoder.stats().strayEvents);
+    TEST_ASSERT_TRUE(decoder.inTransaction());
+
+    // Events dropped, the open transaction is closed as incomplete
+    decoder.markGap();
+    TEST_ASSERT_EQUAL_UINT32(1, log.items.size());
+    TEST_ASSERT_TRUE(log.items[0].incomplete);
+    TEST_ASSERT_EQUAL_UINT8(0x01, log.items[0].data[0]);
+
+    // Data byte whose ACK was lost
+    I2cEventRecorder lost;
+    lost.start();
+    lost.address(0x20, false);
+    lost.push(I2cSnifferEventType::Data, 0x55, 80);
+    lost.data(0x66);
+    lost.stop();
+    decoder.add(lost.events.data(), lost.events.size());
+    TEST_ASSERT_EQUAL_UINT32(2, log.items.size());
+    TEST_ASSERT_TRUE(log.items[1].incomplete);
+    TEST_ASSERT_EQUAL_UINT32(2, log.items[1].data.size());
+    TEST_ASSERT_EQUAL_UINT32(2, log.items[1].acks.size());
+    TEST_ASSERT_EQUAL_UINT32(2, decoder.stats().incomplete);
+
+    // Drop flagged mid batch, only the transaction open at the hole is cut
+    I2cEventRecorder tagged;
+    tagged.start();
+    tagged.address(0x30, false);
+    tagged.data(0x11);
+    size_t hole = tagged.events.size();
+    tagged.data(0x22);
+    tagged.stop();
+    tagged.start();
+    tagged.address(0x30, false);
+    tagged.data(0x33);
+    tagged.stop();
+    tagged.events[hole].gap = 1;
+    decoder.add(tagged.events.data(), tagged.events.size());
+    TEST_ASSERT_EQUAL_UINT32(4, log.items.size());
+    TEST_ASSERT_TRUE(log.items[2].incomplete);
+    TEST_ASSERT_EQUAL_UINT32(1, log.items[2].data.size());
+    TEST_ASSERT_EQUAL_UINT8(0x11, log.items[2].data[0]);
+    TEST_ASSERT_FALSE(log.items[3].incomplete);
+    TEST_ASSERT_EQUAL_UINT8(0x33, log.items[3].data[0]);
+}
+
+void test_i2c_sniff_transformer_formats() {
+    I2cTransaction t;
+    t.startTicks = 2500000;            // 2.5 s at 1 MHz
+    t.durationTicks = 425;
+    t.address = 0x3C;
+    t.addressAck = true;
+    t.data = {0x00, 0xAF};
+    t.acks = {true, false};
+
+    I2cSniffTransformer transformer(1000000);
+    TEST_ASSERT_EQUAL_STRING("[S] ADDR 0x3C W <ACK> 0x00 <ACK> 0xAF <NACK> [P]  425.0 us",
+                             transformer.toLine(t).c_str());
+    TEST_ASSERT_EQUAL_STRING("2500000000,425000,0x3C,W,1,00AF,1,P", transformer.toCsv(t).c_str());
+
+    t.repeatedStart = true;
+    t.read = true;
+    TEST_ASSERT_EQUAL_STRING("2500000000,425000,0x3C,R,1,00AF,1,Sr", transformer.toCsv(t).c_str());
+
+    // PCAP, linktype 209, pseudo header then address byte and data
+    std::string header = transformer.pcapHeader();
+    TEST_ASSERT_EQUAL_UINT32(24, header.size());
+    TEST_ASSERT_EQUAL_UINT8(209, (uint8_t)header[20]);
+
+    std::string record;
+    transformer.appendPcapRecord(record, t);
+    TEST_ASSERT_EQUAL_UINT32(16 + 5 + 3, record.size());
+    TEST_ASSERT_EQUAL_UINT8(2, (uint8_t)record[0]);         // seconds
+    TEST_ASSERT_EQUAL_UINT8(0x20, (uint8_t)record[4]);      // 500000 us, little endian
+    TEST_ASSERT_EQUAL_UINT8(8, (uint8_t)record[8]);
+    TEST_ASSERT_EQUAL_UINT8(1, (uint8_t)record[20]);        // read flag
+    TEST_ASSERT_EQUAL_UINT8(0x79, (uint8_t)record[21]);
+    TEST_ASSERT_EQUAL_UINT8(0xAF, (uint8_t)record[23]);
+
+    // 240 MHz cycle counter
+    transformer.setTickRate(240000000);
+    TEST_ASSERT_EQUAL_UINT64(1000, transformer.ticksToNs(240));
+}
+
+#endif
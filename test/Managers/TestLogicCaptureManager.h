@@ -0,0 +1,340 @@
+#ifndef TEST_LOGIC_CAPTURE_MANAGER_H
+#define TEST_LOGIC_CAPTURE_MANAGER_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../src/Managers/LogicCaptureManager.h"
+#include "../src/Transformers/LogicExportTransformer.h"
+#include "../src/Transformers/SumpTransformer.h"
+
+// Synthetic waveforms: CH0 a UART line (8N1, 10 samples per bit) sending
+// 0x55 at uartStart, CH1 a clock toggling every 4 samples, CH2 low.
+struct SyntheticLogicSource {
+    uint32_t index = 0;
+    uint32_t uartStart = 5000;
+    uint32_t stopAfter = 0;     // stopRequested() true after that many samples, 0 never
+    uint32_t polls = 0;
+
+    static uint8_t uartLevel(uint32_t i, uint32_t start) {
+        if (i < start) return 1;
+        uint32_t bit = (i - start) / 10;
+        if (bit == 0) return 0;                     // start bit
+        if (bit <= 8) return (0x55 >> (bit - 1)) & 1;
+        return 1;                                   // stop bit, idle
+    }
+
+    uint8_t at(uint32_t i) const {
+        return (uint8_t)(uartLevel(i, uartStart) | (((i / 4) & 1) << 1));
+    }
+
+    uint8_t sample() { return at(index++); }
+
+    bool stopRequested() {
+        polls++;
+        return stopAfter && index >= stopAfter;
+    }
+};
+
+void test_logic_trigger_edges_and_pattern() {
+    LogicTrigger t;
+    TEST_ASSERT_FALSE(t.enabled());
+
+    t.edgeMask = 0x01;
+    t.edge = LogicTrigger::Rising;
+    TEST_ASSERT_TRUE(t.fires(0x00, 0x01));
+    TEST_ASSERT_FALSE(t.fires(0x01, 0x00));
+    TEST_ASSERT_FALSE(t.fires(0x00, 0x02));  // other channel
+
+    t.edge = LogicTrigger::Falling;
+    TEST_ASSERT_TRUE(t.fires(0x01, 0x00));
+    TEST_ASSERT_FALSE(t.fires(0x00, 0x01));
+
+    t.edge = LogicTrigger::Either;
+    TEST_ASSERT_TRUE(t.fires(0x01, 0x00));
+    TEST_ASSERT_TRUE(t.fires(0x00, 0x01));
+
+    // Edge on CH0 while CH2 is high
+    t.patternMask = 0x04;
+    t.patternValue = 0x04;
+    TEST_ASSERT_FALSE(t.fires(0x00, 0x01));
+    TEST_ASSERT_TRUE(t.fires(0x04, 0x05));
+
+    // Pattern only
+    LogicTrigger p;
+    p.patternMask = 0x03;
+    p.patternValue = 0x02;
+    TEST_ASSERT_TRUE(p.enabled());
+    TEST_ASSERT_TRUE(p.fires(0xFF, 0x06));
+    TEST_ASSERT_FALSE(p.fires(0xFF, 0x03));
+}
+
+void test_logic_capture_pre_trigger_window() {
+    SyntheticLogicSource source;
+    std::vector<uint8_t> buffer(2000);
+
+    // Falling edge on CH0, the UART start bit
+    LogicCaptureOptions options;
+    options.depth = 2000;
+    options.preTrigger = 300;
+    options.trigger.edgeMask = 0x01;
+    options.trigger.edge = LogicTrigger::Falling;
+
+    LogicCaptureStats stats = LogicCaptureManager::capture(source, options, buffer.data());
+    TEST_ASSERT_TRUE(stats.triggered);
+    TEST_ASSERT_FALSE(stats.stopped);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.first);
+    TEST_ASSERT_EQUAL_UINT32(2000, stats.samples);
+    TEST_ASSERT_EQUAL_UINT32(300, stats.triggerSample);
+
+    // Sample n of the capture is synthetic sample uartStart - 300 + n
+    uint32_t origin = source.uartStart - 300;
+    for (uint32_t n = 0; n < stats.samples; ++n) {
+        TEST_ASSERT_EQUAL_UINT8(source.at(origin + n), buffer[stats.first + n]);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0, buffer[300] & 1);
+    TEST_ASSERT_EQUAL_UINT8(1, buffer[299] & 1);
+}
+
+void test_logic_capture_short_pre_trigger_and_stop() {
+    // Trigger before the ring is full, the capture starts at the first sample
+    SyntheticLogicSource early;
+    early.uartStart = 50;
+    std::vector<uint8_t> buffer(1000);
+    LogicCaptureOptions options;
+    options.depth = 1000;
+    options.preTrigger = 400;
+    options.trigger.edgeMask = 0x01;
+    options.trigger.edge = LogicTrigger::Falling;
+
+    LogicCaptureStats stats = LogicCaptureManager::capture(early, options, buffer.data());
+    TEST_ASSERT_TRUE(stats.triggered);
+    TEST_ASSERT_EQUAL_UINT32(50, stats.triggerSample);
+    TEST_ASSERT_EQUAL_UINT32(400 - 50, stats.first);
+    TEST_ASSERT_EQUAL_UINT32(50 + 600, stats.samples);
+    for (uint32_t n = 0; n < stats.samples; ++n) {
+        TEST_ASSERT_EQUAL_UINT8(early.at(n), buffer[stats.first + n]);
+    }
+
+    // Never triggers, stop is polled while armed
+    SyntheticLogicSource idle;
+    idle.uartStart = 0xFFFFFFFF;
+    idle.stopAfter = 20000;
+    options.trigger.edgeMask = 0x04;
+    stats = LogicCaptureManager::capture(idle, options, buffer.data());
+    TEST_ASSERT_TRUE(stats.stopped);
+    TEST_ASSERT_FALSE(stats.triggered);
+    TEST_ASSERT_EQUAL_UINT32(400, stats.samples);
+    TEST_ASSERT_TRUE(idle.polls >= 4);
+    uint32_t last = idle.index - 1;  // sample that saw the stop, not stored
+    for (uint32_t n = 0; n < 400; ++n) {
+        TEST_ASSERT_EQUAL_UINT8(idle.at(last - 400 + n), buffer[stats.first + n]);
+    }
+
+    // No trigger, depth samples right away
+    SyntheticLogicSource free;
+    LogicCaptureOptions plain;
+    plain.depth = 1000;
+    plain.preTrigger = 500;
+    stats = LogicCaptureManager::capture(free, plain, buffer.data());
+    TEST_ASSERT_FALSE(stats.triggered);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.first);
+    TEST_ASSERT_EQUAL_UINT32(1000, stats.samples);
+    TEST_ASSERT_EQUAL_UINT32(1000, free.index);
+}
+
+void test_logic_trace_run_length_round_trip() {
+    SyntheticLogicSource source;
+    std::vector<uint8_t> samples(20000);
+    for (uint32_t i = 0; i < samples.size(); ++i) samples[i] = source.at(i);
+
+    // Appended in uneven pieces, runs continue across calls
+    LogicTrace trace;
+    for (size_t off = 0; off < samples.size();) {
+        size_t n = std::min<size_t>(samples.size() - off, 1 + off % 777);
+        trace.append(&samples[off], n);
+        off += n;
+    }
+    TEST_ASSERT_EQUAL_UINT32(samples.size(), trace.sampleCount());
+    size_t changes = 1;
+    for (size_t i = 1; i < samples.size(); ++i) changes += samples[i] != samples[i - 1];
+    TEST_ASSERT_EQUAL(changes, trace.runCount());
+
+    std::vector<uint8_t> out(samples.size());
+    TEST_ASSERT_EQUAL(samples.size(), trace.expand(0, out.data(), out.size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(samples.data(), out.data(), samples.size());
+
+    uint8_t window[10];
+    TEST_ASSERT_EQUAL(10, trace.expand(5003, window, 10));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(&samples[5003], window, 10);
+    TEST_ASSERT_EQUAL(5, trace.expand(19995, window, 10));
+
+    // Runs longer than MaxRun are split
+    LogicTrace flat;
+    std::vector<uint8_t> ones(1 << 20, 0x01);
+    for (int i = 0; i < 17; ++i) flat.append(ones.data(), ones.size());
+    TEST_ASSERT_EQUAL_UINT32(17u << 20, flat.sampleCount());
+    TEST_ASSERT_EQUAL(2, flat.runCount());
+
+    // A toggling input over the run budget keeps the samples that fit
+    std::vector<uint8_t> toggling(4096);
+    for (size_t i = 0; i < toggling.size(); ++i) toggling[i] = (uint8_t)(i & 1);
+    TEST_ASSERT_EQUAL(toggling.size(), LogicTrace::countRuns(toggling.data(), toggling.size()));
+    TEST_ASSERT_EQUAL(changes, LogicTrace::countRuns(samples.data(), samples.size()));
+
+    LogicTrace limited;
+    LogicCaptureStats stats;
+    stats.samples = (uint32_t)toggling.size();
+    stats.triggerSample = 3000;
+    stats.triggered = true;
+    LogicCaptureManager::toTrace(toggling.data(), stats, limited, 1000);
+    TEST_ASSERT_TRUE(limited.truncated());
+    TEST_ASSERT_EQUAL(1000, limited.runCount());
+    TEST_ASSERT_EQUAL_UINT32(1000, limited.sampleCount());
+    TEST_ASSERT_FALSE(limited.triggered);
+    TEST_ASSERT_EQUAL(1000, limited.expand(0, out.data(), out.size()));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(toggling.data(), out.data(), 1000);
+}
+
+void test_logic_export_ols_and_vcd() {
+    const uint8_t samples[] = {0x01, 0x01, 0x03, 0x03, 0x03, 0x02, 0x02, 0x00};
+    LogicTrace trace;
+    trace.pins = {4, 5};
+    trace.sampleRate = 1000000;
+    trace.append(samples, sizeof(samples));
+    trace.triggerSample = 2;
+    trace.triggered = true;
+
+    LogicExportTransformer exporter;
+    std::string ols;
+    exporter.toOls(trace, [&](const std::string& chunk) { ols += chunk; });
+    TEST_ASSERT_TRUE(ols.find(";Size: 8\n") != std::string::npos);
+    TEST_ASSERT_TRUE(ols.find(";Rate: 1000000\n") != std::string::npos);
+    TEST_ASSERT_TRUE(ols.find(";Channels: 2\n") != std::string::npos);
+    TEST_ASSERT_TRUE(ols.find(";TriggerPosition: 2\n") != std::string::npos);
+    TEST_ASSERT_TRUE(ols.find("00000001@0\n00000003@2\n00000002@5\n00000000@7\n") != std::string::npos);
+    TEST_ASSERT_EQUAL(ols.size() - 11, ols.find("00000000@7\n"));
+
+    // A last run longer than one sample gets an end marker
+    trace.append(samples + 7, 1);
+    ols.clear();
+    exporter.toOls(trace, [&](const std::string& chunk) { ols += chunk; });
+    TEST_ASSERT_TRUE(ols.find("00000000@7\n00000000@8\n") != std::string::npos);
+
+    std::string vcd;
+    exporter.toVcd(trace, [&](const std::string& chunk) { vcd += chunk; });
+    TEST_ASSERT_TRUE(vcd.find("$timescale 1 ns $end") != std::string::npos);
+    TEST_ASSERT_TRUE(vcd.find("$var wire 1 ! GPIO4 $end") != std::string::npos);
+    TEST_ASSERT_TRUE(vcd.find("$var wire 1 \" GPIO5 $end") != std::string::npos);
+    TEST_ASSERT_TRUE(vcd.find("#0 1! 0\"\n#2000 1\"\n#5000 0!\n#7000 0\"\n#9000\n") != std::string::npos);
+}
+
+void test_logic_sump_session() {
+    SumpTransformer sump;
+    SumpTransformer::Config config;
+    SumpCommand command;
+
+    // Reset, divider 99 (1 MHz), read 1024 / delay 512, flags groups 1-3 off,
+    // trigger mask 0x01 value 0x00, then ID and run
+    const uint8_t stream[] = {
+        0x00, 0x00,
+        0x80, 99, 0, 0, 0,
+        0x81, 0xFF, 0x00, 0x7F, 0x00,
+        0x82, 0x38, 0x00, 0x00, 0x00,
+        0xC0, 0x01, 0x00, 0x00, 0x00,
+        0xC1, 0x00, 0x00, 0x00, 0x00,
+        0x02, 0x01
+    };
+    std::vector<uint8_t> opcodes;
+    for (uint8_t b : stream) {
+        if (!sump.feed(b, command)) {
+            TEST_ASSERT_FALSE(sump.idle());
+            continue;
+        }
+        opcodes.push_back(command.opcode);
+        sump.apply(command, config);
+    }
+    TEST_ASSERT_TRUE(sump.idle());
+    const uint8_t expected[] = {0x00, 0x00, 0x80, 0x81, 0x82, 0xC0, 0xC1, 0x02, 0x01};
+    TEST_ASSERT_EQUAL(sizeof(expected), opcodes.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, opcodes.data(), sizeof(expected));
+
+    TEST_ASSERT_EQUAL_UINT32(1000000, config.sampleRate);
+    TEST_ASSERT_EQUAL_UINT32(1024, config.readCount);
+    TEST_ASSERT_EQUAL_UINT32(512, config.delayCount);
+    TEST_ASSERT_EQUAL_UINT8(1, SumpTransformer::groupCount(config.flags));
+
+    LogicCaptureOptions options = sump.captureOptions(config, 65536);
+    TEST_ASSERT_EQUAL_UINT32(1024, options.depth);
+    TEST_ASSERT_EQUAL_UINT32(512, options.preTrigger);
+    TEST_ASSERT_EQUAL_UINT8(0x01, options.trigger.patternMask);
+    TEST_ASSERT_EQUAL_UINT8(0x00, options.trigger.patternValue);
+    TEST_ASSERT_EQUAL_UINT32(256, sump.captureOptions(config, 256).depth);
+
+    TEST_ASSERT_EQUAL_STRING("1ALS", sump.idReply().c_str());
+    std::string meta = sump.metadataReply("BP", 65536, 8000000, 4);
+    const uint8_t metaExpected[] = {0x01, 'B', 'P', 0x00, 0x21, 0x00, 0x01, 0x00, 0x00,
+                                    0x23, 0x00, 0x7A, 0x12, 0x00, 0x40, 0x04, 0x41, 0x02, 0x00};
+    TEST_ASSERT_EQUAL(sizeof(metaExpected), meta.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(metaExpected, (const uint8_t*)meta.data(), meta.size());
+
+    // Newest first, padded to readCount, then with two groups enabled
+    const uint8_t captured[] = {1, 2, 3};
+    config.readCount = 5;
+    std::string sent;
+    sump.sendSamples(captured, 3, config, [&](const std::string& chunk) { sent += chunk; });
+    const uint8_t oneGroup[] = {3, 2, 1, 0, 0};
+    TEST_ASSERT_EQUAL(5, sent.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(oneGroup, (const uint8_t*)sent.data(), 5);
+
+    config.flags = 0x30;
+    config.readCount = 3;
+    sent.clear();
+    sump.sendSamples(captured, 3, config, [&](const std::string& chunk) { sent += chunk; });
+    const uint8_t twoGroups[] = {3, 0, 2, 0, 1, 0};
+    TEST_ASSERT_EQUAL(6, sent.size());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(twoGroups, (const uint8_t*)sent.data(), 6);
+}
+
+void test_logic_capture_and_compress_throughput() {
+    // 8 channel source with sparse edges, like a slow bus sampled fast
+    struct BusSource {
+        uint32_t index = 0;
+        uint8_t sample() { uint32_t i = index++; return (uint8_t)((i >> 7) ^ (i >> 11)); }
+        bool stopRequested() { return false; }
+    };
+
+    const uint32_t depth = 4 * 1024 * 1024;
+    std::vector<uint8_t> buffer(depth);
+    LogicCaptureOptions options;
+    options.depth = depth;
+    options.preTrigger = depth / 10;
+    options.trigger.edgeMask = 0x80;
+    options.trigger.edge = LogicTrigger::Rising;
+
+    BusSource source;
+    auto t0 = std::chrono::steady_clock::now();
+    LogicCaptureStats stats = LogicCaptureManager::capture(source, options, buffer.data());
+    double captureSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    t0 = std::chrono::steady_clock::now();
+    LogicTrace trace;
+    LogicCaptureManager::toTrace(buffer.data(), stats, trace);
+    double compressSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    TEST_ASSERT_TRUE(stats.triggered);
+    TEST_ASSERT_EQUAL_UINT32(stats.samples, trace.sampleCount());
+    TEST_ASSERT_TRUE(stats.samples > depth - options.preTrigger);
+
+    char msg[200];
+    snprintf(msg, sizeof(msg), "Logic capture: %.0f MS/s capture, %.0f MS/s RLE, %u samples in %u bytes (x%.0f)",
+             source.index / captureSecs / 1e6, depth / compressSecs / 1e6,
+             trace.sampleCount(), (unsigned)trace.compressedBytes(),
+             (double)trace.sampleCount() / trace.compressedBytes());
+    TEST_MESSAGE(msg);
+}
+
+#endif // TEST_LOGIC_CAPTURE_MANAGER_H
@@ -0,0 +1,85 @@
+#ifndef TEST_MODE_FOOTPRINT_MANAGER_H
+#define TEST_MODE_FOOTPRINT_MANAGER_H
+
+#include <unity.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../src/Managers/ModeFootprintManager.h"
+
+// Heap as a counter the modules below allocate from
+struct FootprintTestHeap {
+    uint32_t freeHeap = 300000;
+    uint32_t freePsram = 8000000;
+    uint32_t us = 0;
+};
+
+struct FootprintTestModule {
+    FootprintTestHeap& heap;
+    uint32_t bytes, psram;
+    FootprintTestModule(FootprintTestHeap& heap, uint32_t bytes, uint32_t psram) : heap(heap), bytes(bytes), psram(psram) {
+        heap.freeHeap -= bytes;
+        heap.freePsram -= psram;
+        heap.us += 1500;
+    }
+    ~FootprintTestModule() {
+        heap.freeHeap += bytes;
+        heap.freePsram += psram;
+    }
+};
+
+void test_mode_footprint_build_and_release() {
+    FootprintTestHeap heap;
+    ModeFootprintManager footprints;
+    footprints.setProbe([&]() { return ModeFootprintManager::Memory{heap.freeHeap, heap.freePsram}; });
+    footprints.setClock([&]() { return heap.us; });
+
+    std::unique_ptr<FootprintTestModule> can, subGhz;
+    footprints.build("CAN", [&]() { can.reset(new FootprintTestModule(heap, 2048, 0)); });
+    footprints.build("SubGHz", [&]() { subGhz.reset(new FootprintTestModule(heap, 6144, 65536)); });
+
+    const ModeFootprint* canPrint = footprints.find("CAN");
+    TEST_ASSERT_NOT_NULL(canPrint);
+    TEST_ASSERT_TRUE(canPrint->loaded);
+    TEST_ASSERT_EQUAL_INT32(2048, canPrint->heapBytes);
+    TEST_ASSERT_EQUAL_UINT32(1500, canPrint->buildUs);
+    TEST_ASSERT_EQUAL_INT32(65536, footprints.find("SubGHz")->psramBytes);
+
+    // Mode exit gives it all back, a later entry builds it again
+    footprints.release("SubGHz", [&]() { subGhz.reset(); });
+    const ModeFootprint* sub = footprints.find("SubGHz");
+    TEST_ASSERT_FALSE(sub->loaded);
+    TEST_ASSERT_EQUAL_INT32(6144, sub->heapFreed);
+    TEST_ASSERT_EQUAL_INT32(65536, sub->psramFreed);
+    TEST_ASSERT_EQUAL_UINT32(300000 - 2048, heap.freeHeap);
+
+    footprints.build("SubGHz", [&]() { subGhz.reset(new FootprintTestModule(heap, 6144, 65536)); });
+    TEST_ASSERT_EQUAL_UINT32(2, footprints.find("SubGHz")->loads);
+    TEST_ASSERT_EQUAL_UINT32(2, footprints.footprints().size());
+    TEST_ASSERT_NULL(footprints.find("RFID"));
+}
+
+void test_mode_footprint_lines() {
+    FootprintTestHeap heap;
+    ModeFootprintManager footprints;
+    footprints.setProbe([&]() { return ModeFootprintManager::Memory{heap.freeHeap, heap.freePsram}; });
+    footprints.setClock([&]() { return heap.us; });
+    footprints.setStartup(41500, 30720, 1830);
+
+    std::vector<std::string> lines = footprints.formatLines();
+    TEST_ASSERT_EQUAL_UINT32(3, lines.size());
+    TEST_ASSERT_EQUAL_STRING("Provider built    : 41.5 ms, 30.0 KB heap", lines[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("Boot to provider  : 1830 ms", lines[1].c_str());
+
+    std::unique_ptr<FootprintTestModule> rfid;
+    footprints.build("RFID", [&]() { rfid.reset(new FootprintTestModule(heap, 3072, 0)); });
+    footprints.release("RFID", [&]() { rfid.reset(); });
+    footprints.build("RF24", [&]() { rfid.reset(new FootprintTestModule(heap, 1024, 0)); });
+
+    lines = footprints.formatLines();
+    TEST_ASSERT_EQUAL_UINT32(5, lines.size());
+    TEST_ASSERT_EQUAL_STRING("RFID       freed         3.0       0.0       1.5      1", lines[3].c_str());
+    TEST_ASSERT_EQUAL_STRING("RF24       loaded        1.0       0.0       1.5      1", lines[4].c_str());
+}
+
+#endif
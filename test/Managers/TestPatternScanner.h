@@ -0,0 +1,267 @@
+#ifndef TEST_PATTERN_SCANNER_H
+#define TEST_PATTERN_SCANNER_H
+
+#include <unity.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../src/Managers/PatternScanner.h"
+#include "../src/Managers/BinaryAnalyzeManager.h"
+#include "../src/Data/BinaryPatternTable.h"
+#include "../Views/MockTerminalView.h"
+#include "../Inputs/MockInput.h"
+
+typedef std::vector<std::pair<int, uint32_t>> PatternHits;
+
+static PatternHits scanAll(const PatternTable& table, const uint8_t* data, size_t len, size_t chunk) {
+    PatternHits hits;
+    PatternScanner scanner(table);
+    scanner.reset(0x1000);
+    for (size_t off = 0; off < len; off += chunk) {
+        size_t n = std::min(chunk, len - off);
+        scanner.scan(data + off, n, [&](uint8_t index, uint32_t address) {
+            hits.push_back(std::make_pair((int)index, address));
+        });
+    }
+    return hits;
+}
+
+// Old per block search: one case folded scan per pattern, memcmp signatures
+// in the first 64 bytes, 32 bytes of overlap read again
+static int naiveSecret(const uint8_t* buf, size_t size) {
+    for (size_t i = 0; i < binaryPatternCount; ++i) {
+        const PatternSpec& p = binaryPatterns[i];
+        if (!(p.flags & PatternSpec::IgnoreCase)) continue;
+        for (size_t j = 0; j + p.length <= size; ++j) {
+            bool match = true;
+            for (size_t k = 0; k < p.length; ++k) {
+                if (std::tolower(buf[j + k]) != std::tolower((unsigned char)p.bytes[k])) {
+                    match = false;
+                    break;
+                }
+            }
+            if (match) return (int)i;
+        }
+    }
+    return -1;
+}
+
+static int naiveSignature(const uint8_t* buf, size_t size) {
+    for (size_t i = 0; i < binaryPatternCount; ++i) {
+        const PatternSpec& p = binaryPatterns[i];
+        if (!(p.flags & PatternSpec::FileSignature) || size < p.length) continue;
+        for (size_t j = 0; j + p.length <= std::min(size_t(64), size); ++j) {
+            if (buf[j] == (uint8_t)p.bytes[0] && memcmp(buf + j, p.bytes, p.length) == 0) return (int)i;
+        }
+    }
+    return -1;
+}
+
+static std::vector<uint8_t> patternTestImage(size_t size) {
+    std::vector<uint8_t> image(size);
+    uint32_t x = 0xC0FFEE11;
+    for (auto& b : image) {
+        x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+        b = (uint8_t)x;
+    }
+    return image;
+}
+
+static void plant(std::vector<uint8_t>& image, size_t at, const char* text, size_t len = 0) {
+    if (!len) len = strlen(text);
+    memcpy(image.data() + at, text, len);
+}
+
+// Rewrite src/Data/BinaryPatternTable.h from BinaryPatterns.h
+static void writePatternTable(const PatternAutomaton& automaton) {
+    FILE* f = fopen("src/Data/BinaryPatternTable.h", "w");
+    if (!f) return;
+    const PatternTable& t = automaton.table();
+    fprintf(f, "#pragma once\n\n");
+    fprintf(f, "#include <cstdint>\n#include \"Data/BinaryPatterns.h\"\n\n");
+    fprintf(f, "// Aho-Corasick automaton of binaryPatterns, %u states x %u byte classes.\n", t.stateCount, t.classCount);
+    fprintf(f, "// Generated by the native tests, do not edit:\n");
+    fprintf(f, "// PATTERN_TABLE_REGEN=1 pio test -e native\n\n");
+
+    auto dump = [&](const char* type, const char* name, const std::vector<uint16_t>* wide, const std::vector<uint8_t>* narrow) {
+        size_t n = wide ? wide->size() : narrow->size();
+        fprintf(f, "static const %s %s[%u] = {", type, name, (unsigned)n);
+        for (size_t i = 0; i < n; ++i) {
+            if (i % 16 == 0) fprintf(f, "\n   ");
+            fprintf(f, " %u,", wide ? (unsigned)(*wide)[i] : (unsigned)(*narrow)[i]);
+        }
+        fprintf(f, "\n};\n\n");
+    };
+    dump("uint8_t", "binaryPatternByteClass", nullptr, &automaton.byteClasses());
+    dump("uint16_t", "binaryPatternNext", &automaton.transitions(), nullptr);
+    dump("uint16_t", "binaryPatternOutput", &automaton.outputs(), nullptr);
+    dump("uint16_t", "binaryPatternOutputLink", &automaton.outputLinks(), nullptr);
+    dump("uint8_t", "binaryPatternMatch", nullptr, &automaton.matches());
+
+    fprintf(f, "static const PatternTable binaryPatternTable = {\n");
+    fprintf(f, "    binaryPatternByteClass,\n    binaryPatternNext,\n    binaryPatternOutput,\n");
+    fprintf(f, "    binaryPatternOutputLink,\n    binaryPatternMatch,\n    binaryPatterns,\n");
+    fprintf(f, "    %u, %u, %u\n};\n", t.stateCount, t.classCount, t.patternCount);
+    fclose(f);
+}
+
+void test_pattern_table_is_current() {
+    PatternAutomaton automaton;
+    TEST_ASSERT_TRUE(automaton.build(binaryPatterns, binaryPatternCount));
+    if (getenv("PATTERN_TABLE_REGEN")) writePatternTable(automaton);
+
+    const PatternTable& built = automaton.table();
+    const PatternTable& stored = binaryPatternTable;
+    TEST_ASSERT_EQUAL(built.stateCount, stored.stateCount);
+    TEST_ASSERT_EQUAL(built.classCount, stored.classCount);
+    TEST_ASSERT_EQUAL(built.patternCount, stored.patternCount);
+    TEST_ASSERT_EQUAL_MEMORY(built.byteClass, stored.byteClass, 256);
+    TEST_ASSERT_EQUAL_MEMORY(built.next, stored.next, built.stateCount * built.classCount * sizeof(uint16_t));
+    TEST_ASSERT_EQUAL_MEMORY(built.output, stored.output, built.stateCount * sizeof(uint16_t));
+    TEST_ASSERT_EQUAL_MEMORY(built.outputLink, stored.outputLink, built.stateCount * sizeof(uint16_t));
+    TEST_ASSERT_EQUAL_MEMORY(built.match, stored.match, built.stateCount);
+}
+
+void test_pattern_scanner_case_folding() {
+    const char* text = "xxPassWord=1 BM bm hSqS hsqs Https://a HTTP://b";
+    PatternHits hits = scanAll(binaryPatternTable, (const uint8_t*)text, strlen(text), 4096);
+
+    auto has = [&](const char* label, uint32_t offset) {
+        for (auto& h : hits) {
+            if (strcmp(binaryPatterns[h.first].label, label) == 0 && h.second == 0x1000 + offset) return true;
+        }
+        return false;
+    };
+    TEST_ASSERT_TRUE(has("Password", 2));
+    TEST_ASSERT_TRUE(has("BMP Image", 13));
+    TEST_ASSERT_FALSE(has("BMP Image", 16));   // signatures keep their case
+    TEST_ASSERT_FALSE(has("SquashFS", 19));
+    TEST_ASSERT_TRUE(has("SquashFS", 24));
+    TEST_ASSERT_TRUE(has("URL", 29));
+    TEST_ASSERT_TRUE(has("URL", 39));
+    TEST_ASSERT_EQUAL(5, hits.size());
+}
+
+void test_pattern_scanner_user_pattern_and_suffixes() {
+    // Overlapping occurrences and a pattern that is a suffix of another
+    const PatternSpec user[] = {
+        { "abab", 4, 0, "abab" },
+        { "bab", 3, 0, "bab" },
+    };
+    PatternAutomaton automaton;
+    TEST_ASSERT_TRUE(automaton.build(user, 2));
+
+    const char* text = "abababAbab";
+    PatternHits hits = scanAll(automaton.table(), (const uint8_t*)text, strlen(text), 3);
+
+    PatternHits expected = {
+        {0, 0x1000}, {1, 0x1001}, {0, 0x1002}, {1, 0x1003}, {1, 0x1007},
+    };
+    TEST_ASSERT_EQUAL(expected.size(), hits.size());
+    for (size_t i = 0; i < hits.size(); ++i) {
+        TEST_ASSERT_EQUAL(expected[i].first, hits[i].first);
+        TEST_ASSERT_EQUAL(expected[i].second, hits[i].second);
+    }
+
+    PatternSpec tooLong = { "x", 65, 0, nullptr };
+    TEST_ASSERT_FALSE(automaton.build(&tooLong, 1));
+}
+
+void test_pattern_scanner_across_blocks() {
+    std::vector<uint8_t> image = patternTestImage(64 * 1024);
+    for (size_t at = 500; at < image.size() - 64; at += 4093) {
+        plant(image, at, "-----BEGIN CERTIFICATE-----");
+        plant(image, at + 40, "SQLite format 3", 16);
+    }
+    PatternHits whole = scanAll(binaryPatternTable, image.data(), image.size(), image.size());
+    TEST_ASSERT_TRUE(whole.size() > 30);
+
+    // Any split gives the same matches, case sensitive ones included
+    const size_t chunks[] = {1, 7, 63, 512, 4096};
+    for (size_t chunk : chunks) {
+        PatternHits split = scanAll(binaryPatternTable, image.data(), image.size(), chunk);
+        TEST_ASSERT_EQUAL(whole.size(), split.size());
+        TEST_ASSERT_TRUE(whole == split);
+    }
+}
+
+void test_binary_analyze_matches_naive_search() {
+    std::vector<uint8_t> image = patternTestImage(256 * 1024);
+    const size_t block = 512;
+
+    // Away from the 32 bytes the old search read twice
+    plant(image, 0 * block + 100, "ssh-ED25519 AAAA");
+    plant(image, 3 * block + 10, "\x7F""ELF");
+    plant(image, 3 * block + 200, "https://example");
+    plant(image, 7 * block + 0, "PK\x03\x04");
+    plant(image, 7 * block + 300, "Login: root  Password=toor");
+    plant(image, 40 * block + 61, "GIF89a");   // ends after byte 64
+    plant(image, 41 * block + 59, "GIF8");
+    plant(image, 90 * block + 8, "CONFIG_WIFI_SSID=bus");
+
+    MockTerminalView view;
+    MockInput input;
+    BinaryAnalyzeManager manager(view, input);
+    auto result = manager.analyze(0, image.size(), [&](uint32_t addr, uint8_t* buf, uint32_t len) {
+        memcpy(buf, image.data() + addr, len);
+    }, block);
+
+    std::vector<std::string> files, secrets;
+    for (size_t addr = 0; addr < image.size(); addr += block) {
+        char prefix[16];
+        snprintf(prefix, sizeof(prefix), "0x%06X", (unsigned)addr);
+        int sig = naiveSignature(image.data() + addr, block);
+        if (sig >= 0) files.push_back(std::string(prefix) + " → " + binaryPatterns[sig].label);
+        int secret = naiveSecret(image.data() + addr, block);
+        if (secret >= 0) secrets.push_back(std::string(prefix) + " → Possible " + binaryPatterns[secret].label);
+    }
+
+    TEST_ASSERT_EQUAL(image.size() / block, result.blocks);
+    TEST_ASSERT_EQUAL(4, secrets.size());
+    TEST_ASSERT_TRUE(secrets == result.foundSecrets);
+    TEST_ASSERT_TRUE(files == result.foundFiles);
+    TEST_ASSERT_TRUE(std::find(files.begin(), files.end(), "0x005200 → GIF Image") != files.end());
+    TEST_ASSERT_TRUE(std::find(files.begin(), files.end(), "0x005000 → GIF Image") == files.end());
+}
+
+void test_pattern_scanner_throughput_vs_naive() {
+    const size_t size = 4 * 1024 * 1024;
+    const size_t block = 512;
+    std::vector<uint8_t> image = patternTestImage(size);
+
+    // Old: 19 folded scans plus signatures per block
+    int found = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t addr = 0; addr < size; addr += block) {
+        size_t from = addr >= 32 ? addr - 32 : 0;
+        found += naiveSecret(image.data() + from, addr + block - from) >= 0;
+        found += naiveSignature(image.data() + addr, block) >= 0;
+    }
+    double naiveSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    // New: one automaton walk
+    int hits = 0;
+    PatternScanner scanner(binaryPatternTable);
+    t0 = std::chrono::steady_clock::now();
+    for (size_t addr = 0; addr < size; addr += block) {
+        scanner.scan(image.data() + addr, block, [&](uint8_t, uint32_t) { hits++; });
+    }
+    double scanSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    TEST_ASSERT_TRUE(hits >= found);
+
+    double mb = size / 1048576.0;
+    char msg[200];
+    snprintf(msg, sizeof(msg), "Pattern search 4 MB: naive %.1f MB/s, Aho-Corasick %.1f MB/s (x%.1f), %u states x %u classes",
+             mb / naiveSecs, mb / scanSecs, naiveSecs / scanSecs,
+             binaryPatternTable.stateCount, binaryPatternTable.classCount);
+    TEST_MESSAGE(msg);
+}
+
+#endif // TEST_PATTERN_SCANNER_H
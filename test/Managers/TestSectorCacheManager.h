@@ -0,0 +1,188 @@
+#ifndef TEST_SECTOR_CACHE_MANAGER_H
+#define TEST_SECTOR_CACHE_MANAGER_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "../src/Managers/SectorCacheManager.h"
+#include "FakeRamDisk.h"
+
+static std::vector<uint8_t> sectorPattern(uint32_t lba, uint32_t count, uint8_t seed) {
+    std::vector<uint8_t> out((size_t)count * 512);
+    for (size_t i = 0; i < out.size(); ++i) out[i] = (uint8_t)(seed + lba * 7 + i * 13 + (i >> 9));
+    return out;
+}
+
+void test_sector_cache_sequential_read_ahead() {
+    FakeRamDisk disk(4096);
+    SectorCacheManager cache(disk, 32);
+    std::vector<uint8_t> buf(8 * 512);
+
+    for (uint32_t lba = 0; lba < 1024; lba += 8) {
+        TEST_ASSERT_TRUE(cache.read(lba, buf.data(), 8));
+        TEST_ASSERT_TRUE(memcmp(buf.data(), &disk.data[(size_t)lba * 512], buf.size()) == 0);
+    }
+
+    // First request direct, then one 32 sector read per 4 requests
+    TEST_ASSERT_EQUAL_UINT32(1 + 32, disk.commands);
+    TEST_ASSERT_EQUAL_UINT32(128 - 33, cache.stats().readHits);
+
+    // Random reads are not amplified
+    disk.resetCounters();
+    uint64_t before = cache.stats().deviceSectorsRead;
+    TEST_ASSERT_TRUE(cache.read(3000, buf.data(), 1));
+    TEST_ASSERT_TRUE(cache.read(17, buf.data(), 1));
+    TEST_ASSERT_TRUE(memcmp(buf.data(), &disk.data[17 * 512], 512) == 0);
+    TEST_ASSERT_EQUAL_UINT32(2, disk.commands);
+    TEST_ASSERT_EQUAL_UINT64(2, cache.stats().deviceSectorsRead - before);
+
+    // Out of range
+    TEST_ASSERT_FALSE(cache.read(4090, buf.data(), 8));
+}
+
+void test_sector_cache_write_back_metadata() {
+    FakeRamDisk disk(1024);
+    SectorCacheManager cache(disk);
+    auto a = sectorPattern(10, 3, 1);
+    auto b = sectorPattern(500, 1, 2);
+
+    // FAT style single sector updates stay in the cache
+    for (uint32_t i = 0; i < 3; ++i) TEST_ASSERT_TRUE(cache.write(10 + i, &a[i * 512], 1));
+    TEST_ASSERT_TRUE(cache.write(500, b.data(), 1));
+    TEST_ASSERT_TRUE(cache.write(500, b.data(), 1));
+    TEST_ASSERT_EQUAL_UINT32(0, disk.commands);
+    TEST_ASSERT_EQUAL_UINT32(4, cache.dirtySectors());
+
+    // Reads see them before the flush
+    std::vector<uint8_t> buf(4 * 512);
+    TEST_ASSERT_TRUE(cache.read(9, buf.data(), 4));
+    TEST_ASSERT_TRUE(memcmp(buf.data(), &disk.data[9 * 512], 512) == 0);
+    TEST_ASSERT_TRUE(memcmp(&buf[512], a.data(), a.size()) == 0);
+
+    // Adjacent sectors merged into one write
+    disk.resetCounters();
+    TEST_ASSERT_TRUE(cache.flush());
+    TEST_ASSERT_EQUAL_UINT32(2, disk.commands);
+    TEST_ASSERT_EQUAL_UINT32(1, disk.syncs);
+    TEST_ASSERT_EQUAL_UINT32(0, cache.dirtySectors());
+    TEST_ASSERT_TRUE(memcmp(&disk.data[10 * 512], a.data(), a.size()) == 0);
+    TEST_ASSERT_TRUE(memcmp(&disk.data[500 * 512], b.data(), b.size()) == 0);
+}
+
+void test_sector_cache_evicts_least_recently_used() {
+    FakeRamDisk disk(1024);
+    SectorCacheManager cache(disk, 8, 8, 4);
+    const uint32_t lbas[] = {100, 200, 300, 400};
+    for (uint32_t lba : lbas) TEST_ASSERT_TRUE(cache.write(lba, sectorPattern(lba, 1, 3).data(), 1));
+    TEST_ASSERT_TRUE(cache.write(100, sectorPattern(100, 1, 4).data(), 1));
+
+    // 200 is the oldest now
+    TEST_ASSERT_TRUE(cache.write(600, sectorPattern(600, 1, 3).data(), 1));
+    TEST_ASSERT_EQUAL_UINT32(1, cache.stats().evictions);
+    TEST_ASSERT_EQUAL_UINT32(1, disk.commands);
+    TEST_ASSERT_TRUE(memcmp(&disk.data[200 * 512], sectorPattern(200, 1, 3).data(), 512) == 0);
+    TEST_ASSERT_EQUAL_UINT32(4, cache.dirtySectors());
+
+    // Failed device write is reported, the data is kept
+    disk.failWrites = true;
+    TEST_ASSERT_FALSE(cache.flush());
+    disk.failWrites = false;
+    TEST_ASSERT_TRUE(cache.flush());
+    TEST_ASSERT_TRUE(memcmp(&disk.data[100 * 512], sectorPattern(100, 1, 4).data(), 512) == 0);
+}
+
+void test_sector_cache_gathers_sequential_writes() {
+    FakeRamDisk disk(4096);
+    SectorCacheManager cache(disk, 32, 32);
+    auto image = sectorPattern(64, 256, 5);
+
+    for (uint32_t i = 0; i < 256; i += 8) {
+        TEST_ASSERT_TRUE(cache.write(64 + i, &image[(size_t)i * 512], 8));
+    }
+    TEST_ASSERT_TRUE(cache.flush());
+    TEST_ASSERT_EQUAL_UINT32(8, disk.commands);
+    TEST_ASSERT_TRUE(memcmp(&disk.data[64 * 512], image.data(), image.size()) == 0);
+
+    // Larger than the run, written through and kept coherent with the window
+    std::vector<uint8_t> buf(8 * 512);
+    TEST_ASSERT_TRUE(cache.read(1000, buf.data(), 8));
+    TEST_ASSERT_TRUE(cache.read(1008, buf.data(), 8));
+    auto big = sectorPattern(990, 64, 6);
+    disk.resetCounters();
+    TEST_ASSERT_TRUE(cache.write(990, big.data(), 64));
+    TEST_ASSERT_EQUAL_UINT32(1, disk.commands);
+    TEST_ASSERT_TRUE(cache.read(1016, buf.data(), 8));
+    TEST_ASSERT_EQUAL_UINT32(1, disk.commands);
+    TEST_ASSERT_TRUE(memcmp(buf.data(), &big[26 * 512], buf.size()) == 0);
+}
+
+void test_sector_cache_matches_model_random_io() {
+    const uint32_t sectors = 2048;
+    FakeRamDisk disk(sectors);
+    std::vector<uint8_t> model = disk.data;
+    SectorCacheManager cache(disk, 16, 16, 8);
+    std::mt19937 rng(1234);
+    std::vector<uint8_t> buf(40 * 512);
+    uint32_t cursor = 0;
+
+    for (int op = 0; op < 20000; ++op) {
+        uint32_t kind = rng() % 10;
+        uint32_t count = (kind % 3 == 0) ? 1 + rng() % 2 : 1 + rng() % 40;
+        uint32_t lba = (rng() % 3 == 0) ? cursor : rng() % (sectors - count);
+        if (lba + count > sectors) lba = 0;
+        cursor = lba + count;
+
+        if (kind < 5) {
+            TEST_ASSERT_TRUE(cache.read(lba, buf.data(), count));
+            TEST_ASSERT_TRUE(memcmp(buf.data(), &model[(size_t)lba * 512], (size_t)count * 512) == 0);
+        } else if (kind < 9) {
+            auto data = sectorPattern(lba, count, (uint8_t)op);
+            TEST_ASSERT_TRUE(cache.write(lba, data.data(), count));
+            memcpy(&model[(size_t)lba * 512], data.data(), data.size());
+        } else if (op % 7 == 0) {
+            TEST_ASSERT_TRUE(cache.flush());
+            TEST_ASSERT_TRUE(disk.data == model);
+        }
+    }
+    TEST_ASSERT_TRUE(cache.invalidate());
+    TEST_ASSERT_TRUE(disk.data == model);
+}
+
+void test_sector_cache_throughput_vs_per_sector() {
+    // 4 MB sequential copy in 4 KB USB transfers, then FAT style updates
+    const uint32_t sectors = 16384;
+    FakeRamDisk disk(sectors);
+    SectorCacheManager cache(disk);
+    std::vector<uint8_t> buf(8 * 512);
+    const uint64_t perSectorUs = FakeRamDisk::CommandUs + FakeRamDisk::SectorUs;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (uint32_t lba = 0; lba < 8192; lba += 8) TEST_ASSERT_TRUE(cache.read(lba, buf.data(), 8));
+    uint64_t readUs = disk.elapsedUs;
+
+    disk.resetCounters();
+    for (uint32_t lba = 8192; lba < sectors; lba += 8) TEST_ASSERT_TRUE(cache.write(lba, buf.data(), 8));
+    std::mt19937 rng(7);
+    for (int i = 0; i < 512; ++i) TEST_ASSERT_TRUE(cache.write(32 + rng() % 12, buf.data(), 1));
+    TEST_ASSERT_TRUE(cache.flush());
+    uint64_t writeUs = disk.elapsedUs;
+    double hostSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    // One command per sector before
+    uint64_t oldReadUs = 8192 * perSectorUs;
+    uint64_t oldWriteUs = (8192 + 512) * perSectorUs;
+    TEST_ASSERT_TRUE(readUs * 3 < oldReadUs);
+    TEST_ASSERT_TRUE(writeUs * 3 < oldWriteUs);
+
+    char msg[200];
+    snprintf(msg, sizeof(msg),
+             "MSC 4MB: read %.2f MB/s (per sector %.2f), write %.2f MB/s (per sector %.2f), host %.1f ms",
+             4.0 * 1e6 / readUs, 4.0 * 1e6 / oldReadUs, 4.0 * 1e6 / writeUs, 4.0 * 1e6 / oldWriteUs,
+             hostSecs * 1e3);
+    TEST_MESSAGE(msg);
+}
+
+#endif
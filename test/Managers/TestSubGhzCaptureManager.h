@@ -0,0 +1,162 @@
+#ifndef TEST_SUBGHZ_CAPTURE_MANAGER_H
+#define TEST_SUBGHZ_CAPTURE_MANAGER_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../src/Managers/SubGhzCaptureManager.h"
+#include "../src/Transformers/SubGhzTransformer.h"
+
+// rmt_item32_t word
+static uint32_t rmtItem(bool level0, uint32_t d0, bool level1, uint32_t d1) {
+    return (d0 & 0x7FFF) | (level0 ? 0x8000u : 0) | ((d1 & 0x7FFF) << 16) | (level1 ? 0x80000000u : 0);
+}
+
+// OOK frame of bits, 350/1050 us pulse width, ended like the RMT does
+static std::vector<uint32_t> ookFrame(uint32_t bits, int count) {
+    std::vector<uint32_t> items;
+    for (int i = count - 1; i >= 0; --i) {
+        bool one = (bits >> i) & 1;
+        items.push_back(rmtItem(true, one ? 1050 : 350, false, one ? 350 : 1050));
+    }
+    items.push_back(rmtItem(true, 350, false, 0));
+    return items;
+}
+
+void test_subghz_capture_signed_timings_and_gaps() {
+    std::vector<uint32_t> storage(64);
+    SubGhzCaptureManager capture(storage.data(), storage.size(), 1);
+
+    auto a = ookFrame(0b101, 3);        // 4550 us
+    auto b = ookFrame(0b0, 1);          // 1750 us
+    TEST_ASSERT_TRUE(capture.addFrame(a.data(), a.size(), 1000000 + 4550));
+    TEST_ASSERT_TRUE(capture.addFrame(b.data(), b.size(), 1010000 + 1750));
+
+    TEST_ASSERT_EQUAL_UINT32(2, capture.frameCount());
+    TEST_ASSERT_EQUAL_UINT32(1000000, capture.frame(0).startUs);
+    TEST_ASSERT_EQUAL_UINT32(4550, capture.frame(0).durationUs);
+    TEST_ASSERT_EQUAL_UINT64(11750, capture.durationUs());
+
+    // Frames joined by their gap as a low
+    std::vector<int32_t> expected = {1050, -350, 350, -1050, 1050, -350, 350, -(10000 - 4550), 350, -1050, 350};
+    auto timings = capture.timings();
+    TEST_ASSERT_EQUAL_UINT32(expected.size(), timings.size());
+    TEST_ASSERT_TRUE(expected == timings);
+
+    // Text only on demand
+    std::string text;
+    capture.formatFrame(1, 433.92f, text);
+    TEST_ASSERT_TRUE(text.find("[raw 2 pulses | freq=433.92 MHz | dur=1750 ticks]") == 0);
+    TEST_ASSERT_TRUE(text.find("H:350 | L:1050") != std::string::npos);
+}
+
+void test_subghz_capture_full_buffer_counts_drops() {
+    std::vector<uint32_t> storage(10);
+    SubGhzCaptureManager capture(storage.data(), storage.size(), 1, 4);
+    auto frame = ookFrame(0xF, 4);      // 5 items, ends high
+
+    TEST_ASSERT_TRUE(capture.addFrame(frame.data(), frame.size(), 10000));
+    TEST_ASSERT_TRUE(capture.addFrame(frame.data(), frame.size(), 20000));
+    TEST_ASSERT_TRUE(capture.full());
+    TEST_ASSERT_FALSE(capture.addFrame(frame.data(), frame.size(), 30000));
+    TEST_ASSERT_EQUAL_UINT32(1, capture.droppedFrames());
+    TEST_ASSERT_EQUAL_UINT64(5, capture.droppedItems());
+
+    // Long gaps are clipped
+    std::vector<uint32_t> storage2(16);
+    SubGhzCaptureManager spaced(storage2.data(), storage2.size(), 1);
+    spaced.addFrame(frame.data(), frame.size(), 10000);
+    spaced.addFrame(frame.data(), frame.size(), 60000000);
+    auto timings = spaced.timings();
+    TEST_ASSERT_EQUAL_INT32(-(int32_t)SubGhzCaptureManager::MaxGapUs, timings[9]);
+
+    // A frame ending low merges with its gap
+    const uint32_t lowEnd[] = {rmtItem(true, 500, false, 300), 0};
+    spaced.reset();
+    spaced.addFrame(lowEnd, 2, 10800);
+    spaced.addFrame(lowEnd, 2, 12000);
+    timings = spaced.timings();
+    TEST_ASSERT_EQUAL_UINT32(4, timings.size());
+    TEST_ASSERT_EQUAL_INT32(-(300 + 400), timings[1]);
+
+    capture.reset();
+    TEST_ASSERT_EQUAL_UINT32(0, capture.frameCount());
+    TEST_ASSERT_EQUAL_UINT32(0, capture.droppedFrames());
+}
+
+void test_subghz_sub_file_round_trip() {
+    std::vector<uint32_t> storage(4096);
+    SubGhzCaptureManager capture(storage.data(), storage.size(), 1);
+    uint64_t at = 5000000;
+    for (uint32_t i = 0; i < 40; ++i) {
+        auto frame = ookFrame(0xA5C3u ^ i, 24);
+        at += 20000;
+        capture.addFrame(frame.data(), frame.size(), at);
+    }
+
+    // Written in lines like the sniffer does
+    SubGhzTransformer transformer;
+    std::string file = transformer.rawFileHeader(433920000, "");
+    std::vector<int32_t> line;
+    capture.forEachTiming([&](int32_t t) {
+        line.push_back(t);
+        if (line.size() == SubGhzTransformer::TimingsPerLine) {
+            transformer.appendRawDataLine(file, line.data(), line.size());
+            line.clear();
+        }
+    });
+    transformer.appendRawDataLine(file, line.data(), line.size());
+
+    TEST_ASSERT_TRUE(transformer.isValidSubGhzFile(file));
+    auto commands = transformer.transformFromFileFormat(file);
+    TEST_ASSERT_EQUAL_UINT32(1, commands.size());
+    const auto& cmd = commands[0];
+    TEST_ASSERT_TRUE(cmd.protocol == SubGhzProtocolEnum::RAW);
+    TEST_ASSERT_EQUAL_UINT32(433920000, cmd.frequency_hz);
+    TEST_ASSERT_EQUAL_STRING("FuriHalSubGhzPresetOok650Async", cmd.preset.c_str());
+
+    auto expected = capture.timings();
+    TEST_ASSERT_TRUE(expected.size() > SubGhzTransformer::TimingsPerLine);
+    TEST_ASSERT_EQUAL_UINT32(expected.size(), cmd.raw_timings.size());
+    TEST_ASSERT_TRUE(expected == cmd.raw_timings);
+
+    // And back again through the command writer
+    std::string again = transformer.transformToFileFormat(cmd);
+    TEST_ASSERT_EQUAL_STRING(file.c_str(), again.c_str());
+}
+
+void test_subghz_capture_throughput_vs_formatting() {
+    const int frames = 2000;
+    auto frame = ookFrame(0x5A5A5A, 24);
+    std::vector<uint32_t> storage((size_t)frames * frame.size());
+    SubGhzCaptureManager capture(storage.data(), storage.size(), 1, frames);
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; ++i) capture.addFrame(frame.data(), frame.size(), (uint64_t)i * 40000 + 40000);
+    auto t1 = std::chrono::steady_clock::now();
+
+    // What the sniffer did for each block before
+    size_t chars = 0;
+    for (int f = 0; f < frames; ++f) {
+        std::ostringstream oss;
+        for (size_t i = 0; i < frame.size(); ++i) {
+            oss << ((frame[i] & 0x8000) ? 'H' : 'L') << ":" << (frame[i] & 0x7FFF) << " | "
+                << ((frame[i] & 0x80000000u) ? 'H' : 'L') << ":" << ((frame[i] >> 16) & 0x7FFF) << "   ";
+        }
+        chars += oss.str().size();
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    double captureUs = std::chrono::duration<double, std::micro>(t1 - t0).count();
+    double formatUs = std::chrono::duration<double, std::micro>(t2 - t1).count();
+    printf("  %d RMT blocks: capture %.0f us, ostringstream formatting %.0f us (%zu chars)\n",
+           frames, captureUs, formatUs, chars);
+
+    TEST_ASSERT_EQUAL_UINT32(frames, capture.frameCount());
+    TEST_ASSERT_TRUE(captureUs < formatUs);
+}
+
+#endif
@@ -0,0 +1,149 @@
+#ifndef TEST_UART_BRIDGE_MANAGER_H
+#define TEST_UART_BRIDGE_MANAGER_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include "../src/Managers/UartBridgeManager.h"
+#include "../Views/MockTerminalView.h"
+#include "../Inputs/MockInput.h"
+#include "../Services/FakeByteStream.h"
+
+// Virtual clock, 1 ms per call
+static uint32_t bridgeTestNow = 0;
+static uint32_t bridgeTestClock() { return bridgeTestNow++; }
+
+void test_uart_bridge_forwards_blocks() {
+    MockTerminalView view;
+    MockInput terminalInput, deviceInput;
+    FakeByteStream port;
+    UartBridgeManager bridge(view, terminalInput, deviceInput);
+    bridge.setClock(bridgeTestClock);
+
+    std::string data(10000, 'A');
+    port.inject(data);
+    deviceInput.setIdleReads(5);
+    deviceInput.enqueueKey('x');
+
+    UartBridgeStats stats = bridge.run(port, UartBridgeManager::Options());
+
+    TEST_ASSERT_EQUAL(10000, stats.bytesIn);
+    TEST_ASSERT_TRUE(view.output == data);
+    TEST_ASSERT_LESS_OR_EQUAL(10, view.printCount); // 1 KB blocks, not 1 print per byte
+    TEST_ASSERT_GREATER_THAN(0, view.flushCount);
+}
+
+void test_uart_bridge_loopback_terminal_input() {
+    MockTerminalView view;
+    MockInput terminalInput, deviceInput;
+    FakeByteStream port(true);
+    UartBridgeManager bridge(view, terminalInput, deviceInput);
+    bridge.setClock(bridgeTestClock);
+
+    terminalInput.enqueueKeys("hello");
+    deviceInput.setIdleReads(3);
+    deviceInput.enqueueKey('x');
+
+    UartBridgeStats stats = bridge.run(port, UartBridgeManager::Options());
+
+    TEST_ASSERT_EQUAL(5, stats.bytesOut);
+    TEST_ASSERT_EQUAL_STRING("hello", port.written.c_str());
+    TEST_ASSERT_EQUAL_STRING("hello", view.output.c_str());
+}
+
+void test_uart_bridge_filters_half_duplex_echo() {
+    MockTerminalView view;
+    MockInput terminalInput, deviceInput;
+    FakeByteStream port(true);
+    UartBridgeManager bridge(view, terminalInput, deviceInput);
+    bridge.setClock(bridgeTestClock);
+
+    UartBridgeManager::Options options;
+    options.filterEcho = true;
+    terminalInput.enqueueKeys("AT\r");
+    deviceInput.setIdleReads(3);
+    deviceInput.enqueueKey('x');
+
+    bridge.run(port, options);
+    port.inject("OK\r\n");
+    deviceInput.setIdleReads(3);
+    deviceInput.enqueueKey('x');
+    bridge.run(port, options);
+
+    TEST_ASSERT_EQUAL_STRING("AT\r", port.written.c_str());
+    TEST_ASSERT_EQUAL_STRING("OK\r\n", view.output.c_str());
+}
+
+void test_uart_bridge_read_stops_on_enter() {
+    MockTerminalView view;
+    MockInput terminalInput, deviceInput;
+    FakeByteStream port(false);
+    UartBridgeManager bridge(view, terminalInput, deviceInput);
+    bridge.setClock(bridgeTestClock);
+
+    UartBridgeManager::Options options;
+    options.forwardInput = false;
+    options.stopOnEnter = true;
+    options.stopOnDeviceInput = false;
+
+    port.inject("boot log\r\n");
+    terminalInput.setIdleReads(10);
+    terminalInput.enqueueKeys("ab\n");
+
+    UartBridgeStats stats = bridge.run(port, options);
+
+    TEST_ASSERT_EQUAL(0, stats.bytesOut);
+    TEST_ASSERT_TRUE(port.written.empty());
+    TEST_ASSERT_EQUAL_STRING("boot log\r\n", view.output.c_str());
+    TEST_ASSERT_EQUAL(0, deviceInput.readCount);
+}
+
+void test_uart_bridge_polls_device_on_timer() {
+    MockTerminalView view;
+    MockInput terminalInput, deviceInput;
+    FakeByteStream port;
+    UartBridgeManager bridge(view, terminalInput, deviceInput);
+    bridge.setClock(bridgeTestClock);
+
+    UartBridgeManager::Options options;
+    options.devicePollMs = 50;
+    deviceInput.setIdleReads(4);
+    deviceInput.enqueueKey('x');
+    port.overruns = 0;
+
+    uint32_t before = bridgeTestNow;
+    UartBridgeStats stats = bridge.run(port, options);
+
+    // 5 polls, one every 50 ms of virtual time
+    TEST_ASSERT_EQUAL(5, deviceInput.readCount);
+    TEST_ASSERT_GREATER_OR_EQUAL(250, bridgeTestNow - before);
+    TEST_ASSERT_EQUAL(0, stats.overruns);
+}
+
+void test_uart_bridge_throughput_1mb() {
+    MockTerminalView view;
+    MockInput terminalInput, deviceInput;
+    FakeByteStream port(false);
+    UartBridgeManager bridge(view, terminalInput, deviceInput);
+    bridge.setClock(bridgeTestClock);
+
+    const size_t total = 1024 * 1024;
+    std::string data(total, 'U');
+    port.inject(data);
+    port.overruns = 0;
+    deviceInput.setIdleReads(total / 1024 / 50 + 1);
+    deviceInput.enqueueKey('x');
+
+    auto start = std::chrono::steady_clock::now();
+    UartBridgeStats stats = bridge.run(port, UartBridgeManager::Options());
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    TEST_ASSERT_EQUAL(total, stats.bytesIn);
+
+    char msg[200];
+    snprintf(msg, sizeof(msg), "1 MB bridge: %zu prints (was %zu), %zu reads, %.1f MB/s | %s",
+             view.printCount, total, port.readCalls, total / secs / 1e6, bridge.formatStats(stats).c_str());
+    TEST_MESSAGE(msg);
+}
+
+#endif // TEST_UART_BRIDGE_MANAGER_H
@@ -9,9 +9,8 @@
 void test_horizontal_selector_confirm() {
     MockView mockView;
     MockInput mockInput;
-    InactivityManager manager(mockView);
 
-    HorizontalSelector horizontalSelector(mockView, mockInput, manager);
+    HorizontalSelector horizontalSelector(mockView, mockInput);
 
     std::vector<std::string> options = {"OptionA", "OptionB", "OptionC"};
     std::string title = "Horizontal Selector Test";
@@ -34,9 +33,8 @@ void test_horizontal_selector_confirm() {
 void test_horizontal_selector_cancel() {
     MockView mockView;
     MockInput mockInput;
-    InactivityManager manager(mockView);
 
-    HorizontalSelector horizontalSelector(mockView, mockInput, manager);
+    HorizontalSelector horizontalSelector(mockView, mockInput);
 
     std::vector<std::string> options = {"OptionA", "OptionB", "OptionC"};
     std::string title = "Horizontal Selector Test";
@@ -0,0 +1,136 @@
+#ifndef TEST_WEBSOCKET_OUTPUT_BUFFER_H
+#define TEST_WEBSOCKET_OUTPUT_BUFFER_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../src/Servers/WebSocketOutputBuffer.h"
+
+struct FrameCapture {
+    std::vector<std::string> frames;
+    void attach(WebSocketOutputBuffer& out) {
+        out.setSink([this](const uint8_t* data, size_t len) {
+            frames.emplace_back(reinterpret_cast<const char*>(data), len);
+        });
+    }
+};
+
+void test_ws_output_coalesces_until_newline() {
+    WebSocketOutputBuffer out(256, 20);
+    FrameCapture cap;
+    cap.attach(out);
+
+    out.write("a", 1, 0);
+    out.write("b", 1, 1);
+    out.write("c", 1, 2);
+    TEST_ASSERT_EQUAL(0, cap.frames.size());
+
+    out.write("d\n", 2, 3);
+    TEST_ASSERT_EQUAL(1, cap.frames.size());
+    TEST_ASSERT_EQUAL_STRING("abcd\n", cap.frames[0].c_str());
+}
+
+void test_ws_output_splits_at_max_frame() {
+    WebSocketOutputBuffer out(8, 1000);
+    FrameCapture cap;
+    cap.attach(out);
+
+    std::string data(20, 'x');
+    out.write(data.data(), data.size(), 0);
+    out.flush();
+
+    TEST_ASSERT_EQUAL(3, cap.frames.size());
+    TEST_ASSERT_EQUAL(8, cap.frames[0].size());
+    TEST_ASSERT_EQUAL(8, cap.frames[1].size());
+    TEST_ASSERT_EQUAL(4, cap.frames[2].size());
+}
+
+void test_ws_output_flushes_on_deadline() {
+    WebSocketOutputBuffer out(256, 20);
+    FrameCapture cap;
+    cap.attach(out);
+
+    out.write("abc", 3, 100);
+    out.poll(110);
+    TEST_ASSERT_EQUAL(0, cap.frames.size());
+
+    out.poll(120);
+    TEST_ASSERT_EQUAL(1, cap.frames.size());
+    TEST_ASSERT_EQUAL(0, out.pending());
+}
+
+void test_ws_output_carries_partial_utf8() {
+    WebSocketOutputBuffer out(256, 20);
+    FrameCapture cap;
+    cap.attach(out);
+
+    // "é" = C3 A9, "€" = E2 82 AC, split across writes
+    out.write("\xC3", 1, 0);
+    out.write("\xA9\xE2", 2, 0);
+    out.write("\x82", 1, 0);
+    out.write("\xAC\n", 2, 0);
+
+    TEST_ASSERT_EQUAL(1, cap.frames.size());
+    TEST_ASSERT_EQUAL_STRING("\xC3\xA9\xE2\x82\xAC\n", cap.frames[0].c_str());
+}
+
+void test_ws_output_drops_invalid_utf8() {
+    WebSocketOutputBuffer out(256, 20);
+    FrameCapture cap;
+    cap.attach(out);
+
+    // Stray continuation, truncated sequence, invalid lead
+    out.write("a\x80" "b\xE2\x82" "c\xFF" "d\n", 9, 0);
+
+    TEST_ASSERT_EQUAL(1, cap.frames.size());
+    TEST_ASSERT_EQUAL_STRING("abcd\n", cap.frames[0].c_str());
+}
+
+void test_ws_output_never_splits_multibyte_char() {
+    WebSocketOutputBuffer out(4, 1000);
+    FrameCapture cap;
+    cap.attach(out);
+
+    out.write("ab\xE2\x82\xAC", 5, 0);
+    out.flush();
+
+    TEST_ASSERT_EQUAL(2, cap.frames.size());
+    TEST_ASSERT_EQUAL_STRING("ab", cap.frames[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("\xE2\x82\xAC", cap.frames[1].c_str());
+}
+
+void test_ws_output_replay_1mb_stream() {
+    // UART bridge style replay, one byte per write, newline every 80 chars
+    const size_t total = 1024 * 1024;
+    std::string stream;
+    stream.reserve(total);
+    for (size_t i = 0; i < total; ++i) {
+        stream += (i % 80 == 79) ? '\n' : char('!' + (i % 90));
+    }
+
+    WebSocketOutputBuffer out(1024, 20);
+    uint64_t sent = 0;
+    out.setSink([&sent](const uint8_t*, size_t len) { sent += len; });
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < total; ++i) {
+        out.write(&stream[i], 1, static_cast<uint32_t>(i / 1000));
+    }
+    out.flush();
+    auto end = std::chrono::steady_clock::now();
+
+    double secs = std::chrono::duration<double>(end - start).count();
+    uint32_t frames = out.getFrameCount();
+
+    TEST_ASSERT_EQUAL(total, sent);
+    TEST_ASSERT_EQUAL(total, out.getByteCount());
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "1 MB replay: %u frames, %.1f bytes/frame, %.0f frames/s, %.1f MB/s",
+             frames, (double)total / frames, frames / secs, total / secs / 1e6);
+    TEST_MESSAGE(msg);
+}
+
+#endif // TEST_WEBSOCKET_OUTPUT_BUFFER_H
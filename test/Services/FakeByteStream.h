@@ -0,0 +1,44 @@
+#ifndef FAKE_BYTE_STREAM_H
+#define FAKE_BYTE_STREAM_H
+
+#include <string>
+#include "../src/Interfaces/IByteStream.h"
+
+// In memory UART, optionally looping written bytes back to RX
+class FakeByteStream : public IByteStream {
+public:
+    explicit FakeByteStream(bool loopback = true) : loopback(loopback) {}
+
+    void inject(const std::string& data) { rx += data; }
+
+    size_t available() const override { return rx.size() - rxPos; }
+
+    size_t readBytes(uint8_t* dst, size_t len) override {
+        size_t n = available() < len ? available() : len;
+        rx.copy(reinterpret_cast<char*>(dst), n, rxPos);
+        rxPos += n;
+        readCalls++;
+        return n;
+    }
+
+    size_t writeBytes(const uint8_t* src, size_t len) override {
+        written.append(reinterpret_cast<const char*>(src), len);
+        if (loopback) rx.append(reinterpret_cast<const char*>(src), len);
+        return len;
+    }
+
+    size_t availableForWrite() override { return 64; }
+
+    uint32_t getOverrunCount() const override { return overruns; }
+
+    std::string written;
+    uint32_t overruns = 0;
+    size_t readCalls = 0;
+
+private:
+    bool loopback;
+    std::string rx;
+    size_t rxPos = 0;
+};
+
+#endif // FAKE_BYTE_STREAM_H
@@ -0,0 +1,67 @@
+#ifndef FAKE_I2C_EEPROM_H
+#define FAKE_I2C_EEPROM_H
+
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <cstddef>
+
+// Simulated 24xx EEPROM on an I2C bus, bus time counted in SCL bits.
+// Pointer bits above addressBytes are taken from the device address low
+// bits, as on 24C16 or 24M01. Faults: reads longer than maxRead NACK, a
+// NACK rate in percent, and unreadable bytes.
+class FakeI2cEeprom {
+public:
+    uint8_t baseAddress;
+    uint8_t addressBytes;
+    std::vector<uint8_t> memory;
+    std::vector<bool> unreadable;
+    size_t maxRead = 1024;
+    uint32_t nackPercent = 0;
+    uint32_t frequencyHz = 400000;
+
+    uint32_t transactions = 0;
+    uint64_t bits = 0;
+
+    FakeI2cEeprom(uint8_t base, uint8_t addressBytes, size_t size)
+        : baseAddress(base), addressBytes(addressBytes), memory(size), unreadable(size, false), rng(42) {
+        for (size_t i = 0; i < size; ++i) memory[i] = (uint8_t)(i * 7 + (i >> 8));
+    }
+
+    double busSeconds() const { return (double)bits / frequencyHz; }
+
+    bool setPointer(uint8_t address, uint32_t reg, uint8_t bytes) {
+        transactions++;
+        bits += 1 + 9 * (1 + bytes);
+        if (!selects(address) || bytes != addressBytes || nack()) return false;
+        uint32_t high = (uint32_t)(address - baseAddress) << (8 * addressBytes);
+        uint32_t low = reg & ((1u << (8 * addressBytes)) - 1);
+        pointer = (high | low) % memory.size();
+        return true;
+    }
+
+    size_t readBlock(uint8_t address, uint8_t* out, size_t count) {
+        transactions++;
+        bits += 1 + 9 + 9 * count + 1;
+        if (!selects(address) || count > maxRead || nack()) return 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (unreadable[pointer]) return i;
+            out[i] = memory[pointer];
+            pointer = (pointer + 1) % memory.size();
+        }
+        return count;
+    }
+
+private:
+    uint32_t pointer = 0;
+    std::mt19937 rng;
+
+    bool selects(uint8_t address) const {
+        size_t blocks = memory.size() >> (8 * addressBytes);
+        return address >= baseAddress && address < baseAddress + (blocks ? blocks : 1);
+    }
+
+    bool nack() { return nackPercent && rng() % 100 < nackPercent; }
+};
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef FAKE_ICMP_TRANSPORT_H
+#define FAKE_ICMP_TRANSPORT_H
+
+#include <map>
+#include <vector>
+#include <algorithm>
+#include "../src/Interfaces/IIcmpTransport.h"
+
+// Simulated network on a virtual clock, hosts answer after their latency,
+// requests can be lost at random or the first ones dropped per host
+class FakeIcmpTransport : public IIcmpTransport {
+public:
+    struct Host {
+        uint32_t latencyMs = 10;
+        uint32_t dropFirst = 0; // requests lost before the first answer
+    };
+
+    uint32_t now = 0;
+    uint32_t lossPercent = 0;
+    uint32_t sent = 0;
+    uint32_t maxBurst = 0; // requests sent at the same instant
+    bool sendFails = false;
+    std::map<uint32_t, Host> hosts;
+
+    uint32_t clock() const { return now; }
+
+    bool sendEcho(uint32_t ipv4, uint16_t ident, uint16_t seq) override {
+        if (sendFails) return false;
+        sent++;
+        burst = (sent > 1 && lastSend == now) ? burst + 1 : 1;
+        lastSend = now;
+        if (burst > maxBurst) maxBurst = burst;
+
+        auto it = hosts.find(ipv4);
+        if (it == hosts.end()) return true;
+        if (it->second.dropFirst) { it->second.dropFirst--; return true; }
+        if (lossPercent && nextRandom() % 100 < lossPercent) return true;
+
+        replies.push_back({now + it->second.latencyMs, ipv4, ident, seq});
+        std::sort(replies.begin(), replies.end(), [](const Reply& a, const Reply& b) { return a.at < b.at; });
+        return true;
+    }
+
+    bool receiveEcho(uint32_t& ipv4, uint16_t& ident, uint16_t& seq, uint32_t timeoutMs) override {
+        if (!replies.empty() && replies.front().at <= now + timeoutMs) {
+            Reply r = replies.front();
+            replies.erase(replies.begin());
+            if (r.at > now) now = r.at;
+            ipv4 = r.ipv4;
+            ident = r.ident;
+            seq = r.seq;
+            return true;
+        }
+        now += timeoutMs;
+        return false;
+    }
+
+private:
+    struct Reply {
+        uint32_t at;
+        uint32_t ipv4;
+        uint16_t ident;
+        uint16_t seq;
+    };
+
+    std::vector<Reply> replies;
+    uint32_t lastSend = 0;
+    uint32_t burst = 0;
+    uint32_t seed = 12345;
+
+    uint32_t nextRandom() {
+        seed = seed * 1103515245u + 12345u;
+        return (seed >> 16) & 0x7FFF;
+    }
+};
+
+#endif // FAKE_ICMP_TRANSPORT_H
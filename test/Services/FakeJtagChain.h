@@ -0,0 +1,177 @@
+#ifndef FAKE_JTAG_CHAIN_H
+#define FAKE_JTAG_CHAIN_H
+
+#include <vector>
+#include <cstdint>
+#include "../src/Services/JtagScanEngine.h"
+
+// Simulated JTAG chain behind a bit bang port. The TAP controllers follow
+// IEEE 1149.1: they step on the rising edge of the real TCK pin, whichever
+// port line drives it, and TDO changes on the falling edge. Undriven pins
+// read their pull, the pull-up by default.
+class FakeJtagChain {
+public:
+    struct Device {
+        uint32_t idcode = 0;        // 0, resets to BYPASS
+        int irLength = 4;
+    };
+
+    // Real wiring
+    uint8_t tckPin, tmsPin, tdiPin, tdoPin;
+    int trstPin = -1;
+    std::vector<Device> devices;    // devices[0] on TDI
+
+    uint64_t clocks = 0;            // port clock() calls
+    uint32_t selects = 0;
+
+    FakeJtagChain(uint8_t tck, uint8_t tms, uint8_t tdi, uint8_t tdo, std::vector<Device> chain)
+        : tckPin(tck), tmsPin(tms), tdiPin(tdi), tdoPin(tdo), devices(chain), taps(chain.size()) {
+        for (int i = 0; i < 64; ++i) { driven[i] = -1; pullUp[i] = true; }
+        reset();
+    }
+
+    // Port
+    void select(uint8_t tck, uint8_t tms, uint8_t tdo, uint8_t tdi) {
+        selects++;
+        release();
+        lineTck = tck;
+        lineTms = tms;
+        lineTdo = tdo;
+        lineTdi = tdi;
+        drive(tck, false);
+        drive(tms, true);
+        if (tdi != JtagScanEngine::NoPin) drive(tdi, true);
+    }
+    void setTms(bool level) { drive(lineTms, level); }
+    void setTdi(bool level) { if (lineTdi != JtagScanEngine::NoPin) drive(lineTdi, level); }
+    bool clock() {
+        clocks++;
+        drive(lineTck, true);
+        bool v = read(lineTdo);
+        drive(lineTck, false);
+        return v;
+    }
+    void pull(uint8_t pin, bool up) { pullUp[pin] = up; update(); }
+    void release() {
+        for (int i = 0; i < 64; ++i) { driven[i] = -1; pullUp[i] = true; }
+        update();
+    }
+
+private:
+    enum State {
+        Reset, Idle, SelectDr, CaptureDr, ShiftDr, Exit1Dr, PauseDr, Exit2Dr, UpdateDr,
+        SelectIr, CaptureIr, ShiftIr, Exit1Ir, PauseIr, Exit2Ir, UpdateIr
+    };
+    struct Tap {
+        uint32_t ir = 0;
+        uint64_t shift = 0;
+        int length = 1;
+    };
+
+    std::vector<Tap> taps;
+    State state = Reset;
+    int tdoOut = -1;            // -1 high impedance
+    int lastTck = 1;
+    int8_t driven[64];
+    bool pullUp[64];
+    uint8_t lineTck = 0, lineTms = 0, lineTdo = 0, lineTdi = 0;
+
+    void drive(uint8_t pin, bool level) { driven[pin] = level ? 1 : 0; update(); }
+
+    int level(uint8_t pin) const { return driven[pin] >= 0 ? driven[pin] : (pullUp[pin] ? 1 : 0); }
+
+    bool read(uint8_t pin) const {
+        if (pin == tdoPin && driven[pin] < 0 && tdoOut >= 0) return tdoOut;
+        return level(pin);
+    }
+
+    uint32_t bypassCode(const Device& d) const { return (1u << d.irLength) - 1; }
+
+    void reset() {
+        state = Reset;
+        tdoOut = -1;
+        for (size_t i = 0; i < taps.size(); ++i) taps[i].ir = devices[i].idcode ? 1 : bypassCode(devices[i]);
+    }
+
+    void update() {
+        if (trstPin >= 0 && level((uint8_t)trstPin) == 0) {
+            reset();
+            lastTck = level(tckPin);
+            return;
+        }
+        int tck = level(tckPin);
+        if (tck != lastTck) {
+            if (tck) rising();
+            else falling();
+            lastTck = tck;
+        }
+    }
+
+    void rising() {
+        bool tms = level(tmsPin);
+        bool tdi = level(tdiPin);
+
+        switch (state) {
+            case CaptureDr:
+                for (size_t i = 0; i < taps.size(); ++i) {
+                    bool id = devices[i].idcode && taps[i].ir == 1;
+                    taps[i].shift = id ? devices[i].idcode : 0;
+                    taps[i].length = id ? 32 : 1;
+                }
+                break;
+            case CaptureIr:
+                for (size_t i = 0; i < taps.size(); ++i) {
+                    taps[i].shift = 1;
+                    taps[i].length = devices[i].irLength;
+                }
+                break;
+            case ShiftDr:
+            case ShiftIr: {
+                bool in = tdi;
+                for (size_t i = 0; i < taps.size(); ++i) {
+                    Tap& t = taps[i];
+                    bool out = t.shift & 1;
+                    t.shift = (t.shift >> 1) | ((uint64_t)in << (t.length - 1));
+                    in = out;
+                }
+                break;
+            }
+            case UpdateIr:
+                for (size_t i = 0; i < taps.size(); ++i) taps[i].ir = (uint32_t)taps[i].shift;
+                break;
+            default:
+                break;
+        }
+        state = next(state, tms);
+        if (state == Reset) reset();
+    }
+
+    void falling() {
+        bool shifting = state == ShiftDr || state == ShiftIr;
+        tdoOut = shifting && !taps.empty() ? (int)(taps.back().shift & 1) : -1;
+    }
+
+    static State next(State s, bool tms) {
+        switch (s) {
+            case Reset:     return tms ? Reset : Idle;
+            case Idle:      return tms ? SelectDr : Idle;
+            case SelectDr:  return tms ? SelectIr : CaptureDr;
+            case CaptureDr: return tms ? Exit1Dr : ShiftDr;
+            case ShiftDr:   return tms ? Exit1Dr : ShiftDr;
+            case Exit1Dr:   return tms ? UpdateDr : PauseDr;
+            case PauseDr:   return tms ? Exit2Dr : PauseDr;
+            case Exit2Dr:   return tms ? UpdateDr : ShiftDr;
+            case UpdateDr:  return tms ? SelectDr : Idle;
+            case SelectIr:  return tms ? Reset : CaptureIr;
+            case CaptureIr: return tms ? Exit1Ir : ShiftIr;
+            case ShiftIr:   return tms ? Exit1Ir : ShiftIr;
+            case Exit1Ir:   return tms ? UpdateIr : PauseIr;
+            case PauseIr:   return tms ? Exit2Ir : PauseIr;
+            case Exit2Ir:   return tms ? UpdateIr : ShiftIr;
+            case UpdateIr:  return tms ? SelectDr : Idle;
+        }
+        return Reset;
+    }
+};
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef FAKE_SCRIPT_HOST_H
+#define FAKE_SCRIPT_HOST_H
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include "../src/Interfaces/IScriptHost.h"
+#include "../src/Services/ByteCodeEngine.h"
+
+// Script host in I2C mode with a 256 byte register device at 0x50.
+// Writing data starts a write cycle: register 0xFF reads 1 (busy) for the
+// next busyPolls reads, then 0.
+class FakeScriptHost : public IScriptHost {
+public:
+    std::vector<uint8_t> memory = std::vector<uint8_t>(256, 0xFF);
+    uint32_t busyPolls = 3;
+    bool instructionsEnabled = true;
+    uint32_t stopAfterPolls = 0;        // 0 never stops
+
+    std::vector<std::string> commands;
+    std::vector<std::string> printed;
+    uint32_t delayedMs = 0;
+    uint32_t instructions = 0;
+    uint32_t stopPolls = 0;
+
+    bool runInstruction(const ByteCodeProgram& program, std::vector<uint8_t>& read) override {
+        if (!instructionsEnabled) return false;
+        instructions++;
+        std::string hex = ByteCodeEngine::runI2c(program, bus);
+        read.clear();
+        for (size_t i = 0; i + 1 < hex.size(); i += 3) read.push_back((uint8_t)strtoul(hex.substr(i, 2).c_str(), nullptr, 16));
+        return true;
+    }
+
+    void runCommand(const std::string& line) override { commands.push_back(line); }
+    void print(const std::string& text) override { printed.push_back(text); }
+    void delayMs(uint32_t ms) override { delayedMs += ms; }
+
+    bool stopRequested() override {
+        stopPolls++;
+        return stopAfterPolls && stopPolls >= stopAfterPolls;
+    }
+
+private:
+    struct Bus {
+        FakeScriptHost& host;
+        uint8_t address = 0;
+        uint8_t pointer = 0;
+        uint32_t busy = 0;
+        bool pointerSet = false;
+
+        void beginTransmission(uint8_t a) {
+            address = a;
+            pointerSet = false;
+        }
+        void write(const uint8_t* data, size_t count) {
+            if (address != 0x50) return;
+            for (size_t i = 0; i < count; ++i) {
+                if (!pointerSet) {
+                    pointer = data[i];
+                    pointerSet = true;
+                } else {
+                    host.memory[pointer++] = data[i];
+                    busy = host.busyPolls;
+                }
+            }
+        }
+        void endTransmission(bool) {}
+        size_t requestFrom(uint8_t a, uint8_t* out, size_t count) {
+            if (a != 0x50) return 0;
+            for (size_t i = 0; i < count; ++i) {
+                if (pointer == 0xFF) {
+                    out[i] = busy ? 1 : 0;
+                    if (busy) busy--;
+                } else {
+                    out[i] = host.memory[pointer++];
+                }
+            }
+            return count;
+        }
+        void delayUs(uint32_t) {}
+        void delayMs(uint32_t) {}
+    };
+    Bus bus{*this};
+};
+
+#endif // FAKE_SCRIPT_HOST_H
@@ -0,0 +1,239 @@
+#ifndef TEST_BYTE_CODE_ENGINE_H
+#define TEST_BYTE_CODE_ENGINE_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../src/Services/ByteCodeEngine.h"
+#include "../src/Transformers/InstructionTransformer.h"
+
+// Bus recording every call, reads return a counter
+struct RecordingProgramBus {
+    std::vector<std::string> calls;
+    std::vector<uint8_t> written;
+    std::vector<uint8_t> readAddresses;     // I2C address of each requestFrom
+    uint8_t next = 0x10;
+    uint32_t delayedUs = 0;
+    size_t pending = 0;     // stream bytes available
+
+    void log(const char* name, size_t n) { calls.push_back(std::string(name) + ":" + std::to_string(n)); }
+    void delayUs(uint32_t us) { delayedUs += us; }
+    void delayMs(uint32_t ms) { delayedUs += ms * 1000; }
+
+    // SPI
+    void select(bool active) { log(active ? "cs" : "release", 0); }
+    void transfer(const uint8_t* out, uint8_t* in, size_t count) {
+        log(in ? "xfer-in" : "xfer", count);
+        for (size_t i = 0; i < count; ++i) {
+            if (in) in[i] = next++;
+            else written.push_back(out[i]);
+        }
+    }
+
+    // I2C
+    void beginTransmission(uint8_t address) { log("begin", address); }
+    void write(const uint8_t* data, size_t count) {
+        log("write", count);
+        written.insert(written.end(), data, data + count);
+    }
+    void endTransmission(bool stop) { log(stop ? "stop" : "restart", 0); }
+    size_t requestFrom(uint8_t address, uint8_t* out, size_t count) {
+        log("request", count);
+        readAddresses.push_back(address);
+        for (size_t i = 0; i < count; ++i) out[i] = next++;
+        return count;
+    }
+
+    // Stream and 1-Wire
+    size_t read(uint8_t* out, size_t count, uint32_t timeoutMs) {
+        size_t n = std::min(count, pending);
+        for (size_t i = 0; i < n; ++i) out[i] = (uint8_t)('a' + i);
+        pending -= n;
+        if (n < count) delayedUs += timeoutMs * 1000;
+        return n;
+    }
+    void read(uint8_t* out, size_t count) {
+        log("read", count);
+        for (size_t i = 0; i < count; ++i) out[i] = next++;
+    }
+    void reset() { log("reset", 0); }
+};
+
+static std::string joinCalls(const RecordingProgramBus& bus) {
+    std::string s;
+    for (const auto& c : bus.calls) s += c + " ";
+    return s;
+}
+
+void test_byte_code_engine_spi_and_i2c_spans() {
+    InstructionTransformer transformer;
+    ByteCodeProgram program;
+
+    transformer.compile("[0x9F r:3 d:7] 0x01", program);
+    RecordingProgramBus spi;
+    std::string read = ByteCodeEngine::runSpi(program, spi);
+    TEST_ASSERT_EQUAL_STRING("10 11 12 ", read.c_str());
+    TEST_ASSERT_EQUAL_STRING("cs:0 xfer:1 xfer-in:3 release:0 ", joinCalls(spi).c_str());
+    TEST_ASSERT_EQUAL_UINT32(7, spi.delayedUs);
+
+    // Register write then read back with a repeated start
+    transformer.compile("[0x50 0x00 0x10 0xDE 0xAD 0xBE 0xEF][0x50 0x00 0x10 r:2]", program);
+    RecordingProgramBus i2c;
+    read = ByteCodeEngine::runI2c(program, i2c);
+    TEST_ASSERT_EQUAL_STRING("10 11 ", read.c_str());
+    TEST_ASSERT_EQUAL_STRING("begin:80 write:6 stop:0 begin:80 write:2 restart:0 request:2 ",
+                             joinCalls(i2c).c_str());
+    const std::vector<uint8_t> expected = {0x00, 0x10, 0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x10};
+    TEST_ASSERT_TRUE(i2c.written == expected);
+    TEST_ASSERT_TRUE(i2c.readAddresses == std::vector<uint8_t>{0x50});
+
+    // Each read goes to the address sent after its own START
+    transformer.compile("[0x50 0x00][0x51 r:1]", program);
+    RecordingProgramBus two;
+    ByteCodeEngine::runI2c(program, two);
+    TEST_ASSERT_TRUE(two.readAddresses == std::vector<uint8_t>{0x51});
+}
+
+void test_byte_code_engine_stream_and_one_wire() {
+    InstructionTransformer transformer;
+    ByteCodeProgram program;
+
+    transformer.compile("[\"AT\" 0x0D 0x0A r:4 D:1]", program);
+    RecordingProgramBus uart;
+    uart.pending = 2;
+    std::string read = ByteCodeEngine::runStream(program, uart);
+    TEST_ASSERT_EQUAL_STRING("ab", read.c_str());      // 2 of 4, then the timeout
+    TEST_ASSERT_EQUAL_STRING("write:4 ", joinCalls(uart).c_str());
+    TEST_ASSERT_EQUAL_UINT32(ByteCodeEngine::StreamReadTimeoutMs * 1000 + 1000, uart.delayedUs);
+
+    transformer.compile("[0xCC 0x44] [0xCC 0xBE r:9]", program);
+    RecordingProgramBus oneWire;
+    read = ByteCodeEngine::runOneWire(program, oneWire);
+    TEST_ASSERT_EQUAL_STRING("10 11 12 13 14 15 16 17 18 ", read.c_str());
+    TEST_ASSERT_EQUAL_STRING("reset:0 write:2 reset:0 reset:0 write:2 read:9 reset:0 ", joinCalls(oneWire).c_str());
+}
+
+void test_byte_code_engine_reads_into_bytes() {
+    InstructionTransformer transformer;
+    ByteCodeProgram program;
+    std::vector<uint8_t> read = {0xFF};     // stale content is replaced
+
+    transformer.compile("[0x9F r:3]", program);
+    RecordingProgramBus spi;
+    ByteCodeEngine::runSpi(program, spi, read);
+    TEST_ASSERT_TRUE(read == (std::vector<uint8_t>{0x10, 0x11, 0x12}));
+
+    transformer.compile("[0x50 0x00][0x50 r:2]", program);
+    RecordingProgramBus i2c;
+    ByteCodeEngine::runI2c(program, i2c, read);
+    TEST_ASSERT_TRUE(read == (std::vector<uint8_t>{0x10, 0x11}));
+
+    transformer.compile("[0x01 r:4]", program);
+    RecordingProgramBus uart;
+    uart.pending = 3;
+    ByteCodeEngine::runStream(program, uart, read);
+    TEST_ASSERT_TRUE(read == (std::vector<uint8_t>{'a', 'b', 'c'}));
+
+    transformer.compile("[0xCC r:70]", program);
+    RecordingProgramBus oneWire;
+    ByteCodeEngine::runOneWire(program, oneWire, read);
+    TEST_ASSERT_EQUAL(70, read.size());
+    TEST_ASSERT_EQUAL_HEX8(0x10, read[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x10 + 69, read[69]);
+    TEST_ASSERT_EQUAL_STRING("10 11 ", ByteCodeEngine::toHex({0x10, 0x11}).c_str());
+}
+
+// Counts bus calls like the hardware would see them
+struct CountingSpiBus {
+    uint64_t calls = 0;
+    uint64_t bytes = 0;
+    uint8_t last = 0;
+    void select(bool) { calls++; }
+    uint8_t transfer(uint8_t out) {
+        calls++;
+        bytes++;
+        last ^= out;
+        return last;
+    }
+    void transfer(const uint8_t* out, uint8_t* in, size_t count) {
+        calls++;
+        bytes += count;
+        for (size_t i = 0; i < count; ++i) {
+            last ^= out[i];
+            if (in) in[i] = last;
+        }
+    }
+    void delayUs(uint32_t) {}
+    void delayMs(uint32_t) {}
+};
+
+// What SpiService::executeByteCode did, one transfer per ByteCode byte
+static std::string runSpiPerByte(const std::vector<ByteCode>& codes, CountingSpiBus& bus) {
+    std::string result;
+    bool selected = false;
+    for (const auto& code : codes) {
+        switch (code.getCommand()) {
+            case ByteCodeEnum::Start: if (!selected) bus.select(true); selected = true; break;
+            case ByteCodeEnum::Stop: if (selected) bus.select(false); selected = false; break;
+            case ByteCodeEnum::Write:
+                for (uint32_t i = 0; i < code.getRepeat(); ++i) bus.transfer((uint8_t)code.getData());
+                break;
+            case ByteCodeEnum::Read:
+                for (uint32_t i = 0; i < code.getRepeat(); ++i) {
+                    char hex[5];
+                    snprintf(hex, sizeof(hex), "%02X ", bus.transfer(0x00));
+                    result += hex;
+                }
+                break;
+            default: break;
+        }
+    }
+    if (selected) bus.select(false);
+    return result;
+}
+
+void test_byte_code_engine_4k_write_vs_per_byte() {
+    std::string line = "[0x02 0x00 0x00 0x00";
+    for (int i = 0; i < 4096; ++i) {
+        char token[8];
+        snprintf(token, sizeof(token), " 0x%02X", (unsigned)(i * 7) & 0xFF);
+        line += token;
+    }
+    line += " r:4]";
+
+    InstructionTransformer transformer;
+    ByteCodeProgram program;
+    const int rounds = 20;
+
+    CountingSpiBus oldBus;
+    std::string oldRead;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        auto codes = transformer.transformByteCodes(transformer.transform(line));
+        oldRead = runSpiPerByte(codes, oldBus);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    CountingSpiBus newBus;
+    std::string newRead;
+    for (int r = 0; r < rounds; ++r) {
+        transformer.compile(line, program);
+        newRead = ByteCodeEngine::runSpi(program, newBus);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    double oldUs = std::chrono::duration<double, std::micro>(t1 - t0).count() / rounds;
+    double newUs = std::chrono::duration<double, std::micro>(t2 - t1).count() / rounds;
+    printf("  4 KB SPI write: per byte %.0f us, %llu bus calls | compiled %.0f us, %llu bus calls (%.1fx)\n",
+           oldUs, (unsigned long long)(oldBus.calls / rounds), newUs,
+           (unsigned long long)(newBus.calls / rounds), oldUs / newUs);
+
+    TEST_ASSERT_EQUAL_STRING(oldRead.c_str(), newRead.c_str());
+    TEST_ASSERT_EQUAL_UINT64(oldBus.bytes, newBus.bytes);
+    TEST_ASSERT_EQUAL_UINT64(4 * rounds, newBus.calls);    // select, write, read, release
+    TEST_ASSERT_TRUE(newUs < oldUs);
+}
+
+#endif
@@ -0,0 +1,208 @@
+#ifndef TEST_I2C_DUMP_ENGINE_H
+#define TEST_I2C_DUMP_ENGINE_H
+
+#include <unity.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../src/Services/I2cDumpEngine.h"
+#include "FakeI2cEeprom.h"
+
+struct I2cDumpCapture {
+    std::vector<uint8_t> values;
+    std::vector<bool> valid;
+    uint32_t start;
+    uint32_t next;
+    bool ordered = true;
+
+    I2cDumpCapture(uint32_t start, uint32_t length)
+        : values(length, 0xFF), valid(length, false), start(start), next(start) {}
+
+    void operator()(uint32_t reg, const uint8_t* data, size_t count) {
+        if (reg != next) ordered = false;
+        for (size_t i = 0; i < count; ++i) {
+            values[reg - start + i] = data ? data[i] : 0xFF;
+            valid[reg - start + i] = data != nullptr;
+        }
+        next = reg + (uint32_t)count;
+    }
+};
+
+static bool i2cNeverCancel() { return false; }
+
+void test_i2c_dump_full_eeprom_large_chunks() {
+    FakeI2cEeprom eeprom(0x50, 2, 32768);
+    I2cDumpOptions options;
+    options.length = 32768;
+    options.addressBytes = 2;
+    I2cDumpCapture capture(0, options.length);
+    I2cDumpStats stats;
+
+    TEST_ASSERT_TRUE(I2cDumpEngine::dump(eeprom, options, capture, i2cNeverCancel, stats));
+    TEST_ASSERT_TRUE(capture.ordered);
+    TEST_ASSERT_TRUE(capture.values == eeprom.memory);
+    TEST_ASSERT_EQUAL_UINT32(32768, stats.bytesRead);
+    TEST_ASSERT_EQUAL_UINT32(256, stats.chunks);
+    TEST_ASSERT_EQUAL_UINT32(512, eeprom.transactions);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.nacks);
+}
+
+void test_i2c_dump_adapts_chunk_to_nacks() {
+    // Device or controller limited to 24 bytes per read
+    FakeI2cEeprom eeprom(0x50, 2, 4096);
+    eeprom.maxRead = 24;
+    I2cDumpOptions options;
+    options.length = 4096;
+    options.addressBytes = 2;
+    I2cDumpCapture capture(0, options.length);
+    I2cDumpStats stats;
+
+    TEST_ASSERT_TRUE(I2cDumpEngine::dump(eeprom, options, capture, i2cNeverCancel, stats));
+    TEST_ASSERT_TRUE(capture.values == eeprom.memory);
+    TEST_ASSERT_TRUE(stats.shrinks >= 3);                        // 128 -> 16
+    TEST_ASSERT_TRUE(stats.lastChunk == 16 || stats.lastChunk == 32);
+    TEST_ASSERT_TRUE(stats.nacks <= stats.chunks / I2cDumpEngine::GrowAfter + 4);
+
+    // Random NACKs, still complete and exact
+    FakeI2cEeprom noisy(0x50, 2, 4096);
+    noisy.nackPercent = 8;
+    I2cDumpCapture noisyCapture(0, options.length);
+    TEST_ASSERT_TRUE(I2cDumpEngine::dump(noisy, options, noisyCapture, i2cNeverCancel, stats));
+    TEST_ASSERT_TRUE(noisyCapture.values == noisy.memory);
+    TEST_ASSERT_TRUE(stats.nacks > 0);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.bytesSkipped);
+}
+
+void test_i2c_dump_block_select_and_raw_reads() {
+    // 24C16, 8 blocks of 256 behind 0x50..0x57
+    FakeI2cEeprom eeprom(0x50, 1, 2048);
+    I2cDumpOptions options;
+    options.start = 0x1F0;
+    options.length = 0x200;
+    options.addressBytes = 1;
+    options.blockInAddress = true;
+    I2cDumpCapture capture(options.start, options.length);
+    I2cDumpStats stats;
+
+    TEST_ASSERT_TRUE(I2cDumpEngine::dump(eeprom, options, capture, i2cNeverCancel, stats));
+    for (uint32_t i = 0; i < options.length; ++i) {
+        TEST_ASSERT_EQUAL_UINT8(eeprom.memory[options.start + i], capture.values[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, stats.nacks);
+
+    // Raw, pointer written once then current address reads
+    FakeI2cEeprom raw(0x50, 1, 256);
+    options = I2cDumpOptions();
+    options.start = 0x10;
+    options.length = 200;
+    options.addressBytes = 0;
+    options.maxChunk = 32;
+    I2cDumpCapture rawCapture(options.start, options.length);
+    TEST_ASSERT_TRUE(I2cDumpEngine::dump(raw, options, rawCapture, i2cNeverCancel, stats));
+    TEST_ASSERT_EQUAL_UINT32(1 + 7, raw.transactions);
+    TEST_ASSERT_EQUAL_UINT8(raw.memory[0x10], rawCapture.values[0]);
+    TEST_ASSERT_EQUAL_UINT8(raw.memory[0x10 + 199], rawCapture.values[199]);
+
+    // Raw read failing mid chunk: skipped without a retry, the pointer is
+    // written again before the next chunk
+    raw.unreadable[0x40] = true;
+    raw.transactions = 0;
+    I2cDumpCapture rawSkip(options.start, options.length);
+    TEST_ASSERT_TRUE(I2cDumpEngine::dump(raw, options, rawSkip, i2cNeverCancel, stats));
+    TEST_ASSERT_EQUAL_UINT32(32, stats.bytesSkipped);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.nacks);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.shrinks);
+    TEST_ASSERT_EQUAL_UINT32(1 + 7 + 1, raw.transactions);
+    TEST_ASSERT_FALSE(rawSkip.valid[0x30 - 0x10]);
+    TEST_ASSERT_TRUE(rawSkip.valid[0x50 - 0x10]);
+    TEST_ASSERT_EQUAL_UINT8(raw.memory[0x50], rawSkip.values[0x50 - 0x10]);
+    TEST_ASSERT_EQUAL_UINT8(raw.memory[0x10 + 199], rawSkip.values[199]);
+}
+
+void test_i2c_dump_skips_unreadable_and_cancels() {
+    FakeI2cEeprom eeprom(0x50, 1, 256);
+    eeprom.unreadable[0x40] = true;
+    eeprom.unreadable[0x41] = true;
+    I2cDumpOptions options;
+    I2cDumpCapture capture(0, 256);
+    I2cDumpStats stats;
+
+    TEST_ASSERT_TRUE(I2cDumpEngine::dump(eeprom, options, capture, i2cNeverCancel, stats));
+    TEST_ASSERT_TRUE(capture.ordered);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.bytesSkipped);
+    TEST_ASSERT_EQUAL_UINT32(254, stats.bytesRead);
+    TEST_ASSERT_FALSE(capture.valid[0x40]);
+    TEST_ASSERT_FALSE(capture.valid[0x41]);
+    TEST_ASSERT_TRUE(capture.valid[0x42]);
+    TEST_ASSERT_EQUAL_UINT8(eeprom.memory[0x3F], capture.values[0x3F]);
+    TEST_ASSERT_EQUAL_UINT8(eeprom.memory[0x42], capture.values[0x42]);
+
+    // Nothing answers, aborted after the skips
+    FakeI2cEeprom absent(0x60, 1, 256);
+    I2cDumpCapture none(0, 256);
+    TEST_ASSERT_FALSE(I2cDumpEngine::dump(absent, options, none, i2cNeverCancel, stats));
+    TEST_ASSERT_TRUE(stats.aborted);
+    TEST_ASSERT_EQUAL_UINT32(I2cDumpEngine::MaxConsecutiveSkips, stats.bytesSkipped);
+
+    // Cancelled between chunks
+    FakeI2cEeprom big(0x50, 2, 8192);
+    options.addressBytes = 2;
+    options.length = 8192;
+    options.maxChunk = 64;
+    I2cDumpCapture partial(0, 8192);
+    int polls = 0;
+    TEST_ASSERT_FALSE(I2cDumpEngine::dump(big, options, partial, [&]() { return ++polls > 5; }, stats));
+    TEST_ASSERT_TRUE(stats.cancelled);
+    TEST_ASSERT_EQUAL_UINT32(5 * 64, stats.bytesRead);
+    TEST_ASSERT_EQUAL_UINT32(10, big.transactions);
+}
+
+void test_i2c_dump_hex_line_stream() {
+    I2cHexLineStream stream(0x10);
+    std::vector<std::string> lines;
+    auto emit = [&](const std::string& line) { lines.push_back(line); };
+
+    const uint8_t data[] = {'A', 'B', 0x00, 0x7F, 0xFF};
+    stream.add(0x10, data, 5, emit);
+    stream.add(0x15, nullptr, 2, emit);
+    std::vector<uint8_t> rest(9, 0x41);
+    stream.add(0x17, rest.data(), rest.size(), emit);
+    TEST_ASSERT_EQUAL_UINT32(1, lines.size());
+    stream.add(0x20, data, 2, emit);
+    stream.finish(emit);
+    TEST_ASSERT_EQUAL_UINT32(2, lines.size());
+
+    TEST_ASSERT_EQUAL_STRING(
+        "10: 41 42 00 7F FF ?? ?? 41 41 41 41 41 41 41 41 41  AB.....AAAAAAAAA", lines[0].c_str());
+    TEST_ASSERT_EQUAL_STRING(
+        "20: 41 42                                            AB..............", lines[1].c_str());
+}
+
+void test_i2c_dump_throughput_fast_mode_plus() {
+    // 24C256 at 1 MHz, 16 byte chunks as before against the Wire buffer size
+    FakeI2cEeprom before(0x50, 2, 32768), after(0x50, 2, 32768);
+    before.frequencyHz = after.frequencyHz = 1000000;
+    I2cDumpOptions options;
+    options.length = 32768;
+    options.addressBytes = 2;
+    I2cDumpStats stats;
+
+    options.maxChunk = 16;
+    I2cDumpCapture a(0, options.length);
+    TEST_ASSERT_TRUE(I2cDumpEngine::dump(before, options, a, i2cNeverCancel, stats));
+    double beforeSecs = before.busSeconds() + 0.001 * stats.chunks;   // delay(1) per chunk
+
+    options.maxChunk = 128;
+    I2cDumpCapture b(0, options.length);
+    TEST_ASSERT_TRUE(I2cDumpEngine::dump(after, options, b, i2cNeverCancel, stats));
+    stats.elapsedUs = (uint32_t)(after.busSeconds() * 1e6);
+    TEST_ASSERT_TRUE(b.values == after.memory);
+    TEST_ASSERT_TRUE(after.busSeconds() * 5 < beforeSecs);
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "I2C dump 32 KB @ 1 MHz: %.1f kB/s (16 byte chunks + delay: %.1f kB/s)",
+             stats.bytesPerSecond() / 1000, 32.768 / beforeSecs);
+    TEST_MESSAGE(msg);
+}
+
+#endif
@@ -0,0 +1,175 @@
+#ifndef TEST_ICMP_DISCOVERY_ENGINE_H
+#define TEST_ICMP_DISCOVERY_ENGINE_H
+
+#include <unity.h>
+#include <cstdio>
+#include <vector>
+#include "../src/Services/IcmpDiscoveryEngine.h"
+#include "FakeIcmpTransport.h"
+
+static uint32_t icmpTestIp(const char* text) {
+    uint32_t ip = 0;
+    IcmpDiscoveryEngine::parseIpv4(text, ip);
+    return ip;
+}
+
+void test_icmp_discovery_parses_cidr() {
+    uint32_t first, count;
+
+    TEST_ASSERT_TRUE(IcmpDiscoveryEngine::parseCidr("192.168.1.77/24", first, count));
+    TEST_ASSERT_EQUAL_STRING("192.168.1.1", IcmpDiscoveryEngine::ipToString(first).c_str());
+    TEST_ASSERT_EQUAL(254, count);
+
+    TEST_ASSERT_TRUE(IcmpDiscoveryEngine::parseCidr("10.0.0.0/22", first, count));
+    TEST_ASSERT_EQUAL(1022, count);
+
+    TEST_ASSERT_TRUE(IcmpDiscoveryEngine::parseCidr("10.0.0.9", first, count));
+    TEST_ASSERT_EQUAL(1, count);
+    TEST_ASSERT_TRUE(IcmpDiscoveryEngine::parseCidr("10.0.0.9/31", first, count));
+    TEST_ASSERT_EQUAL(2, count);
+
+    TEST_ASSERT_FALSE(IcmpDiscoveryEngine::parseCidr("10.0.0.0/8", first, count));
+    TEST_ASSERT_FALSE(IcmpDiscoveryEngine::parseCidr("10.0.0/24", first, count));
+    TEST_ASSERT_FALSE(IcmpDiscoveryEngine::parseCidr("10.0.0.256/24", first, count));
+    TEST_ASSERT_FALSE(IcmpDiscoveryEngine::parseCidr("10.0.0.1/", first, count));
+
+    TEST_ASSERT_EQUAL(24, IcmpDiscoveryEngine::maskToPrefix("255.255.255.0"));
+    TEST_ASSERT_EQUAL(20, IcmpDiscoveryEngine::maskToPrefix("255.255.240.0"));
+    TEST_ASSERT_EQUAL(-1, IcmpDiscoveryEngine::maskToPrefix("255.0.255.0"));
+}
+
+void test_icmp_discovery_streams_replies_by_latency() {
+    FakeIcmpTransport net;
+    net.hosts[icmpTestIp("192.168.1.10")] = {120, 0};
+    net.hosts[icmpTestIp("192.168.1.20")] = {5, 0};
+    net.hosts[icmpTestIp("192.168.1.30")] = {40, 0};
+
+    IcmpDiscoveryEngine engine(net);
+    engine.setClock([&net]() { return net.clock(); });
+
+    std::vector<std::string> found;
+    std::vector<uint32_t> rtts;
+    uint32_t first, count;
+    IcmpDiscoveryEngine::parseCidr("192.168.1.0/24", first, count);
+
+    IcmpDiscoveryEngine::Options options;
+    options.maxInFlight = 64;
+    IcmpDiscoveryStats stats = engine.run(first, count, icmpTestIp("192.168.1.2"), options,
+        [&](uint32_t ip, uint32_t rtt) {
+            found.push_back(IcmpDiscoveryEngine::ipToString(ip));
+            rtts.push_back(rtt);
+        });
+
+    // All three in the first window, fastest first, not in address order
+    TEST_ASSERT_EQUAL(3, found.size());
+    TEST_ASSERT_EQUAL_STRING("192.168.1.20", found[0].c_str());
+    TEST_ASSERT_EQUAL_STRING("192.168.1.30", found[1].c_str());
+    TEST_ASSERT_EQUAL_STRING("192.168.1.10", found[2].c_str());
+    TEST_ASSERT_EQUAL(5, rtts[0]);
+    TEST_ASSERT_EQUAL(120, rtts[2]);
+
+    TEST_ASSERT_EQUAL(3, stats.hostsUp);
+    TEST_ASSERT_EQUAL(253, stats.hostsScanned); // own address skipped
+    TEST_ASSERT_FALSE(stats.stopped);
+}
+
+void test_icmp_discovery_keeps_window_in_flight() {
+    FakeIcmpTransport net;
+    IcmpDiscoveryEngine engine(net);
+    engine.setClock([&net]() { return net.clock(); });
+
+    IcmpDiscoveryEngine::Options options;
+    options.maxInFlight = 32;
+    options.timeoutMs = 400;
+    options.retries = 1;
+
+    uint32_t first, count;
+    IcmpDiscoveryEngine::parseCidr("10.1.2.0/24", first, count);
+    IcmpDiscoveryStats stats = engine.run(first, count, 0, options, nullptr);
+
+    TEST_ASSERT_EQUAL(32, net.maxBurst);
+    TEST_ASSERT_EQUAL(254 * 2, stats.probes);
+    TEST_ASSERT_EQUAL(0, stats.hostsUp);
+
+    // Empty subnet: 16 rounds of timeouts instead of 508
+    uint32_t sequentialMs = 254 * 2 * options.timeoutMs;
+    TEST_ASSERT_LESS_THAN(sequentialMs / 16, stats.elapsedMs);
+
+    char msg[200];
+    snprintf(msg, sizeof(msg), "Empty /24: %s, sequential %.1f s",
+             engine.formatStats(stats).c_str(), sequentialMs / 1000.0f);
+    TEST_MESSAGE(msg);
+}
+
+void test_icmp_discovery_retries_lost_requests() {
+    FakeIcmpTransport net;
+    net.hosts[icmpTestIp("10.0.0.5")] = {20, 1}; // first request lost
+
+    IcmpDiscoveryEngine engine(net);
+    engine.setClock([&net]() { return net.clock(); });
+
+    IcmpDiscoveryEngine::Options options;
+    options.retries = 0;
+    IcmpDiscoveryStats stats = engine.run(icmpTestIp("10.0.0.5"), 1, 0, options, nullptr);
+    TEST_ASSERT_EQUAL(0, stats.hostsUp);
+
+    net.hosts[icmpTestIp("10.0.0.5")].dropFirst = 1;
+    options.retries = 1;
+    stats = engine.run(icmpTestIp("10.0.0.5"), 1, 0, options, nullptr);
+    TEST_ASSERT_EQUAL(1, stats.hostsUp);
+    TEST_ASSERT_EQUAL(2, stats.probes);
+}
+
+void test_icmp_discovery_stops_on_request() {
+    FakeIcmpTransport net;
+    IcmpDiscoveryEngine engine(net);
+    engine.setClock([&net]() { return net.clock(); });
+
+    int polls = 0;
+    uint32_t first, count;
+    IcmpDiscoveryEngine::parseCidr("172.16.0.0/16", first, count);
+    IcmpDiscoveryStats stats = engine.run(first, count, 0, IcmpDiscoveryEngine::Options(), nullptr,
+        [&polls]() { return ++polls > 20; });
+
+    TEST_ASSERT_TRUE(stats.stopped);
+    TEST_ASSERT_LESS_THAN(count, stats.hostsScanned);
+}
+
+void test_icmp_discovery_survives_send_failures() {
+    FakeIcmpTransport net;
+    net.sendFails = true;
+    IcmpDiscoveryEngine engine(net);
+    engine.setClock([&net]() { return net.clock(); });
+
+    IcmpDiscoveryStats stats = engine.run(icmpTestIp("10.0.0.1"), 8, 0, IcmpDiscoveryEngine::Options(), nullptr);
+
+    TEST_ASSERT_EQUAL(0, stats.probes);
+    TEST_ASSERT_EQUAL(8, stats.hostsScanned);
+}
+
+void test_icmp_discovery_lossy_network_1022_hosts() {
+    FakeIcmpTransport net;
+    net.lossPercent = 20;
+    uint32_t first, count;
+    IcmpDiscoveryEngine::parseCidr("10.20.0.0/22", first, count);
+    for (uint32_t i = 0; i < count; i += 10) net.hosts[first + i] = {5 + i % 150, 0};
+
+    IcmpDiscoveryEngine engine(net);
+    engine.setClock([&net]() { return net.clock(); });
+
+    IcmpDiscoveryEngine::Options options;
+    options.maxInFlight = 32;
+    options.timeoutMs = 400;
+    options.retries = 2;
+    IcmpDiscoveryStats stats = engine.run(first, count, 0, options, nullptr);
+
+    // 20% loss, 3 tries: under 1% of the live hosts missed
+    TEST_ASSERT_GREATER_OR_EQUAL(net.hosts.size() - 2, stats.hostsUp);
+
+    char msg[200];
+    snprintf(msg, sizeof(msg), "Lossy /22: %s of %zu live (virtual time)",
+             engine.formatStats(stats).c_str(), net.hosts.size());
+    TEST_MESSAGE(msg);
+}
+
+#endif // TEST_ICMP_DISCOVERY_ENGINE_H
@@ -0,0 +1,135 @@
+#ifndef TEST_JTAG_SCAN_ENGINE_H
+#define TEST_JTAG_SCAN_ENGINE_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "../src/Services/JtagScanEngine.h"
+#include "FakeJtagChain.h"
+
+static std::vector<uint8_t> jtagPins(uint8_t count) {
+    std::vector<uint8_t> pins;
+    for (uint8_t i = 0; i < count; ++i) pins.push_back(i + 1);
+    return pins;
+}
+
+void test_jtag_engine_tap_primitives() {
+    // ESP32-S3 and STM32F4 boundary scan TAP, STM32 on TDO
+    FakeJtagChain chain(4, 5, 6, 7, {{0x120034E5, 5}, {0x06413041, 5}});
+    chain.select(4, 5, 7, 6);
+
+    TEST_ASSERT_EQUAL_HEX32(0x06413041, JtagScanEngine::readIdcode(chain));
+    TEST_ASSERT_EQUAL_INT(2, JtagScanEngine::countDevices(chain));
+    TEST_ASSERT_EQUAL_HEX32(0xDEADBEEF, JtagScanEngine::bypassTest(chain, 2, 0xDEADBEEF));
+
+    std::vector<uint32_t> ids;
+    JtagScanEngine::readDeviceIds(chain, 2, ids);
+    TEST_ASSERT_EQUAL_UINT32(2, ids.size());
+    TEST_ASSERT_EQUAL_HEX32(0x06413041, ids[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x120034E5, ids[1]);
+
+    TEST_ASSERT_TRUE(JtagScanEngine::isValidIdcode(0x06413041));
+    TEST_ASSERT_FALSE(JtagScanEngine::isValidIdcode(0xFFFFFFFF));
+    TEST_ASSERT_FALSE(JtagScanEngine::isValidIdcode(0x00000000));
+    TEST_ASSERT_FALSE(JtagScanEngine::isValidIdcode(0x06413040));
+    TEST_ASSERT_EQUAL_HEX32(0x80000001, JtagScanEngine::bitReverse(0x80000001));
+    TEST_ASSERT_EQUAL_HEX32(0x0000000F, JtagScanEngine::bitReverse(0xF0000000));
+}
+
+void test_jtag_engine_staged_search_finds_pinout() {
+    FakeJtagChain chain(6, 3, 8, 2, {{0x4BA00477, 4}, {0x06413041, 5}});
+    chain.trstPin = 5;
+    auto pins = jtagPins(8);
+
+    JtagPinout found;
+    JtagScanStats stats;
+    TEST_ASSERT_TRUE(JtagScanEngine::scan(chain, pins, found, stats));
+
+    TEST_ASSERT_EQUAL_UINT8(6, found.tck);
+    TEST_ASSERT_EQUAL_UINT8(3, found.tms);
+    TEST_ASSERT_EQUAL_UINT8(8, found.tdi);
+    TEST_ASSERT_EQUAL_UINT8(2, found.tdo);
+    TEST_ASSERT_EQUAL_INT(5, found.trst);
+    TEST_ASSERT_EQUAL_UINT32(2, found.ids.size());
+    TEST_ASSERT_EQUAL_HEX32(0x06413041, found.ids[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x4BA00477, found.ids[1]);
+
+    TEST_ASSERT_TRUE(stats.idcodePermutations <= 8 * 7 * 6);
+    TEST_ASSERT_TRUE(stats.bypassPermutations >= 1 && stats.bypassPermutations <= 5);
+    TEST_ASSERT_TRUE(stats.trstPermutations >= 1 && stats.trstPermutations <= 4);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.exhaustivePermutations);
+}
+
+void test_jtag_engine_no_device_and_fallback() {
+    // Nothing connected, every pin reads its pull-up
+    FakeJtagChain empty(1, 2, 3, 4, {});
+    auto pins = jtagPins(6);
+    JtagPinout found;
+    JtagScanStats stats;
+
+    TEST_ASSERT_FALSE(JtagScanEngine::scan(empty, pins, found, stats, false));
+    TEST_ASSERT_EQUAL_UINT32(6 * 5 * 4, stats.idcodePermutations);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.bypassPermutations);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.exhaustivePermutations);
+
+    TEST_ASSERT_FALSE(JtagScanEngine::scan(empty, pins, found, stats, true));
+    TEST_ASSERT_EQUAL_UINT32(6 * 5 * 4 * 3, stats.exhaustivePermutations);
+
+    // Device resetting to BYPASS, only the exhaustive search finds it
+    FakeJtagChain bypassOnly(5, 1, 2, 6, {{0, 6}});
+    TEST_ASSERT_TRUE(JtagScanEngine::scan(bypassOnly, pins, found, stats, true));
+    TEST_ASSERT_EQUAL_UINT8(5, found.tck);
+    TEST_ASSERT_EQUAL_UINT8(1, found.tms);
+    TEST_ASSERT_EQUAL_UINT8(2, found.tdi);
+    TEST_ASSERT_EQUAL_UINT8(6, found.tdo);
+    TEST_ASSERT_EQUAL_UINT32(1, found.ids.size());
+    TEST_ASSERT_TRUE(stats.exhaustivePermutations > 0);
+}
+
+void test_jtag_engine_idcode_without_tdi() {
+    // TDI not among the scanned pins, the IDCODE pinout is still reported
+    FakeJtagChain chain(2, 4, 20, 3, {{0x06413041, 5}});
+    auto pins = jtagPins(6);
+    JtagPinout found;
+    JtagScanStats stats;
+
+    TEST_ASSERT_TRUE(JtagScanEngine::scan(chain, pins, found, stats));
+    TEST_ASSERT_EQUAL_UINT8(2, found.tck);
+    TEST_ASSERT_EQUAL_UINT8(4, found.tms);
+    TEST_ASSERT_EQUAL_UINT8(3, found.tdo);
+    TEST_ASSERT_EQUAL_UINT8(JtagScanEngine::NoPin, found.tdi);
+    TEST_ASSERT_EQUAL_HEX32(0x06413041, found.ids[0]);
+}
+
+void test_jtag_engine_staged_vs_exhaustive_throughput() {
+    // Same pinout on 12 pins, IDCODE device against BYPASS only device
+    auto pins = jtagPins(12);
+    JtagPinout found;
+    JtagScanStats staged, exhaustive;
+
+    FakeJtagChain idChain(11, 9, 7, 10, {{0x06413041, 5}});
+    auto t0 = std::chrono::steady_clock::now();
+    TEST_ASSERT_TRUE(JtagScanEngine::scan(idChain, pins, found, staged));
+    staged.elapsedUs = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - t0).count() + 1;
+
+    FakeJtagChain bypassChain(11, 9, 7, 10, {{0, 5}});
+    t0 = std::chrono::steady_clock::now();
+    TEST_ASSERT_TRUE(JtagScanEngine::scan(bypassChain, pins, found, exhaustive));
+    exhaustive.elapsedUs = (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - t0).count() + 1;
+
+    // The staged search clocks far less per permutation and tries fewer
+    TEST_ASSERT_TRUE(idChain.clocks * 20 < bypassChain.clocks);
+
+    char msg[200];
+    snprintf(msg, sizeof(msg),
+             "JTAG 12 pins: staged %u perms, %llu TCK | exhaustive %u perms, %llu TCK | %.0f perms/s simulated",
+             staged.permutations(), (unsigned long long)idChain.clocks,
+             exhaustive.permutations(), (unsigned long long)bypassChain.clocks,
+             staged.permutationsPerSecond());
+    TEST_MESSAGE(msg);
+}
+
+#endif
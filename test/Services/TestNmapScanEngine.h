@@ -0,0 +1,193 @@
+#ifndef TEST_NMAP_SCAN_ENGINE_H
+#define TEST_NMAP_SCAN_ENGINE_H
+
+#include <unity.h>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+#include "../src/Services/NmapScanEngine.h"
+
+// Local sockets on 127.0.0.1, bound to a free port picked by the kernel
+static int nmapTestBind(int type, uint16_t& port) {
+    int fd = ::socket(AF_INET, type, 0);
+    sockaddr_in sa{};
+    sa.sin_family = AF_INET;
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    sa.sin_port = 0;
+    ::bind(fd, (sockaddr*)&sa, sizeof(sa));
+    socklen_t len = sizeof(sa);
+    ::getsockname(fd, (sockaddr*)&sa, &len);
+    port = ntohs(sa.sin_port);
+    return fd;
+}
+
+static int nmapTestListen(uint16_t& port) {
+    int fd = nmapTestBind(SOCK_STREAM, port);
+    ::listen(fd, 64);
+    return fd;
+}
+
+// Port nobody listens on
+static uint16_t nmapTestClosedPort(int type) {
+    uint16_t port;
+    ::close(nmapTestBind(type, port));
+    return port;
+}
+
+static uint32_t nmapTestLoopback() {
+    return htonl(INADDR_LOOPBACK);
+}
+
+void test_nmap_engine_timing_templates() {
+    NmapTiming t0 = NmapScanEngine::timingTemplate(0);
+    NmapTiming t3 = NmapScanEngine::timingTemplate(3);
+    NmapTiming t5 = NmapScanEngine::timingTemplate(5);
+
+    TEST_ASSERT_EQUAL(1, t0.maxParallel);
+    TEST_ASSERT_GREATER_THAN(0, t0.scanDelayMs);
+    TEST_ASSERT_GREATER_THAN(t3.maxParallel, t5.maxParallel);
+    TEST_ASSERT_LESS_THAN(t3.maxRttMs, t5.maxRttMs);
+    TEST_ASSERT_EQUAL(3, NmapScanEngine::timingTemplate(42).level);
+}
+
+void test_nmap_engine_tcp_open_and_closed() {
+    std::vector<int> listeners;
+    std::vector<uint16_t> ports;
+    for (int i = 0; i < 4; ++i) {
+        uint16_t port;
+        listeners.push_back(nmapTestListen(port));
+        ports.push_back(port);
+    }
+    for (int i = 0; i < 4; ++i) ports.push_back(nmapTestClosedPort(SOCK_STREAM));
+
+    NmapScanEngine engine(NmapScanEngine::timingTemplate(4));
+    std::vector<int> states = engine.scan(nmapTestLoopback(), ports, Layer4Protocol::TCP);
+
+    TEST_ASSERT_EQUAL(ports.size(), states.size());
+    for (int i = 0; i < 4; ++i) TEST_ASSERT_EQUAL(nmap_rc_enum::TCP_OPEN, states[i]);
+    for (int i = 4; i < 8; ++i) TEST_ASSERT_EQUAL(nmap_rc_enum::TCP_CLOSED, states[i]);
+    TEST_ASSERT_EQUAL(8, engine.getStats().probes);
+    TEST_ASSERT_EQUAL(0, engine.getStats().retries);
+
+    for (int fd : listeners) ::close(fd);
+}
+
+void test_nmap_engine_udp_states() {
+    uint16_t openPort, silentPort;
+    int responder = nmapTestBind(SOCK_DGRAM, openPort);
+    int silent = nmapTestBind(SOCK_DGRAM, silentPort);
+    uint16_t closedPort = nmapTestClosedPort(SOCK_DGRAM);
+
+    // Echo one datagram back
+    std::thread echo([responder]() {
+        char buf[64];
+        sockaddr_in from{};
+        socklen_t len = sizeof(from);
+        ssize_t n = ::recvfrom(responder, buf, sizeof(buf), 0, (sockaddr*)&from, &len);
+        if (n > 0) ::sendto(responder, buf, n, 0, (sockaddr*)&from, len);
+    });
+
+    NmapTiming timing = NmapScanEngine::timingTemplate(5);
+    timing.maxRetries = 1;
+    NmapScanEngine engine(timing);
+    std::vector<uint16_t> ports = {openPort, silentPort, closedPort};
+    std::vector<int> states = engine.scan(nmapTestLoopback(), ports, Layer4Protocol::UDP);
+    echo.join();
+
+    TEST_ASSERT_EQUAL(nmap_rc_enum::UDP_OPEN, states[0]);
+    TEST_ASSERT_EQUAL(nmap_rc_enum::UDP_OPEN_FILTERED, states[1]);
+    TEST_ASSERT_EQUAL(nmap_rc_enum::UDP_CLOSED, states[2]);
+    TEST_ASSERT_EQUAL(1, engine.getStats().retries); // silent port sent twice
+
+    ::close(responder);
+    ::close(silent);
+}
+
+void test_nmap_engine_timeouts_overlap() {
+    // 16 silent UDP ports, all waiting on their deadline at the same time
+    std::vector<int> sockets;
+    std::vector<uint16_t> ports;
+    for (int i = 0; i < 16; ++i) {
+        uint16_t port;
+        sockets.push_back(nmapTestBind(SOCK_DGRAM, port));
+        ports.push_back(port);
+    }
+
+    NmapTiming timing = NmapScanEngine::timingTemplate(4);
+    timing.maxRetries = 0;
+    timing.initialRttMs = 200;
+    NmapScanEngine engine(timing);
+
+    std::vector<int> states = engine.scan(nmapTestLoopback(), ports, Layer4Protocol::UDP);
+
+    for (int st : states) TEST_ASSERT_EQUAL(nmap_rc_enum::UDP_OPEN_FILTERED, st);
+    // One timeout for the whole window, not 16 in a row
+    TEST_ASSERT_LESS_THAN(16 * 200 / 4, engine.getStats().elapsedMs);
+
+    for (int fd : sockets) ::close(fd);
+}
+
+void test_nmap_engine_adapts_timeout() {
+    uint16_t port;
+    int listener = nmapTestListen(port);
+    std::vector<uint16_t> ports(20, port);
+
+    NmapTiming timing = NmapScanEngine::timingTemplate(3);
+    NmapScanEngine engine(timing);
+    TEST_ASSERT_EQUAL(timing.initialRttMs, engine.getTimeoutMs());
+
+    engine.scan(nmapTestLoopback(), ports, Layer4Protocol::TCP);
+
+    // Loopback answers in well under a ms, timeout drops to the floor
+    TEST_ASSERT_EQUAL(timing.minRttMs, engine.getTimeoutMs());
+    ::close(listener);
+}
+
+void test_nmap_engine_throughput_1000_ports() {
+    std::vector<uint16_t> ports;
+    for (int i = 0; i < 1000; ++i) ports.push_back(nmapTestClosedPort(SOCK_STREAM));
+
+    NmapScanEngine engine(NmapScanEngine::timingTemplate(5));
+    std::vector<int> states = engine.scan(nmapTestLoopback(), ports, Layer4Protocol::TCP);
+
+    for (int st : states) TEST_ASSERT_EQUAL(nmap_rc_enum::TCP_CLOSED, st);
+    TEST_MESSAGE(engine.formatStats().c_str());
+}
+
+void test_nmap_engine_unanswered_window_vs_sequential() {
+    // Unanswered probes are what a real scan waits on, loopback answers the rest at once
+    std::vector<int> sockets;
+    std::vector<uint16_t> ports;
+    for (int i = 0; i < 32; ++i) {
+        uint16_t port;
+        sockets.push_back(nmapTestBind(SOCK_DGRAM, port));
+        ports.push_back(port);
+    }
+
+    NmapTiming timing = NmapScanEngine::timingTemplate(4);
+    timing.initialRttMs = 50;
+    timing.maxRetries = 0;
+
+    NmapTiming sequential = timing;
+    sequential.maxParallel = 1;
+    NmapScanEngine one(sequential);
+    one.scan(nmapTestLoopback(), ports, Layer4Protocol::UDP);
+
+    NmapScanEngine many(timing);
+    many.scan(nmapTestLoopback(), ports, Layer4Protocol::UDP);
+
+    TEST_ASSERT_LESS_THAN(one.getStats().elapsedMs / 4, many.getStats().elapsedMs);
+
+    char msg[300];
+    snprintf(msg, sizeof(msg), "1 socket: %s | window: %s",
+             one.formatStats().c_str(), many.formatStats().c_str());
+    TEST_MESSAGE(msg);
+
+    for (int fd : sockets) ::close(fd);
+}
+
+#endif // TEST_NMAP_SCAN_ENGINE_H
@@ -0,0 +1,177 @@
+#ifndef TEST_SCRIPT_ENGINE_H
+#define TEST_SCRIPT_ENGINE_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include "../src/Services/ScriptEngine.h"
+#include "FakeScriptHost.h"
+
+static std::string scriptCompileError(const std::string& source) {
+    InstructionTransformer instructions;
+    ScriptEngine engine(instructions);
+    Script script;
+    std::string error;
+    return engine.compile(source, script, error) ? std::string("ok") : error;
+}
+
+void test_script_engine_reports_compile_errors() {
+    TEST_ASSERT_EQUAL_STRING("ok", scriptCompileError("# empty\n\nset x = 1\n").c_str());
+    TEST_ASSERT_EQUAL_STRING("line 2: 'if' without end", scriptCompileError("set x 1\nif x\nprint yes\n").c_str());
+    TEST_ASSERT_EQUAL_STRING("line 1: end without block", scriptCompileError("end").c_str());
+    TEST_ASSERT_EQUAL_STRING("line 2: else without if", scriptCompileError("loop 2\nelse\nend").c_str());
+    TEST_ASSERT_EQUAL_STRING("line 1: break outside a loop", scriptCompileError("break").c_str());
+    TEST_ASSERT_EQUAL_STRING("line 1: missing operand", scriptCompileError("set x = 1 +").c_str());
+    TEST_ASSERT_EQUAL_STRING("line 1: missing )", scriptCompileError("if (1\nend").c_str());
+    TEST_ASSERT_EQUAL_STRING("line 1: 'read' is read only", scriptCompileError("set read = 1").c_str());
+    TEST_ASSERT_EQUAL_STRING("line 1: unclosed $(", scriptCompileError("print $(1 + 2").c_str());
+}
+
+void test_script_engine_control_flow_and_text() {
+    const char* source =
+        "set sum = 0\n"
+        "loop 10 i\n"
+        "  if i % 2\n"
+        "    set sum = sum + i\n"
+        "  else\n"
+        "    set sum = sum - 1\n"
+        "  end\n"
+        "end\n"
+        "set n = 0\n"
+        "while 1\n"
+        "  set n = n + 1\n"
+        "  if n >= 7\n"
+        "    break\n"
+        "  end\n"
+        "end\n"
+        "print sum=$sum n=$n p=$(2 + 3 * 4 << 1) c=$('A') neg=$(-5 / 2) $$\n"
+        "loop 3\n"
+        "  scan $(0x10 | 1)\n"
+        "end\n"
+        "delay 25\n"
+        "exit\n"
+        "print never\n";
+
+    InstructionTransformer instructions;
+    ScriptEngine engine(instructions);
+    FakeScriptHost host;
+    std::string error;
+    const Script* script = engine.load("demo", source, error);
+    TEST_ASSERT_NOT_NULL(script);
+
+    ScriptRunStats stats = engine.run(*script, host);
+    TEST_ASSERT_EQUAL_STRING("", stats.error.c_str());
+    TEST_ASSERT_FALSE(stats.stopped);
+    TEST_ASSERT_EQUAL_UINT32(1, host.printed.size());
+    TEST_ASSERT_EQUAL_STRING("sum=20 n=7 p=28 c=65 neg=-2 $", host.printed[0].c_str());  // 1+3+5+7+9 - 5
+    TEST_ASSERT_EQUAL_UINT32(3, host.commands.size());
+    TEST_ASSERT_EQUAL_STRING("scan 17", host.commands[2].c_str());
+    TEST_ASSERT_EQUAL_UINT32(3, stats.commands);
+    TEST_ASSERT_EQUAL_UINT32(25, host.delayedMs);
+
+    // Runtime errors carry the line
+    TEST_ASSERT_NOT_NULL(script = engine.load("div", "set a = 0\nset b = 1\nprint $(b / a)\n", error));
+    stats = engine.run(*script, host);
+    TEST_ASSERT_EQUAL_STRING("line 3: division by zero", stats.error.c_str());
+
+    host.instructionsEnabled = false;
+    TEST_ASSERT_NOT_NULL(script = engine.load("mode", "[0x50 r]", error));
+    TEST_ASSERT_EQUAL_STRING("line 1: instructions are not available in this mode", engine.run(*script, host).error.c_str());
+}
+
+void test_script_engine_programs_and_verifies_eeprom() {
+    // Page write, poll the write cycle, read back and compare
+    const char* source =
+        "loop 16 a\n"
+        "  [0x50 $a $(a * 3 + 1)]\n"
+        "  set polls = 0\n"
+        "  [0x50 0xFF r]\n"
+        "  while read & 1\n"
+        "    set polls = polls + 1\n"
+        "    [0x50 0xFF r]\n"
+        "  end\n"
+        "end\n"
+        "set bad = 0\n"
+        "loop 16 a\n"
+        "  [0x50 $a r]\n"
+        "  if read != a * 3 + 1\n"
+        "    set bad = bad + 100\n"
+        "  end\n"
+        "end\n"
+        "[0x50 0x05 r:2]\n"
+        "if read0 != 16 || read1 != 19 || read2 != -1 || reads != 2\n"
+        "  set bad = bad + 1\n"
+        "end\n"
+        "print bad=$bad polls=$polls\n";
+
+    InstructionTransformer instructions;
+    ScriptEngine engine(instructions);
+    FakeScriptHost host;
+    std::string error;
+    const Script* script = engine.load("eeprom", source, error);
+    TEST_ASSERT_NOT_NULL(script);
+    ScriptRunStats stats = engine.run(*script, host);
+
+    TEST_ASSERT_EQUAL_STRING("", stats.error.c_str());
+    for (int a = 0; a < 16; ++a) TEST_ASSERT_EQUAL_UINT8((uint8_t)(a * 3 + 1), host.memory[a]);
+    TEST_ASSERT_EQUAL_STRING("bad=0 polls=3", host.printed[0].c_str());
+    TEST_ASSERT_EQUAL_UINT32(16 * 5 + 16 + 1, stats.instructions);    // write and 4 polls, verify, last read
+}
+
+void test_script_engine_cache_and_stop() {
+    InstructionTransformer instructions;
+    ScriptEngine engine(instructions);
+    std::string error;
+
+    const Script* first = engine.load("/poll.txt", "[0x50 0xFF r]\n", error);
+    const Script* again = engine.load("/poll.txt", "[0x50 0xFF r]\n", error);
+    TEST_ASSERT_TRUE(first == again);
+    TEST_ASSERT_EQUAL_UINT32(1, engine.cachedScripts());
+    const Script* changed = engine.load("/poll.txt", "[0x50 0xFF r:2]\n", error);
+    TEST_ASSERT_NOT_NULL(changed);
+    TEST_ASSERT_EQUAL_UINT32(1, engine.cachedScripts());
+    TEST_ASSERT_NULL(engine.load("/poll.txt", "while 1\n", error));
+    TEST_ASSERT_EQUAL_UINT32(0, engine.cachedScripts());
+
+    // Endless loop stopped from the host
+    FakeScriptHost host;
+    host.stopAfterPolls = 4;
+    const Script* endless = engine.load("endless", "while 1\nset x = x + 1\nend\n", error);
+    ScriptRunStats stats = engine.run(*endless, host);
+    TEST_ASSERT_TRUE(stats.stopped);
+    TEST_ASSERT_EQUAL_UINT32(4 * ScriptEngine::StopPollSteps, stats.steps);
+}
+
+void test_script_engine_precompiled_instruction_throughput() {
+    // Same bus traffic, constant lines are compiled once, $ lines every time
+    const char* constant = "loop 20000\n  [0x50 0x10 0xAB]\n  [0x50 0x10 r:4]\nend\n";
+    const char* templated = "set v = 0xAB\nloop 20000\n  [0x50 0x10 $v]\n  [0x50 0x10 r:$(4)]\nend\n";
+
+    InstructionTransformer instructions;
+    ScriptEngine engine(instructions);
+    std::string error;
+    const Script* fast = engine.load("constant", constant, error);
+    const Script* slow = engine.load("templated", templated, error);
+    TEST_ASSERT_NOT_NULL(fast);
+    TEST_ASSERT_NOT_NULL(slow);
+
+    FakeScriptHost hostA, hostB;
+    auto t0 = std::chrono::steady_clock::now();
+    ScriptRunStats a = engine.run(*fast, hostA);
+    auto t1 = std::chrono::steady_clock::now();
+    ScriptRunStats b = engine.run(*slow, hostB);
+    auto t2 = std::chrono::steady_clock::now();
+
+    double fastUs = std::chrono::duration<double, std::micro>(t1 - t0).count();
+    double slowUs = std::chrono::duration<double, std::micro>(t2 - t1).count();
+    printf("  40000 instructions: precompiled %.0f us (%.0f/s) | compiled per run %.0f us (%.0f/s)\n",
+           fastUs, a.instructions / fastUs * 1e6, slowUs, b.instructions / slowUs * 1e6);
+
+    TEST_ASSERT_EQUAL_UINT32(40000, a.instructions);
+    TEST_ASSERT_EQUAL_UINT32(40000, b.instructions);
+    TEST_ASSERT_TRUE(hostA.memory == hostB.memory);
+    TEST_ASSERT_TRUE(fastUs < slowUs);
+}
+
+#endif
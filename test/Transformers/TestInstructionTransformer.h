@@ -0,0 +1,94 @@
+#ifndef TEST_INSTRUCTION_TRANSFORMER_H
+#define TEST_INSTRUCTION_TRANSFORMER_H
+
+#include <unity.h>
+#include <string>
+#include <vector>
+#include "../src/Transformers/InstructionTransformer.h"
+
+// Program expanded back to one ByteCode per byte, as transformByteCodes gives
+static std::vector<ByteCode> expandProgram(const ByteCodeProgram& program) {
+    std::vector<ByteCode> codes;
+    for (const auto& op : program.ops()) {
+        if (op.command == ByteCodeEnum::Write) {
+            for (uint32_t i = 0; i < op.count; ++i) codes.emplace_back(ByteCodeEnum::Write, program.bytes(op)[i]);
+        } else {
+            ByteCode code(op.command);
+            code.setRepeat(op.count);
+            codes.push_back(code);
+        }
+    }
+    return codes;
+}
+
+void test_instruction_compile_matches_transform() {
+    const char* lines[] = {
+        "[0xA0 0x00 0x10 r:16]",
+        "[0x3C 'A' \"hello world\" 12 255 300 r rrr d:10 D:2 ss S h l]",
+        "[0x50 0x1234 r:300 ddd]",
+        "[0xA0 0x01][0xA1 r:4]",
+        "[ 'x' ' ' \"[not a block]\" ]",
+        "[0xZZ 0x 7 ! r:x r: q]",
+    };
+
+    InstructionTransformer transformer;
+    ByteCodeProgram program;
+    for (const char* line : lines) {
+        std::vector<ByteCode> expected;
+        for (const ByteCode& code : transformer.transformByteCodes(transformer.transform(line))) {
+            if (code.getCommand() != ByteCodeEnum::None) expected.push_back(code);
+        }
+
+        transformer.compile(line, program);
+        std::vector<ByteCode> actual = expandProgram(program);
+
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected.size(), actual.size(), line);
+        for (size_t i = 0; i < expected.size(); ++i) {
+            TEST_ASSERT_TRUE_MESSAGE(expected[i].getCommand() == actual[i].getCommand(), line);
+            TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected[i].getData(), actual[i].getData(), line);
+            TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected[i].getRepeat(), actual[i].getRepeat(), line);
+        }
+    }
+}
+
+void test_instruction_compile_coalesces_spans() {
+    InstructionTransformer transformer;
+    ByteCodeProgram program;
+    transformer.compile("[0xA0 0x00 'A' \"hi\" r:16 d:5 0x01 0x02]", program);
+
+    const auto& ops = program.ops();
+    TEST_ASSERT_EQUAL_UINT32(6, ops.size());
+    TEST_ASSERT_TRUE(ops[0].command == ByteCodeEnum::Start);
+    TEST_ASSERT_TRUE(ops[1].command == ByteCodeEnum::Write);
+    TEST_ASSERT_EQUAL_UINT32(5, ops[1].count);
+    const uint8_t first[] = {0xA0, 0x00, 'A', 'h', 'i'};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(first, program.bytes(ops[1]), 5);
+    TEST_ASSERT_TRUE(ops[2].command == ByteCodeEnum::Read);
+    TEST_ASSERT_EQUAL_UINT32(16, ops[2].count);
+    TEST_ASSERT_TRUE(ops[3].command == ByteCodeEnum::DelayUs);
+    TEST_ASSERT_EQUAL_UINT32(5, ops[3].count);
+    TEST_ASSERT_EQUAL_UINT32(2, ops[4].count);
+    TEST_ASSERT_EQUAL_UINT32(5, ops[4].offset);
+    TEST_ASSERT_TRUE(ops[5].command == ByteCodeEnum::Stop);
+    TEST_ASSERT_EQUAL_UINT32(7, program.byteCount());
+
+    // Blocks without a closing bracket run to the end of the line
+    transformer.compile("> 0x55 r:2", program);
+    TEST_ASSERT_EQUAL_UINT32(2, program.ops().size());
+    TEST_ASSERT_EQUAL_UINT8(0x55, program.bytes(program.ops()[0])[0]);
+    transformer.compile("{0x01 r}", program);
+    TEST_ASSERT_EQUAL_UINT32(2, program.ops().size());
+    TEST_ASSERT_TRUE(program.ops()[1].command == ByteCodeEnum::Read);
+
+    // The program keeps its storage between lines
+    std::string big = "[";
+    for (int i = 0; i < 512; ++i) big += " 0xAB";
+    big += "]";
+    transformer.compile(big, program);
+    const uint8_t* storage = program.bytes(program.ops()[1]);
+    transformer.compile(big, program);
+    TEST_ASSERT_TRUE(storage == program.bytes(program.ops()[1]));
+    TEST_ASSERT_EQUAL_UINT32(512, program.ops()[1].count);
+}
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef TEST_RPC_FRAME_TRANSFORMER_H
+#define TEST_RPC_FRAME_TRANSFORMER_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "../src/Transformers/RpcFrameTransformer.h"
+
+struct RpcTestFrame {
+    uint8_t type;
+    uint8_t status;
+    uint16_t id;
+    std::string payload;
+    bool crcOk;
+    bool oversized;
+};
+
+// Feed a byte stream in chunks of random size, as USB packets would arrive
+static std::vector<RpcTestFrame> rpcTestParse(RpcFrameTransformer& parser, const std::string& wire,
+                                              std::mt19937& rng, size_t maxChunk) {
+    std::vector<RpcTestFrame> frames;
+    const uint8_t* data = (const uint8_t*)wire.data();
+    const uint8_t* end = data + wire.size();
+    RpcFrame frame;
+    while (data < end) {
+        size_t chunk = 1 + rng() % maxChunk;
+        const uint8_t* chunkEnd = data + std::min<size_t>(chunk, (size_t)(end - data));
+        while (parser.next(data, chunkEnd, frame)) {
+            frames.push_back({frame.type, frame.status, frame.id,
+                              std::string((const char*)frame.payload, frame.length), frame.crcOk,
+                              frame.oversized});
+        }
+    }
+    return frames;
+}
+
+// Device side of the loopback: Ping echoes, a bad crc is answered by id
+static std::string rpcTestDevice(RpcFrameTransformer& parser, const std::string& wire, std::mt19937& rng) {
+    std::string out;
+    for (const auto& f : rpcTestParse(parser, wire, rng, 700)) {
+        uint8_t status = !f.crcOk ? RpcFrameTransformer::CrcError
+                       : f.type == RpcFrameTransformer::Ping ? RpcFrameTransformer::Ok
+                       : RpcFrameTransformer::UnknownType;
+        const std::string& payload = status == RpcFrameTransformer::Ok ? f.payload : std::string();
+        RpcFrameTransformer::encode(out, f.type | RpcFrameTransformer::Response, status, f.id,
+                                    (const uint8_t*)payload.data(), (uint32_t)payload.size());
+    }
+    return out;
+}
+
+void test_rpc_frame_layout() {
+    const uint8_t payload[3] = {0x01, 0x02, 0x03};
+    std::string wire;
+    RpcFrameTransformer::encode(wire, RpcFrameTransformer::SpiTransfer, 0, 0x1234, payload, 3);
+
+    TEST_ASSERT_EQUAL_UINT32(RpcFrameTransformer::HeaderSize + 3 + RpcFrameTransformer::TrailerSize, wire.size());
+    const uint8_t* w = (const uint8_t*)wire.data();
+    TEST_ASSERT_EQUAL_HEX8(0xA5, w[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x5A, w[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x10, w[2]);
+    TEST_ASSERT_EQUAL_HEX8(0x34, w[4]);
+    TEST_ASSERT_EQUAL_HEX8(0x12, w[5]);
+    TEST_ASSERT_EQUAL_UINT32(3, RpcFrameTransformer::le32(w + 6));
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)~(0x10 + 0x34 + 0x12 + 3), w[10]);
+
+    // Streamed encoding gives the same bytes
+    uint8_t head[RpcFrameTransformer::HeaderSize], tail[RpcFrameTransformer::TrailerSize];
+    uint32_t crc = RpcFrameTransformer::putHeader(head, RpcFrameTransformer::SpiTransfer, 0, 0x1234, 3);
+    crc = RpcFrameTransformer::crc32(payload, 1, crc);
+    crc = RpcFrameTransformer::crc32(payload + 1, 2, crc);
+    RpcFrameTransformer::putTrailer(tail, crc);
+    std::string streamed = std::string((const char*)head, sizeof(head)) + std::string((const char*)payload, 3) +
+                           std::string((const char*)tail, sizeof(tail));
+    TEST_ASSERT_TRUE(streamed == wire);
+
+    // CRC-32 of "123456789"
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, RpcFrameTransformer::crc32((const uint8_t*)"123456789", 9, 0));
+}
+
+void test_rpc_frame_pipelined_loopback() {
+    std::mt19937 rng(24);
+    std::string requests;
+    std::vector<std::string> sent;
+    for (uint16_t id = 0; id < 64; ++id) {
+        size_t size = id % 8 == 0 ? 40000 + rng() % 25000 : rng() % 300;
+        std::string payload(size, '\0');
+        for (auto& c : payload) c = (char)rng();
+        sent.push_back(payload);
+        uint8_t type = id == 10 ? 0x7E : RpcFrameTransformer::Ping;
+        RpcFrameTransformer::encode(requests, type, 0, id, (const uint8_t*)payload.data(), (uint32_t)size);
+    }
+
+    RpcFrameTransformer device, host;
+    std::string replies = rpcTestDevice(device, requests, rng);
+    auto frames = rpcTestParse(host, replies, rng, 4096);
+
+    TEST_ASSERT_EQUAL_UINT32(64, frames.size());
+    for (uint16_t id = 0; id < 64; ++id) {
+        TEST_ASSERT_EQUAL_UINT16(id, frames[id].id);
+        TEST_ASSERT_TRUE(frames[id].crcOk);
+        if (id == 10) {
+            TEST_ASSERT_EQUAL_HEX8(RpcFrameTransformer::UnknownType, frames[id].status);
+            continue;
+        }
+        TEST_ASSERT_EQUAL_HEX8(RpcFrameTransformer::Ping | RpcFrameTransformer::Response, frames[id].type);
+        TEST_ASSERT_TRUE(frames[id].payload == sent[id]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(64, device.stats().frames);
+    TEST_ASSERT_EQUAL_UINT32(0, device.stats().droppedBytes);
+    TEST_ASSERT_TRUE(device.idle());
+}
+
+void test_rpc_frame_recovers_from_corruption() {
+    std::mt19937 rng(7);
+    auto frame = [](uint16_t id, const std::string& payload) {
+        std::string out;
+        RpcFrameTransformer::encode(out, RpcFrameTransformer::Ping, 0, id,
+                                    (const uint8_t*)payload.data(), (uint32_t)payload.size());
+        return out;
+    };
+
+    std::string damagedPayload = frame(2, "payload");
+    damagedPayload[RpcFrameTransformer::HeaderSize + 3] ^= 0x40;
+
+    std::string damagedLength = frame(3, "length");
+    damagedLength[8] = 0x7F;                            // 8 MB, caught by the header check
+
+    std::string oversized(RpcFrameTransformer::HeaderSize, '\0');
+    RpcFrameTransformer::putHeader((uint8_t*)&oversized[0], RpcFrameTransformer::Ping, 0, 4,
+                                   RpcFrameTransformer::MaxPayload + 1);
+
+    // A frame starting inside a rejected header is still found
+    std::string truncated = frame(5, "cut").substr(0, 6);
+
+    std::string wire = std::string("\r\ngarbage\xA5\xA5", 11) + frame(1, "first") + damagedPayload +
+                       damagedLength + oversized + truncated + frame(6, "last");
+
+    RpcFrameTransformer parser;
+    auto frames = rpcTestParse(parser, wire, rng, 5);
+    TEST_ASSERT_EQUAL_UINT32(3, frames.size());
+    TEST_ASSERT_EQUAL_UINT16(1, frames[0].id);
+    TEST_ASSERT_TRUE(frames[0].crcOk);
+    TEST_ASSERT_EQUAL_UINT16(2, frames[1].id);          // answered with CrcError by the device
+    TEST_ASSERT_FALSE(frames[1].crcOk);
+    TEST_ASSERT_EQUAL_UINT16(6, frames[2].id);
+    TEST_ASSERT_EQUAL_STRING("last", frames[2].payload.c_str());
+    TEST_ASSERT_EQUAL_UINT32(2, parser.stats().frames);
+    TEST_ASSERT_EQUAL_UINT32(1, parser.stats().crcErrors);
+    TEST_ASSERT_TRUE(parser.stats().headerErrors >= 2);
+    TEST_ASSERT_TRUE(parser.idle());
+
+    // Reset drops a partial frame
+    std::string half = frame(8, "half").substr(0, 14);
+    const uint8_t* p = (const uint8_t*)half.data();
+    RpcFrame out;
+    TEST_ASSERT_FALSE(parser.next(p, p + half.size(), out));
+    TEST_ASSERT_FALSE(parser.idle());
+    parser.resetParser();
+    TEST_ASSERT_TRUE(parser.idle());
+}
+
+void test_rpc_frame_skips_payload_over_device_limit() {
+    std::mt19937 rng(11);
+    auto frame = [](uint16_t id, size_t size) {
+        std::string payload(size, (char)id), out;
+        RpcFrameTransformer::encode(out, RpcFrameTransformer::Ping, 0, id,
+                                    (const uint8_t*)payload.data(), (uint32_t)payload.size());
+        return out;
+    };
+
+    std::string damaged = frame(3, 3000);
+    damaged[RpcFrameTransformer::HeaderSize + 10] ^= 0x01;
+    std::string wire = frame(1, 1024) + frame(2, 20000) + damaged + frame(4, 1);
+
+    RpcFrameTransformer parser;
+    parser.setMaxPayload(1024);
+    TEST_ASSERT_EQUAL_UINT32(1024, parser.maxPayload());
+    auto frames = rpcTestParse(parser, wire, rng, 700);
+
+    // Over the limit, still answered by id; the crc is checked as it passes
+    TEST_ASSERT_EQUAL_UINT32(4, frames.size());
+    TEST_ASSERT_FALSE(frames[0].oversized);
+    TEST_ASSERT_EQUAL_UINT32(1024, frames[0].payload.size());
+    TEST_ASSERT_TRUE(frames[1].oversized);
+    TEST_ASSERT_TRUE(frames[1].crcOk);
+    TEST_ASSERT_EQUAL_UINT16(2, frames[1].id);
+    TEST_ASSERT_EQUAL_UINT32(0, frames[1].payload.size());
+    TEST_ASSERT_TRUE(frames[2].oversized);
+    TEST_ASSERT_FALSE(frames[2].crcOk);
+    TEST_ASSERT_FALSE(frames[3].oversized);
+    TEST_ASSERT_TRUE(frames[3].crcOk);
+    TEST_ASSERT_EQUAL_UINT16(4, frames[3].id);
+    TEST_ASSERT_TRUE(parser.idle());
+
+    // The protocol limit stays the ceiling
+    parser.setMaxPayload(RpcFrameTransformer::MaxPayload * 2);
+    TEST_ASSERT_EQUAL_UINT32(RpcFrameTransformer::MaxPayload, parser.maxPayload());
+}
+
+void test_rpc_frame_loopback_throughput_vs_hex_text() {
+    // 4 MB as 64 KB frames through encode and parse, against the text path
+    // formatting and parsing the same bytes as "A5 01 " hex
+    std::mt19937 rng(3);
+    std::string block(RpcFrameTransformer::MaxPayload, '\0');
+    for (auto& c : block) c = (char)rng();
+    const int frames = 64;
+
+    RpcFrameTransformer parser;
+    std::string wire;
+    size_t received = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; ++i) {
+        wire.clear();
+        RpcFrameTransformer::encode(wire, RpcFrameTransformer::FlashRead | RpcFrameTransformer::Response, 0,
+                                    (uint16_t)i, (const uint8_t*)block.data(), (uint32_t)block.size());
+        const uint8_t* p = (const uint8_t*)wire.data();
+        const uint8_t* end = p + wire.size();
+        RpcFrame frame;
+        while (p < end) {
+            const uint8_t* chunkEnd = std::min(end, p + 4096);
+            while (parser.next(p, chunkEnd, frame)) received += frame.crcOk ? frame.length : 0;
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+
+    static const char digits[] = "0123456789ABCDEF";
+    std::string text, decoded;
+    size_t textReceived = 0;
+    for (int i = 0; i < frames; ++i) {
+        text.clear();
+        for (unsigned char c : block) {
+            text += digits[c >> 4];
+            text += digits[c & 0x0F];
+            text += ' ';
+        }
+        decoded.clear();
+        for (size_t k = 0; k + 1 < text.size(); k += 3) decoded += (char)strtoul(text.substr(k, 2).c_str(), nullptr, 16);
+        textReceived += decoded.size();
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    double binaryS = std::chrono::duration<double>(t1 - t0).count();
+    double textS = std::chrono::duration<double>(t2 - t1).count();
+    double mb = frames * block.size() / 1e6;
+    printf("  4 MB loopback: frames %.0f MB/s, %.3f%% overhead | hex text %.0f MB/s, 200%% overhead\n",
+           mb / binaryS, 100.0 * (RpcFrameTransformer::HeaderSize + RpcFrameTransformer::TrailerSize) / block.size(),
+           mb / textS);
+
+    TEST_ASSERT_EQUAL_UINT32(frames * block.size(), received);
+    TEST_ASSERT_EQUAL_UINT32(frames * block.size(), textReceived);
+    TEST_ASSERT_TRUE(binaryS < textS);
+}
+
+#endif
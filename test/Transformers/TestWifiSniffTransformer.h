@@ -0,0 +1,140 @@
+#ifndef TEST_WIFI_SNIFF_TRANSFORMER_H
+#define TEST_WIFI_SNIFF_TRANSFORMER_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <vector>
+#include "../src/Transformers/WifiSniffTransformer.h"
+#include "../src/Buffers/SpscRingBuffer.h"
+
+// Beacon from AA:BB:CC:DD:EE:FF, SSID "home"
+static WifiSniffRecord sniffTestBeacon() {
+    WifiSniffRecord r{};
+    const uint8_t header[24] = {
+        0x80, 0x00, 0x00, 0x00,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF,
+        0xAA, 0xBB, 0xCC, 0xDD, 0xEE, 0xFF,
+        0x10, 0x00
+    };
+    memcpy(r.frame, header, sizeof(header));
+    // timestamp(8) interval(2) capabilities(2), then SSID element
+    size_t pos = 36;
+    r.frame[pos++] = 0;
+    r.frame[pos++] = 4;
+    memcpy(r.frame + pos, "home", 4);
+    pos += 4;
+
+    r.timestampUs = 3500001;
+    r.length = 300;
+    r.captured = (uint16_t)pos;
+    r.rssi = -52;
+    r.channel = 6;
+    return r;
+}
+
+static uint32_t sniffTestLe32(const std::string& s, size_t at) {
+    return (uint8_t)s[at] | ((uint8_t)s[at + 1] << 8) | ((uint8_t)s[at + 2] << 16) | ((uint32_t)(uint8_t)s[at + 3] << 24);
+}
+
+static uint16_t sniffTestLe16(const std::string& s, size_t at) {
+    return (uint8_t)s[at] | ((uint8_t)s[at + 1] << 8);
+}
+
+void test_wifi_sniff_formats_line() {
+    WifiSniffTransformer transformer;
+    WifiSniffRecord r = sniffTestBeacon();
+
+    TEST_ASSERT_EQUAL_STRING("CH:6 RSSI:-52 Type:Beacon SSID:\"home\" MAC:AA:BB:CC:DD:EE:FF",
+                             transformer.toLine(r).c_str());
+
+    // Header cut before addr2, no MAC
+    r.captured = 8;
+    TEST_ASSERT_EQUAL_STRING("CH:6 RSSI:-52 Type:Beacon", transformer.toLine(r).c_str());
+}
+
+void test_wifi_sniff_pcap_header() {
+    WifiSniffTransformer transformer;
+    std::string h = transformer.pcapHeader();
+
+    TEST_ASSERT_EQUAL(24, h.size());
+    TEST_ASSERT_EQUAL_HEX32(0xA1B2C3D4, sniffTestLe32(h, 0));
+    TEST_ASSERT_EQUAL(2, sniffTestLe16(h, 4));
+    TEST_ASSERT_EQUAL(4, sniffTestLe16(h, 6));
+    TEST_ASSERT_EQUAL(127, sniffTestLe32(h, 20));
+}
+
+void test_wifi_sniff_pcap_record() {
+    WifiSniffTransformer transformer;
+    WifiSniffRecord r = sniffTestBeacon();
+    std::string out;
+    transformer.appendPcapRecord(out, r);
+
+    size_t radiotap = WifiSniffTransformer::RadiotapSize;
+    TEST_ASSERT_EQUAL(16 + radiotap + r.captured, out.size());
+    TEST_ASSERT_EQUAL(3, sniffTestLe32(out, 0));             // ts_sec
+    TEST_ASSERT_EQUAL(500001, sniffTestLe32(out, 4));        // ts_usec
+    TEST_ASSERT_EQUAL(r.captured + radiotap, sniffTestLe32(out, 8));
+    TEST_ASSERT_EQUAL(r.length + radiotap, sniffTestLe32(out, 12));
+
+    // Radiotap
+    TEST_ASSERT_EQUAL(0, (uint8_t)out[16]);
+    TEST_ASSERT_EQUAL(radiotap, sniffTestLe16(out, 18));
+    TEST_ASSERT_EQUAL_HEX32(0x2A, sniffTestLe32(out, 20));  // flags, channel, dBm signal
+    TEST_ASSERT_EQUAL(2437, sniffTestLe16(out, 26));
+    TEST_ASSERT_EQUAL(-52, (int8_t)out[30]);
+
+    // 802.11 frame right after
+    TEST_ASSERT_EQUAL(0x80, (uint8_t)out[16 + radiotap]);
+    TEST_ASSERT_EQUAL_MEMORY(r.frame, out.data() + 16 + radiotap, r.captured);
+}
+
+void test_wifi_sniff_callback_cost_vs_strings() {
+    // Old callback: format a line, lock, push into a capped vector
+    const int frames = 200000;
+    WifiSniffTransformer transformer;
+    WifiSniffRecord frame = sniffTestBeacon();
+
+    std::vector<std::string> log;
+    std::mutex mux;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; ++i) {
+        std::string line = transformer.toLine(frame);
+        std::lock_guard<std::mutex> lock(mux);
+        if (log.size() < 200) log.push_back(line);
+        if (i % 64 == 63) log.clear(); // consumer swap
+    }
+    double stringNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / frames;
+
+    // New callback: copy into a ring slot
+    static SpscRingBuffer<WifiSniffRecord, 64> ring;
+    static WifiSniffRecord out[64];
+    t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; ++i) {
+        WifiSniffRecord* slot = ring.writeSlot();
+        if (slot) {
+            slot->timestampUs = i;
+            slot->length = frame.length;
+            slot->captured = frame.captured;
+            slot->rssi = frame.rssi;
+            slot->channel = frame.channel;
+            memcpy(slot->frame, frame.frame, frame.captured);
+            ring.commit();
+        }
+        if (i % 64 == 63) ring.pop(out, 64);
+    }
+    double ringNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / frames;
+
+    TEST_ASSERT_TRUE(ring.empty());
+    TEST_ASSERT_EQUAL(frames - 1, out[63].timestampUs);
+
+    char msg[160];
+    snprintf(msg, sizeof(msg), "Sniffer callback: ring copy %.1f ns/frame, string + lock %.1f ns/frame (x%.1f)",
+             ringNs, stringNs, stringNs / ringNs);
+    TEST_MESSAGE(msg);
+}
+
+#endif // TEST_WIFI_SNIFF_TRANSFORMER_H
@@ -0,0 +1,148 @@
+#ifndef TEST_IRP_ENCODER_H
+#define TEST_IRP_ENCODER_H
+
+#include <unity.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "../src/Vendors/MakeHex.h"
+#include "../src/Vendors/IrpEncoder.h"
+#include "../src/Data/UniversalRemoteCommands.h"
+
+struct IrpCommandGroup {
+    const InfraredCommandStruct* commands;
+    size_t count;
+};
+
+static std::vector<IrpCommandGroup> irpUniversalGroups() {
+    return {
+        {universalOnOff, sizeof(universalOnOff) / sizeof(universalOnOff[0])},
+        {universalMute, sizeof(universalMute) / sizeof(universalMute[0])},
+        {universalPlay, sizeof(universalPlay) / sizeof(universalPlay[0])},
+        {universalPause, sizeof(universalPause) / sizeof(universalPause[0])},
+        {universalVolUp, sizeof(universalVolUp) / sizeof(universalVolUp[0])},
+        {universalVolDown, sizeof(universalVolDown) / sizeof(universalVolDown[0])},
+        {universalChannelUp, sizeof(universalChannelUp) / sizeof(universalChannelUp[0])},
+        {universalChannelDown, sizeof(universalChannelDown) / sizeof(universalChannelDown[0])},
+    };
+}
+
+// Compiled output against encodeRemoteCommand, bit for bit
+static void assertSameAsMakeHex(IrpEncoder& encoder, const InfraredCommand& cmd, const char* name) {
+    int refFrequency = 38, frequency = 38;
+    std::vector<float> ref = encodeRemoteCommand(cmd, name, refFrequency);
+
+    float out[IrpEncoder::MaxTimings];
+    size_t count = encoder.encode(cmd, name, out, IrpEncoder::MaxTimings, frequency);
+
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%s D=%d S=%d F=%d", name, cmd.getDevice(), cmd.getSubdevice(), cmd.getFunction());
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(ref.size(), count, msg);
+    TEST_ASSERT_EQUAL_INT_MESSAGE(refFrequency, frequency, msg);
+    TEST_ASSERT_TRUE_MESSAGE(count > 0, msg);
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(ref.data(), out, count * sizeof(float)) == 0, msg);
+}
+
+void test_irp_encoder_matches_makehex_universal_commands() {
+    IrpEncoder encoder;
+    size_t total = 0;
+    for (const auto& group : irpUniversalGroups()) {
+        for (size_t i = 0; i < group.count; ++i) {
+            const auto& c = group.commands[i];
+            InfraredCommand cmd(c.proto, c.device, c.subdevice, c.function);
+            std::string name = InfraredProtocolMapper::toString(c.proto);
+            assertSameAsMakeHex(encoder, cmd, name.c_str());
+
+            // Enum path, cached resolution, microsecond buffer for sendRaw
+            std::vector<float> ref;
+            int refFrequency = 38, frequency = 38;
+            ref = encodeRemoteCommand(cmd, name.c_str(), refFrequency);
+            uint16_t raw[IrpEncoder::MaxTimings];
+            size_t count = encoder.encode(cmd, raw, IrpEncoder::MaxTimings, frequency);
+            TEST_ASSERT_EQUAL_UINT32(ref.size(), count);
+            for (size_t k = 0; k < count; ++k) TEST_ASSERT_EQUAL_UINT16(static_cast<uint16_t>(ref[k]), raw[k]);
+            total++;
+        }
+    }
+    TEST_ASSERT_TRUE(total > 1000);
+}
+
+void test_irp_encoder_matches_makehex_every_protocol() {
+    IrpEncoder encoder;
+    const size_t count = sizeof(protocolDefinitions) / sizeof(protocolDefinitions[0]);
+    const int devices[][3] = {
+        {0, -1, 0}, {7, -1, 2}, {4, 0, 8}, {255, 255, 255}, {25, 122, 70}, {1, 2, 127}
+    };
+
+    for (size_t p = 0; p < count; ++p) {
+        TEST_ASSERT_EQUAL_INT((int)p, encoder.findProtocol(protocolDefinitions[p].name));
+        for (const auto& d : devices) {
+            InfraredCommand cmd(RAW, d[0], d[1], d[2]);
+            assertSameAsMakeHex(encoder, cmd, protocolDefinitions[p].name);
+        }
+    }
+
+    // Names resolved on the fly: RC6 mode/length, NEC aliases, NEC2 default
+    const char* special[] = {"RC6-6-20", "rc6-6-24", "NEC", "necx", "bose", "unknown"};
+    for (const char* name : special) {
+        assertSameAsMakeHex(encoder, InfraredCommand(RAW, 4, 12, 33), name);
+        assertSameAsMakeHex(encoder, InfraredCommand(RAW, 4, -1, 33), name);
+    }
+    TEST_ASSERT_EQUAL_INT(-1, encoder.findProtocol("NEC"));
+}
+
+void test_irp_encoder_rejects_small_buffer() {
+    IrpEncoder encoder;
+    float out[IrpEncoder::MaxTimings];
+    int frequency = 0;
+    InfraredCommand cmd(RAW, 4, -1, 8);
+
+    size_t full = encoder.encode(cmd, "nec1", out, IrpEncoder::MaxTimings, frequency);
+    TEST_ASSERT_EQUAL_INT(38, frequency);
+    TEST_ASSERT_TRUE(full > 8);
+    TEST_ASSERT_EQUAL_UINT32(0, encoder.encode(cmd, "nec1", out, full - 1, frequency));
+    TEST_ASSERT_EQUAL_UINT32(full, encoder.encode(cmd, "nec1", out, full, frequency));
+}
+
+void test_irp_encoder_throughput_vs_makehex() {
+    // Device-B-Gone style burst: every universal power code in a row
+    std::vector<InfraredCommand> commands;
+    std::vector<std::string> names;
+    for (const auto& group : irpUniversalGroups()) {
+        for (size_t i = 0; i < group.count; ++i) {
+            const auto& c = group.commands[i];
+            commands.emplace_back(c.proto, c.device, c.subdevice, c.function);
+            names.push_back(InfraredProtocolMapper::toString(c.proto));
+        }
+    }
+
+    size_t refTimings = 0, timings = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < commands.size(); ++i) {
+        int frequency = 38;
+        refTimings += encodeRemoteCommand(commands[i], names[i].c_str(), frequency).size();
+    }
+    double refSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    IrpEncoder encoder;
+    uint16_t raw[IrpEncoder::MaxTimings];
+    t0 = std::chrono::steady_clock::now();
+    for (int round = 0; round < 2; ++round) {   // first round compiles
+        timings = 0;
+        for (const auto& cmd : commands) {
+            int frequency = 38;
+            timings += encoder.encode(cmd, raw, IrpEncoder::MaxTimings, frequency);
+        }
+    }
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() / 2;
+
+    TEST_ASSERT_EQUAL_UINT32(refTimings, timings);
+
+    char msg[128];
+    snprintf(msg, sizeof(msg), "IR encode: compiled %.1f us/cmd, MakeHex %.1f us/cmd (x%.1f)",
+             secs * 1e6 / commands.size(), refSecs * 1e6 / commands.size(), refSecs / secs);
+    TEST_MESSAGE(msg);
+}
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef MOCK_TERMINAL_VIEW_H
+#define MOCK_TERMINAL_VIEW_H
+
+#include <string>
+#include "../src/Interfaces/ITerminalView.h"
+
+// Terminal view recording everything printed
+class MockTerminalView : public ITerminalView {
+public:
+    void initialize() override {}
+    void welcome(TerminalTypeEnum&, std::string&) override {}
+    void print(const std::string& text) override { output += text; printCount++; }
+    void print(const uint8_t data) override { output += std::to_string(data); printCount++; }
+    void println(const std::string& text) override { output += text + "\n"; printCount++; }
+    void printPrompt(const std::string& mode) override { output += mode + "> "; }
+    void waitPress() override {}
+    void clear() override { output.clear(); }
+    void flush() override { flushCount++; }
+
+    std::string output;
+    size_t printCount = 0;
+    size_t flushCount = 0;
+};
+
+#endif // MOCK_TERMINAL_VIEW_H
@@ -0,0 +1,43 @@
+#ifndef MOCK_VIEW_H
+#define MOCK_VIEW_H
+
+#include <string>
+#include <vector>
+#include "../src/Interfaces/IDeviceView.h"
+
+// Device view recording the selector calls
+class MockView : public IDeviceView {
+public:
+    void initialize() override {}
+    SPIClass& getScreenSpiInstance() override { return spi; }
+    void logo() override {}
+    void welcome(TerminalTypeEnum&, std::string&) override {}
+    void show(PinoutConfig&) override {}
+    void loading() override {}
+    void clear() override {}
+    void drawLogicTrace(uint8_t, const std::vector<uint8_t>&) override {}
+    void setRotation(uint8_t) override {}
+
+    void topBar(const std::string& title, bool, bool) override {
+        topBarCalled = true;
+        lastTitle = title;
+    }
+
+    void horizontalSelection(const std::vector<std::string>& options, uint16_t selectedIndex,
+                             const std::string&, const std::string&) override {
+        horizontalSelectionCalled = true;
+        displayedOptions = options;
+        lastSelectedIndex = selectedIndex;
+    }
+
+    bool topBarCalled = false;
+    bool horizontalSelectionCalled = false;
+    std::string lastTitle;
+    std::vector<std::string> displayedOptions;
+    uint16_t lastSelectedIndex = 0;
+
+private:
+    SPIClass spi;
+};
+
+#endif // MOCK_VIEW_H
@@ -0,0 +1,155 @@
+#ifndef TEST_TERMINAL_ROW_RENDERER_H
+#define TEST_TERMINAL_ROW_RENDERER_H
+
+#include <unity.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "../src/Buffers/TerminalCellBuffer.h"
+#include "../src/Views/TerminalRowRenderer.h"
+
+// Cardputer geometry, 6x12 cells
+struct MockRowSurface {
+    static constexpr int CharW = 6;
+    static constexpr int CharH = 12;
+
+    bool canScroll = false;
+    uint64_t pixels = 0;
+    int rowsDrawn = 0;
+    int scrolls = 0;
+    std::vector<std::string> screen;    // text as drawn
+
+    explicit MockRowSurface(int rows) : screen(rows) {}
+
+    void drawRow(int row, const char* text, int length, int span, int) {
+        pixels += (uint64_t)span * CharW * CharH;
+        rowsDrawn++;
+        screen[row].assign(text, length);
+    }
+
+    bool scroll(int lines) {
+        if (!canScroll) return false;
+        scrolls++;
+        screen.erase(screen.begin(), screen.begin() + lines);
+        screen.resize(screen.size() + lines);
+        return true;
+    }
+};
+
+static void cellsWrite(TerminalCellBuffer& cells, int& row, const std::string& text) {
+    int col = 0;
+    for (char c : text) cells.put(row, col++, c);
+    if (++row >= cells.rows()) {
+        cells.scrollUp();
+        row = cells.rows() - 1;
+    }
+}
+
+static std::string cellsVisible(const TerminalCellBuffer& cells, int screenRow) {
+    std::string line(cells.visibleLine(screenRow), cells.cols());
+    line.erase(line.find_last_not_of(' ') + 1);
+    return line;
+}
+
+void test_terminal_cells_ring_and_scrollback() {
+    TerminalCellBuffer cells(3, 8, 4);
+    int row = 0;
+    for (int i = 0; i < 9; ++i) cellsWrite(cells, row, "line" + std::to_string(i));
+
+    // Live screen holds the last two lines and the blank cursor row
+    TEST_ASSERT_EQUAL_STRING("line7", cellsVisible(cells, 0).c_str());
+    TEST_ASSERT_EQUAL_STRING("line8", cellsVisible(cells, 1).c_str());
+    TEST_ASSERT_EQUAL_STRING("", cellsVisible(cells, 2).c_str());
+    TEST_ASSERT_EQUAL_INT(4, cells.historyCount());
+
+    // Back in the history, clamped to what is kept
+    TEST_ASSERT_TRUE(cells.setScrollOffset(10));
+    TEST_ASSERT_EQUAL_INT(4, cells.scrollOffset());
+    TEST_ASSERT_EQUAL_STRING("line3", cellsVisible(cells, 0).c_str());
+    TEST_ASSERT_EQUAL_STRING("line5", cellsVisible(cells, 2).c_str());
+
+    // Output while scrolled back keeps the view until history runs out
+    cells.setScrollOffset(2);
+    cells.clearDirty();
+    cellsWrite(cells, row, "line9");
+    TEST_ASSERT_EQUAL_INT(3, cells.scrollOffset());
+    TEST_ASSERT_EQUAL_STRING("line5", cellsVisible(cells, 0).c_str());
+    TEST_ASSERT_FALSE(cells.anyDirty());
+
+    cells.setScrollOffset(0);
+    TEST_ASSERT_EQUAL_STRING("line9", cellsVisible(cells, 1).c_str());
+    cells.clearHistory();
+    TEST_ASSERT_FALSE(cells.setScrollOffset(1));
+}
+
+void test_terminal_renderer_draws_only_changed_rows() {
+    TerminalCellBuffer cells(10, 38, 16);
+    MockRowSurface surface(10);
+    TerminalRowRenderer<MockRowSurface> renderer;
+    renderer.reset(10, 38);
+
+    // Nothing on an empty screen but the cursor
+    renderer.render(cells, surface, 0, 0);
+    TEST_ASSERT_EQUAL_INT(1, surface.rowsDrawn);
+    TEST_ASSERT_EQUAL_UINT64(1 * 6 * 12, surface.pixels);
+
+    // Typing redraws the row up to the cursor
+    surface.pixels = 0;
+    surface.rowsDrawn = 0;
+    for (int i = 0; i < 5; ++i) cells.put(0, i, "HIZ> "[i]);
+    renderer.render(cells, surface, 0, 5);
+    TEST_ASSERT_EQUAL_INT(1, surface.rowsDrawn);
+    TEST_ASSERT_EQUAL_UINT64(6 * 6 * 12, surface.pixels);
+    TEST_ASSERT_EQUAL_STRING("HIZ>", surface.screen[0].c_str());
+
+    // Same text written again is not drawn
+    surface.rowsDrawn = 0;
+    cells.put(0, 0, 'X');
+    cells.put(0, 0, 'H');
+    cells.markDirty(3);
+    renderer.render(cells, surface, 0, 5);
+    TEST_ASSERT_EQUAL_INT(0, surface.rowsDrawn);
+
+    // Cursor move erases the old underline and draws the new one
+    renderer.render(cells, surface, 1, 0);
+    TEST_ASSERT_EQUAL_INT(2, surface.rowsDrawn);
+}
+
+void test_terminal_renderer_streaming_pixels() {
+    const int rows = 10, cols = 38, lines = 400;
+    const uint64_t fullFrame = 240ull * 135;
+
+    // Short log lines, each followed by a render like println does
+    auto stream = [&](MockRowSurface& surface) {
+        TerminalCellBuffer cells(rows, cols, 256);
+        TerminalRowRenderer<MockRowSurface> renderer;
+        renderer.reset(rows, cols);
+        int row = 0;
+        for (int i = 0; i < lines; ++i) {
+            char text[48];
+            snprintf(text, sizeof(text), "[%04d] RX %02X %02X", i, i & 0xFF, (i * 7) & 0xFF);
+            cellsWrite(cells, row, text);
+            renderer.render(cells, surface, row, 0);
+        }
+        TEST_ASSERT_EQUAL_STRING("[0399] RX 8F E9", surface.screen[rows - 2].c_str());
+        TEST_ASSERT_EQUAL_STRING("[0391] RX 87 B1", surface.screen[0].c_str());
+    };
+
+    MockRowSurface software(rows);
+    stream(software);
+
+    MockRowSurface hardware(rows);
+    hardware.canScroll = true;
+    stream(hardware);
+
+    uint64_t fullRedraw = fullFrame * lines;
+    printf("  %d lines: full frames %llu px, dirty rows %llu px, with hardware scroll %llu px\n",
+           lines, (unsigned long long)fullRedraw, (unsigned long long)software.pixels,
+           (unsigned long long)hardware.pixels);
+
+    TEST_ASSERT_TRUE(software.pixels * 2 < fullRedraw);
+    TEST_ASSERT_TRUE(hardware.pixels * 5 < software.pixels);
+    TEST_ASSERT_TRUE(hardware.scrolls > 0);
+}
+
+#endif
@@ -1,11 +1,206 @@
 #include <unity.h>
+#include "Servers/TestWebSocketOutputBuffer.h"
+#include "Buffers/TestSpscRingBuffer.h"
+#include "Buffers/TestRecordRingBuffer.h"
+#include "Views/TestTerminalRowRenderer.h"
+#include "Selectors/TestHorizontalSelector.h"
+#include "Transformers/TestWifiSniffTransformer.h"
+#include "Transformers/TestInstructionTransformer.h"
+#include "Transformers/TestRpcFrameTransformer.h"
+#include "Managers/TestUartBridgeManager.h"
+#include "Managers/TestFlashDumpManager.h"
+#include "Managers/TestPatternScanner.h"
+#include "Managers/TestBlockStatsKernel.h"
+#include "Managers/TestLogicCaptureManager.h"
+#include "Managers/TestEdgeStatsManager.h"
+#include "Managers/TestSectorCacheManager.h"
+#include "Managers/TestI2cSniffManager.h"
+#include "Managers/TestCanStatsManager.h"
+#include "Managers/TestSubGhzCaptureManager.h"
+#include "Managers/TestModeFootprintManager.h"
+#include "Vendors/TestIrpEncoder.h"
+#include "Services/TestIcmpDiscoveryEngine.h"
+#include "Services/TestJtagScanEngine.h"
+#include "Services/TestI2cDumpEngine.h"
+#include "Services/TestByteCodeEngine.h"
+#include "Services/TestScriptEngine.h"
+#include "Benchmarks/BenchHotPaths.h"
+#ifndef ARDUINO
+#include "Services/TestNmapScanEngine.h" // loopback sockets
+#include "Hal/TestHalSim.h"             // simulated peripherals
+#endif
 
-void setup() {
+int runTests() {
     UNITY_BEGIN();
-    // Tests
-    UNITY_END();
+
+    // Servers
+    RUN_TEST(test_ws_output_coalesces_until_newline);
+    RUN_TEST(test_ws_output_splits_at_max_frame);
+    RUN_TEST(test_ws_output_flushes_on_deadline);
+    RUN_TEST(test_ws_output_carries_partial_utf8);
+    RUN_TEST(test_ws_output_drops_invalid_utf8);
+    RUN_TEST(test_ws_output_never_splits_multibyte_char);
+    RUN_TEST(test_ws_output_replay_1mb_stream);
+
+    // Buffers
+    RUN_TEST(test_spsc_ring_push_pop_wraps);
+    RUN_TEST(test_spsc_ring_partial_push_when_full);
+    RUN_TEST(test_spsc_ring_write_slot_in_place);
+    RUN_TEST(test_spsc_ring_threaded_order);
+    RUN_TEST(test_spsc_ring_throughput_vs_deque);
+    RUN_TEST(test_spsc_ring_wakeup_latency_vs_polling);
+    RUN_TEST(test_record_ring_variable_lengths);
+    RUN_TEST(test_record_ring_records_never_wrap);
+    RUN_TEST(test_record_ring_counts_drops_and_truncation);
+    RUN_TEST(test_record_ring_drain_reuses_batch);
+    RUN_TEST(test_record_ring_simulated_producer);
+
+    // Views
+    RUN_TEST(test_terminal_cells_ring_and_scrollback);
+    RUN_TEST(test_terminal_renderer_draws_only_changed_rows);
+    RUN_TEST(test_terminal_renderer_streaming_pixels);
+
+    // Selectors
+    RUN_TEST(test_horizontal_selector_confirm);
+    RUN_TEST(test_horizontal_selector_cancel);
+
+    // Transformers
+    RUN_TEST(test_wifi_sniff_formats_line);
+    RUN_TEST(test_wifi_sniff_pcap_header);
+    RUN_TEST(test_wifi_sniff_pcap_record);
+    RUN_TEST(test_wifi_sniff_callback_cost_vs_strings);
+    RUN_TEST(test_instruction_compile_matches_transform);
+    RUN_TEST(test_instruction_compile_coalesces_spans);
+    RUN_TEST(test_rpc_frame_layout);
+    RUN_TEST(test_rpc_frame_pipelined_loopback);
+    RUN_TEST(test_rpc_frame_recovers_from_corruption);
+    RUN_TEST(test_rpc_frame_skips_payload_over_device_limit);
+    RUN_TEST(test_rpc_frame_loopback_throughput_vs_hex_text);
+
+    // Managers
+    RUN_TEST(test_uart_bridge_forwards_blocks);
+    RUN_TEST(test_uart_bridge_loopback_terminal_input);
+    RUN_TEST(test_uart_bridge_filters_half_duplex_echo);
+    RUN_TEST(test_uart_bridge_read_stops_on_enter);
+    RUN_TEST(test_uart_bridge_polls_device_on_timer);
+    RUN_TEST(test_uart_bridge_throughput_1mb);
+    RUN_TEST(test_flash_dump_crc32_reference);
+    RUN_TEST(test_flash_dump_full_image);
+    RUN_TEST(test_flash_dump_stop_from_output);
+    RUN_TEST(test_flash_dump_hex_lines);
+    RUN_TEST(test_flash_dump_xmodem_packet);
+    RUN_TEST(test_flash_dump_overlaps_read_and_output);
+    RUN_TEST(test_pattern_table_is_current);
+    RUN_TEST(test_pattern_scanner_case_folding);
+    RUN_TEST(test_pattern_scanner_user_pattern_and_suffixes);
+    RUN_TEST(test_pattern_scanner_across_blocks);
+    RUN_TEST(test_binary_analyze_matches_naive_search);
+    RUN_TEST(test_pattern_scanner_throughput_vs_naive);
+    RUN_TEST(test_block_stats_log2_fixed_point);
+    RUN_TEST(test_block_stats_exact_cases);
+    RUN_TEST(test_block_stats_matches_float_reference);
+    RUN_TEST(test_block_stats_throughput_vs_float);
+    RUN_TEST(test_logic_trigger_edges_and_pattern);
+    RUN_TEST(test_logic_capture_pre_trigger_window);
+    RUN_TEST(test_logic_capture_short_pre_trigger_and_stop);
+    RUN_TEST(test_logic_trace_run_length_round_trip);
+    RUN_TEST(test_logic_export_ols_and_vcd);
+    RUN_TEST(test_logic_sump_session);
+    RUN_TEST(test_logic_capture_and_compress_throughput);
+    RUN_TEST(test_edge_stats_pwm_duty_and_period);
+    RUN_TEST(test_edge_stats_jitter_and_histogram);
+    RUN_TEST(test_edge_stats_tick_wraparound);
+    RUN_TEST(test_edge_stats_gaps_break_intervals);
+    RUN_TEST(test_edge_stats_report_text);
+    RUN_TEST(test_edge_stats_throughput);
+    RUN_TEST(test_sector_cache_sequential_read_ahead);
+    RUN_TEST(test_sector_cache_write_back_metadata);
+    RUN_TEST(test_sector_cache_evicts_least_recently_used);
+    RUN_TEST(test_sector_cache_gathers_sequential_writes);
+    RUN_TEST(test_sector_cache_matches_model_random_io);
+    RUN_TEST(test_sector_cache_throughput_vs_per_sector);
+    RUN_TEST(test_i2c_sniff_register_read_with_repeated_start);
+    RUN_TEST(test_i2c_sniff_address_nack_and_tick_wraparound);
+    RUN_TEST(test_i2c_sniff_gaps_and_stray_events);
+    RUN_TEST(test_i2c_sniff_transformer_formats);
+    RUN_TEST(test_can_stats_counts_rates_and_changed_bytes);
+    RUN_TEST(test_can_stats_dlc_change_and_id_limit);
+    RUN_TEST(test_can_stats_top_view);
+    RUN_TEST(test_can_log_transformer_formats);
+    RUN_TEST(test_subghz_capture_signed_timings_and_gaps);
+    RUN_TEST(test_subghz_capture_full_buffer_counts_drops);
+    RUN_TEST(test_subghz_sub_file_round_trip);
+    RUN_TEST(test_subghz_capture_throughput_vs_formatting);
+    RUN_TEST(test_mode_footprint_build_and_release);
+    RUN_TEST(test_mode_footprint_lines);
+
+    // Vendors
+    RUN_TEST(test_irp_encoder_matches_makehex_universal_commands);
+    RUN_TEST(test_irp_encoder_matches_makehex_every_protocol);
+    RUN_TEST(test_irp_encoder_rejects_small_buffer);
+    RUN_TEST(test_irp_encoder_throughput_vs_makehex);
+
+    // Services
+    RUN_TEST(test_icmp_discovery_parses_cidr);
+    RUN_TEST(test_icmp_discovery_streams_replies_by_latency);
+    RUN_TEST(test_icmp_discovery_keeps_window_in_flight);
+    RUN_TEST(test_icmp_discovery_retries_lost_requests);
+    RUN_TEST(test_icmp_discovery_stops_on_request);
+    RUN_TEST(test_icmp_discovery_survives_send_failures);
+    RUN_TEST(test_icmp_discovery_lossy_network_1022_hosts);
+    RUN_TEST(test_jtag_engine_tap_primitives);
+    RUN_TEST(test_jtag_engine_staged_search_finds_pinout);
+    RUN_TEST(test_jtag_engine_no_device_and_fallback);
+    RUN_TEST(test_jtag_engine_idcode_without_tdi);
+    RUN_TEST(test_jtag_engine_staged_vs_exhaustive_throughput);
+    RUN_TEST(test_i2c_dump_full_eeprom_large_chunks);
+    RUN_TEST(test_i2c_dump_adapts_chunk_to_nacks);
+    RUN_TEST(test_i2c_dump_block_select_and_raw_reads);
+    RUN_TEST(test_i2c_dump_skips_unreadable_and_cancels);
+    RUN_TEST(test_i2c_dump_hex_line_stream);
+    RUN_TEST(test_i2c_dump_throughput_fast_mode_plus);
+    RUN_TEST(test_byte_code_engine_spi_and_i2c_spans);
+    RUN_TEST(test_byte_code_engine_stream_and_one_wire);
+    RUN_TEST(test_byte_code_engine_reads_into_bytes);
+    RUN_TEST(test_byte_code_engine_4k_write_vs_per_byte);
+    RUN_TEST(test_script_engine_reports_compile_errors);
+    RUN_TEST(test_script_engine_control_flow_and_text);
+    RUN_TEST(test_script_engine_programs_and_verifies_eeprom);
+    RUN_TEST(test_script_engine_cache_and_stop);
+    RUN_TEST(test_script_engine_precompiled_instruction_throughput);
+    #ifndef ARDUINO
+    RUN_TEST(test_nmap_engine_timing_templates);
+    RUN_TEST(test_nmap_engine_tcp_open_and_closed);
+    RUN_TEST(test_nmap_engine_udp_states);
+    RUN_TEST(test_nmap_engine_timeouts_overlap);
+    RUN_TEST(test_nmap_engine_adapts_timeout);
+    RUN_TEST(test_nmap_engine_throughput_1000_ports);
+    RUN_TEST(test_nmap_engine_unanswered_window_vs_sequential);
+    #endif
+
+    #ifndef ARDUINO
+    // Simulated HAL
+    RUN_TEST(test_hal_sim_virtual_clock_and_gpio);
+    RUN_TEST(test_hal_sim_wire_spi_and_uart);
+    RUN_TEST(test_hal_sim_rmt_ring_feeds_analyzer);
+    #endif
+
+    // Benchmarks
+    RUN_TEST(test_benchmarks_hot_paths);
+
+    return UNITY_END();
+}
+
+#ifdef ARDUINO
+void setup() {
+    runTests();
 }
 
 void loop() {
     // Required by PlatformIO
 }
+#else
+int main() {
+    return runTests();
+}
+#endif
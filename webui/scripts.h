@@ -3,7 +3,7 @@
 inline const char* scripts_js = R"rawliteral(
 
 let socket = null;
-let pendingEchoLines = 0;
+let pendingEcho = false;
 let reconnectInterval = 1000; // ms
 let responseTimeout = null;
 let responseTimeoutDelay = 6000; // ms
@@ -24,15 +24,15 @@ function connectSocket() {
   socket.onopen = function () {
     hideWsLostPopup();
     bridgeMode = false;
-    pendingEchoLines = 0;
+    pendingEcho = false;
     console.log("[WebSocket] Connected");
   };
 
   socket.onmessage = function (event) {
     const output = document.getElementById("output");
-    const lines = event.data.split("\n");
+    let data = event.data;
 
-    if (event.data.includes("Bridge: Stopped by user.")) {
+    if (data.includes("Bridge: Stopped by user.")) {
       bridgeMode = false;
       console.log("[WebSocket] Bridge mode exited.");
     }
@@ -40,12 +40,16 @@ function connectSocket() {
     clearTimeout(responseTimeout);
     hideWsLostPopup(); 
 
-    if (pendingEchoLines > 0) {
-      pendingEchoLines -= 1;
-      return;
+    // Output is coalesced by the device, the echo of the command
+    // can share a frame with its result. Drop everything before the newline.
+    if (pendingEcho) {
+      const eol = data.indexOf("\n");
+      if (eol < 0) return;
+      pendingEcho = false;
+      data = data.slice(eol);
     }
 
-    output.value += lines.join("\n");
+    output.value += data;
     output.scrollTop = output.scrollHeight;
     console.log("[WebSocket] Recv:", event.data);
   };
@@ -83,7 +87,7 @@ function sendCommand() {
     clearTimeout(responseTimeout);
     hideWsLostPopup();
     console.log("[WebSocket] Bridge Mode");
-    pendingEchoLines = cmd.length
+    pendingEcho = true;
     socket.send(cmd + "\n");
     input.value = "";
     addToHistory(cmd);
@@ -103,9 +107,9 @@ function sendCommand() {
   if (!bridgeMode && !/^\d+$/.test(cmd)) {
     output.value += cmd;
     addToHistory(cmd);
-    pendingEchoLines = cmd.length;
+    pendingEcho = true;
   } else {
-    pendingEchoLines = 0;
+    pendingEcho = false;
   }
 }
 